@@ -14,7 +14,7 @@
 
 #pragma once
 
-#include <sstream>
+#include <string>
 
 #include "cir/lib/syntax/function.h"
 #include "subspace/containers/vec.h"
@@ -27,15 +27,14 @@ struct Output {
 };
 
 inline std::string to_string(const Output& out) noexcept {
-  // TODO: Use fmt library (or add such to subspace).
-  std::ostringstream s;
+  auto s = std::string();
   bool saw_fn = false;
   for (const auto& [id, f] : out.functions) {
-    if (saw_fn) s << "\n\n";
+    if (saw_fn) s += "\n\n";
     saw_fn = true;
-    s << cir::to_string(f, out);
+    s += cir::to_string(f, out);
   }
-  return s.str();
+  return s;
 }
 
 }  // namespace cir
@@ -26,6 +26,7 @@
 #include "subdoc/llvm.h"
 #include "subspace/choice/choice.h"
 #include "subspace/fn/fn.h"
+#include "subspace/hash/hash.h"
 #include "subspace/option/option.h"
 #include "subspace/prelude.h"
 
@@ -199,7 +200,7 @@ struct NamespaceId {
 
   struct Hash {
     std::size_t operator()(const NamespaceId& k) const {
-      return std::hash<std::string>()(k.name);
+      return size_t{sus::hash::hash(k.name)};
     }
   };
 };
@@ -216,7 +217,7 @@ struct RecordId {
 
   struct Hash {
     std::size_t operator()(const RecordId& k) const {
-      return std::hash<std::string>()(k.name);
+      return size_t{sus::hash::hash(k.name)};
     }
   };
 };
@@ -235,8 +236,11 @@ struct FunctionId {
 
   struct Hash {
     std::size_t operator()(const FunctionId& k) const {
-      return (std::hash<std::string>()(k.name) << size_t{k.is_static}) +
-             std::hash<u64>()(k.overload_set);
+      auto h = sus::hash::DefaultHasher();
+      sus::hash::hash_into(k.name, h);
+      sus::hash::hash_into(k.is_static, h);
+      sus::hash::hash_into(k.overload_set, h);
+      return size_t{h.finish()};
     }
   };
 };
@@ -647,8 +651,8 @@ struct Database {
 
       // Namespace path goes from the outside in to the global, we want the
       // inverse, and then to skip the global namespace.
-      auto it = iter_namespace_path(decl).collect_vec().into_iter().rev();
-      it.next();  // TODO: Use Iterator::skip().
+      auto it =
+          iter_namespace_path(decl).collect_vec().into_iter().rev().skip(1u);
       for (const Namespace& n : it) {
         switch (n) {
           case Namespace::Tag::Global: {
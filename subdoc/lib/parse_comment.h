@@ -19,6 +19,7 @@
 
 #include "subdoc/lib/doc_attributes.h"
 #include "subdoc/llvm.h"
+#include "subspace/hash/hash.h"
 #include "subspace/result/result.h"
 
 namespace subdoc {
@@ -71,8 +72,8 @@ inline sus::Result<ParsedComment, ParseCommentError> parse_comment(
               llvm::StringRef(line.Text).substr(6u, line.Text.rfind("]") - 6u);
           if (v.starts_with("overloads=")) {
             llvm::StringRef name = v.substr(strlen("overloads="));
-            attrs.overload_set = sus::some(
-                std::hash<std::string_view>()(std::string_view(name.data())));
+            attrs.overload_set =
+                sus::some(sus::hash::hash(std::string_view(name.data())));
           } else if (v.starts_with("inherit=")) {
             llvm::StringRef name = v.substr(strlen("inherit="));
             auto vec = sus::Vec<InheritPathElement>();
@@ -21,6 +21,7 @@
 #include "subdoc/lib/run_options.h"
 #include "subdoc/llvm.h"
 #include "subspace/fn/fn.h"
+#include "subspace/hash/hash.h"
 #include "subspace/option/option.h"
 #include "subspace/prelude.h"
 
@@ -34,7 +35,7 @@ struct VisitedLocation {
 
   struct Hash {
     size_t operator()(const VisitedLocation& v) const {
-      return std::hash<std::string>()(v.location_as_string);
+      return size_t{sus::hash::hash(v.location_as_string)};
     }
   };
 };
@@ -19,17 +19,18 @@
 
 namespace sus::choice_type::__private {
 
-/// Determines the number of bytes to use in the index.
+/// Determines the number of bits to use in the index.
 ///
-/// The index must have room for `count` many values. And we should use a 32-bit
-/// value unless there's a reason not to. So we use something smaller only if
-/// it fits into the inner union's tail padding.
-template <size_t count, size_t size_of_union, size_t data_size_of_union>
+/// The index must have room for `count` many values. The index is stored beside
+/// the union rather than in its tail padding (see the `storage_` member of
+/// Choice for why), so any bytes it uses beyond what's needed add directly to
+/// the size of the Choice whenever the union's alignment is smaller than the
+/// index. So we use the smallest integer that can hold all the values. Loading
+/// a narrow index costs the same as loading a wide one.
+template <size_t count>
 consteval size_t index_size() noexcept {
-  constexpr size_t size_of_padding = size_of_union - data_size_of_union;
-  if constexpr (count + 1 <= size_t{0xff} && size_of_padding >= 8u) return 8u;
-  if constexpr (count + 1 <= size_t{0xffff} && size_of_padding >= 16u)
-    return 16u;
+  if constexpr (count + 1 <= size_t{0xff}) return 8u;
+  if constexpr (count + 1 <= size_t{0xffff}) return 16u;
   if constexpr (count + 1 <= size_t{0xffffffff}) return 32u;
   return 64u;
 }
@@ -41,14 +42,11 @@ consteval size_t index_size() noexcept {
 /// the union, and it can only handle size_t many things.
 ///
 // clang-format off
-template <size_t count, size_t size_of_union, size_t data_size_of_union>
+template <size_t count>
 using IndexType =
-  std::conditional_t<
-      index_size<count, size_of_union, data_size_of_union>() == 8, uint8_t,
-  std::conditional_t<
-      index_size<count, size_of_union, data_size_of_union>() == 16, uint16_t,
-  std::conditional_t<
-      index_size<count, size_of_union, data_size_of_union>() == 32, uint32_t,
+  std::conditional_t<index_size<count>() == 8, uint8_t,
+  std::conditional_t<index_size<count>() == 16, uint16_t,
+  std::conditional_t<index_size<count>() == 32, uint32_t,
   std::conditional_t<
       ::sus::mem::size_of<size_t>() == ::sus::mem::size_of<uint64_t>(), uint64_t,
   void>>>>;
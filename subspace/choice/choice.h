@@ -16,7 +16,9 @@
 
 #include <stdint.h>
 
+#include <array>
 #include <type_traits>
+#include <utility>
 
 #include "subspace/choice/__private/all_values_are_unique.h"
 #include "subspace/choice/__private/index_of_value.h"
@@ -81,22 +83,6 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
       __private::AllValuesAreUnique<Tags...>,
       "All tag values must be unique or some of them would be inaccessible.");
 
-  // The data size of a union is not known from sus::data_size_of(), but is the
-  // max of all its members. We know all the member types so we can compute it
-  // ourselves.
-  static constexpr size_t union_data_size = []() -> size_t {
-    auto find_max = [max = size_t{1u}](size_t a) mutable {
-      if (a == 0 || max == 0)
-        max = 0;
-      else if (a > max)
-        max = a;
-      return max;
-    };
-    auto max = (find_max(::sus::data_size_of<Ts>()), ..., find_max(1));
-    // If the result was 0 then a member of the union does not have a defined
-    // data size.
-    return max > 0u ? max : ::sus::size_of<Storage>();
-  }();
   // We add 2 to `sizeof...(Tags)` for the range of the index.
   //
   // The ~0 value (all bits are 1) is reserved for using the index as a
@@ -107,8 +93,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
   // reserved to mark the type as moved-from. Any use of the type afterward will
   // panic due to the index being outside the range of acceptable values.
   using IndexType =
-      __private::IndexType<sizeof...(Tags) + 2u, ::sus::size_of<Storage>(),
-                           union_data_size>;
+      __private::IndexType<sizeof...(Tags) + 2u>;
   static_assert(!std::is_void_v<IndexType>,
                 "A union can only hold a number of members representable in "
                 "size_t (minus two).");
@@ -505,6 +490,56 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     }
   }
 
+  /// Calls `f` with the active member of the Choice, and returns the result.
+  ///
+  /// The tag of the active member is passed to `f` as a
+  /// `std::integral_constant<Tag, V>`, so `f` can branch on it at compile time
+  /// with `if constexpr (decltype(tag)::value == V)`. If the active member has
+  /// values, they are passed as a second argument in the same form that `as()`
+  /// returns them. For a member with void values, `f` receives only the tag.
+  /// The function `f` must return the same type for every member.
+  ///
+  /// This dispatches with a single indexed call through a table of function
+  /// pointers, no matter how many members the Choice has, instead of comparing
+  /// the active member against each tag in turn.
+  ///
+  /// # Panics
+  /// The function will panic if the Choice was moved from.
+  ///
+  /// # Example
+  /// ```
+  /// auto u = Choice<sus_choice_types((Order::First, u32),
+  ///                                  (Order::Second, void))>
+  ///     ::with<Order::First>(3u);
+  /// u32 x = u.visit([](auto tag, const auto&... v) -> u32 {
+  ///   if constexpr (decltype(tag)::value == Order::First)
+  ///     return (v + ...);
+  ///   else
+  ///     return 0u;
+  /// });
+  /// ```
+  template <class F>
+  constexpr decltype(auto) visit(F&& f) const& noexcept {
+    check(index_ != kUseAfterMove);
+    return kVisitTable<const Storage&, F>[size_t{index_}](::sus::forward<F>(f),
+                                                          storage_);
+  }
+
+  /// Calls `f` with the active member of the Choice, and returns the result.
+  ///
+  /// This is like `visit()` except the values in the active member are passed
+  /// to `f` as mutable references, in the same form that `as_mut()` returns
+  /// them.
+  ///
+  /// # Panics
+  /// The function will panic if the Choice was moved from.
+  template <class F>
+  constexpr decltype(auto) visit_mut(F&& f) & noexcept {
+    check(index_ != kUseAfterMove);
+    return kVisitTable<Storage&, F>[size_t{index_}](::sus::forward<F>(f),
+                                                    storage_);
+  }
+
   /// sus::ops::Eq<Choice<Ts...>, Choice<Us...>> trait.
   template <class... Us, auto V, auto... Vs>
     requires(__private::ChoiceIsEq<TagsType, __private::TypeList<Ts...>,
@@ -591,6 +626,36 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
  private:
   constexpr inline Choice(IndexType i) noexcept : index_(i) {}
 
+  template <size_t I, class S, class F>
+  static constexpr decltype(auto) visit_member(F&& f, S storage) noexcept {
+    constexpr TagsType tags[] = {Tags...};
+    using TagConstant = std::integral_constant<TagsType, tags[I]>;
+    if constexpr (__private::ValueIsVoid<__private::StorageTypeOfTag<I, Ts...>>)
+      return ::sus::forward<F>(f)(TagConstant());
+    else if constexpr (std::is_const_v<std::remove_reference_t<S>>)
+      return ::sus::forward<F>(f)(
+          TagConstant(), __private::find_choice_storage<I>(storage).as());
+    else
+      return ::sus::forward<F>(f)(
+          TagConstant(), __private::find_choice_storage_mut<I>(storage).as_mut());
+  }
+
+  // One entry per member, indexed by `index_`, so that `visit()` compiles to a
+  // single indirect call.
+  template <class S, class F>
+  static constexpr auto kVisitTable = []<size_t... Is>(
+                                          std::index_sequence<Is...>) {
+    using R = decltype(visit_member<0u, S, F>(std::declval<F>(),
+                                              std::declval<S>()));
+    static_assert((... && std::same_as<R, decltype(visit_member<Is, S, F>(
+                                              std::declval<F>(),
+                                              std::declval<S>()))>),
+                  "The function passed to visit() must return the same type "
+                  "for every member of the Choice.");
+    return std::array<R (*)(F&&, S) noexcept, sizeof...(Is)>{
+        &visit_member<Is, S, F>...};
+  }(std::make_index_sequence<sizeof...(Tags)>());
+
   // TODO: We don't use `[[sus_no_unique_address]]` here as the compiler
   // overwrites the `index_` when we move-construct into the Storage union.
   // Clang: https://github.com/llvm/llvm-project/issues/60711
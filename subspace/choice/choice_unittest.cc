@@ -54,6 +54,13 @@ enum class Order {
 static_assert(sizeof(Choice<sus_choice_types((Order::First, i32, u64))>) ==
               2 * sizeof(u64) + sizeof(u64));
 
+// The index uses the smallest integer that can hold all the tags, so it adds
+// little to the Choice when the members have small alignment.
+static_assert(sizeof(Choice<sus_choice_types((Order::First, u8),
+                                             (Order::Second, u8))>) == 2u);
+static_assert(sizeof(Choice<sus_choice_types((Order::First, u16),
+                                             (Order::Second, u8))>) == 4u);
+
 TEST(Choice, Tag) {
   using One =
       Choice<sus_choice_types((Order::First, u64), (Order::Second, u32))>;
@@ -783,4 +790,57 @@ TEST(Choice, VoidValues) {
   EXPECT_LT(u4, u6);
 }
 
+TEST(Choice, Visit) {
+  using U = Choice<sus_choice_types((Order::First, u32),
+                                    (Order::Second, i8, u64),
+                                    (Order::Third, void))>;
+  auto f = [](auto tag, const auto&... v) -> u64 {
+    if constexpr (decltype(tag)::value == Order::First) {
+      return (u64(v), ...);
+    } else if constexpr (decltype(tag)::value == Order::Second) {
+      static_assert(sizeof...(v) == 1u);
+      return (v.template at<1>(), ...);
+    } else {
+      static_assert(sizeof...(v) == 0u);
+      return 99u;
+    }
+  };
+  auto u1 = U::with<Order::First>(3u);
+  EXPECT_EQ(u1.visit(f), 3u);
+  auto u2 = U::with<Order::Second>(sus::tuple(-1_i8, 4_u64));
+  EXPECT_EQ(u2.visit(f), 4u);
+  auto u3 = U::with<Order::Third>();
+  EXPECT_EQ(u3.visit(f), 99u);
+
+  // The tag is a constant expression.
+  Order which = u2.visit([](auto tag, const auto&...) {
+    constexpr Order o = decltype(tag)::value;
+    return o;
+  });
+  EXPECT_EQ(which, Order::Second);
+}
+
+TEST(Choice, VisitMut) {
+  using U = Choice<sus_choice_types((Order::First, u32),
+                                    (Order::Second, i8, u64),
+                                    (Order::Third, void))>;
+  auto f = [](auto tag, auto&&... v) {
+    if constexpr (decltype(tag)::value == Order::First) {
+      ((v += 1u), ...);
+    } else if constexpr (decltype(tag)::value == Order::Second) {
+      ((v.template at_mut<1>() += 2u), ...);
+    }
+  };
+  auto u1 = U::with<Order::First>(3u);
+  u1.visit_mut(f);
+  EXPECT_EQ(u1.as<Order::First>(), 4u);
+  auto u2 = U::with<Order::Second>(sus::tuple(-1_i8, 4_u64));
+  u2.visit_mut(f);
+  auto t = u2.as<Order::Second>();
+  EXPECT_EQ(t.at<1>(), 6u);
+  auto u3 = U::with<Order::Third>();
+  u3.visit_mut(f);
+  EXPECT_EQ(u3.which(), Order::Third);
+}
+
 }  // namespace
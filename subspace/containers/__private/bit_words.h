@@ -0,0 +1,141 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/slice.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/__private/intrinsics.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+// Operations on arrays of 64-bit words which are shared by the bit containers.
+//
+// The loops work on whole words at a time over the primitive values, without
+// overflow checks, and have no dependencies between iterations (other than a
+// sum), so that the compiler can vectorize them. Bits past the length of a bit
+// container are always kept as zero, so that counting and iterating don't need
+// to mask the last word.
+namespace sus::containers::__private {
+
+/// The number of bits stored in each word.
+static constexpr size_t kBitsPerWord = 64u;
+
+/// Returns the number of words needed to hold `bits` many bits.
+constexpr inline size_t words_for_bits(size_t bits) noexcept {
+  return (bits + kBitsPerWord - 1u) / kBitsPerWord;
+}
+
+/// Returns the index of the word holding bit `i`.
+constexpr inline usize word_index(usize i) noexcept {
+  return usize(size_t{i} / kBitsPerWord);
+}
+
+/// Returns a word with only the bit for bit `i` set.
+constexpr inline u64 bit_mask(usize i) noexcept {
+  return u64(1u) << u32(static_cast<uint32_t>(size_t{i} % kBitsPerWord));
+}
+
+/// Returns a word with the bits set that are in use in the last word of a
+/// container of `len` bits.
+constexpr inline u64 last_word_mask(usize len) noexcept {
+  const auto used = static_cast<uint32_t>(size_t{len} % kBitsPerWord);
+  if (used == 0u) return u64::MAX;
+  return (u64(1u) << u32(used)) - 1u;
+}
+
+constexpr inline usize count_ones(Slice<u64> words) noexcept {
+  const u64* p = words.as_ptr();
+  const size_t n = size_t{words.len()};
+  size_t count = 0u;
+  for (size_t i = 0u; i < n; ++i)
+    count += ::sus::num::__private::count_ones(p[i].primitive_value);
+  return count;
+}
+
+constexpr inline bool any(Slice<u64> words) noexcept {
+  const u64* p = words.as_ptr();
+  const size_t n = size_t{words.len()};
+  uint64_t acc = 0u;
+  for (size_t i = 0u; i < n; ++i) acc |= p[i].primitive_value;
+  return acc != 0u;
+}
+
+constexpr inline void and_words(SliceMut<u64> dst, Slice<u64> src) noexcept {
+  ::sus::check(dst.len() == src.len());
+  u64* d = dst.as_mut_ptr();
+  const u64* s = src.as_ptr();
+  const size_t n = size_t{dst.len()};
+  for (size_t i = 0u; i < n; ++i) d[i].primitive_value &= s[i].primitive_value;
+}
+constexpr inline void or_words(SliceMut<u64> dst, Slice<u64> src) noexcept {
+  ::sus::check(dst.len() == src.len());
+  u64* d = dst.as_mut_ptr();
+  const u64* s = src.as_ptr();
+  const size_t n = size_t{dst.len()};
+  for (size_t i = 0u; i < n; ++i) d[i].primitive_value |= s[i].primitive_value;
+}
+constexpr inline void xor_words(SliceMut<u64> dst, Slice<u64> src) noexcept {
+  ::sus::check(dst.len() == src.len());
+  u64* d = dst.as_mut_ptr();
+  const u64* s = src.as_ptr();
+  const size_t n = size_t{dst.len()};
+  for (size_t i = 0u; i < n; ++i) d[i].primitive_value ^= s[i].primitive_value;
+}
+
+/// Flips every bit in the first `len` bits of `words`, leaving the bits past
+/// `len` as zero.
+constexpr inline void flip_words(SliceMut<u64> words, usize len) noexcept {
+  u64* p = words.as_mut_ptr();
+  const size_t n = size_t{words.len()};
+  for (size_t i = 0u; i < n; ++i) p[i].primitive_value = ~p[i].primitive_value;
+  if (n > 0u) p[n - 1u] &= last_word_mask(len);
+}
+
+/// Returns the number of set bits before bit `i`.
+constexpr inline usize rank(Slice<u64> words, usize i) noexcept {
+  const usize full = word_index(i);
+  usize count = count_ones(words[::sus::ops::RangeTo<usize>(full)]);
+  if (const u64 partial = bit_mask(i) - 1u; partial != 0u)
+    count += usize::from((words[full] & partial).count_ones());
+  return count;
+}
+
+/// Returns the index of the set bit which has `k` set bits before it.
+constexpr inline Option<usize> select(Slice<u64> words, usize k) noexcept {
+  const u64* p = words.as_ptr();
+  const size_t n = size_t{words.len()};
+  size_t rem = size_t{k};
+  for (size_t i = 0u; i < n; ++i) {
+    uint64_t w = p[i].primitive_value;
+    const size_t ones = ::sus::num::__private::count_ones(w);
+    if (rem >= ones) {
+      rem -= ones;
+      continue;
+    }
+    // Clear the lowest `rem` set bits, then the lowest remaining bit is the
+    // one. The word is not zero, since it has more than `rem` set bits.
+    for (; rem > 0u; --rem) w &= w - 1u;
+    return Option<usize>::some(
+        i * kBitsPerWord + ::sus::num::__private::trailing_zeros_nonzero(
+                               ::sus::marker::unsafe_fn, w));
+  }
+  return Option<usize>::none();
+}
+
+}  // namespace sus::containers::__private
@@ -0,0 +1,291 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <new>
+
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+
+namespace sus::containers::__private {
+
+/// Picks the branching parameter `B` of a B-tree node holding keys of type
+/// `K`. A node holds up to `2 * B - 1` keys, which are sized to fill about
+/// four cache lines, so that a search within a node reads a few adjacent cache
+/// lines instead of chasing a pointer per comparison.
+template <class K>
+consteval size_t btree_branching() noexcept {
+  constexpr size_t kKeyBytes = 4u * 64u;
+  constexpr size_t b = (kKeyBytes / sizeof(K) + 1u) / 2u;
+  // At least 3, so that a node split leaves both halves non-empty after the
+  // middle key moves up. At most 16, to bound the cost of shifting elements
+  // on insert and remove.
+  return b < 3u ? 3u : (b > 16u ? 16u : b);
+}
+
+template <class K, class V>
+struct BTreeInternal;
+
+/// A leaf node of a B-tree, and the common prefix of an internal node.
+///
+/// Keys and values are stored in separate arrays so that searching a node only
+/// touches the keys. The arrays are uninitialized past `len`.
+template <class K, class V>
+struct BTreeLeaf {
+  static constexpr size_t kB = btree_branching<K>();
+  static constexpr size_t kCapacity = 2u * kB - 1u;
+  static constexpr size_t kMinLen = kB - 1u;
+
+  BTreeLeaf() noexcept {}
+  ~BTreeLeaf() noexcept {}
+
+  BTreeLeaf(const BTreeLeaf&) = delete;
+  BTreeLeaf& operator=(const BTreeLeaf&) = delete;
+
+  BTreeInternal<K, V>* parent = nullptr;
+  /// The index of this node in `parent->edges`.
+  uint16_t parent_idx = 0u;
+  uint16_t len = 0u;
+  bool internal = false;
+  union {
+    K keys[kCapacity];
+  };
+  union {
+    V vals[kCapacity];
+  };
+};
+
+/// An internal node of a B-tree, which has `len + 1` children.
+template <class K, class V>
+struct BTreeInternal final : public BTreeLeaf<K, V> {
+  BTreeInternal() noexcept { this->internal = true; }
+
+  BTreeLeaf<K, V>* edges[BTreeLeaf<K, V>::kCapacity + 1u];
+};
+
+template <class K, class V>
+inline BTreeInternal<K, V>* as_internal(BTreeLeaf<K, V>* n) noexcept {
+  return static_cast<BTreeInternal<K, V>*>(n);
+}
+
+/// Frees a node without destroying any keys or values in it.
+template <class K, class V>
+void btree_free_node(BTreeLeaf<K, V>* n) noexcept {
+  if (n->internal)
+    delete as_internal(n);
+  else
+    delete n;
+}
+
+/// Destroys the keys and values in `n` and all its children, and frees them.
+template <class K, class V>
+void btree_destroy(BTreeLeaf<K, V>* n) noexcept {
+  for (size_t i = 0u; i < n->len; ++i) {
+    n->keys[i].~K();
+    n->vals[i].~V();
+  }
+  if (n->internal) {
+    for (size_t i = 0u; i <= n->len; ++i)
+      btree_destroy(as_internal(n)->edges[i]);
+  }
+  btree_free_node(n);
+}
+
+/// Moves `count` elements from `src` to `dst`, where `dst` is uninitialized,
+/// leaving `src` uninitialized. The ranges may overlap.
+template <class T>
+void btree_move_elements(T* src, T* dst, size_t count) noexcept {
+  if (count == 0u || src == dst) return;
+  if constexpr (::sus::mem::relocate_by_memcpy<T>) {
+    memmove(static_cast<void*>(dst), static_cast<const void*>(src),
+            count * sizeof(T));
+  } else if (dst < src) {
+    for (size_t i = 0u; i < count; ++i) {
+      new (&dst[i]) T(::sus::move(src[i]));
+      src[i].~T();
+    }
+  } else {
+    for (size_t i = count; i > 0u; --i) {
+      new (&dst[i - 1u]) T(::sus::move(src[i - 1u]));
+      src[i - 1u].~T();
+    }
+  }
+}
+
+/// Points the children `edges[from..=to]` of `n` back at `n`.
+template <class K, class V>
+void btree_correct_children(BTreeInternal<K, V>* n, size_t from,
+                            size_t to) noexcept {
+  for (size_t i = from; i <= to; ++i) {
+    n->edges[i]->parent = n;
+    n->edges[i]->parent_idx = static_cast<uint16_t>(i);
+  }
+}
+
+/// Inserts a key and value at `idx` in a node that is not full. The edges of
+/// an internal node are not changed.
+template <class K, class V>
+void btree_insert_kv(BTreeLeaf<K, V>* n, size_t idx, K&& k, V&& v) noexcept {
+  btree_move_elements(n->keys + idx, n->keys + idx + 1u, n->len - idx);
+  btree_move_elements(n->vals + idx, n->vals + idx + 1u, n->len - idx);
+  new (&n->keys[idx]) K(::sus::move(k));
+  new (&n->vals[idx]) V(::sus::move(v));
+  n->len += 1u;
+}
+
+template <class K, class V>
+struct BTreeKV {
+  K key;
+  V val;
+};
+
+/// Removes and returns the key and value at `idx` in a node. The edges of an
+/// internal node are not changed.
+template <class K, class V>
+BTreeKV<K, V> btree_take_kv(BTreeLeaf<K, V>* n, size_t idx) noexcept {
+  auto kv = BTreeKV<K, V>(::sus::move(n->keys[idx]), ::sus::move(n->vals[idx]));
+  n->keys[idx].~K();
+  n->vals[idx].~V();
+  btree_move_elements(n->keys + idx + 1u, n->keys + idx, n->len - idx - 1u);
+  btree_move_elements(n->vals + idx + 1u, n->vals + idx, n->len - idx - 1u);
+  n->len -= 1u;
+  return kv;
+}
+
+/// Returns the index of the first key in `n` which is not less than `key`.
+template <class K, class V>
+size_t btree_lower_bound(const BTreeLeaf<K, V>* n, const K& key) noexcept {
+  // A linear scan over a node's keys reads them in order from a few cache
+  // lines, and is as fast as a binary search at these node sizes.
+  size_t i = 0u;
+  while (i < n->len && n->keys[i] < key) ++i;
+  return i;
+}
+
+/// Deep-copies the subtree rooted at `src`.
+template <class K, class V>
+BTreeLeaf<K, V>* btree_clone(const BTreeLeaf<K, V>* src) noexcept {
+  BTreeLeaf<K, V>* n;
+  if (src->internal)
+    n = new BTreeInternal<K, V>();
+  else
+    n = new BTreeLeaf<K, V>();
+  for (size_t i = 0u; i < src->len; ++i) {
+    new (&n->keys[i]) K(::sus::clone(src->keys[i]));
+    new (&n->vals[i]) V(::sus::clone(src->vals[i]));
+  }
+  n->len = src->len;
+  if (src->internal) {
+    auto* from = static_cast<const BTreeInternal<K, V>*>(src);
+    for (size_t i = 0u; i <= src->len; ++i)
+      as_internal(n)->edges[i] = btree_clone(from->edges[i]);
+    btree_correct_children(as_internal(n), 0u, n->len);
+  }
+  return n;
+}
+
+/// A position between two adjacent keys of a leaf node, or at either end of
+/// it.
+///
+/// Since all leaves are at the same depth, each gap between two adjacent keys
+/// in the whole tree corresponds to exactly one leaf edge. This makes leaf
+/// edges comparable with `==`, which lets a range iterator stop when its front
+/// and back edges meet.
+template <class K, class V>
+struct BTreeEdge {
+  BTreeLeaf<K, V>* node;
+  size_t idx;
+
+  bool operator==(const BTreeEdge&) const noexcept = default;
+};
+
+/// A key and value in a node, as found by `btree_next_kv()` and
+/// `btree_next_back_kv()`.
+template <class K, class V>
+struct BTreeKVHandle {
+  BTreeLeaf<K, V>* node;
+  size_t idx;
+};
+
+template <class K, class V>
+BTreeEdge<K, V> btree_first_leaf_edge(BTreeLeaf<K, V>* n) noexcept {
+  while (n->internal) n = as_internal(n)->edges[0u];
+  return BTreeEdge<K, V>(n, 0u);
+}
+
+template <class K, class V>
+BTreeEdge<K, V> btree_last_leaf_edge(BTreeLeaf<K, V>* n) noexcept {
+  while (n->internal) n = as_internal(n)->edges[n->len];
+  return BTreeEdge<K, V>(n, n->len);
+}
+
+/// Returns the leaf edge just before the first key that is not less than
+/// `key`.
+template <class K, class V>
+BTreeEdge<K, V> btree_lower_bound_edge(BTreeLeaf<K, V>* n,
+                                       const K& key) noexcept {
+  while (true) {
+    const size_t i = btree_lower_bound(n, key);
+    if (!n->internal) return BTreeEdge<K, V>(n, i);
+    n = as_internal(n)->edges[i];
+  }
+}
+
+/// Returns the key and value after the leaf edge `e`, and moves `e` past it.
+/// There must be a key after `e`.
+template <class K, class V>
+BTreeKVHandle<K, V> btree_next_kv(BTreeEdge<K, V>& e) noexcept {
+  BTreeLeaf<K, V>* n = e.node;
+  size_t i = e.idx;
+  while (i >= n->len) {
+    i = n->parent_idx;
+    n = n->parent;
+  }
+  if (n->internal)
+    e = btree_first_leaf_edge(as_internal(n)->edges[i + 1u]);
+  else
+    e = BTreeEdge<K, V>(n, i + 1u);
+  return BTreeKVHandle<K, V>(n, i);
+}
+
+/// Returns the key and value before the leaf edge `e`, and moves `e` before
+/// it. There must be a key before `e`.
+template <class K, class V>
+BTreeKVHandle<K, V> btree_next_back_kv(BTreeEdge<K, V>& e) noexcept {
+  BTreeLeaf<K, V>* n = e.node;
+  size_t i = e.idx;
+  while (i == 0u) {
+    i = n->parent_idx;
+    n = n->parent;
+  }
+  i -= 1u;
+  if (n->internal)
+    e = btree_last_leaf_edge(as_internal(n)->edges[i]);
+  else
+    e = BTreeEdge<K, V>(n, i);
+  return BTreeKVHandle<K, V>(n, i);
+}
+
+/// The value type of the BTreeMap inside a BTreeSet.
+struct BTreeSetValue {
+  constexpr bool operator==(const BTreeSetValue&) const noexcept = default;
+};
+
+}  // namespace sus::containers::__private
@@ -0,0 +1,201 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/__private/reductions.h"
+#include "subspace/num/__private/intrinsics.h"
+
+// Kernels for the element-wise arithmetic on SliceMut
+// (`checked_add_assign()`, `saturating_mul_assign()`, etc).
+//
+// Like the reductions, these are loops over the primitive values without
+// branches in them, so that the compiler can vectorize them. Overflow is
+// detected from the wrapped result with bit tricks, rather than through a
+// branch on each element.
+namespace sus::containers::__private {
+
+/// Panics unless the slices at `a` and `b` have the same length, and are
+/// either the same slice or do not overlap.
+template <class T>
+constexpr void check_elementwise(const T* a, size_t a_len, const T* b,
+                                 size_t b_len) noexcept {
+  ::sus::check(a_len == b_len);
+  if (a != b) ::sus::check(a + a_len <= b || b + b_len <= a);
+}
+
+template <class P>
+struct AddOp {
+  using U = std::make_unsigned_t<P>;
+  using M = WrappingMath<P>;
+
+  static constexpr P wrapping(P x, P y) noexcept {
+    return static_cast<P>(static_cast<U>(static_cast<M>(static_cast<U>(x)) +
+                                         static_cast<M>(static_cast<U>(y))));
+  }
+  static constexpr bool overflows(P x, P y) noexcept {
+    const P r = wrapping(x, y);
+    if constexpr (std::is_signed_v<P>) {
+      // Overflow happened if both inputs have a different sign than the
+      // result.
+      return ((x ^ r) & (y ^ r)) < 0;
+    } else {
+      return r < x;
+    }
+  }
+  static constexpr P saturating(P x, P y) noexcept {
+    if constexpr (std::is_signed_v<P>) {
+      const P bound = x < P{0} ? ::sus::num::__private::min_value<P>()
+                               : ::sus::num::__private::max_value<P>();
+      return overflows(x, y) ? bound : wrapping(x, y);
+    } else {
+      return overflows(x, y) ? ::sus::num::__private::max_value<P>()
+                             : wrapping(x, y);
+    }
+  }
+};
+
+template <class P>
+struct SubOp {
+  using U = std::make_unsigned_t<P>;
+  using M = WrappingMath<P>;
+
+  static constexpr P wrapping(P x, P y) noexcept {
+    return static_cast<P>(static_cast<U>(static_cast<M>(static_cast<U>(x)) -
+                                         static_cast<M>(static_cast<U>(y))));
+  }
+  static constexpr bool overflows(P x, P y) noexcept {
+    if constexpr (std::is_signed_v<P>) {
+      // Overflow happened if the inputs have different signs, and the result
+      // has a different sign than `x`.
+      const P r = wrapping(x, y);
+      return ((x ^ y) & (x ^ r)) < 0;
+    } else {
+      return x < y;
+    }
+  }
+  static constexpr P saturating(P x, P y) noexcept {
+    if constexpr (std::is_signed_v<P>) {
+      const P bound = x < P{0} ? ::sus::num::__private::min_value<P>()
+                               : ::sus::num::__private::max_value<P>();
+      return overflows(x, y) ? bound : wrapping(x, y);
+    } else {
+      return overflows(x, y) ? P{0} : wrapping(x, y);
+    }
+  }
+};
+
+template <class P>
+struct MulOp {
+  using U = std::make_unsigned_t<P>;
+  using M = WrappingMath<P>;
+  // Products of values up to 32 bits are exact in 64 bits, which lets the
+  // compiler vectorize them. There's no wider type for 64 bit values.
+  using W = std::conditional_t<std::is_signed_v<P>, int64_t, uint64_t>;
+  static constexpr bool kWiden = sizeof(P) <= 4u;
+
+  static constexpr P wrapping(P x, P y) noexcept {
+    return static_cast<P>(static_cast<U>(static_cast<M>(static_cast<U>(x)) *
+                                         static_cast<M>(static_cast<U>(y))));
+  }
+  static constexpr bool overflows(P x, P y) noexcept {
+    if constexpr (kWiden) {
+      const W w = W{x} * W{y};
+      return w < W{::sus::num::__private::min_value<P>()} ||
+             w > W{::sus::num::__private::max_value<P>()};
+    } else {
+      return ::sus::num::__private::mul_with_overflow(x, y).overflow;
+    }
+  }
+  static constexpr P saturating(P x, P y) noexcept {
+    if constexpr (kWiden) {
+      const W w = W{x} * W{y};
+      const W lo = W{::sus::num::__private::min_value<P>()};
+      const W hi = W{::sus::num::__private::max_value<P>()};
+      return static_cast<P>(w < lo ? lo : (w > hi ? hi : w));
+    } else {
+      return ::sus::num::__private::saturating_mul(x, y);
+    }
+  }
+};
+
+/// Applies `a[i] = Op::wrapping(a[i], b[i])` to the integers in `a[0..n]`.
+template <template <class> class Op, class T>
+constexpr void wrapping_assign(T* a, const T* b, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  for (size_t i = 0u; i < n; ++i) {
+    a[i].primitive_value =
+        Op<P>::wrapping(a[i].primitive_value, b[i].primitive_value);
+  }
+}
+
+/// Applies `a[i] = Op::saturating(a[i], b[i])` to the integers in `a[0..n]`.
+template <template <class> class Op, class T>
+constexpr void saturating_assign(T* a, const T* b, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  for (size_t i = 0u; i < n; ++i) {
+    a[i].primitive_value =
+        Op<P>::saturating(a[i].primitive_value, b[i].primitive_value);
+  }
+}
+
+/// The number of elements checked for overflow at a time by
+/// `checked_assign()`, before any of them are written. Small enough that a
+/// block stays in the L1 cache between the two passes over it.
+constexpr size_t kCheckedBlock = 256u;
+
+/// Applies `a[i] = Op::wrapping(a[i], b[i])` to the integers in `a[0..n]`,
+/// stopping at the first element where the operation overflows.
+///
+/// Returns the index of the element that overflowed, or `n` if none did.
+/// Elements before the returned index are written, and the rest are not.
+template <template <class> class Op, class T>
+constexpr size_t checked_assign(T* a, const T* b, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  for (size_t done = 0u; done < n; done += kCheckedBlock) {
+    const size_t m = n - done < kCheckedBlock ? n - done : kCheckedBlock;
+    T* const ab = a + done;
+    const T* const bb = b + done;
+    // Look for overflow in the whole block without branching, which is the
+    // common case, before writing any of it. The flags are combined in an
+    // integer the same width as the values, as the compiler won't vectorize
+    // a reduction over `bool`.
+    std::make_unsigned_t<P> overflow = 0u;
+    for (size_t i = 0u; i < m; ++i) {
+      overflow |= static_cast<std::make_unsigned_t<P>>(
+          Op<P>::overflows(ab[i].primitive_value, bb[i].primitive_value));
+    }
+    if (overflow != 0u) [[unlikely]] {
+      for (size_t i = 0u; i < m; ++i) {
+        if (Op<P>::overflows(ab[i].primitive_value, bb[i].primitive_value))
+          return done + i;
+        ab[i].primitive_value =
+            Op<P>::wrapping(ab[i].primitive_value, bb[i].primitive_value);
+      }
+    }
+    for (size_t i = 0u; i < m; ++i) {
+      ab[i].primitive_value =
+          Op<P>::wrapping(ab[i].primitive_value, bb[i].primitive_value);
+    }
+  }
+  return n;
+}
+
+}  // namespace sus::containers::__private
@@ -0,0 +1,441 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <bit>
+#include <type_traits>
+
+#include "subspace/num/__private/intrinsics.h"
+
+// Kernels for the numeric reductions on Slice (`sum()`, `min()`, `dot()`,
+// etc).
+//
+// These loops run over the primitive values directly, and are written so the
+// compiler can vectorize them: no per-element branches or overflow checks, and
+// independent accumulators for floating point, where the compiler may not
+// reassociate additions itself. Overflow for integers is instead detected
+// once at the end, by summing exactly into a wide accumulator.
+namespace sus::containers::__private {
+
+/// A 192-bit two's complement integer, which can hold the exact sum of any
+/// number of 128-bit values that fit in memory.
+struct WideSum {
+  uint64_t w0 = 0u;
+  uint64_t w1 = 0u;
+  uint64_t w2 = 0u;
+
+  /// Adds the unsigned 128-bit value `hi:lo`.
+  constexpr void add(uint64_t lo, uint64_t hi) noexcept {
+    w0 += lo;
+    const uint64_t c0 = w0 < lo ? 1u : 0u;
+    const uint64_t t = w1 + hi;
+    const uint64_t c1 = t < hi ? 1u : 0u;
+    w1 = t + c0;
+    w2 += c1 + (w1 < c0 ? 1u : 0u);
+  }
+
+  /// Subtracts the unsigned 128-bit value `hi:lo`.
+  constexpr void sub(uint64_t lo, uint64_t hi) noexcept {
+    const uint64_t b0 = w0 < lo ? 1u : 0u;
+    w0 -= lo;
+    const uint64_t b1 = w1 < hi ? 1u : 0u;
+    const uint64_t t = w1 - hi;
+    const uint64_t b2 = t < b0 ? 1u : 0u;
+    w1 = t - b0;
+    w2 -= b1 + b2;
+  }
+
+  constexpr bool is_negative() const noexcept { return (w2 >> 63u) != 0u; }
+
+  /// Returns true if the value is in the range of the primitive integer `P`.
+  template <class P>
+  constexpr bool fits() const noexcept {
+    if constexpr (std::is_signed_v<P>) {
+      const uint64_t ext = (w0 >> 63u) != 0u ? ~uint64_t{0} : uint64_t{0};
+      if (w1 != ext || w2 != ext) return false;
+      const auto v = static_cast<int64_t>(w0);
+      return v >= int64_t{::sus::num::__private::min_value<P>()} &&
+             v <= int64_t{::sus::num::__private::max_value<P>()};
+    } else {
+      return w1 == 0u && w2 == 0u &&
+             w0 <= uint64_t{::sus::num::__private::max_value<P>()};
+    }
+  }
+
+  /// Returns the value as `P` if it fits, or else the closest bound of `P`.
+  template <class P>
+  constexpr P saturate() const noexcept {
+    if (fits<P>()) return static_cast<P>(w0);
+    if (is_negative()) return ::sus::num::__private::min_value<P>();
+    return ::sus::num::__private::max_value<P>();
+  }
+};
+
+/// The unsigned type to do wrapping math for primitive `P` in, which avoids
+/// promotion to (signed) `int`.
+template <class P>
+using WrappingMath =
+    std::conditional_t<(sizeof(P) < sizeof(unsigned int)), unsigned int,
+                       std::make_unsigned_t<P>>;
+
+/// The value of the sign bit of the primitive integer `P`, which is added to
+/// signed values to make them non-negative.
+template <class P>
+constexpr uint64_t sign_bias() noexcept {
+  if constexpr (std::is_signed_v<P>)
+    return uint64_t{1} << (sizeof(P) * 8u - 1u);
+  else
+    return 0u;
+}
+
+/// Subtracts `count` times `bias` from `sum`, where `bias` is a power of two
+/// below 2^64.
+constexpr void remove_bias(WideSum& sum, uint64_t count,
+                           uint64_t bias) noexcept {
+  if (bias == 0u) return;
+  const auto shift = static_cast<uint32_t>(std::countr_zero(bias));
+  const uint64_t hi = shift == 0u ? 0u : count >> (64u - shift);
+  sum.sub(count << shift, hi);
+}
+
+/// Each chunk is summed into 64-bit accumulators from values below 2^32, so
+/// this many values can be summed before the accumulators could overflow.
+constexpr size_t kExactChunk = size_t{1} << 31u;
+
+/// Returns the exact sum of the integers in `p[0..n]`.
+template <class T>
+constexpr WideSum exact_sum(const T* p, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  using U = std::make_unsigned_t<P>;
+  // Signed values are offset to be non-negative by flipping the sign bit,
+  // which adds `bias` to each of them. The offset is removed at the end.
+  constexpr uint64_t bias = sign_bias<P>();
+  WideSum sum;
+  for (size_t done = 0u; done < n;) {
+    const size_t m = n - done < kExactChunk ? n - done : kExactChunk;
+    const T* const c = p + done;
+    if constexpr (sizeof(P) <= 4u) {
+      uint64_t acc = 0u;
+      for (size_t i = 0u; i < m; ++i)
+        acc += static_cast<U>(static_cast<U>(c[i].primitive_value) ^ bias);
+      sum.add(acc, 0u);
+    } else {
+      // Sums the low and high 32 bits of each value separately.
+      uint64_t acc_lo = 0u;
+      uint64_t acc_hi = 0u;
+      for (size_t i = 0u; i < m; ++i) {
+        const uint64_t u = static_cast<uint64_t>(c[i].primitive_value) ^ bias;
+        acc_lo += u & 0xffffffffu;
+        acc_hi += u >> 32u;
+      }
+      sum.add(acc_lo, 0u);
+      sum.add(acc_hi << 32u, acc_hi >> 32u);
+    }
+    done += m;
+  }
+  remove_bias(sum, n, bias);
+  return sum;
+}
+
+/// Returns the sum of the integers in `p[0..n]`, wrapping around at the
+/// bounds of the type.
+template <class T>
+constexpr T wrapping_sum(const T* p, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  using M = WrappingMath<P>;
+  M acc = 0u;
+  for (size_t i = 0u; i < n; ++i)
+    acc += static_cast<M>(static_cast<std::make_unsigned_t<P>>(
+        p[i].primitive_value));
+  return T(static_cast<P>(acc));
+}
+
+/// Returns the exact product of 64-bit values `a * b`, as `hi:lo`.
+constexpr void wide_mul(uint64_t a, uint64_t b, uint64_t& lo,
+                        uint64_t& hi) noexcept {
+  const auto out = ::sus::num::__private::widening_mul(a, b);
+  lo = out.lo;
+  hi = out.hi;
+}
+
+/// Returns the magnitude of `v` as an unsigned value.
+template <class P>
+constexpr std::make_unsigned_t<P> unsigned_abs(P v) noexcept {
+  using U = std::make_unsigned_t<P>;
+  if constexpr (std::is_signed_v<P>) {
+    if (v < P{0}) return static_cast<U>(U{0} - static_cast<U>(v));
+  }
+  return static_cast<U>(v);
+}
+
+/// Returns the exact sum of `a[i] * b[i]` for the integers in `a[0..n]` and
+/// `b[0..n]`.
+template <class T>
+constexpr WideSum exact_dot(const T* a, const T* b, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  WideSum sum;
+  if constexpr (sizeof(P) <= 4u) {
+    // Each product fits in 64 bits, and is summed like in `exact_sum()`.
+    using Q = std::conditional_t<std::is_signed_v<P>, int64_t, uint64_t>;
+    constexpr uint64_t bias = sign_bias<Q>();
+    for (size_t done = 0u; done < n;) {
+      const size_t m = n - done < kExactChunk ? n - done : kExactChunk;
+      uint64_t acc_lo = 0u;
+      uint64_t acc_hi = 0u;
+      for (size_t i = done; i < done + m; ++i) {
+        const Q q = Q{a[i].primitive_value} * Q{b[i].primitive_value};
+        const uint64_t u = static_cast<uint64_t>(q) ^ bias;
+        acc_lo += u & 0xffffffffu;
+        acc_hi += u >> 32u;
+      }
+      sum.add(acc_lo, 0u);
+      sum.add(acc_hi << 32u, acc_hi >> 32u);
+      done += m;
+    }
+    remove_bias(sum, n, bias);
+  } else {
+    // There's no wider type to multiply in, so each 128-bit product is built
+    // from 32-bit halves.
+    for (size_t i = 0u; i < n; ++i) {
+      const P x = a[i].primitive_value;
+      const P y = b[i].primitive_value;
+      uint64_t lo, hi;
+      wide_mul(unsigned_abs(x), unsigned_abs(y), lo, hi);
+      if ((x < P{0}) != (y < P{0}))
+        sum.sub(lo, hi);
+      else
+        sum.add(lo, hi);
+    }
+  }
+  return sum;
+}
+
+/// Returns the sum of `a[i] * b[i]` for the integers in `a[0..n]` and
+/// `b[0..n]`, wrapping around at the bounds of the type.
+template <class T>
+constexpr T wrapping_dot(const T* a, const T* b, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  using M = WrappingMath<P>;
+  using U = std::make_unsigned_t<P>;
+  M acc = 0u;
+  for (size_t i = 0u; i < n; ++i) {
+    acc += static_cast<M>(static_cast<U>(a[i].primitive_value)) *
+           static_cast<M>(static_cast<U>(b[i].primitive_value));
+  }
+  return T(static_cast<P>(acc));
+}
+
+/// Returns the product of the integers in `p[0..n]`, wrapping around at the
+/// bounds of the type.
+template <class T>
+constexpr T wrapping_product(const T* p, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  using M = WrappingMath<P>;
+  M acc = 1u;
+  for (size_t i = 0u; i < n; ++i)
+    acc *= static_cast<M>(static_cast<std::make_unsigned_t<P>>(
+        p[i].primitive_value));
+  return T(static_cast<P>(acc));
+}
+
+/// The exact product of some integers, as a magnitude and a sign.
+template <class P>
+struct ExactProduct {
+  std::make_unsigned_t<P> magnitude;
+  bool negative;
+  bool overflow;
+
+  constexpr bool fits() const noexcept {
+    using U = std::make_unsigned_t<P>;
+    if (overflow) return false;
+    if (negative) {
+      // The magnitude of the minimum value is one more than the maximum.
+      return magnitude <=
+             static_cast<U>(U{0} - static_cast<U>(
+                                       ::sus::num::__private::min_value<P>()));
+    }
+    return magnitude <= static_cast<U>(::sus::num::__private::max_value<P>());
+  }
+
+  constexpr P saturate() const noexcept {
+    using U = std::make_unsigned_t<P>;
+    if (!fits()) {
+      return negative ? ::sus::num::__private::min_value<P>()
+                      : ::sus::num::__private::max_value<P>();
+    }
+    if (negative) return static_cast<P>(U{0} - magnitude);
+    return static_cast<P>(magnitude);
+  }
+};
+
+/// Returns the exact product of the integers in `p[0..n]`.
+template <class T>
+constexpr ExactProduct<decltype(T::primitive_value)> exact_product(
+    const T* p, size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  using U = std::make_unsigned_t<P>;
+  // A zero anywhere makes the product zero, no matter how large the product of
+  // the other values is.
+  bool has_zero = false;
+  bool negative = false;
+  for (size_t i = 0u; i < n; ++i) {
+    has_zero |= p[i].primitive_value == P{0};
+    negative ^= p[i].primitive_value < P{0};
+  }
+  if (has_zero) return ExactProduct<P>{U{0}, false, false};
+
+  // Without zeros, the magnitude can only grow, so we can stop once it
+  // overflows.
+  U magnitude = 1u;
+  for (size_t i = 0u; i < n; ++i) {
+    const auto out = ::sus::num::__private::mul_with_overflow(
+        magnitude, unsigned_abs(p[i].primitive_value));
+    if (out.overflow) return ExactProduct<P>{U{0}, negative, true};
+    magnitude = out.value;
+  }
+  return ExactProduct<P>{magnitude, negative, false};
+}
+
+/// The number of independent accumulators used for floating point reductions.
+/// The compiler may not reorder floating point math itself, so the
+/// accumulators are what allow it to use vector instructions.
+constexpr size_t kFloatLanes = 8u;
+
+/// The number of values summed directly, without pairwise summation, in each
+/// block of `pairwise_sum()`.
+constexpr size_t kPairwiseBlock = 128u;
+
+/// Returns the sum of `a[i] * b[i]` for the floats in `a[0..n]` and `b[0..n]`
+/// if `b` is not null, or the sum of `a[0..n]` if it is.
+template <class T>
+constexpr decltype(T::primitive_value) lanes_sum(const T* a, const T* b,
+                                                 size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  P acc[kFloatLanes] = {};
+  P rest = P{0};
+  size_t i = 0u;
+  if (b == nullptr) {
+    for (; i + kFloatLanes <= n; i += kFloatLanes) {
+      for (size_t j = 0u; j < kFloatLanes; ++j)
+        acc[j] += a[i + j].primitive_value;
+    }
+    for (; i < n; ++i) rest += a[i].primitive_value;
+  } else {
+    for (; i + kFloatLanes <= n; i += kFloatLanes) {
+      for (size_t j = 0u; j < kFloatLanes; ++j)
+        acc[j] += a[i + j].primitive_value * b[i + j].primitive_value;
+    }
+    for (; i < n; ++i) rest += a[i].primitive_value * b[i].primitive_value;
+  }
+  return (((acc[0] + acc[1]) + (acc[2] + acc[3])) +
+          ((acc[4] + acc[5]) + (acc[6] + acc[7]))) +
+         rest;
+}
+
+/// Like `lanes_sum()` but uses pairwise summation, which has an error that
+/// grows with O(log n) rather than the O(n) of adding each value in turn.
+///
+/// The values are summed in blocks, and the block sums are combined like
+/// incrementing a binary counter, so that only sums over the same number of
+/// blocks are added together.
+template <class T>
+constexpr decltype(T::primitive_value) pairwise_sum(const T* a, const T* b,
+                                                    size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  P partial[64u] = {};
+  size_t depth = 0u;
+  for (size_t k = 0u, done = 0u; done < n; ++k, done += kPairwiseBlock) {
+    const size_t m = n - done < kPairwiseBlock ? n - done : kPairwiseBlock;
+    P s = lanes_sum(a + done, b == nullptr ? b : b + done, m);
+    for (size_t c = k; (c & 1u) != 0u; c >>= 1u) s = partial[--depth] + s;
+    partial[depth++] = s;
+  }
+  P total = P{0};
+  while (depth > 0u) total = partial[--depth] + total;
+  return total;
+}
+
+/// Returns the product of the floats in `p[0..n]`.
+template <class T>
+constexpr decltype(T::primitive_value) float_product(const T* p,
+                                                     size_t n) noexcept {
+  using P = decltype(T::primitive_value);
+  P acc[kFloatLanes] = {P{1}, P{1}, P{1}, P{1}, P{1}, P{1}, P{1}, P{1}};
+  size_t i = 0u;
+  for (; i + kFloatLanes <= n; i += kFloatLanes) {
+    for (size_t j = 0u; j < kFloatLanes; ++j)
+      acc[j] *= p[i + j].primitive_value;
+  }
+  P s = ((acc[0] * acc[1]) * (acc[2] * acc[3])) *
+        ((acc[4] * acc[5]) * (acc[6] * acc[7]));
+  for (; i < n; ++i) s *= p[i].primitive_value;
+  return s;
+}
+
+/// Returns the smaller of `x` and `m`, where a NaN is only chosen if both are
+/// NaN. Integers are compared directly.
+template <class P>
+constexpr P select_min(P m, P x) noexcept {
+  if constexpr (std::is_floating_point_v<P>)
+    return (x < m || m != m) ? x : m;
+  else
+    return x < m ? x : m;
+}
+
+/// Returns the larger of `x` and `m`, where a NaN is only chosen if both are
+/// NaN. Integers are compared directly.
+template <class P>
+constexpr P select_max(P m, P x) noexcept {
+  if constexpr (std::is_floating_point_v<P>)
+    return (x > m || m != m) ? x : m;
+  else
+    return x > m ? x : m;
+}
+
+/// Returns the minimum and maximum of the numbers in `p[0..n]`, where `n` is
+/// at least 1.
+template <class T, bool kMin, bool kMax>
+constexpr void min_max(const T* p, size_t n, decltype(T::primitive_value)& lo,
+                       decltype(T::primitive_value)& hi) noexcept {
+  using P = decltype(T::primitive_value);
+  P mins[kFloatLanes], maxs[kFloatLanes];
+  for (size_t j = 0u; j < kFloatLanes; ++j) {
+    mins[j] = p[0u].primitive_value;
+    maxs[j] = p[0u].primitive_value;
+  }
+  size_t i = 0u;
+  for (; i + kFloatLanes <= n; i += kFloatLanes) {
+    for (size_t j = 0u; j < kFloatLanes; ++j) {
+      const P x = p[i + j].primitive_value;
+      if constexpr (kMin) mins[j] = select_min(mins[j], x);
+      if constexpr (kMax) maxs[j] = select_max(maxs[j], x);
+    }
+  }
+  for (; i < n; ++i) {
+    if constexpr (kMin) mins[0u] = select_min(mins[0u], p[i].primitive_value);
+    if constexpr (kMax) maxs[0u] = select_max(maxs[0u], p[i].primitive_value);
+  }
+  lo = mins[0u];
+  hi = maxs[0u];
+  for (size_t j = 1u; j < kFloatLanes; ++j) {
+    lo = select_min(lo, mins[j]);
+    hi = select_max(hi, maxs[j]);
+  }
+}
+
+}  // namespace sus::containers::__private
@@ -0,0 +1,197 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/__private/bit_words.h"
+#include "subspace/containers/iterators/iter_ones.h"
+#include "subspace/containers/slice.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::containers {
+
+/// A fixed-size array of `N` bits, packed into 64-bit words.
+///
+/// This is the fixed-size counterpart to `BitVec`, with the same operations,
+/// and it is stored inline without a heap allocation. A BitArray is `Copy`, and
+/// in addition to the assigning operators it has `&`, `|`, `^` and `~`
+/// operators which return a new BitArray.
+///
+/// # Example
+/// ```
+/// auto a = sus::containers::BitArray<128>();
+/// a.set(1u, true);
+/// auto b = ~a;
+/// sus::check(b.count_ones() == 127u);
+/// ```
+template <size_t N>
+  requires(N > 0u)
+class BitArray final {
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs a BitArray with all bits unset.
+  constexpr BitArray() noexcept = default;
+
+  /// Returns the number of bits in the BitArray, which is `N`.
+  static constexpr usize len() noexcept { return N; }
+
+  /// Returns the bit at index `i`, or None if `i` is out of bounds.
+  constexpr Option<bool> get(usize i) const& noexcept {
+    if (i >= N) return Option<bool>::none();
+    return Option<bool>::some(get_unchecked(::sus::marker::unsafe_fn, i));
+  }
+
+  /// Returns the bit at index `i`.
+  ///
+  /// # Panics
+  /// The function will panic if `i` is out of bounds.
+  constexpr bool operator[](usize i) const& noexcept {
+    ::sus::check(i < N);
+    return get_unchecked(::sus::marker::unsafe_fn, i);
+  }
+
+  /// Returns the bit at index `i`, without a bounds check.
+  ///
+  /// # Safety
+  /// If `i` is out of bounds, Undefined Behaviour results.
+  constexpr bool get_unchecked(::sus::marker::UnsafeFnMarker,
+                               usize i) const& noexcept {
+    return (words_[size_t{__private::word_index(i)}] &
+            __private::bit_mask(i)) != 0u;
+  }
+
+  /// Sets the bit at index `i` to `value`.
+  ///
+  /// # Panics
+  /// The function will panic if `i` is out of bounds.
+  constexpr void set(usize i, bool value) & noexcept {
+    ::sus::check(i < N);
+    u64& w = words_[size_t{__private::word_index(i)}];
+    if (value)
+      w |= __private::bit_mask(i);
+    else
+      w &= ~__private::bit_mask(i);
+  }
+
+  /// Returns the number of set bits.
+  constexpr usize count_ones() const& noexcept {
+    return __private::count_ones(as_words());
+  }
+  /// Returns the number of unset bits.
+  constexpr usize count_zeros() const& noexcept { return N - count_ones(); }
+  /// Returns true if any bit is set.
+  constexpr bool any() const& noexcept { return __private::any(as_words()); }
+  /// Returns true if every bit is set.
+  constexpr bool all() const& noexcept { return count_ones() == N; }
+
+  /// Returns the number of set bits before index `i`.
+  ///
+  /// # Panics
+  /// The function will panic if `i` is greater than `N`.
+  constexpr usize rank(usize i) const& noexcept {
+    ::sus::check(i <= N);
+    return __private::rank(as_words(), i);
+  }
+
+  /// Returns the index of the set bit which has `k` set bits before it, or
+  /// None if there are not more than `k` set bits.
+  ///
+  /// This is the inverse of `rank()`: for a set bit at index `i`,
+  /// `select(rank(i)) == i`.
+  constexpr Option<usize> select(usize k) const& noexcept {
+    return __private::select(as_words(), k);
+  }
+
+  /// Flips every bit.
+  constexpr void flip_all() & noexcept {
+    __private::flip_words(as_mut_words(), N);
+  }
+
+  /// Sets each bit to the logical AND of itself and the same bit in `o`.
+  constexpr void operator&=(const BitArray& o) & noexcept {
+    __private::and_words(as_mut_words(), o.as_words());
+  }
+  /// Sets each bit to the logical OR of itself and the same bit in `o`.
+  constexpr void operator|=(const BitArray& o) & noexcept {
+    __private::or_words(as_mut_words(), o.as_words());
+  }
+  /// Sets each bit to the logical XOR of itself and the same bit in `o`.
+  constexpr void operator^=(const BitArray& o) & noexcept {
+    __private::xor_words(as_mut_words(), o.as_words());
+  }
+
+  friend constexpr BitArray operator&(BitArray l, const BitArray& r) noexcept {
+    l &= r;
+    return l;
+  }
+  friend constexpr BitArray operator|(BitArray l, const BitArray& r) noexcept {
+    l |= r;
+    return l;
+  }
+  friend constexpr BitArray operator^(BitArray l, const BitArray& r) noexcept {
+    l ^= r;
+    return l;
+  }
+  constexpr BitArray operator~() const& noexcept {
+    BitArray out = *this;
+    out.flip_all();
+    return out;
+  }
+
+  /// Returns an iterator over the indices of the set bits, in increasing
+  /// order.
+  constexpr IterOnes iter_ones() const& noexcept sus_lifetimebound {
+    return IterOnes::with(as_words());
+  }
+  IterOnes iter_ones() && = delete;
+
+  /// Returns the words holding the bits. Bit `i` is bit `i % 64` of word
+  /// `i / 64`, and the bits past `N` in the last word are always zero.
+  constexpr Slice<u64> as_words() const& noexcept sus_lifetimebound {
+    return Slice<u64>::from_raw_parts(::sus::marker::unsafe_fn, words_,
+                                      usize(kWords));
+  }
+  Slice<u64> as_words() && = delete;
+
+  /// sus::ops::Eq<BitArray> trait.
+  friend constexpr bool operator==(const BitArray& l,
+                                   const BitArray& r) noexcept {
+    return l.as_words() == r.as_words();
+  }
+
+ private:
+  static constexpr size_t kWords = __private::words_for_bits(N);
+
+  constexpr SliceMut<u64> as_mut_words() & noexcept {
+    return SliceMut<u64>::from_raw_parts_mut(::sus::marker::unsafe_fn, words_,
+                                             usize(kWords));
+  }
+
+  u64 words_[kWords];
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, u64);
+};
+
+}  // namespace sus::containers
+
+// Promote BitArray into the `sus` namespace.
+namespace sus {
+using ::sus::containers::BitArray;
+}  // namespace sus
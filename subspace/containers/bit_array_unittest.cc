@@ -0,0 +1,103 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/containers/bit_array.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::containers::BitArray;
+
+static_assert(sizeof(BitArray<1>) == sizeof(u64));
+static_assert(sizeof(BitArray<64>) == sizeof(u64));
+static_assert(sizeof(BitArray<65>) == 2 * sizeof(u64));
+static_assert(sus::mem::Copy<BitArray<8>>);
+static_assert(sus::mem::relocate_by_memcpy<BitArray<8>>);
+
+TEST(BitArray, Default) {
+  auto a = BitArray<100>();
+  EXPECT_EQ(a.len(), 100u);
+  EXPECT_EQ(a.count_ones(), 0u);
+  EXPECT_FALSE(a.any());
+  EXPECT_FALSE(a.all());
+  EXPECT_TRUE(a.get(100u).is_none());
+}
+
+TEST(BitArray, SetGet) {
+  auto a = BitArray<100>();
+  a.set(0u, true);
+  a.set(99u, true);
+  EXPECT_EQ(a[0u], true);
+  EXPECT_EQ(a[1u], false);
+  EXPECT_EQ(a.get(99u), sus::some(true));
+  EXPECT_EQ(a.count_ones(), 2u);
+  EXPECT_EQ(a.count_zeros(), 98u);
+  a.set(0u, false);
+  EXPECT_EQ(a.count_ones(), 1u);
+}
+
+TEST(BitArray, Operators) {
+  auto a = BitArray<70>();
+  auto b = BitArray<70>();
+  a.set(1u, true);
+  a.set(65u, true);
+  b.set(65u, true);
+  b.set(69u, true);
+  auto c = a & b;
+  EXPECT_EQ(sus::Vec<usize>::from_iter(c.iter_ones()),
+            sus::Vec<usize>::with_values(65u));
+  c = a | b;
+  EXPECT_EQ(sus::Vec<usize>::from_iter(c.iter_ones()),
+            sus::Vec<usize>::with_values(1u, 65u, 69u));
+  c = a ^ b;
+  EXPECT_EQ(sus::Vec<usize>::from_iter(c.iter_ones()),
+            sus::Vec<usize>::with_values(1u, 69u));
+  auto n = ~a;
+  EXPECT_EQ(n.count_ones(), 68u);
+  EXPECT_EQ(n.as_words()[1u], 0x3Du);
+  EXPECT_TRUE((n | a).all());
+  EXPECT_EQ(~~a, a);
+  EXPECT_NE(a, b);
+}
+
+TEST(BitArray, RankSelect) {
+  auto a = BitArray<128>();
+  a.set(3u, true);
+  a.set(64u, true);
+  a.set(127u, true);
+  EXPECT_EQ(a.rank(4u), 1u);
+  EXPECT_EQ(a.rank(64u), 1u);
+  EXPECT_EQ(a.rank(65u), 2u);
+  EXPECT_EQ(a.rank(128u), 3u);
+  EXPECT_EQ(a.select(1u), sus::some(64_usize));
+  EXPECT_EQ(a.select(2u), sus::some(127_usize));
+  EXPECT_TRUE(a.select(3u).is_none());
+}
+
+TEST(BitArray, Constexpr) {
+  constexpr auto a = []() {
+    auto a = BitArray<10>();
+    a.set(2u, true);
+    a.set(7u, true);
+    return a;
+  }();
+  static_assert(a.count_ones() == 2u);
+  static_assert(a.rank(7u) == 1u);
+  static_assert(a.select(1u).unwrap() == 7u);
+}
+
+}  // namespace
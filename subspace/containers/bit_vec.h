@@ -0,0 +1,256 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/__private/bit_words.h"
+#include "subspace/containers/iterators/iter_ones.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::containers {
+
+/// A growable array of bits, packed into 64-bit words.
+///
+/// A BitVec uses one bit per element, where a `Vec<bool>` would use one byte.
+/// Operations over the whole BitVec, like `count_ones()` and `operator&=`, work
+/// a word (64 bits) at a time, and `iter_ones()` jumps directly between set
+/// bits.
+///
+/// `rank()` and `select()` scan the words up to the answer, without building
+/// an index, so they take time linear in the position being looked for.
+///
+/// # Example
+/// ```
+/// auto bits = sus::containers::BitVec::with_len(100u);
+/// bits.set(3u, true);
+/// bits.set(70u, true);
+/// sus::check(bits.count_ones() == 2u);
+/// for (usize i : bits.iter_ones()) { /* Visits 3, then 70. */ }
+/// ```
+class BitVec final {
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty BitVec, without allocating.
+  constexpr BitVec() noexcept = default;
+
+  /// Constructs a BitVec of `len` bits, all unset.
+  static BitVec with_len(usize len) noexcept {
+    auto v = BitVec();
+    v.resize(len, false);
+    return v;
+  }
+
+  BitVec(BitVec&&) = default;
+  BitVec& operator=(BitVec&&) = default;
+
+  /// sus::mem::Clone trait.
+  BitVec clone() const noexcept { return BitVec(words_.clone(), len_); }
+
+  /// Returns the number of bits in the BitVec.
+  constexpr usize len() const& noexcept { return len_; }
+  /// Returns true if the BitVec has no bits.
+  constexpr bool is_empty() const& noexcept { return len_ == 0u; }
+
+  /// Returns the bit at index `i`, or None if `i` is out of bounds.
+  Option<bool> get(usize i) const& noexcept {
+    if (i >= len_) return Option<bool>::none();
+    return Option<bool>::some(get_unchecked(::sus::marker::unsafe_fn, i));
+  }
+
+  /// Returns the bit at index `i`.
+  ///
+  /// # Panics
+  /// The function will panic if `i` is out of bounds.
+  bool operator[](usize i) const& noexcept {
+    ::sus::check(i < len_);
+    return get_unchecked(::sus::marker::unsafe_fn, i);
+  }
+
+  /// Returns the bit at index `i`, without a bounds check.
+  ///
+  /// # Safety
+  /// If `i` is out of bounds, Undefined Behaviour results.
+  bool get_unchecked(::sus::marker::UnsafeFnMarker,
+                     usize i) const& noexcept {
+    const u64& w = words_.get_unchecked(::sus::marker::unsafe_fn,
+                                        __private::word_index(i));
+    return (w & __private::bit_mask(i)) != 0u;
+  }
+
+  /// Sets the bit at index `i` to `value`.
+  ///
+  /// # Panics
+  /// The function will panic if `i` is out of bounds.
+  void set(usize i, bool value) & noexcept {
+    ::sus::check(i < len_);
+    u64& w = words_.get_unchecked_mut(::sus::marker::unsafe_fn,
+                                      __private::word_index(i));
+    if (value)
+      w |= __private::bit_mask(i);
+    else
+      w &= ~__private::bit_mask(i);
+  }
+
+  /// Appends a bit to the end of the BitVec.
+  void push(bool value) noexcept {
+    if (size_t{len_} % __private::kBitsPerWord == 0u) words_.push(u64(0u));
+    len_ += 1u;
+    if (value) set(len_ - 1u, true);
+  }
+
+  /// Removes the last bit from the BitVec and returns it, or None if it is
+  /// empty.
+  Option<bool> pop() noexcept {
+    if (len_ == 0u) return Option<bool>::none();
+    const bool value = (*this)[len_ - 1u];
+    // Keep the bits past `len_` as zero.
+    set(len_ - 1u, false);
+    len_ -= 1u;
+    if (size_t{len_} % __private::kBitsPerWord == 0u) words_.pop();
+    return Option<bool>::some(value);
+  }
+
+  /// Changes the length of the BitVec to `len`. New bits are set to `value`.
+  void resize(usize len, bool value) noexcept {
+    const auto words = usize(__private::words_for_bits(size_t{len}));
+    if (len < len_) {
+      // SAFETY: The words are `u64`, which need no destruction.
+      words_.set_len(::sus::marker::unsafe_fn, words);
+    } else {
+      // Set the unused bits of the last word, which are zero.
+      if (value && !words_.is_empty())
+        words_[words_.len() - 1u] |= ~__private::last_word_mask(len_);
+      words_.reserve(words - words_.len());
+      while (words_.len() < words) words_.push(value ? u64::MAX : u64(0u));
+    }
+    len_ = len;
+    // Keep the bits past `len_` as zero.
+    if (!words_.is_empty())
+      words_[words_.len() - 1u] &= __private::last_word_mask(len_);
+  }
+
+  /// Removes all the bits, without releasing the memory.
+  void clear() noexcept {
+    words_.clear();
+    len_ = 0u;
+  }
+
+  /// Returns the number of set bits.
+  usize count_ones() const& noexcept {
+    return __private::count_ones(words_.as_slice());
+  }
+  /// Returns the number of unset bits.
+  usize count_zeros() const& noexcept { return len_ - count_ones(); }
+  /// Returns true if any bit is set.
+  bool any() const& noexcept {
+    return __private::any(words_.as_slice());
+  }
+  /// Returns true if every bit is set. This is true if the BitVec is empty.
+  bool all() const& noexcept { return count_ones() == len_; }
+
+  /// Returns the number of set bits before index `i`.
+  ///
+  /// # Panics
+  /// The function will panic if `i` is greater than `len()`.
+  usize rank(usize i) const& noexcept {
+    ::sus::check(i <= len_);
+    return __private::rank(words_.as_slice(), i);
+  }
+
+  /// Returns the index of the set bit which has `k` set bits before it, or
+  /// None if there are not more than `k` set bits.
+  ///
+  /// This is the inverse of `rank()`: for a set bit at index `i`,
+  /// `select(rank(i)) == i`.
+  Option<usize> select(usize k) const& noexcept {
+    return __private::select(words_.as_slice(), k);
+  }
+
+  /// Flips every bit.
+  void flip_all() & noexcept {
+    __private::flip_words(words_.as_mut_slice(), len_);
+  }
+
+  /// Sets each bit to the logical AND of itself and the same bit in `o`.
+  ///
+  /// # Panics
+  /// The function will panic if the BitVecs have different lengths.
+  void operator&=(const BitVec& o) & noexcept {
+    ::sus::check(len_ == o.len_);
+    __private::and_words(words_.as_mut_slice(), o.words_.as_slice());
+  }
+  /// Sets each bit to the logical OR of itself and the same bit in `o`.
+  ///
+  /// # Panics
+  /// The function will panic if the BitVecs have different lengths.
+  void operator|=(const BitVec& o) & noexcept {
+    ::sus::check(len_ == o.len_);
+    __private::or_words(words_.as_mut_slice(), o.words_.as_slice());
+  }
+  /// Sets each bit to the logical XOR of itself and the same bit in `o`.
+  ///
+  /// # Panics
+  /// The function will panic if the BitVecs have different lengths.
+  void operator^=(const BitVec& o) & noexcept {
+    ::sus::check(len_ == o.len_);
+    __private::xor_words(words_.as_mut_slice(), o.words_.as_slice());
+  }
+
+  /// Returns an iterator over the indices of the set bits, in increasing
+  /// order.
+  IterOnes iter_ones() const& noexcept sus_lifetimebound {
+    return IterOnes::with(words_.as_slice());
+  }
+  IterOnes iter_ones() && = delete;
+
+  /// Returns the words holding the bits. Bit `i` is bit `i % 64` of word
+  /// `i / 64`, and the bits past `len()` in the last word are always zero.
+  Slice<u64> as_words() const& noexcept sus_lifetimebound {
+    return words_.as_slice();
+  }
+  Slice<u64> as_words() && = delete;
+
+  /// sus::ops::Eq<BitVec> trait.
+  friend bool operator==(const BitVec& l, const BitVec& r) noexcept {
+    return l.len_ == r.len_ && l.words_ == r.words_;
+  }
+
+ private:
+  BitVec(Vec<u64> words, usize len) noexcept
+      : words_(::sus::move(words)), len_(len) {}
+
+  Vec<u64> words_;
+  usize len_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(words_),
+                                  decltype(len_));
+};
+
+}  // namespace sus::containers
+
+// Promote BitVec into the `sus` namespace.
+namespace sus {
+using ::sus::containers::BitVec;
+}  // namespace sus
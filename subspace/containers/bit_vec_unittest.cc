@@ -0,0 +1,159 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/containers/bit_vec.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::containers::BitVec;
+
+TEST(BitVec, Empty) {
+  auto v = BitVec();
+  EXPECT_EQ(v.len(), 0u);
+  EXPECT_TRUE(v.is_empty());
+  EXPECT_EQ(v.count_ones(), 0u);
+  EXPECT_FALSE(v.any());
+  EXPECT_TRUE(v.all());
+  EXPECT_TRUE(v.get(0u).is_none());
+  EXPECT_TRUE(v.pop().is_none());
+  EXPECT_TRUE(v.iter_ones().next().is_none());
+}
+
+TEST(BitVec, PushPop) {
+  auto v = BitVec();
+  for (usize i; i < 130u; i += 1u) v.push(i % 3u == 0u);
+  EXPECT_EQ(v.len(), 130u);
+  EXPECT_EQ(v.as_words().len(), 3u);
+  EXPECT_EQ(v.count_ones(), 44u);
+  EXPECT_EQ(v[0u], true);
+  EXPECT_EQ(v[1u], false);
+  EXPECT_EQ(v[129u], true);
+  EXPECT_EQ(v.get(129u), sus::some(true));
+  EXPECT_TRUE(v.get(130u).is_none());
+
+  EXPECT_EQ(v.pop(), sus::some(true));
+  EXPECT_EQ(v.pop(), sus::some(false));
+  EXPECT_EQ(v.len(), 128u);
+  EXPECT_EQ(v.as_words().len(), 2u);
+  EXPECT_EQ(v.count_ones(), 43u);
+}
+
+TEST(BitVec, Set) {
+  auto v = BitVec::with_len(100u);
+  EXPECT_EQ(v.count_zeros(), 100u);
+  v.set(3u, true);
+  v.set(64u, true);
+  v.set(99u, true);
+  EXPECT_EQ(v.count_ones(), 3u);
+  EXPECT_TRUE(v.any());
+  v.set(64u, false);
+  EXPECT_EQ(v.count_ones(), 2u);
+  EXPECT_EQ(v[64u], false);
+  EXPECT_EQ(v[99u], true);
+}
+
+TEST(BitVec, Resize) {
+  auto v = BitVec::with_len(10u);
+  v.resize(70u, true);
+  EXPECT_EQ(v.len(), 70u);
+  EXPECT_EQ(v.count_ones(), 60u);
+  EXPECT_EQ(v[9u], false);
+  EXPECT_EQ(v[10u], true);
+  v.resize(5u, true);
+  EXPECT_EQ(v.count_ones(), 0u);
+  v.resize(64u, true);
+  EXPECT_EQ(v.count_ones(), 59u);
+  EXPECT_EQ(v.as_words()[0u], u64::MAX << 5u);
+  v.clear();
+  EXPECT_TRUE(v.is_empty());
+}
+
+TEST(BitVec, FlipAll) {
+  auto v = BitVec::with_len(70u);
+  v.set(1u, true);
+  v.flip_all();
+  EXPECT_EQ(v.count_ones(), 69u);
+  EXPECT_EQ(v[1u], false);
+  EXPECT_TRUE(!v.all());
+  // Bits past the end stay unset.
+  EXPECT_EQ(v.as_words()[1u], 0x3Fu);
+  v.set(1u, true);
+  EXPECT_TRUE(v.all());
+}
+
+TEST(BitVec, WordOps) {
+  auto a = BitVec::with_len(100u);
+  auto b = BitVec::with_len(100u);
+  a.set(1u, true);
+  a.set(70u, true);
+  b.set(70u, true);
+  b.set(99u, true);
+
+  auto c = a.clone();
+  c &= b;
+  EXPECT_EQ(sus::Vec<usize>::from_iter(c.iter_ones()),
+            sus::Vec<usize>::with_values(70u));
+  c = a.clone();
+  c |= b;
+  EXPECT_EQ(sus::Vec<usize>::from_iter(c.iter_ones()),
+            sus::Vec<usize>::with_values(1u, 70u, 99u));
+  c = a.clone();
+  c ^= b;
+  EXPECT_EQ(sus::Vec<usize>::from_iter(c.iter_ones()),
+            sus::Vec<usize>::with_values(1u, 99u));
+  EXPECT_EQ(a, a.clone());
+  EXPECT_NE(a, b);
+}
+
+TEST(BitVec, IterOnes) {
+  auto v = BitVec::with_len(300u);
+  v.set(0u, true);
+  v.set(63u, true);
+  v.set(64u, true);
+  v.set(299u, true);
+  EXPECT_EQ(sus::Vec<usize>::from_iter(v.iter_ones()),
+            sus::Vec<usize>::with_values(0u, 63u, 64u, 299u));
+  EXPECT_EQ(v.iter_ones().count(), 4u);
+  auto it = v.iter_ones();
+  EXPECT_EQ(it.next(), sus::some(0_usize));
+  EXPECT_EQ(sus::move(it).count(), 3u);
+}
+
+TEST(BitVec, RankSelect) {
+  auto v = BitVec::with_len(200u);
+  for (usize i = 5u; i < 200u; i += 7u) v.set(i, true);
+  EXPECT_EQ(v.rank(0u), 0u);
+  EXPECT_EQ(v.rank(5u), 0u);
+  EXPECT_EQ(v.rank(6u), 1u);
+  EXPECT_EQ(v.rank(64u), 9u);
+  EXPECT_EQ(v.rank(200u), v.count_ones());
+  for (usize i : v.iter_ones()) EXPECT_EQ(v.select(v.rank(i)), sus::some(i));
+  EXPECT_EQ(v.select(0u), sus::some(5_usize));
+  EXPECT_TRUE(v.select(v.count_ones()).is_none());
+}
+
+#if GTEST_HAS_DEATH_TEST
+TEST(BitVecDeathTest, OutOfBounds) {
+  auto v = BitVec::with_len(10u);
+  EXPECT_DEATH(v.set(10u, true), "");
+  EXPECT_DEATH(bool b = v[10u], "");
+  auto w = BitVec::with_len(11u);
+  EXPECT_DEATH(v &= w, "");
+}
+#endif
+
+}  // namespace
@@ -0,0 +1,498 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/containers/__private/btree_node.h"
+#include "subspace/containers/iterators/btree_iter.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/mem/replace.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/ord.h"
+#include "subspace/ops/range.h"
+#include "subspace/option/option.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::containers {
+
+/// An ordered map from keys to values, stored in a B-tree.
+///
+/// Each node of the tree holds many keys in a contiguous array, sized to span
+/// a few cache lines, so a lookup visits a handful of nodes where a binary
+/// search tree would visit a node per comparison. Iterating the map walks the
+/// arrays of each node in turn, which makes scans over a range of keys
+/// especially cheap compared to a tree with a node per entry, such as
+/// `std::map`.
+///
+/// Unlike a `FlatMap`, `insert()` and `remove()` take logarithmic time, as
+/// they only shift the elements of a single node.
+///
+/// The keys must be `Ord`, and each key appears at most once in the map.
+///
+/// # Example
+/// ```
+/// auto m = sus::containers::BTreeMap<i32, u32>();
+/// m.insert(3, 30u);
+/// m.insert(1, 10u);
+/// m.insert(2, 20u);
+/// // Iterates over the entries with keys in 2..4.
+/// for (auto [k, v] : m.range(sus::ops::Range<i32>(2, 4))) {
+///   sus::check(v == u32::from(k) * 10u);
+/// }
+/// ```
+template <class K, class V>
+class BTreeMap final {
+  static_assert(!std::is_reference_v<K> && !std::is_reference_v<V>,
+                "References in BTreeMap are not supported.");
+
+  using Leaf = __private::BTreeLeaf<K, V>;
+  using Internal = __private::BTreeInternal<K, V>;
+  using Edge = __private::BTreeEdge<K, V>;
+
+ public:
+  /// An iterator over the entries of a BTreeMap.
+  using Iter = BTreeIter<K, V, ::sus::Tuple<const K&, const V&>>;
+  /// An iterator over the entries of a BTreeMap, with mutable values.
+  using IterMut = BTreeIter<K, V, ::sus::Tuple<const K&, V&>>;
+
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty BTreeMap, without allocating.
+  BTreeMap() noexcept = default;
+
+  ~BTreeMap() noexcept {
+    if (root_ != nullptr) __private::btree_destroy(root_);
+  }
+
+  BTreeMap(BTreeMap&& o) noexcept
+      : root_(::sus::mem::replace(mref(o.root_), nullptr)),
+        len_(::sus::mem::replace(mref(o.len_), 0_usize)) {}
+  BTreeMap& operator=(BTreeMap&& o) noexcept {
+    if (this != &o) {
+      if (root_ != nullptr) __private::btree_destroy(root_);
+      root_ = ::sus::mem::replace(mref(o.root_), nullptr);
+      len_ = ::sus::mem::replace(mref(o.len_), 0_usize);
+    }
+    return *this;
+  }
+
+  /// sus::mem::Clone trait.
+  BTreeMap clone() const& noexcept
+    requires(::sus::mem::Clone<K> && ::sus::mem::Clone<V>)
+  {
+    auto m = BTreeMap();
+    if (root_ != nullptr) m.root_ = __private::btree_clone(root_);
+    m.len_ = len_;
+    return m;
+  }
+
+  /// Returns the number of entries in the map.
+  usize len() const& noexcept { return len_; }
+  /// Returns true if the map has no entries.
+  bool is_empty() const& noexcept { return len_ == 0u; }
+
+  /// Removes all entries, and frees the tree.
+  void clear() noexcept {
+    if (root_ != nullptr) __private::btree_destroy(root_);
+    root_ = nullptr;
+    len_ = 0u;
+  }
+
+  /// Returns true if the map has an entry for `key`.
+  bool contains_key(const K& key) const& noexcept {
+    return find(key).is_some();
+  }
+
+  /// Returns a reference to the value for `key`, or None if there is no entry
+  /// for `key`.
+  Option<const V&> get(const K& key) const& noexcept {
+    return find(key).map([](__private::BTreeKVHandle<K, V> kv) -> const V& {
+      return kv.node->vals[kv.idx];
+    });
+  }
+  Option<const V&> get(const K& key) && = delete;
+
+  /// Returns a mutable reference to the value for `key`, or None if there is
+  /// no entry for `key`.
+  Option<V&> get_mut(const K& key) & noexcept {
+    return find(key).map([](__private::BTreeKVHandle<K, V> kv) -> V& {
+      return kv.node->vals[kv.idx];
+    });
+  }
+
+  /// Returns the entry with the smallest key, or None if the map is empty.
+  Option<::sus::Tuple<const K&, const V&>> first_key_value() const& noexcept {
+    if (root_ == nullptr)
+      return Option<::sus::Tuple<const K&, const V&>>::none();
+    Leaf* n = __private::btree_first_leaf_edge(root_).node;
+    return Option<::sus::Tuple<const K&, const V&>>::some(
+        ::sus::Tuple<const K&, const V&>::with(n->keys[0u], n->vals[0u]));
+  }
+  Option<::sus::Tuple<const K&, const V&>> first_key_value() && = delete;
+
+  /// Returns the entry with the largest key, or None if the map is empty.
+  Option<::sus::Tuple<const K&, const V&>> last_key_value() const& noexcept {
+    if (root_ == nullptr)
+      return Option<::sus::Tuple<const K&, const V&>>::none();
+    Leaf* n = __private::btree_last_leaf_edge(root_).node;
+    return Option<::sus::Tuple<const K&, const V&>>::some(
+        ::sus::Tuple<const K&, const V&>::with(n->keys[n->len - 1u],
+                                               n->vals[n->len - 1u]));
+  }
+  Option<::sus::Tuple<const K&, const V&>> last_key_value() && = delete;
+
+  /// Inserts `value` for `key`.
+  ///
+  /// If there was already an entry for `key`, its value is replaced and the
+  /// old value is returned. Otherwise None is returned.
+  Option<V> insert(K key, V value) noexcept {
+    if (root_ == nullptr) {
+      root_ = new Leaf();
+      __private::btree_insert_kv(root_, 0u, ::sus::move(key),
+                                 ::sus::move(value));
+      len_ = 1u;
+      return Option<V>::none();
+    }
+    Leaf* n = root_;
+    while (true) {
+      const size_t i = __private::btree_lower_bound(n, key);
+      if (i < n->len && !(key < n->keys[i])) {
+        return Option<V>::some(
+            ::sus::mem::replace(mref(n->vals[i]), ::sus::move(value)));
+      }
+      if (!n->internal) {
+        insert_recursing(n, i, ::sus::move(key), ::sus::move(value));
+        len_ += 1u;
+        return Option<V>::none();
+      }
+      n = __private::as_internal(n)->edges[i];
+    }
+  }
+
+  /// Removes the entry for `key`, returning its value, or None if there was no
+  /// entry for `key`.
+  Option<V> remove(const K& key) noexcept {
+    Option<__private::BTreeKVHandle<K, V>> found = find(key);
+    if (found.is_none()) return Option<V>::none();
+    auto [n, i] = ::sus::move(found).unwrap();
+    len_ -= 1u;
+    if (!n->internal) {
+      V v = __private::btree_take_kv(n, i).val;
+      rebalance(n);
+      return Option<V>::some(::sus::move(v));
+    }
+    // Replace the entry with its predecessor, which is always in a leaf, and
+    // remove that from the leaf instead.
+    Leaf* leaf = __private::btree_last_leaf_edge(
+                     __private::as_internal(n)->edges[i])
+                     .node;
+    auto pred = __private::btree_take_kv(leaf, leaf->len - 1u);
+    n->keys[i] = ::sus::move(pred.key);
+    V v = ::sus::mem::replace(mref(n->vals[i]), ::sus::move(pred.val));
+    rebalance(leaf);
+    return Option<V>::some(::sus::move(v));
+  }
+
+  /// Returns an iterator over `Tuple<const K&, const V&>` for each entry, in
+  /// increasing order of the keys.
+  Iter iter() const& noexcept sus_lifetimebound {
+    return Iter(full_front(), full_back(), len_, true);
+  }
+  Iter iter() && = delete;
+
+  /// Returns an iterator over `Tuple<const K&, V&>` for each entry, in
+  /// increasing order of the keys.
+  IterMut iter_mut() & noexcept sus_lifetimebound {
+    return IterMut(full_front(), full_back(), len_, true);
+  }
+
+  /// Returns an iterator over `Tuple<const K&, const V&>` for the entries with
+  /// keys in `range`, in increasing order of the keys.
+  ///
+  /// Finding the ends of the range takes logarithmic time, and then each step
+  /// of the iterator, in either direction, takes amortized constant time.
+  ///
+  /// # Example
+  /// ```
+  /// // All entries with keys in 10..20.
+  /// m.range(sus::ops::Range<i32>(10, 20));
+  /// // All entries with keys of at least 10.
+  /// m.range(sus::ops::RangeFrom<i32>(10));
+  /// ```
+  Iter range(const ::sus::ops::RangeBounds<K> auto& range) const& noexcept
+      sus_lifetimebound {
+    auto [front, back] = range_edges(range);
+    return Iter(front, back, len_, false);
+  }
+  Iter range(const ::sus::ops::RangeBounds<K> auto& range) && = delete;
+
+  /// Returns an iterator over `Tuple<const K&, V&>` for the entries with keys
+  /// in `range`, in increasing order of the keys.
+  IterMut range_mut(const ::sus::ops::RangeBounds<K> auto& range) & noexcept
+      sus_lifetimebound {
+    auto [front, back] = range_edges(range);
+    return IterMut(front, back, len_, false);
+  }
+
+  /// sus::ops::Eq<BTreeMap<K, V>> trait.
+  friend bool operator==(const BTreeMap& l, const BTreeMap& r) noexcept
+    requires(::sus::ops::Eq<K> && ::sus::ops::Eq<V>)
+  {
+    if (l.len_ != r.len_) return false;
+    auto ri = r.iter();
+    for (auto [lk, lv] : l.iter()) {
+      auto [rk, rv] = ri.next().unwrap();
+      if (!(lk == rk && lv == rv)) return false;
+    }
+    return true;
+  }
+
+ private:
+  template <class>
+  friend class BTreeSet;
+
+  static_assert(::sus::ops::Ord<K>, "BTreeMap keys must be Ord.");
+
+  Option<__private::BTreeKVHandle<K, V>> find(const K& key) const noexcept {
+    Leaf* n = root_;
+    while (n != nullptr) {
+      const size_t i = __private::btree_lower_bound(n, key);
+      if (i < n->len && !(key < n->keys[i])) {
+        return Option<__private::BTreeKVHandle<K, V>>::some(
+            __private::BTreeKVHandle<K, V>(n, i));
+      }
+      n = n->internal ? __private::as_internal(n)->edges[i] : nullptr;
+    }
+    return Option<__private::BTreeKVHandle<K, V>>::none();
+  }
+
+  Edge full_front() const noexcept {
+    if (root_ == nullptr) return Edge(nullptr, 0u);
+    return __private::btree_first_leaf_edge(root_);
+  }
+  Edge full_back() const noexcept {
+    if (root_ == nullptr) return Edge(nullptr, 0u);
+    return __private::btree_last_leaf_edge(root_);
+  }
+
+  template <class R>
+  ::sus::Tuple<Edge, Edge> range_edges(const R& range) const noexcept {
+    Option<const K&> start = range.start_bound();
+    Option<const K&> end = range.end_bound();
+    if (root_ == nullptr ||
+        (start.is_some() && end.is_some() && !(*start < *end))) {
+      return ::sus::Tuple<Edge, Edge>::with(Edge(nullptr, 0u),
+                                            Edge(nullptr, 0u));
+    }
+    Edge front = start.is_some()
+                     ? __private::btree_lower_bound_edge(root_, *start)
+                     : full_front();
+    Edge back = end.is_some()
+                    ? __private::btree_lower_bound_edge(root_, *end)
+                    : full_back();
+    return ::sus::Tuple<Edge, Edge>::with(front, back);
+  }
+
+  /// Inserts into a node, splitting it and its ancestors as needed to make
+  /// room. `right_edge` is the child to the right of the new key, in an
+  /// internal node.
+  void insert_recursing(Leaf* n, size_t idx, K&& key, V&& value,
+                        Leaf* right_edge = nullptr) noexcept {
+    while (true) {
+      if (n->len < Leaf::kCapacity) {
+        insert_fit(n, idx, ::sus::move(key), ::sus::move(value), right_edge);
+        return;
+      }
+      // Split the node in half around its middle key, which moves up into the
+      // parent with the new right half as the edge to its right.
+      constexpr size_t kMid = Leaf::kB - 1u;
+      Leaf* right = n->internal ? static_cast<Leaf*>(new Internal())
+                                : new Leaf();
+      const size_t right_len = n->len - kMid - 1u;
+      __private::btree_move_elements(n->keys + kMid + 1u, right->keys,
+                                     right_len);
+      __private::btree_move_elements(n->vals + kMid + 1u, right->vals,
+                                     right_len);
+      if (n->internal) {
+        for (size_t i = 0u; i <= right_len; ++i) {
+          __private::as_internal(right)->edges[i] =
+              __private::as_internal(n)->edges[kMid + 1u + i];
+        }
+      }
+      right->len = static_cast<uint16_t>(right_len);
+      n->len = static_cast<uint16_t>(kMid + 1u);
+      auto mid = __private::btree_take_kv(n, kMid);
+      if (n->internal)
+        __private::btree_correct_children(__private::as_internal(right), 0u,
+                                          right_len);
+
+      if (idx <= kMid) {
+        insert_fit(n, idx, ::sus::move(key), ::sus::move(value), right_edge);
+      } else {
+        insert_fit(right, idx - kMid - 1u, ::sus::move(key),
+                   ::sus::move(value), right_edge);
+      }
+
+      if (n->parent == nullptr) {
+        auto* new_root = new Internal();
+        __private::btree_insert_kv(static_cast<Leaf*>(new_root), 0u,
+                                   ::sus::move(mid.key), ::sus::move(mid.val));
+        new_root->edges[0u] = n;
+        new_root->edges[1u] = right;
+        __private::btree_correct_children(new_root, 0u, 1u);
+        root_ = new_root;
+        return;
+      }
+      idx = n->parent_idx;
+      n = n->parent;
+      key = ::sus::move(mid.key);
+      value = ::sus::move(mid.val);
+      right_edge = right;
+    }
+  }
+
+  static void insert_fit(Leaf* n, size_t idx, K&& key, V&& value,
+                         Leaf* right_edge) noexcept {
+    __private::btree_insert_kv(n, idx, ::sus::move(key), ::sus::move(value));
+    if (n->internal) {
+      Internal* in = __private::as_internal(n);
+      for (size_t i = n->len; i > idx + 1u; --i)
+        in->edges[i] = in->edges[i - 1u];
+      in->edges[idx + 1u] = right_edge;
+      __private::btree_correct_children(in, idx + 1u, n->len);
+    }
+  }
+
+  /// Restores the minimum length of `n` after a removal, by taking a key from
+  /// a sibling or merging with it, and then fixes up its ancestors.
+  void rebalance(Leaf* n) noexcept {
+    while (n->parent != nullptr && n->len < Leaf::kMinLen) {
+      Internal* parent = n->parent;
+      const size_t i = n->parent_idx;
+      if (i > 0u && parent->edges[i - 1u]->len > Leaf::kMinLen) {
+        steal_left(parent, i);
+        return;
+      }
+      if (i < parent->len && parent->edges[i + 1u]->len > Leaf::kMinLen) {
+        steal_right(parent, i);
+        return;
+      }
+      merge(parent, i > 0u ? i - 1u : i);
+      n = parent;
+    }
+    if (root_->len == 0u) {
+      Leaf* old_root = root_;
+      if (old_root->internal) {
+        root_ = __private::as_internal(old_root)->edges[0u];
+        root_->parent = nullptr;
+        root_->parent_idx = 0u;
+      } else {
+        root_ = nullptr;
+      }
+      __private::btree_free_node(old_root);
+    }
+  }
+
+  /// Rotates the last key of `parent->edges[i - 1]` through the parent into
+  /// the front of `parent->edges[i]`.
+  static void steal_left(Internal* parent, size_t i) noexcept {
+    Leaf* n = parent->edges[i];
+    Leaf* left = parent->edges[i - 1u];
+    auto kv = __private::btree_take_kv(left, left->len - 1u);
+    auto pk = ::sus::mem::replace(mref(parent->keys[i - 1u]),
+                                  ::sus::move(kv.key));
+    auto pv = ::sus::mem::replace(mref(parent->vals[i - 1u]),
+                                  ::sus::move(kv.val));
+    if (n->internal) {
+      Internal* in = __private::as_internal(n);
+      for (size_t e = n->len + 1u; e > 0u; --e)
+        in->edges[e] = in->edges[e - 1u];
+      in->edges[0u] = __private::as_internal(left)->edges[left->len + 1u];
+    }
+    __private::btree_insert_kv(n, 0u, ::sus::move(pk), ::sus::move(pv));
+    if (n->internal)
+      __private::btree_correct_children(__private::as_internal(n), 0u, n->len);
+  }
+
+  /// Rotates the first key of `parent->edges[i + 1]` through the parent onto
+  /// the end of `parent->edges[i]`.
+  static void steal_right(Internal* parent, size_t i) noexcept {
+    Leaf* n = parent->edges[i];
+    Leaf* right = parent->edges[i + 1u];
+    auto kv = __private::btree_take_kv(right, 0u);
+    auto pk = ::sus::mem::replace(mref(parent->keys[i]), ::sus::move(kv.key));
+    auto pv = ::sus::mem::replace(mref(parent->vals[i]), ::sus::move(kv.val));
+    __private::btree_insert_kv(n, n->len, ::sus::move(pk), ::sus::move(pv));
+    if (n->internal) {
+      Internal* in = __private::as_internal(n);
+      Internal* rin = __private::as_internal(right);
+      in->edges[n->len] = rin->edges[0u];
+      __private::btree_correct_children(in, n->len, n->len);
+      for (size_t e = 0u; e <= right->len; ++e)
+        rin->edges[e] = rin->edges[e + 1u];
+      __private::btree_correct_children(rin, 0u, right->len);
+    }
+  }
+
+  /// Merges `parent->edges[i + 1]` and the key between them into
+  /// `parent->edges[i]`.
+  static void merge(Internal* parent, size_t i) noexcept {
+    Leaf* left = parent->edges[i];
+    Leaf* right = parent->edges[i + 1u];
+    auto kv = __private::btree_take_kv(static_cast<Leaf*>(parent), i);
+    for (size_t e = i + 1u; e <= parent->len; ++e)
+      parent->edges[e] = parent->edges[e + 1u];
+    if (i + 1u <= parent->len)
+      __private::btree_correct_children(parent, i + 1u, parent->len);
+
+    const size_t left_len = left->len;
+    __private::btree_insert_kv(left, left_len, ::sus::move(kv.key),
+                               ::sus::move(kv.val));
+    __private::btree_move_elements(right->keys, left->keys + left_len + 1u,
+                                   right->len);
+    __private::btree_move_elements(right->vals, left->vals + left_len + 1u,
+                                   right->len);
+    left->len += right->len;
+    if (left->internal) {
+      Internal* lin = __private::as_internal(left);
+      Internal* rin = __private::as_internal(right);
+      for (size_t e = 0u; e <= right->len; ++e)
+        lin->edges[left_len + 1u + e] = rin->edges[e];
+      __private::btree_correct_children(lin, left_len + 1u, left->len);
+    }
+    right->len = 0u;
+    __private::btree_free_node(right);
+  }
+
+  Leaf* root_ = nullptr;
+  usize len_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(root_),
+                                  decltype(len_));
+};
+
+}  // namespace sus::containers
+
+// Promote BTreeMap into the `sus` namespace.
+namespace sus {
+using ::sus::containers::BTreeMap;
+}  // namespace sus
@@ -0,0 +1,269 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/containers/btree_map.h"
+
+#include <map>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::containers::BTreeMap;
+
+TEST(BTreeMap, InsertGet) {
+  auto m = BTreeMap<i32, u32>();
+  EXPECT_TRUE(m.is_empty());
+  EXPECT_TRUE(m.get(1).is_none());
+  EXPECT_TRUE(m.insert(3, 30u).is_none());
+  EXPECT_TRUE(m.insert(1, 10u).is_none());
+  EXPECT_TRUE(m.insert(2, 20u).is_none());
+  EXPECT_EQ(m.len(), 3u);
+  EXPECT_EQ(m.insert(2, 22u), sus::some(20_u32));
+  EXPECT_EQ(m.len(), 3u);
+
+  EXPECT_EQ(m.get(1).unwrap(), 10u);
+  EXPECT_EQ(m.get(2).unwrap(), 22u);
+  EXPECT_TRUE(m.get(4).is_none());
+  EXPECT_TRUE(m.contains_key(3));
+  EXPECT_FALSE(m.contains_key(0));
+  m.get_mut(3).unwrap() += 1u;
+  EXPECT_EQ(m.get(3).unwrap(), 31u);
+}
+
+TEST(BTreeMap, Remove) {
+  auto m = BTreeMap<i32, u32>();
+  m.insert(1, 10u);
+  m.insert(2, 20u);
+  EXPECT_EQ(m.remove(2), sus::some(20_u32));
+  EXPECT_TRUE(m.remove(2).is_none());
+  EXPECT_EQ(m.remove(1), sus::some(10_u32));
+  EXPECT_TRUE(m.is_empty());
+  EXPECT_TRUE(m.iter().next().is_none());
+  m.insert(5, 50u);
+  EXPECT_EQ(m.len(), 1u);
+}
+
+TEST(BTreeMap, FirstLast) {
+  auto m = BTreeMap<i32, u32>();
+  EXPECT_TRUE(m.first_key_value().is_none());
+  for (i32 i = 0; i < 1000; i += 1) m.insert(i, u32::from(i));
+  auto [first_k, first_v] = m.first_key_value().unwrap();
+  EXPECT_EQ(first_k, 0);
+  auto [last_k, last_v] = m.last_key_value().unwrap();
+  EXPECT_EQ(last_k, 999);
+  EXPECT_EQ(last_v, 999u);
+}
+
+TEST(BTreeMap, Iter) {
+  auto m = BTreeMap<i32, u32>();
+  for (i32 i = 999; i >= 0; i -= 1) m.insert(i, u32::from(i) * 2u);
+  i32 expect = 0;
+  for (auto [k, v] : m.iter()) {
+    EXPECT_EQ(k, expect);
+    EXPECT_EQ(v, u32::from(k) * 2u);
+    expect += 1;
+  }
+  EXPECT_EQ(expect, 1000);
+
+  auto it = m.iter();
+  EXPECT_EQ(it.size_hint().lower, 1000u);
+  auto [back_k, back_v] = it.next_back().unwrap();
+  EXPECT_EQ(back_k, 999);
+  auto [front_k, front_v] = it.next().unwrap();
+  EXPECT_EQ(front_k, 0);
+  EXPECT_EQ(it.size_hint().lower, 998u);
+  auto [rev_k, rev_v] = sus::move(it).rev().next().unwrap();
+  EXPECT_EQ(rev_k, 998);
+
+  for (auto [k, v] : m.iter_mut()) v += 1u;
+  EXPECT_EQ(m.get(10).unwrap(), 21u);
+}
+
+TEST(BTreeMap, Range) {
+  auto m = BTreeMap<i32, u32>();
+  for (i32 i = 0; i < 1000; i += 2) m.insert(i, u32::from(i));
+
+  auto keys = [](auto it) {
+    auto v = sus::Vec<i32>();
+    for (auto [k, _] : it) v.push(k);
+    return v;
+  };
+  EXPECT_EQ(keys(m.range(sus::ops::Range<i32>(10, 17))),
+            sus::Vec<i32>::with_values(10, 12, 14, 16));
+  EXPECT_EQ(keys(m.range(sus::ops::Range<i32>(9, 16))),
+            sus::Vec<i32>::with_values(10, 12, 14));
+  EXPECT_EQ(keys(m.range(sus::ops::RangeFrom<i32>(993))),
+            sus::Vec<i32>::with_values(994, 996, 998));
+  EXPECT_EQ(keys(m.range(sus::ops::RangeTo<i32>(5))),
+            sus::Vec<i32>::with_values(0, 2, 4));
+  EXPECT_EQ(m.range(sus::ops::RangeFull<i32>()).count(), 500u);
+  EXPECT_EQ(m.range(sus::ops::Range<i32>(11, 12)).count(), 0u);
+  EXPECT_EQ(m.range(sus::ops::Range<i32>(20, 10)).count(), 0u);
+  EXPECT_EQ(m.range(sus::ops::RangeFrom<i32>(1000)).count(), 0u);
+  auto empty = BTreeMap<i32, u32>();
+  EXPECT_EQ(empty.range(sus::ops::Range<i32>(0, 1)).count(), 0u);
+
+  // A range meets in the middle when iterated from both ends.
+  auto r = m.range(sus::ops::Range<i32>(100, 600));
+  auto back = sus::Vec<i32>();
+  auto front = sus::Vec<i32>();
+  while (true) {
+    auto b = r.next_back();
+    if (b.is_none()) break;
+    auto [bk, bv] = sus::move(b).unwrap();
+    back.push(bk);
+    auto f = r.next();
+    if (f.is_none()) break;
+    auto [fk, fv] = sus::move(f).unwrap();
+    front.push(fk);
+  }
+  EXPECT_EQ(front.len() + back.len(), 250u);
+  EXPECT_EQ(front[0u], 100);
+  EXPECT_EQ(back[0u], 598);
+  EXPECT_EQ(front[front.len() - 1u] + 2, back[back.len() - 1u]);
+
+  for (auto [k, v] : m.range_mut(sus::ops::RangeFrom<i32>(500))) v = 0u;
+  EXPECT_EQ(m.get(498).unwrap(), 498u);
+  EXPECT_EQ(m.get(500).unwrap(), 0u);
+}
+
+// A type that can't be relocated by memcpy, to check the element-wise moves
+// when nodes are shifted, split and merged.
+struct Tracked {
+  Tracked(i32 i) : i(i) {}
+  Tracked(Tracked&& o) : i(o.i) { o.i = -1; }
+  Tracked& operator=(Tracked&& o) {
+    i = o.i;
+    o.i = -1;
+    return *this;
+  }
+  Tracked clone() const { return Tracked(i); }
+  bool operator==(const Tracked& o) const noexcept { return i == o.i; }
+  std::strong_ordering operator<=>(const Tracked& o) const noexcept {
+    return i <=> o.i;
+  }
+  i32 i;
+};
+
+// A key large enough to get the smallest nodes, so that the tree is deep.
+struct Big {
+  Big(i32 i) : i(i) {}
+  bool operator==(const Big& o) const noexcept { return i == o.i; }
+  std::strong_ordering operator<=>(const Big& o) const noexcept {
+    return i <=> o.i;
+  }
+  i32 i;
+  char padding[124];
+};
+static_assert(sus::containers::__private::BTreeLeaf<Big, i32>::kB == 3u);
+
+i32 as_i32(i32 i) { return i; }
+i32 as_i32(const Tracked& t) { return t.i; }
+i32 as_i32(const Big& b) { return b.i; }
+static_assert(!sus::mem::relocate_by_memcpy<Tracked>);
+
+template <class K, class V>
+void check_matches(const BTreeMap<K, V>& m, const std::map<i32, i32>& s) {
+  ASSERT_EQ(m.len(), s.size());
+  auto it = s.begin();
+  for (auto [k, v] : m.iter()) {
+    ASSERT_EQ(as_i32(k), it->first);
+    ASSERT_EQ(as_i32(v), it->second);
+    ++it;
+  }
+  auto rit = s.rbegin();
+  auto rev = m.iter();
+  while (true) {
+    auto o = rev.next_back();
+    if (o.is_none()) break;
+    auto [k, v] = sus::move(o).unwrap();
+    ASSERT_EQ(as_i32(k), rit->first);
+    ++rit;
+  }
+  ASSERT_EQ(rit, s.rend());
+}
+
+template <class K, class V>
+void random_ops(u32 n) {
+  auto m = BTreeMap<K, V>();
+  std::map<i32, i32> s;
+  u32 state = 12345u;
+  auto rand = [&]() {
+    state = state.wrapping_mul(1103515245u).wrapping_add(12345u);
+    return i32::from((state >> 8u) % 2000u);
+  };
+  for (u32 i = 0u; i < n; i += 1u) {
+    const i32 k = rand();
+    const i32 v = rand();
+    if (rand() % 3 == 0) {
+      auto r = m.remove(K(k));
+      auto sit = s.find(k);
+      ASSERT_EQ(r.is_some(), sit != s.end());
+      if (sit != s.end()) {
+        ASSERT_EQ(as_i32(sus::move(r).unwrap()), sit->second);
+        s.erase(sit);
+      }
+    } else {
+      auto r = m.insert(K(k), V(v));
+      ASSERT_EQ(r.is_some(), s.contains(k));
+      s[k] = v;
+    }
+  }
+  check_matches(m, s);
+  auto c = m.clone();
+  EXPECT_EQ(c, m);
+  const std::map<i32, i32> snapshot = s;
+  // Drain the map in a shuffled order to exercise merging down to an empty
+  // tree.
+  while (!s.empty()) {
+    auto sit = s.lower_bound(rand());
+    if (sit == s.end()) sit = s.begin();
+    ASSERT_TRUE(m.remove(K(sit->first)).is_some());
+    s.erase(sit);
+  }
+  EXPECT_TRUE(m.is_empty());
+  check_matches(c, snapshot);
+}
+
+TEST(BTreeMap, RandomOps) { random_ops<i32, i32>(20000u); }
+
+TEST(BTreeMap, RandomOpsNotRelocatable) {
+  random_ops<Tracked, Tracked>(20000u);
+}
+
+TEST(BTreeMap, RandomOpsDeep) { random_ops<Big, i32>(20000u); }
+
+TEST(BTreeMap, Clone) {
+  auto m = BTreeMap<i32, sus::Vec<i32>>();
+  m.insert(1, sus::Vec<i32>::with_values(1, 2));
+  auto c = m.clone();
+  EXPECT_EQ(c, m);
+  c.get_mut(1).unwrap().push(3);
+  EXPECT_NE(c, m);
+}
+
+TEST(BTreeMap, Move) {
+  auto m = BTreeMap<i32, i32>();
+  m.insert(1, 2);
+  auto n = sus::move(m);
+  EXPECT_EQ(n.len(), 1u);
+  m = sus::move(n);
+  EXPECT_EQ(m.get(1).unwrap(), 2);
+  m.clear();
+  EXPECT_TRUE(m.is_empty());
+}
+
+}  // namespace
@@ -0,0 +1,137 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/containers/__private/btree_node.h"
+#include "subspace/containers/btree_map.h"
+#include "subspace/containers/iterators/btree_iter.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/ord.h"
+#include "subspace/ops/range.h"
+#include "subspace/option/option.h"
+
+namespace sus::containers {
+
+/// An ordered set of keys, stored in a B-tree.
+///
+/// This is a `BTreeMap` without values, and has the same performance
+/// characteristics. See `BTreeMap` for details.
+///
+/// The keys must be `Ord`.
+template <class K>
+class BTreeSet final {
+  static_assert(!std::is_reference_v<K>,
+                "References in BTreeSet are not supported.");
+
+  using Map = BTreeMap<K, __private::BTreeSetValue>;
+
+ public:
+  /// An iterator over the keys of a BTreeSet.
+  using Iter = BTreeIter<K, __private::BTreeSetValue, const K&>;
+
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty BTreeSet, without allocating.
+  BTreeSet() noexcept = default;
+
+  BTreeSet(BTreeSet&&) = default;
+  BTreeSet& operator=(BTreeSet&&) = default;
+
+  /// sus::mem::Clone trait.
+  BTreeSet clone() const& noexcept
+    requires(::sus::mem::Clone<K>)
+  {
+    return BTreeSet(::sus::clone(map_));
+  }
+
+  /// Returns the number of keys in the set.
+  usize len() const& noexcept { return map_.len(); }
+  /// Returns true if the set has no keys.
+  bool is_empty() const& noexcept { return map_.is_empty(); }
+
+  /// Removes all keys, and frees the tree.
+  void clear() noexcept { map_.clear(); }
+
+  /// Returns true if the set contains `key`.
+  bool contains(const K& key) const& noexcept {
+    return map_.contains_key(key);
+  }
+
+  /// Returns the smallest key, or None if the set is empty.
+  Option<const K&> first() const& noexcept {
+    return map_.first_key_value().map(
+        [](::sus::Tuple<const K&, const __private::BTreeSetValue&> kv)
+            -> const K& { return kv.template at<0u>(); });
+  }
+  Option<const K&> first() && = delete;
+
+  /// Returns the largest key, or None if the set is empty.
+  Option<const K&> last() const& noexcept {
+    return map_.last_key_value().map(
+        [](::sus::Tuple<const K&, const __private::BTreeSetValue&> kv)
+            -> const K& { return kv.template at<0u>(); });
+  }
+  Option<const K&> last() && = delete;
+
+  /// Adds `key` to the set, returning true if it was not already present.
+  bool insert(K key) noexcept {
+    return map_.insert(::sus::move(key), __private::BTreeSetValue())
+        .is_none();
+  }
+
+  /// Removes `key` from the set, returning true if it was present.
+  bool remove(const K& key) noexcept { return map_.remove(key).is_some(); }
+
+  /// Returns an iterator over the keys, in increasing order.
+  Iter iter() const& noexcept sus_lifetimebound {
+    return Iter(map_.full_front(), map_.full_back(), map_.len_, true);
+  }
+  Iter iter() && = delete;
+
+  /// Returns an iterator over the keys in `range`, in increasing order.
+  Iter range(const ::sus::ops::RangeBounds<K> auto& range) const& noexcept
+      sus_lifetimebound {
+    auto [front, back] = map_.range_edges(range);
+    return Iter(front, back, map_.len_, false);
+  }
+  Iter range(const ::sus::ops::RangeBounds<K> auto& range) && = delete;
+
+  /// sus::ops::Eq<BTreeSet<K>> trait.
+  friend bool operator==(const BTreeSet& l, const BTreeSet& r) noexcept
+    requires(::sus::ops::Eq<K>)
+  {
+    return l.map_ == r.map_;
+  }
+
+ private:
+  explicit BTreeSet(Map map) noexcept : map_(::sus::move(map)) {}
+
+  Map map_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(map_));
+};
+
+}  // namespace sus::containers
+
+// Promote BTreeSet into the `sus` namespace.
+namespace sus {
+using ::sus::containers::BTreeSet;
+}  // namespace sus
@@ -0,0 +1,55 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/containers/btree_set.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::containers::BTreeSet;
+
+TEST(BTreeSet, InsertRemove) {
+  auto s = BTreeSet<i32>();
+  EXPECT_TRUE(s.first().is_none());
+  for (i32 i = 0; i < 500; i += 1) EXPECT_TRUE(s.insert(i * 3 % 500));
+  EXPECT_FALSE(s.insert(7));
+  EXPECT_EQ(s.len(), 500u);
+  EXPECT_TRUE(s.contains(499));
+  EXPECT_EQ(s.first().unwrap(), 0);
+  EXPECT_EQ(s.last().unwrap(), 499);
+  EXPECT_TRUE(s.remove(0));
+  EXPECT_FALSE(s.remove(0));
+  EXPECT_EQ(s.first().unwrap(), 1);
+}
+
+TEST(BTreeSet, Iter) {
+  auto s = BTreeSet<i32>();
+  for (i32 i = 10; i > 0; i -= 1) s.insert(i);
+  i32 expect = 1;
+  for (const i32& i : s.iter()) {
+    EXPECT_EQ(i, expect);
+    expect += 1;
+  }
+  EXPECT_EQ(s.range(sus::ops::Range<i32>(3, 6)).count(), 3u);
+  EXPECT_EQ(s.range(sus::ops::RangeFrom<i32>(3)).next_back().unwrap(), 10);
+
+  auto c = s.clone();
+  EXPECT_EQ(c, s);
+  c.remove(3);
+  EXPECT_NE(c, s);
+}
+
+}  // namespace
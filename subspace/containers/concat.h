@@ -31,7 +31,7 @@ namespace sus::containers {
 /// requires `T` to provide `concat_into(T::ConcatOutputType&)` that does the
 /// concatenation.
 ///
-/// TODO: String should satisfy Concat as well.
+/// `Str` and `String` are also `Concat`, with their output being `String`.
 template <class T>
 concept Concat = requires(const T& t, const ::sus::num::usize& cap) {
   // Concat between types of T must report their lengths.
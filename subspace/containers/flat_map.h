@@ -0,0 +1,264 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/iter/into_iterator.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/replace.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/ord.h"
+#include "subspace/option/option.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::containers {
+
+/// A map from keys to values, stored as a sorted array of keys beside an array
+/// of values.
+///
+/// Lookups are a binary search over the contiguous keys, which touches far
+/// less memory than walking the nodes of a tree, and the keys and values take
+/// no more space than two `Vec`s. The cost is that `insert()` and `remove()`
+/// shift the elements after the key, so they take linear time. This makes a
+/// FlatMap a good fit for maps which are built once, or in bulk, and then read
+/// many times.
+///
+/// To build a FlatMap in linear time, pass items already sorted by key to
+/// `from_sorted_iter()`, or combine two maps with `merge()`.
+///
+/// The keys must be `Ord`, and each key appears at most once in the map.
+///
+/// # Example
+/// ```
+/// auto m = sus::containers::FlatMap<i32, u32>();
+/// m.insert(3, 30u);
+/// m.insert(1, 10u);
+/// sus::check(m.get(3).unwrap() == 30u);
+/// sus::check(m.keys()[0u] == 1);
+/// ```
+template <class K, class V>
+class FlatMap final {
+  static_assert(!std::is_reference_v<K> && !std::is_reference_v<V>,
+                "References in FlatMap are not supported.");
+
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty FlatMap, without allocating.
+  FlatMap() noexcept = default;
+
+  /// Constructs an empty FlatMap with space for `cap` entries.
+  static FlatMap with_capacity(usize cap) noexcept {
+    return FlatMap(Vec<K>::with_capacity(cap), Vec<V>::with_capacity(cap));
+  }
+
+  /// Constructs a FlatMap from an iterator over `Tuple<K, V>` items, in linear
+  /// time.
+  ///
+  /// # Panics
+  /// The function will panic if the keys are not in strictly increasing order.
+  static FlatMap from_sorted_iter(
+      ::sus::iter::IntoIterator<::sus::Tuple<K, V>> auto&& into_iter) noexcept {
+    auto m = FlatMap();
+    for (::sus::Tuple<K, V> item : ::sus::move(into_iter).into_iter()) {
+      auto [k, v] = ::sus::move(item);
+      ::sus::check(m.keys_.is_empty() || m.keys_[m.keys_.len() - 1u] < k);
+      m.keys_.push(::sus::move(k));
+      m.values_.push(::sus::move(v));
+    }
+    return m;
+  }
+
+  FlatMap(FlatMap&&) = default;
+  FlatMap& operator=(FlatMap&&) = default;
+
+  /// sus::mem::Clone trait.
+  FlatMap clone() const& noexcept
+    requires(::sus::mem::Clone<K> && ::sus::mem::Clone<V>)
+  {
+    return FlatMap(::sus::clone(keys_), ::sus::clone(values_));
+  }
+
+  /// Returns the number of entries in the map.
+  usize len() const& noexcept { return keys_.len(); }
+  /// Returns true if the map has no entries.
+  bool is_empty() const& noexcept { return keys_.is_empty(); }
+
+  /// Removes all entries, without releasing the memory.
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+
+  /// Returns true if the map has an entry for `key`.
+  bool contains_key(const K& key) const& noexcept {
+    return keys_.binary_search(key).is_ok();
+  }
+
+  /// Returns a reference to the value for `key`, or None if there is no entry
+  /// for `key`.
+  Option<const V&> get(const K& key) const& noexcept {
+    auto r = keys_.binary_search(key);
+    if (r.is_err()) return Option<const V&>::none();
+    return Option<const V&>::some(values_.get_unchecked(
+        ::sus::marker::unsafe_fn, ::sus::move(r).unwrap()));
+  }
+  Option<const V&> get(const K& key) && = delete;
+
+  /// Returns a mutable reference to the value for `key`, or None if there is
+  /// no entry for `key`.
+  Option<V&> get_mut(const K& key) & noexcept {
+    auto r = keys_.binary_search(key);
+    if (r.is_err()) return Option<V&>::none();
+    return Option<V&>::some(values_.get_unchecked_mut(
+        ::sus::marker::unsafe_fn, ::sus::move(r).unwrap()));
+  }
+
+  /// Inserts `value` for `key`, keeping the keys sorted.
+  ///
+  /// If there was already an entry for `key`, its value is replaced and the
+  /// old value is returned. Otherwise None is returned.
+  Option<V> insert(K key, V value) noexcept {
+    auto r = keys_.binary_search(key);
+    if (r.is_ok()) {
+      V& slot = values_.get_unchecked_mut(::sus::marker::unsafe_fn,
+                                          ::sus::move(r).unwrap());
+      return Option<V>::some(
+          ::sus::mem::replace(mref(slot), ::sus::move(value)));
+    }
+    const usize at = ::sus::move(r).unwrap_err();
+    keys_.insert(at, ::sus::move(key));
+    values_.insert(at, ::sus::move(value));
+    return Option<V>::none();
+  }
+
+  /// Removes the entry for `key`, returning its value, or None if there was no
+  /// entry for `key`.
+  Option<V> remove(const K& key) noexcept {
+    auto r = keys_.binary_search(key);
+    if (r.is_err()) return Option<V>::none();
+    const usize at = ::sus::move(r).unwrap();
+    keys_.remove(at);
+    return Option<V>::some(values_.remove(at));
+  }
+
+  /// Moves all the entries of `other` into this map, in linear time.
+  ///
+  /// When both maps have an entry for the same key, the value from `other`
+  /// replaces the value in this map.
+  void merge(FlatMap other) & noexcept {
+    if (other.is_empty()) return;
+    if (is_empty()) {
+      *this = ::sus::move(other);
+      return;
+    }
+    auto keys = Vec<K>::with_capacity(len() + other.len());
+    auto values = Vec<V>::with_capacity(len() + other.len());
+    usize a;
+    usize b;
+    while (a < len() && b < other.len()) {
+      K& ka = keys_.get_unchecked_mut(::sus::marker::unsafe_fn, a);
+      K& kb = other.keys_.get_unchecked_mut(::sus::marker::unsafe_fn, b);
+      if (ka < kb) {
+        keys.push(::sus::move(ka));
+        values.push(::sus::move(
+            values_.get_unchecked_mut(::sus::marker::unsafe_fn, a)));
+        a += 1u;
+      } else {
+        // On equal keys, `other` wins and the entry in `this` is skipped.
+        if (!(kb < ka)) a += 1u;
+        keys.push(::sus::move(kb));
+        values.push(::sus::move(
+            other.values_.get_unchecked_mut(::sus::marker::unsafe_fn, b)));
+        b += 1u;
+      }
+    }
+    for (; a < len(); a += 1u) {
+      keys.push(
+          ::sus::move(keys_.get_unchecked_mut(::sus::marker::unsafe_fn, a)));
+      values.push(
+          ::sus::move(values_.get_unchecked_mut(::sus::marker::unsafe_fn, a)));
+    }
+    for (; b < other.len(); b += 1u) {
+      keys.push(::sus::move(
+          other.keys_.get_unchecked_mut(::sus::marker::unsafe_fn, b)));
+      values.push(::sus::move(
+          other.values_.get_unchecked_mut(::sus::marker::unsafe_fn, b)));
+    }
+    keys_ = ::sus::move(keys);
+    values_ = ::sus::move(values);
+  }
+
+  /// Returns the keys, in increasing order.
+  Slice<K> keys() const& noexcept sus_lifetimebound {
+    return keys_.as_slice();
+  }
+  Slice<K> keys() && = delete;
+
+  /// Returns the values, in the order of their keys.
+  Slice<V> values() const& noexcept sus_lifetimebound {
+    return values_.as_slice();
+  }
+  Slice<V> values() && = delete;
+
+  /// Returns the values as mutable references, in the order of their keys.
+  SliceMut<V> values_mut() & noexcept sus_lifetimebound {
+    return values_.as_mut_slice();
+  }
+
+  /// Returns an iterator over `Tuple<const K&, const V&>` for each entry, in
+  /// increasing order of the keys.
+  auto iter() const& noexcept sus_lifetimebound {
+    return keys_.iter().zip(values_.iter());
+  }
+  auto iter() && = delete;
+
+  /// sus::ops::Eq<FlatMap<K, V>> trait.
+  friend bool operator==(const FlatMap& l, const FlatMap& r) noexcept
+    requires(::sus::ops::Eq<K> && ::sus::ops::Eq<V>)
+  {
+    return l.keys_ == r.keys_ && l.values_ == r.values_;
+  }
+
+ private:
+  FlatMap(Vec<K> keys, Vec<V> values) noexcept
+      : keys_(::sus::move(keys)), values_(::sus::move(values)) {}
+
+  static_assert(::sus::ops::Ord<K>, "FlatMap keys must be Ord.");
+
+  Vec<K> keys_;
+  Vec<V> values_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(keys_),
+                                           decltype(values_));
+};
+
+}  // namespace sus::containers
+
+// Promote FlatMap into the `sus` namespace.
+namespace sus {
+using ::sus::containers::FlatMap;
+}  // namespace sus
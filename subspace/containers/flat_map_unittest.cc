@@ -0,0 +1,126 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/containers/flat_map.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::containers::FlatMap;
+
+TEST(FlatMap, InsertGet) {
+  auto m = FlatMap<i32, u32>();
+  EXPECT_TRUE(m.is_empty());
+  EXPECT_TRUE(m.insert(3, 30u).is_none());
+  EXPECT_TRUE(m.insert(1, 10u).is_none());
+  EXPECT_TRUE(m.insert(2, 20u).is_none());
+  EXPECT_EQ(m.len(), 3u);
+  EXPECT_EQ(m.insert(2, 22u), sus::some(20_u32));
+  EXPECT_EQ(m.len(), 3u);
+
+  EXPECT_EQ(m.get(1).unwrap(), 10u);
+  EXPECT_EQ(m.get(2).unwrap(), 22u);
+  EXPECT_TRUE(m.get(4).is_none());
+  EXPECT_TRUE(m.contains_key(3));
+  EXPECT_FALSE(m.contains_key(0));
+  m.get_mut(3).unwrap() += 1u;
+  EXPECT_EQ(m.get(3).unwrap(), 31u);
+
+  EXPECT_EQ(m.keys(), sus::Vec<i32>::with_values(1, 2, 3));
+  EXPECT_EQ(m.values(), sus::Vec<u32>::with_values(10u, 22u, 31u));
+}
+
+TEST(FlatMap, Remove) {
+  auto m = FlatMap<i32, u32>();
+  m.insert(1, 10u);
+  m.insert(2, 20u);
+  m.insert(3, 30u);
+  EXPECT_EQ(m.remove(2), sus::some(20_u32));
+  EXPECT_TRUE(m.remove(2).is_none());
+  EXPECT_EQ(m.keys(), sus::Vec<i32>::with_values(1, 3));
+  EXPECT_EQ(m.values(), sus::Vec<u32>::with_values(10u, 30u));
+  m.clear();
+  EXPECT_TRUE(m.is_empty());
+}
+
+TEST(FlatMap, FromSortedIter) {
+  auto items = sus::Vec<sus::Tuple<i32, u32>>();
+  items.push(sus::Tuple<i32, u32>::with(1, 10u));
+  items.push(sus::Tuple<i32, u32>::with(4, 40u));
+  items.push(sus::Tuple<i32, u32>::with(9, 90u));
+  auto m = FlatMap<i32, u32>::from_sorted_iter(sus::move(items).into_iter());
+  EXPECT_EQ(m.len(), 3u);
+  EXPECT_EQ(m.get(4).unwrap(), 40u);
+  EXPECT_EQ(m.keys(), sus::Vec<i32>::with_values(1, 4, 9));
+}
+
+TEST(FlatMap, Merge) {
+  auto a = FlatMap<i32, u32>();
+  a.insert(1, 10u);
+  a.insert(3, 30u);
+  a.insert(5, 50u);
+  auto b = FlatMap<i32, u32>();
+  b.insert(2, 200u);
+  b.insert(3, 300u);
+  b.insert(7, 700u);
+  a.merge(sus::move(b));
+  EXPECT_EQ(a.keys(), sus::Vec<i32>::with_values(1, 2, 3, 5, 7));
+  EXPECT_EQ(a.values(),
+            sus::Vec<u32>::with_values(10u, 200u, 300u, 50u, 700u));
+
+  auto e = FlatMap<i32, u32>();
+  e.merge(a.clone());
+  EXPECT_EQ(e, a);
+  e.merge(FlatMap<i32, u32>());
+  EXPECT_EQ(e, a);
+}
+
+TEST(FlatMap, Iter) {
+  auto m = FlatMap<i32, u32>();
+  m.insert(2, 20u);
+  m.insert(1, 10u);
+  i32 key_sum = 0;
+  u32 value_sum = 0u;
+  for (auto [k, v] : m.iter()) {
+    key_sum += k;
+    value_sum += v;
+  }
+  EXPECT_EQ(key_sum, 3);
+  EXPECT_EQ(value_sum, 30u);
+  for (u32& v : m.values_mut().iter_mut()) v *= 2u;
+  EXPECT_EQ(m.get(2).unwrap(), 40u);
+}
+
+TEST(FlatMap, Clone) {
+  auto m = FlatMap<i32, sus::Vec<i32>>();
+  m.insert(1, sus::Vec<i32>::with_values(1, 2));
+  auto c = m.clone();
+  EXPECT_EQ(c, m);
+  c.get_mut(1).unwrap().push(3);
+  EXPECT_NE(c, m);
+}
+
+#if GTEST_HAS_DEATH_TEST
+TEST(FlatMapDeathTest, FromUnsortedIter) {
+  auto items = sus::Vec<sus::Tuple<i32, u32>>();
+  items.push(sus::Tuple<i32, u32>::with(4, 40u));
+  items.push(sus::Tuple<i32, u32>::with(1, 10u));
+  EXPECT_DEATH(
+      (FlatMap<i32, u32>::from_sorted_iter(sus::move(items).into_iter())), "");
+}
+#endif
+
+}  // namespace
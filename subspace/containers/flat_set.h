@@ -0,0 +1,186 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/iter/into_iterator.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/ord.h"
+
+namespace sus::containers {
+
+/// A set of values, stored as a sorted array.
+///
+/// This is the set counterpart to `FlatMap`, with the same tradeoffs: lookups
+/// are a binary search over contiguous memory, while `insert()` and `remove()`
+/// take linear time. Use `from_sorted_iter()` and `merge()` to build a FlatSet
+/// in linear time.
+///
+/// # Example
+/// ```
+/// auto s = sus::containers::FlatSet<i32>();
+/// s.insert(3);
+/// s.insert(1);
+/// sus::check(s.contains(3));
+/// sus::check(s.as_slice()[0u] == 1);
+/// ```
+template <class K>
+class FlatSet final {
+  static_assert(!std::is_reference_v<K>,
+                "References in FlatSet are not supported.");
+
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty FlatSet, without allocating.
+  FlatSet() noexcept = default;
+
+  /// Constructs an empty FlatSet with space for `cap` values.
+  static FlatSet with_capacity(usize cap) noexcept {
+    return FlatSet(Vec<K>::with_capacity(cap));
+  }
+
+  /// Constructs a FlatSet from an iterator over values, in linear time.
+  ///
+  /// # Panics
+  /// The function will panic if the values are not in strictly increasing
+  /// order.
+  static FlatSet from_sorted_iter(
+      ::sus::iter::IntoIterator<K> auto&& into_iter) noexcept {
+    auto s = FlatSet();
+    for (K k : ::sus::move(into_iter).into_iter()) {
+      ::sus::check(s.keys_.is_empty() || s.keys_[s.keys_.len() - 1u] < k);
+      s.keys_.push(::sus::move(k));
+    }
+    return s;
+  }
+
+  FlatSet(FlatSet&&) = default;
+  FlatSet& operator=(FlatSet&&) = default;
+
+  /// sus::mem::Clone trait.
+  FlatSet clone() const& noexcept
+    requires(::sus::mem::Clone<K>)
+  {
+    return FlatSet(::sus::clone(keys_));
+  }
+
+  /// Returns the number of values in the set.
+  usize len() const& noexcept { return keys_.len(); }
+  /// Returns true if the set has no values.
+  bool is_empty() const& noexcept { return keys_.is_empty(); }
+
+  /// Removes all values, without releasing the memory.
+  void clear() noexcept { keys_.clear(); }
+
+  /// Returns true if `key` is in the set.
+  bool contains(const K& key) const& noexcept {
+    return keys_.binary_search(key).is_ok();
+  }
+
+  /// Adds `key` to the set, keeping the values sorted.
+  ///
+  /// Returns true if `key` was added, and false if it was already in the set.
+  bool insert(K key) noexcept {
+    auto r = keys_.binary_search(key);
+    if (r.is_ok()) return false;
+    keys_.insert(::sus::move(r).unwrap_err(), ::sus::move(key));
+    return true;
+  }
+
+  /// Removes `key` from the set, returning true if it was in the set.
+  bool remove(const K& key) noexcept {
+    auto r = keys_.binary_search(key);
+    if (r.is_err()) return false;
+    keys_.remove(::sus::move(r).unwrap());
+    return true;
+  }
+
+  /// Moves all the values of `other` into this set, in linear time.
+  void merge(FlatSet other) & noexcept {
+    if (other.is_empty()) return;
+    if (is_empty()) {
+      *this = ::sus::move(other);
+      return;
+    }
+    auto keys = Vec<K>::with_capacity(len() + other.len());
+    usize a;
+    usize b;
+    while (a < len() && b < other.len()) {
+      K& ka = keys_.get_unchecked_mut(::sus::marker::unsafe_fn, a);
+      K& kb = other.keys_.get_unchecked_mut(::sus::marker::unsafe_fn, b);
+      if (ka < kb) {
+        keys.push(::sus::move(ka));
+        a += 1u;
+      } else {
+        if (!(kb < ka)) a += 1u;
+        keys.push(::sus::move(kb));
+        b += 1u;
+      }
+    }
+    for (; a < len(); a += 1u)
+      keys.push(
+          ::sus::move(keys_.get_unchecked_mut(::sus::marker::unsafe_fn, a)));
+    for (; b < other.len(); b += 1u)
+      keys.push(::sus::move(
+          other.keys_.get_unchecked_mut(::sus::marker::unsafe_fn, b)));
+    keys_ = ::sus::move(keys);
+  }
+
+  /// Returns the values, in increasing order.
+  Slice<K> as_slice() const& noexcept sus_lifetimebound {
+    return keys_.as_slice();
+  }
+  Slice<K> as_slice() && = delete;
+
+  /// Returns an iterator over const references to the values, in increasing
+  /// order.
+  auto iter() const& noexcept sus_lifetimebound { return keys_.iter(); }
+  auto iter() && = delete;
+
+  /// sus::ops::Eq<FlatSet<K>> trait.
+  friend bool operator==(const FlatSet& l, const FlatSet& r) noexcept
+    requires(::sus::ops::Eq<K>)
+  {
+    return l.keys_ == r.keys_;
+  }
+
+ private:
+  explicit FlatSet(Vec<K> keys) noexcept : keys_(::sus::move(keys)) {}
+
+  static_assert(::sus::ops::Ord<K>, "FlatSet values must be Ord.");
+
+  Vec<K> keys_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(keys_));
+};
+
+}  // namespace sus::containers
+
+// Promote FlatSet into the `sus` namespace.
+namespace sus {
+using ::sus::containers::FlatSet;
+}  // namespace sus
@@ -0,0 +1,60 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/containers/flat_set.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::containers::FlatSet;
+
+TEST(FlatSet, InsertRemove) {
+  auto s = FlatSet<i32>();
+  EXPECT_TRUE(s.insert(3));
+  EXPECT_TRUE(s.insert(1));
+  EXPECT_TRUE(s.insert(2));
+  EXPECT_FALSE(s.insert(2));
+  EXPECT_EQ(s.len(), 3u);
+  EXPECT_EQ(s.as_slice(), sus::Vec<i32>::with_values(1, 2, 3));
+  EXPECT_TRUE(s.contains(1));
+  EXPECT_FALSE(s.contains(4));
+  EXPECT_TRUE(s.remove(1));
+  EXPECT_FALSE(s.remove(1));
+  EXPECT_EQ(s.as_slice(), sus::Vec<i32>::with_values(2, 3));
+}
+
+TEST(FlatSet, FromSortedIter) {
+  auto s = FlatSet<i32>::from_sorted_iter(
+      sus::Vec<i32>::with_values(1, 5, 8).into_iter());
+  EXPECT_EQ(s.len(), 3u);
+  EXPECT_TRUE(s.contains(5));
+  i32 sum = 0;
+  for (const i32& i : s.iter()) sum += i;
+  EXPECT_EQ(sum, 14);
+}
+
+TEST(FlatSet, Merge) {
+  auto a = FlatSet<i32>::from_sorted_iter(
+      sus::Vec<i32>::with_values(1, 3, 5).into_iter());
+  auto b = FlatSet<i32>::from_sorted_iter(
+      sus::Vec<i32>::with_values(2, 3, 9).into_iter());
+  a.merge(sus::move(b));
+  EXPECT_EQ(a.as_slice(), sus::Vec<i32>::with_values(1, 2, 3, 5, 9));
+  auto c = a.clone();
+  EXPECT_EQ(c, a);
+}
+
+}  // namespace
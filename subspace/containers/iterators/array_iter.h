@@ -63,6 +63,44 @@ struct [[nodiscard]] ArrayIntoIter final
     return Option<Item>::some(move(item));
   }
 
+  // sus::iter::Iterator trait.
+  //
+  // Skips ahead `n` elements in constant time. The skipped elements are left in
+  // the Array and destroyed along with it.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      front_index_ = back_index_;
+      return Option<Item>::none();
+    }
+    front_index_ += n;
+    return next();
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  //
+  // Skips back `n` elements in constant time. The skipped elements are left in
+  // the Array and destroyed along with it.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      back_index_ = front_index_;
+      return Option<Item>::none();
+    }
+    back_index_ -= n;
+    return next_back();
+  }
+
+  /// sus::iter::Iterator method.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    const usize remaining = back_index_ - front_index_;
+    return ::sus::iter::SizeHint(
+        remaining, ::sus::Option<::sus::num::usize>::some(remaining));
+  }
+
+  /// sus::iter::ExactSizeIterator trait.
+  ::sus::num::usize exact_size_hint() const noexcept {
+    return back_index_ - front_index_;
+  }
+
  private:
   ArrayIntoIter(Array<Item, N>&& array) noexcept : array_(::sus::move(array)) {}
 
@@ -0,0 +1,99 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/containers/__private/btree_node.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::containers {
+
+template <class K, class V>
+class BTreeMap;
+template <class K>
+class BTreeSet;
+
+/// An iterator over the entries of a `BTreeMap` or `BTreeSet`, in increasing
+/// order of their keys, or a range of them.
+///
+/// The iterator walks the leaves of the tree in order, moving through a parent
+/// node only between leaves, so it visits each node once.
+///
+/// The `Item` is a `Tuple<const K&, const V&>` or `Tuple<const K&, V&>` for a
+/// map, and a `const K&` for a set.
+template <class K, class V, class ItemT>
+class [[nodiscard]] BTreeIter final
+    : public ::sus::iter::IteratorBase<BTreeIter<K, V, ItemT>, ItemT> {
+ public:
+  using Item = ItemT;
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (front_ == back_) [[unlikely]]
+      return Option<Item>::none();
+    remaining_ -= 1u;
+    return Option<Item>::some(make_item(__private::btree_next_kv(front_)));
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept {
+    if (front_ == back_) [[unlikely]]
+      return Option<Item>::none();
+    remaining_ -= 1u;
+    return Option<Item>::some(make_item(__private::btree_next_back_kv(back_)));
+  }
+
+  /// sus::iter::Iterator trait.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    // Iterating over a range does not know how many keys are in the range,
+    // only that it's at most the size of the tree.
+    return ::sus::iter::SizeHint(
+        exact_ ? remaining_ : 0_usize,
+        ::sus::Option<::sus::num::usize>::some(remaining_));
+  }
+
+ private:
+  friend class BTreeMap<K, V>;
+  friend class BTreeSet<K>;
+
+  using Edge = __private::BTreeEdge<K, V>;
+
+  BTreeIter(Edge front, Edge back, usize remaining, bool exact) noexcept
+      : front_(front), back_(back), remaining_(remaining), exact_(exact) {}
+
+  static Item make_item(__private::BTreeKVHandle<K, V> kv) noexcept {
+    if constexpr (std::is_reference_v<Item>) {
+      return kv.node->keys[kv.idx];
+    } else {
+      return Item::with(kv.node->keys[kv.idx], kv.node->vals[kv.idx]);
+    }
+  }
+
+  Edge front_;
+  Edge back_;
+  // The number of entries left, if `exact_`, or an upper bound on it.
+  usize remaining_;
+  bool exact_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(front_),
+                                  decltype(back_), decltype(remaining_),
+                                  decltype(exact_));
+};
+
+}  // namespace sus::containers
@@ -16,6 +16,9 @@
 
 #include "subspace/iter/iterator_defn.h"
 #include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/ord.h"
+#include "subspace/ops/range.h"
+#include "subspace/option/option.h"
 
 namespace sus::containers {
 template <class T>
@@ -111,7 +114,63 @@ struct [[nodiscard]] [[sus_trivial_abi]] Chunks final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    const auto len = v_.len();
+    Option<::sus::num::usize> start = n.checked_mul(chunk_size_);
+    if (start.is_none() || *start >= len) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    // The last chunk may be shorter than `chunk_size_`.
+    const auto end = *start + ::sus::ops::min(len - *start, chunk_size_);
+    // SAFETY: `start < end <= len` by the checks above.
+    auto nth = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                      ::sus::ops::Range(*start, end));
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeFrom(end));
+    return Option<Item>::some(nth);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept {
+    if (v_.is_empty()) return Option<Item>::none();
+    const auto start = (v_.len() - 1u) / chunk_size_ * chunk_size_;
+    // SAFETY: `start <= len - 1` since it is rounded down.
+    return Option<Item>::some(v_.get_range_unchecked(
+        ::sus::marker::unsafe_fn, ::sus::ops::RangeFrom(start)));
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`, and can't overflow because the
+    // chunk starts inside the slice.
+    const auto start = (len - 1u - n) * chunk_size_;
+    // The last chunk may be shorter than `chunk_size_`.
+    const auto end = start + ::sus::ops::min(v_.len() - start, chunk_size_);
+    // SAFETY: `start < end <= v_.len()` by the checks above.
+    auto nth_back = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                           ::sus::ops::Range(start, end));
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeTo(start));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by Slice.
@@ -219,7 +278,63 @@ struct [[nodiscard]] [[sus_trivial_abi]] ChunksMut final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    const auto len = v_.len();
+    Option<::sus::num::usize> start = n.checked_mul(chunk_size_);
+    if (start.is_none() || *start >= len) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    // The last chunk may be shorter than `chunk_size_`.
+    const auto end = *start + ::sus::ops::min(len - *start, chunk_size_);
+    // SAFETY: `start < end <= len` by the checks above.
+    auto nth = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                          ::sus::ops::Range(*start, end));
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeFrom(end));
+    return Option<Item>::some(nth);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept {
+    if (v_.is_empty()) return Option<Item>::none();
+    const auto start = (v_.len() - 1u) / chunk_size_ * chunk_size_;
+    // SAFETY: `start <= len - 1` since it is rounded down.
+    return Option<Item>::some(v_.get_range_mut_unchecked(
+        ::sus::marker::unsafe_fn, ::sus::ops::RangeFrom(start)));
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`, and can't overflow because the
+    // chunk starts inside the slice.
+    const auto start = (len - 1u - n) * chunk_size_;
+    // The last chunk may be shorter than `chunk_size_`.
+    const auto end = start + ::sus::ops::min(v_.len() - start, chunk_size_);
+    // SAFETY: `start < end <= v_.len()` by the checks above.
+    auto nth_back = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                               ::sus::ops::Range(start, end));
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeTo(start));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by SliceMut.
@@ -316,7 +431,51 @@ struct [[nodiscard]] [[sus_trivial_abi]] ChunksExact final
     return v_.len() / chunk_size_;
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<::sus::num::usize> start = n.checked_mul(chunk_size_);
+    if (start.is_none() || *start >= v_.len()) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    // SAFETY: `start < len` by the check above.
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeFrom(*start));
+    return next();
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`, and the chunk ends inside the slice
+    // since `v_.len()` is a multiple of `chunk_size_`.
+    const auto start = (len - 1u - n) * chunk_size_;
+    const auto end = start + chunk_size_;
+    // SAFETY: `start < end <= v_.len()` as above.
+    auto nth_back = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                           ::sus::ops::Range(start, end));
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeTo(start));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by Slice.
@@ -418,7 +577,51 @@ struct [[nodiscard]] [[sus_trivial_abi]] ChunksExactMut final
     return v_.len() / chunk_size_;
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<::sus::num::usize> start = n.checked_mul(chunk_size_);
+    if (start.is_none() || *start >= v_.len()) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    // SAFETY: `start < len` by the check above.
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeFrom(*start));
+    return next();
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`, and the chunk ends inside the slice
+    // since `v_.len()` is a multiple of `chunk_size_`.
+    const auto start = (len - 1u - n) * chunk_size_;
+    const auto end = start + chunk_size_;
+    // SAFETY: `start < end <= v_.len()` as above.
+    auto nth_back = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                               ::sus::ops::Range(start, end));
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeTo(start));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by Slice.
@@ -446,8 +649,8 @@ struct [[nodiscard]] [[sus_trivial_abi]] ChunksExactMut final
                                   decltype(rem_), decltype(chunk_size_));
 };
 
-/// An iterator over a slice in (non-overlapping) chunks (`chunk_size` elements at
-/// a time), starting at the end of the slice.
+/// An iterator over a slice in (non-overlapping) chunks (`chunk_size` elements
+/// at a time), starting at the end of the slice.
 ///
 /// When the slice len is not evenly divided by the chunk size, the last slice
 /// of the iteration will be the remainder.
@@ -531,7 +734,63 @@ struct [[nodiscard]] [[sus_trivial_abi]] RChunks final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<::sus::num::usize> offset = n.checked_mul(chunk_size_);
+    if (offset.is_none() || *offset >= v_.len()) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    const auto end = v_.len() - *offset;
+    const auto start = end.saturating_sub(chunk_size_);
+    // SAFETY: `start < end <= len` by the checks above.
+    auto nth = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                      ::sus::ops::Range(start, end));
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeTo(start));
+    return Option<Item>::some(nth);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept {
+    if (v_.is_empty()) return Option<Item>::none();
+    const auto rem = v_.len() % chunk_size_;
+    const auto end = rem == 0u ? chunk_size_ : rem;
+    // SAFETY: `end <= len`, as `len` is non-empty and `end` is either its
+    // remainder or, when `chunk_size_` divides it, `chunk_size_`.
+    return Option<Item>::some(v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                                     ::sus::ops::RangeTo(end)));
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`.
+    const auto offset_from_end = (len - 1u - n) * chunk_size_;
+    const auto end = v_.len() - offset_from_end;
+    const auto start = end.saturating_sub(chunk_size_);
+    // SAFETY: `start < end <= v_.len()` by the checks above.
+    auto nth_back = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                           ::sus::ops::Range(start, end));
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeFrom(end));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by Slice.
@@ -628,7 +887,63 @@ struct [[nodiscard]] [[sus_trivial_abi]] RChunksMut final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<::sus::num::usize> offset = n.checked_mul(chunk_size_);
+    if (offset.is_none() || *offset >= v_.len()) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    const auto end = v_.len() - *offset;
+    const auto start = end.saturating_sub(chunk_size_);
+    // SAFETY: `start < end <= len` by the checks above.
+    auto nth = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                          ::sus::ops::Range(start, end));
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeTo(start));
+    return Option<Item>::some(nth);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept {
+    if (v_.is_empty()) return Option<Item>::none();
+    const auto rem = v_.len() % chunk_size_;
+    const auto end = rem == 0u ? chunk_size_ : rem;
+    // SAFETY: `end <= len`, as `len` is non-empty and `end` is either its
+    // remainder or, when `chunk_size_` divides it, `chunk_size_`.
+    return Option<Item>::some(v_.get_range_mut_unchecked(
+        ::sus::marker::unsafe_fn, ::sus::ops::RangeTo(end)));
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`.
+    const auto offset_from_end = (len - 1u - n) * chunk_size_;
+    const auto end = v_.len() - offset_from_end;
+    const auto start = end.saturating_sub(chunk_size_);
+    // SAFETY: `start < end <= v_.len()` by the checks above.
+    auto nth_back = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                               ::sus::ops::Range(start, end));
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeFrom(end));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by SliceMut.
@@ -650,8 +965,8 @@ struct [[nodiscard]] [[sus_trivial_abi]] RChunksMut final
                                   decltype(chunk_size_));
 };
 
-/// An iterator over a slice in (non-overlapping) chunks (`chunk_size` elements at
-/// a time), starting at the end of the slice.
+/// An iterator over a slice in (non-overlapping) chunks (`chunk_size` elements
+/// at a time), starting at the end of the slice.
 ///
 /// When the slice len is not evenly divided by the chunk size, the last up to
 /// `chunk_size-1` elements will be omitted but can be retrieved from the
@@ -725,7 +1040,52 @@ struct [[nodiscard]] [[sus_trivial_abi]] RChunksExact final
     return v_.len() / chunk_size_;
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<::sus::num::usize> offset = n.checked_mul(chunk_size_);
+    if (offset.is_none() || *offset >= v_.len()) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    // SAFETY: `offset < len` by the check above.
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeTo(v_.len() - *offset));
+    return next();
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`, and `v_.len()` is a multiple of
+    // `chunk_size_`.
+    const auto offset_from_end = (len - 1u - n) * chunk_size_;
+    const auto end = v_.len() - offset_from_end;
+    const auto start = end - chunk_size_;
+    // SAFETY: `start < end <= v_.len()` as above.
+    auto nth_back = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                           ::sus::ops::Range(start, end));
+    v_ = v_.get_range_unchecked(::sus::marker::unsafe_fn,
+                                ::sus::ops::RangeFrom(end));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by Slice.
@@ -825,7 +1185,52 @@ struct [[nodiscard]] [[sus_trivial_abi]] RChunksExactMut final
     return v_.len() / chunk_size_;
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the chunks without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th chunk in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<::sus::num::usize> offset = n.checked_mul(chunk_size_);
+    if (offset.is_none() || *offset >= v_.len()) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    // SAFETY: `offset < len` by the check above.
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeTo(v_.len() - *offset));
+    return next();
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last chunk without iterating over the others.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th chunk from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    const auto len = exact_size_hint();
+    if (n >= len) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    }
+    // Can't underflow because `n < len`, and `v_.len()` is a multiple of
+    // `chunk_size_`.
+    const auto offset_from_end = (len - 1u - n) * chunk_size_;
+    const auto end = v_.len() - offset_from_end;
+    const auto start = end - chunk_size_;
+    // SAFETY: `start < end <= v_.len()` as above.
+    auto nth_back = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                               ::sus::ops::Range(start, end));
+    v_ = v_.get_range_mut_unchecked(::sus::marker::unsafe_fn,
+                                    ::sus::ops::RangeFrom(end));
+    return Option<Item>::some(nth_back);
+  }
 
  private:
   // Constructed by Slice.
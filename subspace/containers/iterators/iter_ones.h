@@ -0,0 +1,98 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/containers/__private/bit_words.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/range.h"
+#include "subspace/option/option.h"
+
+namespace sus::containers {
+
+class BitVec;
+template <size_t N>
+  requires(N > 0u)
+class BitArray;
+
+/// An iterator over the indices of the set bits in a bit container, in
+/// increasing order.
+///
+/// Each step finds the next set bit with a single `trailing_zeros()` on the
+/// current word, and skips over words with no bits set.
+///
+/// This struct is created by the `iter_ones()` method on `BitVec` and
+/// `BitArray`.
+class [[nodiscard]] [[sus_trivial_abi]] IterOnes final
+    : public ::sus::iter::IteratorBase<IterOnes, ::sus::num::usize> {
+ public:
+  // `Item` is the index of a set bit.
+  using Item = ::sus::num::usize;
+
+  IterOnes(IterOnes&&) = default;
+  IterOnes& operator=(IterOnes&&) = default;
+
+  /// sus::mem::Clone trait.
+  IterOnes clone() const noexcept { return IterOnes(words_, word_, base_); }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    while (word_ == 0u) {
+      if (words_.is_empty()) return Option<Item>::none();
+      word_ = words_[0u];
+      words_ = words_[::sus::ops::RangeFrom<usize>(1u)];
+      base_ += __private::kBitsPerWord;
+    }
+    const usize index = base_ + usize::from(word_.trailing_zeros());
+    // Clear the lowest set bit.
+    word_ &= word_ - 1u;
+    return Option<Item>::some(index);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the set bits a word at a time without iterating over them.
+  ::sus::num::usize count() && noexcept {
+    return usize::from(word_.count_ones()) + __private::count_ones(words_);
+  }
+
+ private:
+  // Constructed by BitVec and BitArray.
+  friend class BitVec;
+  template <size_t N>
+    requires(N > 0u)
+  friend class BitArray;
+
+  static constexpr IterOnes with(Slice<u64> words) noexcept {
+    if (words.is_empty()) return IterOnes(words, 0u, 0u);
+    return IterOnes(words[::sus::ops::RangeFrom<usize>(1u)], words[0u], 0u);
+  }
+
+  constexpr IterOnes(Slice<u64> words, u64 word, usize base) noexcept
+      : words_(words), word_(word), base_(base) {}
+
+  // The words after the current one.
+  Slice<u64> words_;
+  // The current word, with the bits that have been returned cleared.
+  u64 word_;
+  // The index of the lowest bit in `word_`.
+  usize base_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(words_),
+                                  decltype(word_), decltype(base_));
+};
+
+}  // namespace sus::containers
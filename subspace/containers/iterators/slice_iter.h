@@ -70,6 +70,30 @@ struct [[nodiscard]] [[sus_trivial_abi]] SliceIter final
     return Option<Item>::some(*end_);
   }
 
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead `n` elements in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      ptr_ = end_;
+      return Option<Item>::none();
+    }
+    ptr_ += n;
+    return next();
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back `n` elements in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      end_ = ptr_;
+      return Option<Item>::none();
+    }
+    end_ -= n;
+    return next_back();
+  }
+
   ::sus::iter::SizeHint size_hint() const noexcept final {
     // SAFETY: The constructor checks that end_ - ptr_ is positive and Slice can
     // not exceed isize::MAX.
@@ -142,6 +166,30 @@ struct [[sus_trivial_abi]] SliceIterMut final
     return Option<Item>::some(mref(*end_));
   }
 
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead `n` elements in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      ptr_ = end_;
+      return Option<Item>::none();
+    }
+    ptr_ += n;
+    return next();
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back `n` elements in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      end_ = ptr_;
+      return Option<Item>::none();
+    }
+    end_ -= n;
+    return next_back();
+  }
+
   ::sus::iter::SizeHint size_hint() const noexcept final {
     const auto remaining = exact_size_hint();
     return {remaining, ::sus::Option<::sus::num::usize>::some(remaining)};
@@ -0,0 +1,206 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <utility>
+
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/mem/replace.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::containers {
+
+/// An iterator over the rows of a `SoaVec`, which returns const references to
+/// the fields of each row.
+///
+/// This type is returned from `SoaVec::iter()`.
+template <class... Ts>
+struct [[nodiscard]] [[sus_trivial_abi]] SoaVecIter final
+    : public ::sus::iter::IteratorBase<SoaVecIter<Ts...>,
+                                       ::sus::Tuple<const Ts&...>> {
+ public:
+  using Item = ::sus::Tuple<const Ts&...>;
+
+  static constexpr auto with(usize len, const Ts*... columns) noexcept {
+    return SoaVecIter(len, columns...);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (front_ == back_) [[unlikely]]
+      return Option<Item>::none();
+    return Option<Item>::some(
+        row(::sus::mem::replace(mref(front_), front_ + 1u),
+            std::index_sequence_for<Ts...>()));
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept {
+    if (front_ == back_) [[unlikely]]
+      return Option<Item>::none();
+    back_ -= 1u;
+    return Option<Item>::some(row(back_, std::index_sequence_for<Ts...>()));
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead `n` rows in constant time.
+  Option<Item> nth(usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      front_ = back_;
+      return Option<Item>::none();
+    }
+    front_ += n;
+    return next();
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back `n` rows in constant time.
+  Option<Item> nth_back(usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      back_ = front_;
+      return Option<Item>::none();
+    }
+    back_ -= n;
+    return next_back();
+  }
+
+  // sus::iter::Iterator trait.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    const usize remaining = exact_size_hint();
+    return ::sus::iter::SizeHint(
+        remaining, ::sus::Option<::sus::num::usize>::some(remaining));
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept { return back_ - front_; }
+
+ private:
+  constexpr SoaVecIter(usize len, const Ts*... columns) noexcept
+      : columns_(::sus::Tuple<const Ts*...>::with(columns...)),
+        front_(0u),
+        back_(len) {}
+
+  template <size_t... Is>
+  Item row(usize index, std::index_sequence<Is...>) const noexcept {
+    return Item::with(*(columns_.template at<Is>() + size_t{index})...);
+  }
+
+  // Pointers to the start of each column.
+  ::sus::Tuple<const Ts*...> columns_;
+  // The rows in [front_, back_) are yet to be returned.
+  usize front_;
+  usize back_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(columns_), decltype(front_),
+                                  decltype(back_));
+};
+
+/// An iterator over the rows of a `SoaVec`, which returns mutable references
+/// to the fields of each row.
+///
+/// This type is returned from `SoaVec::iter_mut()`.
+template <class... Ts>
+struct [[nodiscard]] [[sus_trivial_abi]] SoaVecIterMut final
+    : public ::sus::iter::IteratorBase<SoaVecIterMut<Ts...>,
+                                       ::sus::Tuple<Ts&...>> {
+ public:
+  using Item = ::sus::Tuple<Ts&...>;
+
+  static constexpr auto with(usize len, Ts*... columns) noexcept {
+    return SoaVecIterMut(len, columns...);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (front_ == back_) [[unlikely]]
+      return Option<Item>::none();
+    return Option<Item>::some(
+        row(::sus::mem::replace(mref(front_), front_ + 1u),
+            std::index_sequence_for<Ts...>()));
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept {
+    if (front_ == back_) [[unlikely]]
+      return Option<Item>::none();
+    back_ -= 1u;
+    return Option<Item>::some(row(back_, std::index_sequence_for<Ts...>()));
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead `n` rows in constant time.
+  Option<Item> nth(usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      front_ = back_;
+      return Option<Item>::none();
+    }
+    front_ += n;
+    return next();
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back `n` rows in constant time.
+  Option<Item> nth_back(usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      back_ = front_;
+      return Option<Item>::none();
+    }
+    back_ -= n;
+    return next_back();
+  }
+
+  // sus::iter::Iterator trait.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    const usize remaining = exact_size_hint();
+    return ::sus::iter::SizeHint(
+        remaining, ::sus::Option<::sus::num::usize>::some(remaining));
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept { return back_ - front_; }
+
+ private:
+  constexpr SoaVecIterMut(usize len, Ts*... columns) noexcept
+      : columns_(::sus::Tuple<Ts*...>::with(columns...)),
+        front_(0u),
+        back_(len) {}
+
+  template <size_t... Is>
+  Item row(usize index, std::index_sequence<Is...>) const noexcept {
+    return Item::with(*(columns_.template at<Is>() + size_t{index})...);
+  }
+
+  // Pointers to the start of each column.
+  ::sus::Tuple<Ts*...> columns_;
+  // The rows in [front_, back_) are yet to be returned.
+  usize front_;
+  usize back_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(columns_), decltype(front_),
+                                  decltype(back_));
+};
+
+}  // namespace sus::containers
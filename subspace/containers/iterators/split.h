@@ -160,7 +160,13 @@ class [[nodiscard]] [[sus_trivial_abi]] Split final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Finds the last subslice by searching from the back of the slice, without
+  /// searching through the rest of it.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  // TODO: Impl count(), nth(), nth_back().
 
  private:
   // Constructed by Slice.
@@ -282,7 +288,13 @@ class [[nodiscard]] [[sus_trivial_abi]] SplitMut final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Finds the last subslice by searching from the back of the slice, without
+  /// searching through the rest of it.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  // TODO: Impl count(), nth(), nth_back().
 
  private:
   // Constructed by SliceMut.
@@ -412,7 +424,13 @@ class [[nodiscard]] [[sus_trivial_abi]] SplitInclusive final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Finds the last subslice by searching from the back of the slice, without
+  /// searching through the rest of it.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  // TODO: Impl count(), nth(), nth_back().
 
  private:
   // Constructed by Slice.
@@ -529,7 +547,13 @@ class [[nodiscard]] [[sus_trivial_abi]] SplitInclusiveMut final
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Finds the last subslice by searching from the back of the slice, without
+  /// searching through the rest of it.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  // TODO: Impl count(), nth(), nth_back().
 
  private:
   // Constructed by SliceMut.
@@ -583,7 +607,13 @@ class [[nodiscard]] [[sus_trivial_abi]] RSplit final
     return inner_.size_hint();
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Finds the last subslice by searching from the back of the slice, without
+  /// searching through the rest of it.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  // TODO: Impl count(), nth(), nth_back().
 
  private:
   // Constructed by Slice.
@@ -635,7 +665,13 @@ class [[nodiscard]] [[sus_trivial_abi]] RSplitMut final
     return inner_.size_hint();
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Finds the last subslice by searching from the back of the slice, without
+  /// searching through the rest of it.
+  Option<Item> last() && noexcept { return next_back(); }
+
+  // TODO: Impl count(), nth(), nth_back().
 
  private:
   // Constructed by SliceMut.
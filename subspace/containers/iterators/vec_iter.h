@@ -65,6 +65,32 @@ struct [[nodiscard]] VecIntoIter final
     return Option<Item>::some(move(item));
   }
 
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead `n` elements in constant time. The skipped elements are left
+  /// in the Vec and destroyed along with it.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      front_index_ = back_index_;
+      return Option<Item>::none();
+    }
+    front_index_ += n;
+    return next();
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back `n` elements in constant time. The skipped elements are left
+  /// in the Vec and destroyed along with it.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    if (n >= exact_size_hint()) [[unlikely]] {
+      back_index_ = front_index_;
+      return Option<Item>::none();
+    }
+    back_index_ -= n;
+    return next_back();
+  }
+
   /// sus::iter::Iterator method.
   ::sus::iter::SizeHint size_hint() const noexcept final {
     const usize remaining = back_index_ - front_index_;
@@ -20,6 +20,7 @@
 
 #include "subspace/iter/iterator_defn.h"
 #include "subspace/mem/relocate.h"
+#include "subspace/num/nonzero.h"
 #include "subspace/num/unsigned_integer.h"
 #include "subspace/ops/range.h"
 
@@ -48,10 +49,10 @@ class [[nodiscard]] [[sus_trivial_abi]] Windows final
   Option<Item> next() noexcept {
     Option<Item> ret;
 
-    if (size_ > v_.len()) {
+    if (size_.get() > v_.len()) {
       return ret;
     } else {
-      ret = Option<Item>::some(v_[::sus::ops::RangeTo<usize>(size_)]);
+      ret = Option<Item>::some(v_[::sus::ops::RangeTo<usize>(size_.get())]);
       v_ = v_[::sus::ops::RangeFrom<usize>(1u)];
       return ret;
     }
@@ -61,11 +62,11 @@ class [[nodiscard]] [[sus_trivial_abi]] Windows final
   Option<Item> next_back() noexcept {
     Option<Item> ret;
 
-    if (size_ > v_.len()) {
+    if (size_.get() > v_.len()) {
       return ret;
     } else {
       ret = Option<Item>::some(
-          v_[::sus::ops::RangeFrom<usize>(v_.len() - size_)]);
+          v_[::sus::ops::RangeFrom<usize>(v_.len() - size_.get())]);
       v_ = v_[::sus::ops::RangeTo<usize>(v_.len() - 1u)];
       return ret;
     }
@@ -79,30 +80,76 @@ class [[nodiscard]] [[sus_trivial_abi]] Windows final
 
   /// sus::iter::ExactSizeIterator trait.
   ::sus::num::usize exact_size_hint() const noexcept {
-    if (size_ > v_.len()) {
+    if (size_.get() > v_.len()) {
       return 0u;
     } else {
-      return v_.len() - size_ + 1u;
+      return v_.len() - size_.get() + 1u;
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the windows without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th window in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<usize> end = size_.get().checked_add(n);
+    if (end.is_none() || *end > v_.len()) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    } else {
+      auto ret = Option<Item>::some(v_[::sus::ops::Range<usize>(n, *end)]);
+      v_ = v_[::sus::ops::RangeFrom<usize>(n + 1u)];
+      return ret;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last window without iterating over the others.
+  Option<Item> last() && noexcept {
+    if (size_.get() > v_.len()) {
+      return Option<Item>::none();
+    } else {
+      return Option<Item>::some(
+          v_[::sus::ops::RangeFrom<usize>(v_.len() - size_.get())]);
+    }
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th window from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    Option<usize> end = v_.len().checked_sub(n);
+    if (end.is_none() || *end < size_.get()) {
+      v_ = Slice<ItemT>();
+      return Option<Item>::none();
+    } else {
+      auto ret = Option<Item>::some(
+          v_[::sus::ops::Range<usize>(*end - size_.get(), *end)]);
+      v_ = v_[::sus::ops::RangeTo<usize>(*end - 1u)];
+      return ret;
+    }
+  }
 
  private:
   // Constructed by Slice.
   friend class Slice<ItemT>;
 
   static constexpr auto with(Slice<ItemT> values,
-                             /* TODO: NonZeroUsize*/ usize size) noexcept {
+                             ::sus::num::NonZero<usize> size) noexcept {
     return Windows(values, size);
   }
 
   constexpr Windows(Slice<ItemT> values,
-                    /* TODO: NonZeroUsize*/ usize size) noexcept
+                    ::sus::num::NonZero<usize> size) noexcept
       : v_(values), size_(size) {}
 
   Slice<ItemT> v_;
-  /* TODO: NonZeroUsize*/ usize size_;
+  ::sus::num::NonZero<usize> size_;
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(v_),
                                   decltype(size_));
@@ -131,10 +178,10 @@ class [[nodiscard]] [[sus_trivial_abi]] WindowsMut final
   Option<Item> next() noexcept {
     Option<Item> ret;
 
-    if (size_ > v_.len()) {
+    if (size_.get() > v_.len()) {
       return ret;
     } else {
-      ret = Option<Item>::some(v_[::sus::ops::RangeTo<usize>(size_)]);
+      ret = Option<Item>::some(v_[::sus::ops::RangeTo<usize>(size_.get())]);
       v_ = v_[::sus::ops::RangeFrom<usize>(1u)];
       return ret;
     }
@@ -144,11 +191,11 @@ class [[nodiscard]] [[sus_trivial_abi]] WindowsMut final
   Option<Item> next_back() noexcept {
     Option<Item> ret;
 
-    if (size_ > v_.len()) {
+    if (size_.get() > v_.len()) {
       return ret;
     } else {
       ret = Option<Item>::some(
-          v_[::sus::ops::RangeFrom<usize>(v_.len() - size_)]);
+          v_[::sus::ops::RangeFrom<usize>(v_.len() - size_.get())]);
       v_ = v_[::sus::ops::RangeTo<usize>(v_.len() - 1u)];
       return ret;
     }
@@ -162,30 +209,76 @@ class [[nodiscard]] [[sus_trivial_abi]] WindowsMut final
 
   /// sus::iter::ExactSizeIterator trait.
   ::sus::num::usize exact_size_hint() const noexcept {
-    if (size_ > v_.len()) {
+    if (size_.get() > v_.len()) {
       return 0u;
     } else {
-      return v_.len() - size_ + 1u;
+      return v_.len() - size_.get() + 1u;
     }
   }
 
-  // TODO: Impl count(), nth(), last(), nth_back().
+  /// sus::iter::Iterator trait.
+  ///
+  /// Counts the windows without iterating over them.
+  ::sus::num::usize count() && noexcept { return exact_size_hint(); }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips ahead to the `n`th window in constant time.
+  Option<Item> nth(::sus::num::usize n) noexcept {
+    Option<usize> end = size_.get().checked_add(n);
+    if (end.is_none() || *end > v_.len()) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    } else {
+      auto ret = Option<Item>::some(v_[::sus::ops::Range<usize>(n, *end)]);
+      v_ = v_[::sus::ops::RangeFrom<usize>(n + 1u)];
+      return ret;
+    }
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Returns the last window without iterating over the others.
+  Option<Item> last() && noexcept {
+    if (size_.get() > v_.len()) {
+      return Option<Item>::none();
+    } else {
+      return Option<Item>::some(
+          v_[::sus::ops::RangeFrom<usize>(v_.len() - size_.get())]);
+    }
+  }
+
+  /// sus::iter::DoubleEndedIterator trait.
+  ///
+  /// Skips back to the `n`th window from the end in constant time.
+  Option<Item> nth_back(::sus::num::usize n) noexcept {
+    Option<usize> end = v_.len().checked_sub(n);
+    if (end.is_none() || *end < size_.get()) {
+      v_ = SliceMut<ItemT>();
+      return Option<Item>::none();
+    } else {
+      auto ret = Option<Item>::some(
+          v_[::sus::ops::Range<usize>(*end - size_.get(), *end)]);
+      v_ = v_[::sus::ops::RangeTo<usize>(*end - 1u)];
+      return ret;
+    }
+  }
 
  private:
   // Constructed by SliceMut.
   friend class SliceMut<ItemT>;
 
   static constexpr auto with(SliceMut<ItemT> values,
-                             /* TODO: NonZeroUsize*/ usize size) noexcept {
+                             ::sus::num::NonZero<usize> size) noexcept {
     return WindowsMut(values, size);
   }
 
   constexpr WindowsMut(SliceMut<ItemT> values,
-                    /* TODO: NonZeroUsize*/ usize size) noexcept
+                    ::sus::num::NonZero<usize> size) noexcept
       : v_(values), size_(size) {}
 
   SliceMut<ItemT> v_;
-  /* TODO: NonZeroUsize*/ usize size_;
+  ::sus::num::NonZero<usize> size_;
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(v_),
                                   decltype(size_));
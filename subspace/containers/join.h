@@ -36,7 +36,7 @@ namespace sus::containers {
 /// The `join_into()` method will be called with `None` for the first element
 /// being joined, then with `Some(const Sep&)` for the remaining elements.
 ///
-/// TODO: String should satisfy Join as well.
+/// `Str` and `String` are also `Join<Str>`, with their output being `String`.
 template <class T, class Sep>
 concept Join = requires(const T& t, const ::sus::num::usize& cap) {
   // The separator must be Clone to be replicated between each join.
@@ -19,6 +19,8 @@
 #include "subspace/assertions/check.h"
 #include "subspace/assertions/debug_check.h"
 #include "subspace/construct/default.h"
+#include "subspace/containers/__private/elementwise.h"
+#include "subspace/containers/__private/reductions.h"
 #include "subspace/containers/__private/sort.h"
 #include "subspace/containers/concat.h"
 #include "subspace/containers/iterators/chunks.h"
@@ -35,7 +37,10 @@
 #include "subspace/marker/unsafe.h"
 #include "subspace/mem/clone.h"
 #include "subspace/mem/move.h"
+#include "subspace/mem/never_value.h"
 #include "subspace/mem/swap.h"
+#include "subspace/num/float_concepts.h"
+#include "subspace/num/integer_concepts.h"
 #include "subspace/num/unsigned_integer.h"
 #include "subspace/ops/eq.h"
 #include "subspace/ops/ord.h"
@@ -43,6 +48,8 @@
 #include "subspace/option/option.h"
 #include "subspace/ptr/copy.h"
 #include "subspace/ptr/swap.h"
+#include "subspace/rand/__private/uniform.h"
+#include "subspace/rand/rng_concept.h"
 #include "subspace/result/result.h"
 #include "subspace/tuple/tuple.h"
 
@@ -164,9 +171,10 @@ class [[sus_trivial_abi]] Slice final {
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(data_),
                                   decltype(len_));
-  // Slice does not satisfy NeverValueField because it requires that the default
-  // constructor is trivial, but Slice's default constructor needs to initialize
-  // its fields.
+  // A live Slice has a `len_` of at most `isize::MAX`, which leaves
+  // `usize::MAX` unused, as a never-value for Option<Slice<T>>.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, Slice, len_,
+                              ::sus::usize::MAX, 0_usize);
 };
 
 #define _ptr_expr data_
@@ -293,9 +301,10 @@ class [[sus_trivial_abi]] SliceMut final {
   Slice<T> slice_;
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(slice_));
-  // SliceMut does not satisfy NeverValueField because it requires that the
-  // default constructor is trivial, but SliceMut's default constructor needs to
-  // initialize its fields.
+  // A live SliceMut has a length of at most `isize::MAX`, which leaves
+  // `usize::MAX` unused, as a never-value for Option<SliceMut<T>>.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, SliceMut, slice_.len_,
+                              ::sus::usize::MAX, 0_usize);
 };
 
 #define _ptr_expr slice_.data_
@@ -24,6 +24,7 @@
 #include "subspace/mem/move.h"
 #include "subspace/num/types.h"
 #include "subspace/prelude.h"
+#include "subspace/rand/xoshiro256.h"
 #include "subspace/result/result.h"
 #include "subspace/test/no_copy_move.h"
 
@@ -1970,6 +1971,80 @@ TEST(Slice, ChunksExactMut) {
   }
 }
 
+TEST(Slice, ChunksNth) {
+  sus::Vec<i32> v = sus::vec(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+  auto s = v.as_slice();
+
+  {
+    auto it = s.chunks(3u);
+    EXPECT_EQ(it.nth(1u).unwrap(), sus::Vec<i32>::with_values(3, 4, 5));
+    EXPECT_EQ(it.nth_back(0u).unwrap(), sus::Vec<i32>::with_values(9));
+    EXPECT_EQ(it.exact_size_hint(), 1u);
+    EXPECT_EQ(it.nth(1u), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = s.chunks(3u);
+    EXPECT_EQ(it.nth_back(1u).unwrap(), sus::Vec<i32>::with_values(6, 7, 8));
+    EXPECT_EQ(it.next_back().unwrap(), sus::Vec<i32>::with_values(3, 4, 5));
+    EXPECT_EQ(it.nth_back(1u), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  EXPECT_EQ(s.chunks(3u).nth(3u).unwrap(), sus::Vec<i32>::with_values(9));
+  EXPECT_EQ(s.chunks(3u).nth(usize::MAX), sus::None);
+  EXPECT_EQ(s.chunks(3u).last().unwrap(), sus::Vec<i32>::with_values(9));
+  EXPECT_EQ(s.chunks(5u).last().unwrap(),
+            sus::Vec<i32>::with_values(5, 6, 7, 8, 9));
+  EXPECT_EQ(s.chunks(3u).count(), 4u);
+  EXPECT_EQ(sus::Slice<i32>().chunks(3u).last(), sus::None);
+
+  auto sm = v.as_mut_slice();
+  {
+    auto it = sm.chunks_mut(4u);
+    EXPECT_EQ(it.nth(2u).unwrap(), sus::Vec<i32>::with_values(8, 9));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = sm.chunks_mut(4u);
+    EXPECT_EQ(it.nth_back(2u).unwrap(), sus::Vec<i32>::with_values(0, 1, 2, 3));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  EXPECT_EQ(sm.chunks_mut(4u).last().unwrap(), sus::Vec<i32>::with_values(8, 9));
+  EXPECT_EQ(sm.chunks_mut(4u).count(), 3u);
+}
+
+TEST(Slice, ChunksExactNth) {
+  sus::Vec<i32> v = sus::vec(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+  auto s = v.as_slice();
+
+  {
+    auto it = s.chunks_exact(3u);
+    EXPECT_EQ(it.nth(1u).unwrap(), sus::Vec<i32>::with_values(3, 4, 5));
+    EXPECT_EQ(it.nth(0u).unwrap(), sus::Vec<i32>::with_values(6, 7, 8));
+    EXPECT_EQ(it.nth(0u), sus::None);
+  }
+  {
+    auto it = s.chunks_exact(3u);
+    EXPECT_EQ(it.nth_back(2u).unwrap(), sus::Vec<i32>::with_values(0, 1, 2));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  EXPECT_EQ(s.chunks_exact(3u).nth(3u), sus::None);
+  EXPECT_EQ(s.chunks_exact(3u).last().unwrap(),
+            sus::Vec<i32>::with_values(6, 7, 8));
+  EXPECT_EQ(s.chunks_exact(3u).count(), 3u);
+
+  auto sm = v.as_mut_slice();
+  {
+    auto it = sm.chunks_exact_mut(4u);
+    EXPECT_EQ(it.nth(1u).unwrap(), sus::Vec<i32>::with_values(4, 5, 6, 7));
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(it.remainder(), sus::Vec<i32>::with_values(8, 9));
+  }
+  EXPECT_EQ(sm.chunks_exact_mut(4u).nth_back(1u).unwrap(),
+            sus::Vec<i32>::with_values(0, 1, 2, 3));
+  EXPECT_EQ(sm.chunks_exact_mut(4u).count(), 2u);
+}
+
 TEST(Slice, SplitAt) {
   sus::Vec<i32> v = sus::vec(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
   sus::Slice<i32> s = v.as_slice();
@@ -4343,6 +4418,71 @@ TEST(SliceMutDeathTest, RotateRightOutOfBounds) {
   }
 }
 
+TEST(Slice, RChunksNth) {
+  sus::Vec<i32> v = sus::vec(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+  auto s = v.as_slice();
+
+  {
+    auto it = s.rchunks(3u);
+    EXPECT_EQ(it.nth(1u).unwrap(), sus::Vec<i32>::with_values(4, 5, 6));
+    EXPECT_EQ(it.nth_back(0u).unwrap(), sus::Vec<i32>::with_values(0));
+    EXPECT_EQ(it.exact_size_hint(), 1u);
+    EXPECT_EQ(it.nth(1u), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = s.rchunks(3u);
+    EXPECT_EQ(it.nth_back(1u).unwrap(), sus::Vec<i32>::with_values(1, 2, 3));
+    EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>::with_values(7, 8, 9));
+    EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>::with_values(4, 5, 6));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  EXPECT_EQ(s.rchunks(3u).nth(3u).unwrap(), sus::Vec<i32>::with_values(0));
+  EXPECT_EQ(s.rchunks(3u).nth(usize::MAX), sus::None);
+  EXPECT_EQ(s.rchunks(3u).last().unwrap(), sus::Vec<i32>::with_values(0));
+  EXPECT_EQ(s.rchunks(5u).last().unwrap(),
+            sus::Vec<i32>::with_values(0, 1, 2, 3, 4));
+  EXPECT_EQ(s.rchunks(3u).count(), 4u);
+
+  auto sm = v.as_mut_slice();
+  EXPECT_EQ(sm.rchunks_mut(4u).nth(2u).unwrap(),
+            sus::Vec<i32>::with_values(0, 1));
+  EXPECT_EQ(sm.rchunks_mut(4u).nth_back(2u).unwrap(),
+            sus::Vec<i32>::with_values(6, 7, 8, 9));
+  EXPECT_EQ(sm.rchunks_mut(4u).last().unwrap(),
+            sus::Vec<i32>::with_values(0, 1));
+  EXPECT_EQ(sm.rchunks_mut(4u).count(), 3u);
+}
+
+TEST(Slice, RChunksExactNth) {
+  sus::Vec<i32> v = sus::vec(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+  auto s = v.as_slice();
+
+  {
+    auto it = s.rchunks_exact(3u);
+    EXPECT_EQ(it.nth(1u).unwrap(), sus::Vec<i32>::with_values(4, 5, 6));
+    EXPECT_EQ(it.nth(0u).unwrap(), sus::Vec<i32>::with_values(1, 2, 3));
+    EXPECT_EQ(it.nth(0u), sus::None);
+  }
+  {
+    auto it = s.rchunks_exact(3u);
+    EXPECT_EQ(it.nth_back(1u).unwrap(), sus::Vec<i32>::with_values(4, 5, 6));
+    EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>::with_values(7, 8, 9));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  EXPECT_EQ(s.rchunks_exact(3u).nth(3u), sus::None);
+  EXPECT_EQ(s.rchunks_exact(3u).last().unwrap(),
+            sus::Vec<i32>::with_values(1, 2, 3));
+  EXPECT_EQ(s.rchunks_exact(3u).count(), 3u);
+
+  auto sm = v.as_mut_slice();
+  EXPECT_EQ(sm.rchunks_exact_mut(4u).nth(1u).unwrap(),
+            sus::Vec<i32>::with_values(2, 3, 4, 5));
+  EXPECT_EQ(sm.rchunks_exact_mut(4u).nth_back(0u).unwrap(),
+            sus::Vec<i32>::with_values(2, 3, 4, 5));
+  EXPECT_EQ(sm.rchunks_exact_mut(4u).count(), 2u);
+}
+
 TEST(Slice, Split) {
   auto v = sus::Vec<i32>::with_values(1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 7, 8);
   auto s = v.as_slice();
@@ -4607,6 +4747,26 @@ TEST(SliceMut, SplitMut) {
   }
 }
 
+TEST(Slice, SplitIterLast) {
+  auto v = sus::Vec<i32>::with_values(1, 2, 3, 4, 3, 5);
+  auto s = v.as_slice();
+
+  EXPECT_EQ(s.split([](const i32& i) { return i == 3; }).last().unwrap(),
+            sus::Vec<i32>::with_values(5));
+  EXPECT_EQ(s.split([](const i32& i) { return i == -1; }).last().unwrap(), s);
+  EXPECT_EQ(s.rsplit([](const i32& i) { return i == 3; }).last().unwrap(),
+            sus::Vec<i32>::with_values(1, 2));
+  EXPECT_EQ(
+      s.split_inclusive([](const i32& i) { return i == 3; }).last().unwrap(),
+      sus::Vec<i32>::with_values(5));
+
+  auto sm = v.as_mut_slice();
+  EXPECT_EQ(sm.split_mut([](const i32& i) { return i == 3; }).last().unwrap(),
+            sus::Vec<i32>::with_values(5));
+  EXPECT_EQ(sm.rsplit_mut([](const i32& i) { return i == 3; }).last().unwrap(),
+            sus::Vec<i32>::with_values(1, 2));
+}
+
 TEST(Slice, SplitInclusive) {
   auto v = sus::Vec<i32>::with_values(1, 2, 2, 3, 4, 5, 5, 6, 7, 7, 7, 8);
   auto s = v.as_slice();
@@ -5820,6 +5980,34 @@ TEST(Slice, Windows) {
   EXPECT_EQ(w7.next(), sus::None);
 }
 
+TEST(Slice, WindowsNth) {
+  sus::Vec<i32> v = sus::vec(0, 1, 2, 3, 4, 5, 6, 7);
+  sus::Slice<i32> s = v.as_slice();
+
+  {
+    auto it = s.windows(3u);
+    EXPECT_EQ(it.nth(2u).unwrap(), sus::Vec<i32>::with_values(2, 3, 4));
+    EXPECT_EQ(it.nth_back(1u).unwrap(), sus::Vec<i32>::with_values(4, 5, 6));
+    EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>::with_values(3, 4, 5));
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  EXPECT_EQ(s.windows(3u).nth(6u), sus::None);
+  EXPECT_EQ(s.windows(3u).nth(usize::MAX), sus::None);
+  EXPECT_EQ(s.windows(3u).nth_back(6u), sus::None);
+  EXPECT_EQ(s.windows(3u).last().unwrap(), sus::Vec<i32>::with_values(5, 6, 7));
+  EXPECT_EQ(s.windows(9u).last(), sus::None);
+  EXPECT_EQ(s.windows(3u).count(), 6u);
+
+  sus::SliceMut<i32> sm = v.as_mut_slice();
+  EXPECT_EQ(sm.windows_mut(3u).nth(5u).unwrap(),
+            sus::Vec<i32>::with_values(5, 6, 7));
+  EXPECT_EQ(sm.windows_mut(3u).nth_back(5u).unwrap(),
+            sus::Vec<i32>::with_values(0, 1, 2));
+  EXPECT_EQ(sm.windows_mut(3u).last().unwrap(),
+            sus::Vec<i32>::with_values(5, 6, 7));
+  EXPECT_EQ(sm.windows_mut(3u).count(), 6u);
+}
+
 TEST(SliceMut, WindowsMut) {
   sus::Vec<i32> v = sus::vec(0, 1, 2, 3, 4, 5, 6, 7);
   sus::SliceMut<i32> s = v.as_mut_slice();
@@ -5868,4 +6056,413 @@ TEST(SliceMut, WindowsMut) {
   EXPECT_EQ(w7.next(), sus::None);
 }
 
+TEST(Slice, NeverValueField) {
+  static_assert(sus::mem::NeverValueField<Slice<i32>>);
+  static_assert(sizeof(sus::Option<Slice<i32>>) == sizeof(Slice<i32>));
+  static_assert(sus::mem::NeverValueField<SliceMut<i32>>);
+  static_assert(sizeof(sus::Option<SliceMut<i32>>) == sizeof(SliceMut<i32>));
+
+  i32 a[] = {1, 2, 3};
+  auto o = sus::Option<Slice<i32>>::none();
+  EXPECT_EQ(o, sus::None);
+  o.insert(Slice<i32>::from(a));
+  EXPECT_EQ(o, sus::Some);
+  EXPECT_EQ(o.as_ref().unwrap().len(), 3u);
+  // An empty Slice is still Some.
+  o.insert(Slice<i32>());
+  EXPECT_EQ(o, sus::Some);
+
+  auto m = sus::Option<SliceMut<i32>>::some(SliceMut<i32>::from(a));
+  EXPECT_EQ(m, sus::Some);
+  EXPECT_EQ(m.take().unwrap().len(), 3u);
+  EXPECT_EQ(m, sus::None);
+}
+
+TEST(Slice, Sum) {
+  i32 a[] = {1, 2, 3, 4};
+  EXPECT_EQ(Slice<i32>::from(a).sum(), 10);
+  EXPECT_EQ(Slice<i32>().sum(), 0);
+
+  // Enough values to fill the vector lanes, with a remainder.
+  auto v = sus::Vec<u32>();
+  for (u32 i = 1u; i <= 1001u; i += 1u) v.push(i);
+  EXPECT_EQ(v.sum(), 501501u);
+  EXPECT_EQ(v.checked_sum(), sus::some(501501_u32));
+
+  // Only the total needs to fit, not each partial sum.
+  i8 b[] = {100_i8, 100_i8, -100_i8};
+  EXPECT_EQ(Slice<i8>::from(b).checked_sum(), sus::some(100_i8));
+  EXPECT_EQ(Slice<i8>::from(b).saturating_sum(), 100_i8);
+
+  i64 c[] = {i64::MAX, i64::MAX, i64::MIN, i64::MIN};
+  EXPECT_EQ(Slice<i64>::from(c).sum(), -2);
+}
+
+TEST(Slice, CheckedSum) {
+  u8 a[] = {200_u8, 55_u8};
+  EXPECT_EQ(Slice<u8>::from(a).checked_sum(), sus::some(255_u8));
+  u8 b[] = {200_u8, 56_u8};
+  EXPECT_EQ(Slice<u8>::from(b).checked_sum(), sus::None);
+
+  i16 c[] = {i16::MIN, -1_i16};
+  EXPECT_EQ(Slice<i16>::from(c).checked_sum(), sus::None);
+
+  u64 d[] = {u64::MAX, 1_u64};
+  EXPECT_EQ(Slice<u64>::from(d).checked_sum(), sus::None);
+  u64 e[] = {u64::MAX - 1_u64, 1_u64};
+  EXPECT_EQ(Slice<u64>::from(e).checked_sum(), sus::some(u64::MAX));
+
+  i64 f[] = {i64::MIN, -1_i64};
+  EXPECT_EQ(Slice<i64>::from(f).checked_sum(), sus::None);
+  i64 g[] = {i64::MIN, i64::MIN, i64::MAX};
+  EXPECT_EQ(Slice<i64>::from(g).checked_sum(), sus::None);
+}
+
+TEST(Slice, SaturatingSum) {
+  u8 a[] = {200_u8, 56_u8};
+  EXPECT_EQ(Slice<u8>::from(a).saturating_sum(), u8::MAX);
+
+  i32 b[] = {i32::MIN, -1_i32, 5_i32};
+  EXPECT_EQ(Slice<i32>::from(b).saturating_sum(), i32::MIN + 4_i32);
+  i32 c[] = {i32::MIN, -1_i32};
+  EXPECT_EQ(Slice<i32>::from(c).saturating_sum(), i32::MIN);
+
+  i64 d[] = {i64::MAX, 1_i64};
+  EXPECT_EQ(Slice<i64>::from(d).saturating_sum(), i64::MAX);
+  u64 e[] = {u64::MAX, u64::MAX};
+  EXPECT_EQ(Slice<u64>::from(e).saturating_sum(), u64::MAX);
+}
+
+TEST(Slice, WrappingSum) {
+  u8 a[] = {200_u8, 56_u8, 3_u8};
+  EXPECT_EQ(Slice<u8>::from(a).wrapping_sum(), 3_u8);
+  i8 b[] = {i8::MIN, -1_i8};
+  EXPECT_EQ(Slice<i8>::from(b).wrapping_sum(), i8::MAX);
+  u64 c[] = {u64::MAX, 2_u64};
+  EXPECT_EQ(Slice<u64>::from(c).wrapping_sum(), 1_u64);
+  EXPECT_EQ(Slice<i32>().wrapping_sum(), 0_i32);
+}
+
+TEST(SliceDeathTest, SumOverflow) {
+  i8 a[] = {i8::MAX, 1_i8};
+  auto s = Slice<i8>::from(a);
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto x = s.sum();
+        EXPECT_EQ(x, 0);
+      },
+      "");
+#endif
+}
+
+TEST(Slice, Product) {
+  i32 a[] = {2, 3, 4};
+  EXPECT_EQ(Slice<i32>::from(a).product(), 24);
+  EXPECT_EQ(Slice<i32>().product(), 1);
+
+  // The minimum value fits, though its magnitude is larger than the maximum.
+  i8 b[] = {-64_i8, 2_i8};
+  EXPECT_EQ(Slice<i8>::from(b).checked_product(), sus::some(i8::MIN));
+  i8 c[] = {64_i8, 2_i8};
+  EXPECT_EQ(Slice<i8>::from(c).checked_product(), sus::None);
+  EXPECT_EQ(Slice<i8>::from(c).saturating_product(), i8::MAX);
+  EXPECT_EQ(Slice<i8>::from(c).wrapping_product(), i8::MIN);
+
+  // A zero makes the product fit, no matter what comes before it.
+  i8 d[] = {100_i8, 100_i8, -3_i8, 0_i8};
+  EXPECT_EQ(Slice<i8>::from(d).checked_product(), sus::some(0_i8));
+  i8 e[] = {100_i8, 100_i8, -3_i8};
+  EXPECT_EQ(Slice<i8>::from(e).checked_product(), sus::None);
+  EXPECT_EQ(Slice<i8>::from(e).saturating_product(), i8::MIN);
+
+  u64 f[] = {u64::MAX, 2_u64};
+  EXPECT_EQ(Slice<u64>::from(f).checked_product(), sus::None);
+  EXPECT_EQ(Slice<u64>::from(f).saturating_product(), u64::MAX);
+  EXPECT_EQ(Slice<u64>::from(f).wrapping_product(), u64::MAX - 1_u64);
+
+  // Multiplying u16 values would promote to (signed) int, which must not
+  // overflow.
+  u16 g[] = {u16::MAX, u16::MAX};
+  EXPECT_EQ(Slice<u16>::from(g).wrapping_product(), 1_u16);
+}
+
+TEST(Slice, Dot) {
+  i32 a[] = {1, 2, 3};
+  i32 b[] = {4, -5, 6};
+  EXPECT_EQ(Slice<i32>::from(a).dot(Slice<i32>::from(b)), 12);
+  EXPECT_EQ(Slice<i32>().dot(Slice<i32>()), 0);
+
+  auto v = sus::Vec<i16>();
+  auto w = sus::Vec<i16>();
+  for (i16 i = 0_i16; i < 100_i16; i += 1_i16) {
+    v.push(i);
+    w.push(-i);
+  }
+  EXPECT_EQ(v.checked_dot(w), sus::None);
+  EXPECT_EQ(v.saturating_dot(w), i16::MIN);
+  // -328350 wraps to -328350 + 5 * 65536.
+  EXPECT_EQ(v.wrapping_dot(w), -670_i16);
+
+  // The products overflow, but their sum does not.
+  i64 c[] = {i64::MAX, i64::MAX};
+  i64 d[] = {2_i64, -2_i64};
+  EXPECT_EQ(Slice<i64>::from(c).checked_dot(Slice<i64>::from(d)),
+            sus::some(0_i64));
+  i64 e[] = {i64::MIN, i64::MIN};
+  i64 f[] = {i64::MIN, 1_i64};
+  EXPECT_EQ(Slice<i64>::from(e).checked_dot(Slice<i64>::from(f)), sus::None);
+  EXPECT_EQ(Slice<i64>::from(e).saturating_dot(Slice<i64>::from(f)),
+            i64::MAX);
+  EXPECT_EQ(Slice<i64>::from(e).wrapping_dot(Slice<i64>::from(f)), i64::MIN);
+
+  u64 g[] = {u64::MAX};
+  EXPECT_EQ(Slice<u64>::from(g).checked_dot(Slice<u64>::from(g)), sus::None);
+  EXPECT_EQ(Slice<u64>::from(g).saturating_dot(Slice<u64>::from(g)),
+            u64::MAX);
+  EXPECT_EQ(Slice<u64>::from(g).wrapping_dot(Slice<u64>::from(g)), 1_u64);
+
+  u32 h[] = {u32::MAX, u32::MAX};
+  u32 k[] = {1_u32, 0_u32};
+  EXPECT_EQ(Slice<u32>::from(h).checked_dot(Slice<u32>::from(k)),
+            sus::some(u32::MAX));
+}
+
+TEST(SliceDeathTest, DotLengthMismatch) {
+  i32 a[] = {1, 2, 3};
+  i32 b[] = {1, 2};
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto x = Slice<i32>::from(a).dot(Slice<i32>::from(b));
+        EXPECT_EQ(x, 0);
+      },
+      "");
+#endif
+}
+
+TEST(Slice, FloatSum) {
+  EXPECT_EQ(Slice<f64>().sum(), 0_f64);
+
+  auto v = sus::Vec<f64>();
+  for (f64 x = 1_f64; x <= 1000_f64; x += 1_f64) v.push(x);
+  EXPECT_EQ(v.sum(), 500500_f64);
+
+  // Pairwise summation keeps the error small where adding each value in turn
+  // into an f32 would drift.
+  auto w = sus::Vec<f32>();
+  for (i32 i = 0; i < 100000; i += 1) w.push(0.1_f32);
+  EXPECT_LT((w.sum() - 10000_f32).abs(), 0.01_f32);
+
+  f32 a[] = {1.5_f32, 2_f32, 4_f32};
+  EXPECT_EQ(Slice<f32>::from(a).product(), 12_f32);
+  EXPECT_EQ(Slice<f32>().product(), 1_f32);
+  EXPECT_EQ(Slice<f32>::from(a).dot(Slice<f32>::from(a)), 22.25_f32);
+}
+
+TEST(Slice, MinMax) {
+  EXPECT_EQ(Slice<i32>().min(), sus::None);
+  EXPECT_EQ(Slice<i32>().max(), sus::None);
+  EXPECT_EQ(Slice<i32>().minmax(), sus::None);
+
+  auto v = sus::Vec<i32>();
+  for (i32 i = 0; i < 1000; i += 1) v.push((i * 37) % 1001 - 500);
+  EXPECT_EQ(v.min(), sus::some(-500_i32));
+  EXPECT_EQ(v.max(), sus::some(500_i32));
+  EXPECT_EQ(v.minmax(), sus::some(sus::Tuple<i32, i32>::with(-500, 500)));
+
+  u8 a[] = {7_u8};
+  EXPECT_EQ(Slice<u8>::from(a).minmax(),
+            sus::some(sus::Tuple<u8, u8>::with(7_u8, 7_u8)));
+
+  // NaN is skipped.
+  f64 b[] = {f64::NAN, 2_f64, -1_f64, f64::NAN, 0.5_f64};
+  EXPECT_EQ(Slice<f64>::from(b).min(), sus::some(-1_f64));
+  EXPECT_EQ(Slice<f64>::from(b).max(), sus::some(2_f64));
+  f64 c[] = {f64::NAN, f64::NAN};
+  EXPECT_TRUE(Slice<f64>::from(c).min().unwrap().is_nan());
+  EXPECT_TRUE(Slice<f64>::from(c).max().unwrap().is_nan());
+}
+
+TEST(SliceMut, CheckedAddAssign) {
+  auto v = sus::Vec<u32>();
+  auto w = sus::Vec<u32>();
+  for (u32 i = 0u; i < 1000u; i += 1u) {
+    v.push(i);
+    w.push(i * 2u);
+  }
+  EXPECT_EQ(v.checked_add_assign(w), sus::None);
+  for (u32 i = 0u; i < 1000u; i += 1u) EXPECT_EQ(v[size_t{i}], i * 3u);
+
+  // Stops at the first overflow, with later elements unchanged.
+  w[700u] = u32::MAX;
+  w[900u] = u32::MAX;
+  EXPECT_EQ(v.checked_add_assign(w), sus::some(700_usize));
+  for (u32 i = 0u; i < 700u; i += 1u) EXPECT_EQ(v[size_t{i}], i * 5u);
+  for (u32 i = 700u; i < 1000u; i += 1u) EXPECT_EQ(v[size_t{i}], i * 3u);
+
+  // The slice can be added to itself.
+  i8 a[] = {1_i8, -2_i8, 63_i8};
+  auto s = SliceMut<i8>::from(a);
+  EXPECT_EQ(s.checked_add_assign(s), sus::None);
+  EXPECT_EQ(a[2u], 126_i8);
+  EXPECT_EQ(s.checked_add_assign(s), sus::some(2_usize));
+  EXPECT_EQ(a[0u], 4_i8);
+  EXPECT_EQ(a[1u], -8_i8);
+  EXPECT_EQ(a[2u], 126_i8);
+
+  i64 b[] = {i64::MIN, 5_i64};
+  i64 c[] = {-1_i64, 5_i64};
+  EXPECT_EQ(SliceMut<i64>::from(b).checked_add_assign(Slice<i64>::from(c)),
+            sus::some(0_usize));
+  EXPECT_EQ(b[0u], i64::MIN);
+  EXPECT_EQ(b[1u], 5_i64);
+}
+
+TEST(SliceMut, CheckedSubAssign) {
+  u8 a[] = {5_u8, 3_u8};
+  u8 b[] = {5_u8, 4_u8};
+  EXPECT_EQ(SliceMut<u8>::from(a).checked_sub_assign(Slice<u8>::from(b)),
+            sus::some(1_usize));
+  EXPECT_EQ(a[0u], 0_u8);
+  EXPECT_EQ(a[1u], 3_u8);
+
+  i32 c[] = {i32::MIN + 1_i32, i32::MAX};
+  i32 d[] = {1_i32, -1_i32};
+  EXPECT_EQ(SliceMut<i32>::from(c).checked_sub_assign(Slice<i32>::from(d)),
+            sus::some(1_usize));
+  EXPECT_EQ(c[0u], i32::MIN);
+}
+
+TEST(SliceMut, CheckedMulAssign) {
+  i16 a[] = {-256_i16, -256_i16};
+  i16 b[] = {128_i16, 129_i16};
+  EXPECT_EQ(SliceMut<i16>::from(a).checked_mul_assign(Slice<i16>::from(b)),
+            sus::some(1_usize));
+  EXPECT_EQ(a[0u], i16::MIN);
+  EXPECT_EQ(a[1u], -256_i16);
+
+  u64 c[] = {1_u64 << 32u, 1_u64 << 32u};
+  u64 d[] = {(1_u64 << 32u) - 1_u64, 1_u64 << 32u};
+  EXPECT_EQ(SliceMut<u64>::from(c).checked_mul_assign(Slice<u64>::from(d)),
+            sus::some(1_usize));
+  EXPECT_EQ(c[0u], u64::MAX - u64::MAX / (1_u64 << 32u));
+
+  i64 e[] = {i64::MIN, 3_i64};
+  i64 f[] = {1_i64, -3_i64};
+  EXPECT_EQ(SliceMut<i64>::from(e).checked_mul_assign(Slice<i64>::from(f)),
+            sus::None);
+  EXPECT_EQ(e[1u], -9_i64);
+}
+
+TEST(SliceMut, SaturatingAssign) {
+  u8 a[] = {200_u8, 10_u8, 3_u8};
+  u8 b[] = {100_u8, 20_u8, 100_u8};
+  auto s = SliceMut<u8>::from(a);
+  s.saturating_add_assign(Slice<u8>::from(b));
+  EXPECT_EQ(a[0u], u8::MAX);
+  EXPECT_EQ(a[1u], 30_u8);
+  s.saturating_sub_assign(Slice<u8>::from(b));
+  EXPECT_EQ(a[0u], 155_u8);
+  EXPECT_EQ(a[1u], 10_u8);
+  EXPECT_EQ(a[2u], 3_u8);
+  s.saturating_mul_assign(Slice<u8>::from(b));
+  EXPECT_EQ(a[0u], u8::MAX);
+  EXPECT_EQ(a[1u], 200_u8);
+  EXPECT_EQ(a[2u], u8::MAX);
+
+  i32 c[] = {i32::MAX, i32::MIN, -5_i32};
+  i32 d[] = {1_i32, -1_i32, 2_i32};
+  auto t = SliceMut<i32>::from(c);
+  t.saturating_add_assign(Slice<i32>::from(d));
+  EXPECT_EQ(c[0u], i32::MAX);
+  EXPECT_EQ(c[1u], i32::MIN);
+  EXPECT_EQ(c[2u], -3_i32);
+  t.saturating_sub_assign(Slice<i32>::from(d));
+  EXPECT_EQ(c[0u], i32::MAX - 1_i32);
+  EXPECT_EQ(c[1u], i32::MIN + 1_i32);
+  EXPECT_EQ(c[2u], -5_i32);
+  i32 e[] = {2_i32, -2_i32, i32::MAX};
+  t.saturating_mul_assign(Slice<i32>::from(e));
+  EXPECT_EQ(c[0u], i32::MAX);
+  EXPECT_EQ(c[1u], i32::MAX);
+  EXPECT_EQ(c[2u], i32::MIN);
+
+  i64 f[] = {i64::MIN, i64::MAX};
+  i64 g[] = {-1_i64, -2_i64};
+  SliceMut<i64>::from(f).saturating_mul_assign(Slice<i64>::from(g));
+  EXPECT_EQ(f[0u], i64::MAX);
+  EXPECT_EQ(f[1u], i64::MIN);
+}
+
+TEST(SliceMut, WrappingAssign) {
+  sus::Vec<u8> v = sus::vec(250_u8, 10_u8, 16_u8);
+  sus::Vec<u8> w = sus::vec(10_u8, 20_u8, 16_u8);
+  v.wrapping_add_assign(w);
+  EXPECT_EQ(v, sus::Vec<u8>::with_values(4_u8, 30_u8, 32_u8));
+  v.wrapping_sub_assign(w);
+  EXPECT_EQ(v, sus::Vec<u8>::with_values(250_u8, 10_u8, 16_u8));
+  v.wrapping_mul_assign(w);
+  EXPECT_EQ(v, sus::Vec<u8>::with_values(196_u8, 200_u8, 0_u8));
+
+  // Multiplying u16 values would promote to (signed) int, which must not
+  // overflow.
+  u16 a[] = {u16::MAX};
+  SliceMut<u16>::from(a).wrapping_mul_assign(Slice<u16>::from(a));
+  EXPECT_EQ(a[0u], 1_u16);
+
+  i64 b[] = {i64::MAX, i64::MIN};
+  i64 c[] = {1_i64, -1_i64};
+  auto s = SliceMut<i64>::from(b);
+  s.wrapping_add_assign(Slice<i64>::from(c));
+  EXPECT_EQ(b[0u], i64::MIN);
+  EXPECT_EQ(b[1u], i64::MAX);
+  s.wrapping_sub_assign(Slice<i64>::from(c));
+  EXPECT_EQ(b[0u], i64::MAX);
+  EXPECT_EQ(b[1u], i64::MIN);
+}
+
+TEST(SliceMutDeathTest, ElementwiseMismatch) {
+  i32 a[] = {1, 2, 3, 4};
+  i32 b[] = {1, 2, 3};
+  auto s = SliceMut<i32>::from(a);
+#if GTEST_HAS_DEATH_TEST
+  // Different lengths.
+  EXPECT_DEATH(s.wrapping_add_assign(Slice<i32>::from(b)), "");
+  // Overlapping slices that are not the same.
+  EXPECT_DEATH(s["0..3"_r].checked_add_assign(s["1..4"_r]), "");
+#endif
+}
+
+TEST(SliceMut, Shuffle) {
+  auto rng = sus::rand::Xoshiro256StarStar::with_seed(7u);
+  // Empty and single element slices are left alone.
+  auto empty = Vec<i32>();
+  empty.as_mut_slice().shuffle(rng);
+  i32 one[] = {5};
+  SliceMut<i32>::from(one).shuffle(rng);
+  EXPECT_EQ(one[0u], 5);
+
+  // The elements are permuted, and each of the 6 orders of 3 elements is
+  // equally likely.
+  u32 counts[6u] = {};
+  for (auto i = 0_usize; i < 60000u; i += 1u) {
+    i32 a[] = {0, 1, 2};
+    SliceMut<i32>::from(a).shuffle(rng);
+    EXPECT_EQ(a[0u] + a[1u] + a[2u], 3);
+    EXPECT_NE(a[0u], a[1u]);
+    counts[size_t{a[0u] * 2 + (a[1u] > a[2u] ? 1 : 0)}] += 1u;
+  }
+  for (u32 c : counts) {
+    EXPECT_GT(c, 9600u);
+    EXPECT_LT(c, 10400u);
+  }
+
+  // Vec has the method too.
+  auto v = Vec<i32>::with_values(1, 2, 3, 4, 5, 6, 7, 8);
+  v.shuffle(rng);
+  v.sort();
+  EXPECT_EQ(v, Vec<i32>::with_values(1, 2, 3, 4, 5, 6, 7, 8));
+}
+
 }  // namespace
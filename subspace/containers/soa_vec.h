@@ -0,0 +1,266 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <tuple>  // For std::tuple_element.
+#include <type_traits>
+#include <utility>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/iterators/soa_vec_iter.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/macros/pure.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/ord.h"
+#include "subspace/option/option.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::containers {
+
+/// A resizeable sequence of rows, where each row is a `Tuple<Ts...>`, stored
+/// as a structure of arrays.
+///
+/// Each field of the rows is stored in its own contiguous column, so that code
+/// which reads only some of the fields does not pull the others through the
+/// cache. Each column is exposed as a `Slice` or `SliceMut` through
+/// `column<I>()` and `column_mut<I>()`, so slice algorithms can run on a single
+/// field of every row, and `column<I>().iter()` iterates over that field.
+///
+/// The rows are iterated with `iter()` and `iter_mut()`, which return a
+/// `Tuple` of references to the fields of each row, or in a ranged for loop.
+///
+/// # Example
+/// ```
+/// auto v = sus::SoaVec<i32, f32>();
+/// v.push(sus::Tuple<i32, f32>::with(1, 2.f));
+/// v.push(sus::Tuple<i32, f32>::with(3, 4.f));
+/// sus::Slice<f32> floats = v.column<1>();
+/// f32 total = 0.f;
+/// for (auto [i, f] : v) total += f;
+/// ```
+template <class... Ts>
+  requires(sizeof...(Ts) > 0u)
+class SoaVec final {
+  static_assert((... && !std::is_reference_v<Ts>),
+                "SoaVec can not hold references.");
+  static_assert((... && !std::is_const_v<Ts>),
+                "`SoaVec<const T>` should be written `const SoaVec<T>`, as "
+                "const applies transitively.");
+
+  /// The type of the `I`th field of each row.
+  template <size_t I>
+  using Field = std::tuple_element_t<I, ::sus::Tuple<Ts...>>;
+
+ public:
+  /// The type of each row.
+  using Row = ::sus::Tuple<Ts...>;
+
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty SoaVec, which does not allocate.
+  inline constexpr SoaVec() noexcept
+      : columns_(::sus::Tuple<Vec<Ts>...>::with(Vec<Ts>()...)) {}
+
+  /// Creates a SoaVec with space for at least `capacity` rows.
+  ///
+  /// # Panics
+  /// Panics if the capacity of any column exceeds `isize::MAX` bytes.
+  static inline SoaVec with_capacity(usize capacity) noexcept {
+    return SoaVec(Vec<Ts>::with_capacity(capacity)...);
+  }
+
+  SoaVec(SoaVec&&) noexcept = default;
+  SoaVec& operator=(SoaVec&&) noexcept = default;
+
+  /// sus::mem::Clone trait.
+  SoaVec clone() const& noexcept
+    requires((... && ::sus::mem::Clone<Ts>))
+  {
+    return clone_impl(std::index_sequence_for<Ts...>());
+  }
+
+  /// Returns the number of rows.
+  [[nodiscard]] sus_pure constexpr inline usize len() const& noexcept {
+    return columns_.template at<0u>().len();
+  }
+
+  /// Returns true if there are no rows.
+  [[nodiscard]] sus_pure constexpr inline bool is_empty() const& noexcept {
+    return len() == 0u;
+  }
+
+  /// Returns the number of rows the SoaVec can hold without reallocating.
+  [[nodiscard]] sus_pure constexpr inline usize capacity() const& noexcept {
+    return capacity_impl(std::index_sequence_for<Ts...>());
+  }
+
+  /// Reserves capacity for at least `additional` more rows.
+  ///
+  /// # Panics
+  /// Panics if the capacity of any column exceeds `isize::MAX` bytes.
+  void reserve(usize additional) noexcept {
+    reserve_impl(additional, std::index_sequence_for<Ts...>());
+  }
+
+  /// Removes all rows, without changing the capacity.
+  void clear() noexcept { clear_impl(std::index_sequence_for<Ts...>()); }
+
+  /// Appends a row, moving each of its fields into the back of its column.
+  ///
+  /// # Panics
+  /// Panics if the capacity of any column exceeds `isize::MAX` bytes.
+  void push(Row row) noexcept {
+    push_impl(::sus::move(row), std::index_sequence_for<Ts...>());
+  }
+
+  /// Removes the last row and returns it, or None if the SoaVec is empty.
+  Option<Row> pop() noexcept {
+    if (is_empty()) return Option<Row>::none();
+    return Option<Row>::some(pop_impl(std::index_sequence_for<Ts...>()));
+  }
+
+  /// Returns const references to the fields of the row at `index`, or None if
+  /// `index` is out of bounds.
+  Option<::sus::Tuple<const Ts&...>> get(usize index) const& noexcept {
+    if (index >= len()) return Option<::sus::Tuple<const Ts&...>>::none();
+    return Option<::sus::Tuple<const Ts&...>>::some(
+        get_impl(index, std::index_sequence_for<Ts...>()));
+  }
+  Option<::sus::Tuple<const Ts&...>> get(usize index) && = delete;
+
+  /// Returns mutable references to the fields of the row at `index`, or None
+  /// if `index` is out of bounds.
+  Option<::sus::Tuple<Ts&...>> get_mut(usize index) & noexcept {
+    if (index >= len()) return Option<::sus::Tuple<Ts&...>>::none();
+    return Option<::sus::Tuple<Ts&...>>::some(
+        get_mut_impl(index, std::index_sequence_for<Ts...>()));
+  }
+
+  /// Returns an iterator over the rows, which returns a `Tuple` of const
+  /// references to the fields of each row.
+  SoaVecIter<Ts...> iter() const& noexcept sus_lifetimebound {
+    return iter_impl(std::index_sequence_for<Ts...>());
+  }
+  SoaVecIter<Ts...> iter() && = delete;
+
+  /// Returns an iterator over the rows, which returns a `Tuple` of mutable
+  /// references to the fields of each row.
+  SoaVecIterMut<Ts...> iter_mut() & noexcept sus_lifetimebound {
+    return iter_mut_impl(std::index_sequence_for<Ts...>());
+  }
+
+  /// Returns a slice over the `I`th field of every row.
+  template <size_t I>
+    requires(I < sizeof...(Ts))
+  [[nodiscard]] sus_pure constexpr Slice<Field<I>> column() const& noexcept
+      sus_lifetimebound {
+    return columns_.template at<I>().as_slice();
+  }
+  template <size_t I>
+  constexpr Slice<Field<I>> column() && = delete;
+
+  /// Returns a mutable slice over the `I`th field of every row.
+  template <size_t I>
+    requires(I < sizeof...(Ts))
+  [[nodiscard]] sus_pure constexpr SliceMut<Field<I>> column_mut() & noexcept
+      sus_lifetimebound {
+    return columns_.template at_mut<I>().as_mut_slice();
+  }
+
+ private:
+  explicit SoaVec(Vec<Ts>&&... columns) noexcept
+      : columns_(::sus::Tuple<Vec<Ts>...>::with(::sus::move(columns)...)) {}
+
+  template <size_t... Is>
+  SoaVec clone_impl(std::index_sequence<Is...>) const& noexcept {
+    return SoaVec(::sus::clone(columns_.template at<Is>())...);
+  }
+
+  template <size_t... Is>
+  constexpr usize capacity_impl(std::index_sequence<Is...>) const& noexcept {
+    usize cap = usize::MAX;
+    (..., (cap = ::sus::ops::min(cap, columns_.template at<Is>().capacity())));
+    return cap;
+  }
+
+  template <size_t... Is>
+  void reserve_impl(usize additional, std::index_sequence<Is...>) noexcept {
+    (..., columns_.template at_mut<Is>().reserve(additional));
+  }
+
+  template <size_t... Is>
+  void clear_impl(std::index_sequence<Is...>) noexcept {
+    (..., columns_.template at_mut<Is>().clear());
+  }
+
+  template <size_t... Is>
+  void push_impl(Row&& row, std::index_sequence<Is...>) noexcept {
+    (..., columns_.template at_mut<Is>().push(
+              ::sus::move(row.template at_mut<Is>())));
+  }
+
+  template <size_t... Is>
+  Row pop_impl(std::index_sequence<Is...>) noexcept {
+    return Row::with(
+        ::sus::move(columns_.template at_mut<Is>().pop()).unwrap()...);
+  }
+
+  template <size_t... Is>
+  SoaVecIter<Ts...> iter_impl(std::index_sequence<Is...>) const& noexcept {
+    return SoaVecIter<Ts...>::with(len(),
+                                   columns_.template at<Is>().as_ptr()...);
+  }
+
+  template <size_t... Is>
+  SoaVecIterMut<Ts...> iter_mut_impl(std::index_sequence<Is...>) & noexcept {
+    return SoaVecIterMut<Ts...>::with(
+        len(), columns_.template at_mut<Is>().as_mut_ptr()...);
+  }
+
+  template <size_t... Is>
+  ::sus::Tuple<const Ts&...> get_impl(usize index,
+                                      std::index_sequence<Is...>) const& {
+    return ::sus::Tuple<const Ts&...>::with(
+        columns_.template at<Is>().get_unchecked(::sus::marker::unsafe_fn,
+                                                 index)...);
+  }
+
+  template <size_t... Is>
+  ::sus::Tuple<Ts&...> get_mut_impl(usize index,
+                                    std::index_sequence<Is...>) & {
+    return ::sus::Tuple<Ts&...>::with(
+        columns_.template at_mut<Is>().get_unchecked_mut(
+            ::sus::marker::unsafe_fn, index)...);
+  }
+
+  // Every column always has the same length.
+  ::sus::Tuple<Vec<Ts>...> columns_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(columns_));
+};
+
+}  // namespace sus::containers
+
+// Promote SoaVec into the `sus` namespace.
+namespace sus {
+using ::sus::containers::SoaVec;
+}  // namespace sus
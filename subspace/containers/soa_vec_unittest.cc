@@ -0,0 +1,188 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/containers/soa_vec.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/prelude.h"
+#include "subspace/tuple/tuple.h"
+
+using sus::containers::SoaVec;
+
+namespace {
+
+using Row = sus::Tuple<i32, f32, u8>;
+
+static_assert(sus::mem::Move<SoaVec<i32, f32>>);
+static_assert(sus::mem::Clone<SoaVec<i32, f32>>);
+static_assert(!sus::mem::Copy<SoaVec<i32, f32>>);
+static_assert(sus::mem::relocate_by_memcpy<SoaVec<i32, f32>>);
+
+TEST(SoaVec, Default) {
+  auto v = SoaVec<i32, f32, u8>();
+  EXPECT_EQ(v.len(), 0u);
+  EXPECT_TRUE(v.is_empty());
+  EXPECT_EQ(v.capacity(), 0u);
+  EXPECT_EQ(v.column<0>().len(), 0u);
+}
+
+TEST(SoaVec, WithCapacity) {
+  auto v = SoaVec<i32, f32, u8>::with_capacity(5u);
+  EXPECT_EQ(v.len(), 0u);
+  EXPECT_GE(v.capacity(), 5u);
+  v.reserve(10u);
+  EXPECT_GE(v.capacity(), 10u);
+}
+
+TEST(SoaVec, PushPop) {
+  auto v = SoaVec<i32, f32, u8>();
+  v.push(Row::with(1, 2.f, 3_u8));
+  v.push(Row::with(4, 5.f, 6_u8));
+  EXPECT_EQ(v.len(), 2u);
+  EXPECT_FALSE(v.is_empty());
+
+  EXPECT_EQ(v.pop(), sus::Option<Row>::some(Row::with(4, 5.f, 6_u8)));
+  EXPECT_EQ(v.pop(), sus::Option<Row>::some(Row::with(1, 2.f, 3_u8)));
+  EXPECT_EQ(v.pop(), sus::None);
+  EXPECT_TRUE(v.is_empty());
+}
+
+TEST(SoaVec, Columns) {
+  auto v = SoaVec<i32, f32, u8>();
+  v.push(Row::with(1, 2.f, 3_u8));
+  v.push(Row::with(4, 5.f, 6_u8));
+  v.push(Row::with(7, 8.f, 9_u8));
+
+  sus::Slice<i32> ints = v.column<0>();
+  EXPECT_EQ(ints, sus::Vec<i32>::with_values(1, 4, 7));
+  sus::Slice<f32> floats = v.column<1>();
+  EXPECT_EQ(floats, sus::Vec<f32>::with_values(2.f, 5.f, 8.f));
+  sus::Slice<u8> bytes = v.column<2>();
+  EXPECT_EQ(bytes, sus::Vec<u8>::with_values(3_u8, 6_u8, 9_u8));
+
+  // Slice algorithms run over a single column.
+  v.column_mut<0>().reverse();
+  EXPECT_EQ(v.column<0>(), sus::Vec<i32>::with_values(7, 4, 1));
+  for (f32& f : v.column_mut<1>().iter_mut()) f += 1.f;
+  EXPECT_EQ(v.column<1>(), sus::Vec<f32>::with_values(3.f, 6.f, 9.f));
+  // Other columns are unchanged.
+  EXPECT_EQ(v.column<2>(), sus::Vec<u8>::with_values(3_u8, 6_u8, 9_u8));
+}
+
+TEST(SoaVec, Get) {
+  auto v = SoaVec<i32, f32>();
+  v.push(sus::Tuple<i32, f32>::with(1, 2.f));
+  v.push(sus::Tuple<i32, f32>::with(3, 4.f));
+
+  auto r = v.get(1u).unwrap();
+  EXPECT_EQ(r.at<0>(), 3);
+  EXPECT_EQ(r.at<1>(), 4.f);
+  EXPECT_EQ(v.get(2u), sus::None);
+
+  auto m = v.get_mut(0u).unwrap();
+  m.at_mut<0>() = 10;
+  EXPECT_EQ(v.column<0>(), sus::Vec<i32>::with_values(10, 3));
+  EXPECT_EQ(v.get_mut(2u), sus::None);
+}
+
+TEST(SoaVec, Iter) {
+  auto v = SoaVec<i32, f32>();
+  EXPECT_EQ(v.iter().next(), sus::None);
+  v.push(sus::Tuple<i32, f32>::with(1, 2.f));
+  v.push(sus::Tuple<i32, f32>::with(3, 4.f));
+  v.push(sus::Tuple<i32, f32>::with(5, 6.f));
+
+  auto it = v.iter();
+  using RowRef = sus::Tuple<const i32&, const f32&>;
+  static_assert(sus::iter::DoubleEndedIterator<decltype(it), RowRef>);
+  static_assert(sus::iter::ExactSizeIterator<decltype(it), RowRef>);
+  EXPECT_EQ(it.exact_size_hint(), 3u);
+  auto first = it.next().unwrap();
+  EXPECT_EQ(first.at<0>(), 1);
+  EXPECT_EQ(first.at<1>(), 2.f);
+  EXPECT_EQ(&first.at<0>(), &v.column<0>()[0u]);
+  auto last = it.next_back().unwrap();
+  EXPECT_EQ(last.at<0>(), 5);
+  EXPECT_EQ(it.nth(0u).unwrap(), sus::tuple(3, 4.f).construct());
+  EXPECT_EQ(it.next(), sus::None);
+  EXPECT_EQ(v.iter().nth_back(2u).unwrap(), sus::tuple(1, 2.f).construct());
+  EXPECT_EQ(v.iter().nth(3u), sus::None);
+
+  // Rows in a ranged for loop.
+  i32 ints = 0;
+  f32 floats = 0.f;
+  for (auto [i, f] : v) {
+    ints += i;
+    floats += f;
+  }
+  EXPECT_EQ(ints, 1 + 3 + 5);
+  EXPECT_EQ(floats, 2.f + 4.f + 6.f);
+
+  // A single column.
+  EXPECT_EQ(v.column<1>().iter().nth(1u).unwrap(), 4.f);
+}
+
+TEST(SoaVec, IterMut) {
+  auto v = SoaVec<i32, f32>();
+  v.push(sus::Tuple<i32, f32>::with(1, 2.f));
+  v.push(sus::Tuple<i32, f32>::with(3, 4.f));
+
+  for (auto [i, f] : v.iter_mut()) {
+    i += 10;
+    f *= 2.f;
+  }
+  EXPECT_EQ(v.column<0>(), sus::Vec<i32>::with_values(11, 13));
+  EXPECT_EQ(v.column<1>(), sus::Vec<f32>::with_values(4.f, 8.f));
+
+  auto it = v.iter_mut();
+  auto row = it.next_back().unwrap();
+  row.at_mut<0>() = 0;
+  EXPECT_EQ(it.exact_size_hint(), 1u);
+  EXPECT_EQ(v.column<0>(), sus::Vec<i32>::with_values(11, 0));
+}
+
+TEST(SoaVec, Clear) {
+  auto v = SoaVec<i32, f32>::with_capacity(4u);
+  v.push(sus::Tuple<i32, f32>::with(1, 2.f));
+  const auto cap = v.capacity();
+  v.clear();
+  EXPECT_TRUE(v.is_empty());
+  EXPECT_EQ(v.capacity(), cap);
+}
+
+TEST(SoaVec, Clone) {
+  auto v = SoaVec<i32, sus::Vec<i32>>();
+  v.push(
+      sus::Tuple<i32, sus::Vec<i32>>::with(1, sus::Vec<i32>::with_values(2)));
+  auto c = sus::clone(v);
+  EXPECT_EQ(c.len(), 1u);
+  EXPECT_EQ(c.column<0>(), sus::Vec<i32>::with_values(1));
+  EXPECT_EQ(c.column<1>()[0u], sus::Vec<i32>::with_values(2));
+  // The clone does not share storage.
+  EXPECT_NE(c.column<1>().as_ptr(), v.column<1>().as_ptr());
+}
+
+TEST(SoaVec, Move) {
+  auto v = SoaVec<i32, f32>();
+  v.push(sus::Tuple<i32, f32>::with(1, 2.f));
+  auto w = sus::move(v);
+  EXPECT_EQ(w.len(), 1u);
+  v = sus::move(w);
+  EXPECT_EQ(v.len(), 1u);
+}
+
+}  // namespace
@@ -36,6 +36,7 @@
 #include "subspace/marker/unsafe.h"
 #include "subspace/mem/clone.h"
 #include "subspace/mem/move.h"
+#include "subspace/mem/never_value.h"
 #include "subspace/mem/relocate.h"
 #include "subspace/mem/replace.h"
 #include "subspace/mem/size_of.h"
@@ -486,6 +487,62 @@ class Vec final {
     set_len(::sus::marker::unsafe_fn, self_len + 1_usize);
   }
 
+  /// Inserts an element at position `index` within the vector, shifting all
+  /// elements after it to the right.
+  ///
+  /// # Panics
+  /// Panics if `index > len()`, or if the new capacity exceeds `isize::MAX`
+  /// bytes.
+  //
+  // Receives by value for the same reason as `push()`.
+  void insert(usize index, T t) noexcept
+    requires(::sus::mem::Move<T> && !std::is_reference_v<T>)
+  {
+    check(!is_moved_from());
+    const auto self_len = len();
+    check(index <= self_len);
+    reserve(1_usize);
+    T* const p = raw_data() + size_t{index};
+    if constexpr (::sus::mem::relocate_by_memcpy<T>) {
+      ::sus::ptr::copy(::sus::marker::unsafe_fn, p, p + 1u, self_len - index);
+      new (p) T(::sus::move(t));
+    } else if (index == self_len) {
+      new (p) T(::sus::move(t));
+    } else {
+      T* const end = raw_data() + size_t{self_len};
+      new (end) T(::sus::move(*(end - 1u)));
+      for (T* q = end - 1u; q != p; --q) *q = ::sus::move(*(q - 1u));
+      *p = ::sus::move(t);
+    }
+    set_len(::sus::marker::unsafe_fn, self_len + 1_usize);
+  }
+
+  /// Removes and returns the element at position `index` within the vector,
+  /// shifting all elements after it to the left.
+  ///
+  /// # Panics
+  /// Panics if `index` is out of bounds.
+  T remove(usize index) noexcept
+    requires(::sus::mem::Move<T> && !std::is_reference_v<T>)
+  {
+    check(!is_moved_from());
+    const auto self_len = len();
+    check(index < self_len);
+    T* const p = raw_data() + size_t{index};
+    T out = ::sus::move(*p);
+    if constexpr (::sus::mem::relocate_by_memcpy<T>) {
+      p->~T();
+      ::sus::ptr::copy(::sus::marker::unsafe_fn, p + 1u, p,
+                       self_len - index - 1u);
+    } else {
+      T* const last = raw_data() + size_t{self_len} - 1u;
+      for (T* q = p; q != last; ++q) *q = ::sus::move(*(q + 1u));
+      last->~T();
+    }
+    set_len(::sus::marker::unsafe_fn, self_len - 1_usize);
+    return out;
+  }
+
   /// Constructs and appends an element to the back of the vector.
   ///
   /// The parameters to `emplace()` are used to construct the element. This
@@ -645,9 +702,12 @@ class Vec final {
                                            decltype(slice_mut_),
                                            decltype(capacity_));
 
-  // Slice does not satisfy NeverValueField because it requires that the default
-  // constructor is trivial, but Slice's default constructor needs to initialize
-  // its fields.
+  // The capacity of a live Vec, including a moved-from one, is limited by the
+  // size of an allocation to at most `isize::MAX`, which leaves `usize::MAX`
+  // unused, as a never-value for Option<Vec<T>>. The destroy-value makes the
+  // Vec appear unallocated, so the destructor does nothing.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, Vec, capacity_,
+                              ::sus::usize::MAX, 0_usize);
 };
 
 #define _ptr_expr slice_mut_.slice_.data_
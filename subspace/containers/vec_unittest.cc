@@ -1014,4 +1014,78 @@ TEST(Vec, Extend) {
   }
 }
 
+TEST(Vec, NeverValueField) {
+  static_assert(sus::mem::NeverValueField<Vec<i32>>);
+  static_assert(sizeof(sus::Option<Vec<i32>>) == sizeof(Vec<i32>));
+
+  auto o = sus::Option<Vec<i32>>::none();
+  EXPECT_EQ(o, sus::None);
+  o.insert(Vec<i32>::with_values(1, 2, 3));
+  EXPECT_EQ(o, sus::Some);
+  EXPECT_EQ(o.as_ref().unwrap(), sus::Vec<i32>::with_values(1, 2, 3));
+  auto v = o.take().unwrap();
+  EXPECT_EQ(o, sus::None);
+  EXPECT_EQ(v, sus::Vec<i32>::with_values(1, 2, 3));
+
+  // An empty Vec, and a moved-from Vec, are still Some.
+  o = sus::Option<Vec<i32>>::some(Vec<i32>());
+  EXPECT_EQ(o, sus::Some);
+  [[maybe_unused]] auto moved = sus::move(o.as_mut().unwrap());
+  EXPECT_EQ(o, sus::Some);
+  o = sus::Option<Vec<i32>>::none();
+  EXPECT_EQ(o, sus::None);
+
+  auto vo = Vec<sus::Option<Vec<i32>>>();
+  vo.push(sus::Option<Vec<i32>>::some(Vec<i32>::with_values(4)));
+  vo.push(sus::Option<Vec<i32>>::none());
+  EXPECT_EQ(vo[0u], sus::Some);
+  EXPECT_EQ(vo[1u], sus::None);
+}
+
+TEST(Vec, InsertRemove) {
+  auto v = Vec<i32>::with_values(1, 3);
+  v.insert(1u, 2);
+  v.insert(0u, 0);
+  v.insert(4u, 4);
+  EXPECT_EQ(v, Vec<i32>::with_values(0, 1, 2, 3, 4));
+  EXPECT_EQ(v.remove(0u), 0);
+  EXPECT_EQ(v.remove(1u), 2);
+  EXPECT_EQ(v.remove(2u), 4);
+  EXPECT_EQ(v, Vec<i32>::with_values(1, 3));
+
+  // A type that can't be relocated by memcpy is shifted by moves.
+  struct S {
+    S(i32 i) : i(i) {}
+    S(S&& o) : i(o.i) { o.i = -1; }
+    S& operator=(S&& o) {
+      i = o.i;
+      o.i = -1;
+      return *this;
+    }
+    i32 i;
+  };
+  static_assert(!sus::mem::relocate_by_memcpy<S>);
+  auto s = Vec<S>();
+  s.push(S(1));
+  s.push(S(3));
+  s.insert(1u, S(2));
+  s.insert(3u, S(4));
+  EXPECT_EQ(s[0u].i, 1);
+  EXPECT_EQ(s[1u].i, 2);
+  EXPECT_EQ(s[2u].i, 3);
+  EXPECT_EQ(s[3u].i, 4);
+  EXPECT_EQ(s.remove(1u).i, 2);
+  EXPECT_EQ(s.len(), 3u);
+  EXPECT_EQ(s[1u].i, 3);
+  EXPECT_EQ(s[2u].i, 4);
+}
+
+#if GTEST_HAS_DEATH_TEST
+TEST(VecDeathTest, InsertRemoveOutOfBounds) {
+  auto v = Vec<i32>::with_values(1, 2);
+  EXPECT_DEATH(v.insert(3u, 3), "");
+  EXPECT_DEATH(v.remove(2u), "");
+}
+#endif
+
 }  // namespace
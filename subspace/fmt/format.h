@@ -0,0 +1,155 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <string>
+#include <type_traits>
+
+#include "subspace/containers/vec.h"
+#include "subspace/fmt/format_string.h"
+#include "subspace/fmt/formatter.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
+
+namespace sus::fmt {
+
+namespace __private {
+
+/// A type-erased argument to be formatted.
+template <Write W>
+struct Arg {
+  const void* value;
+  void (*format)(const void* value, W& out) noexcept;
+};
+
+template <Write W, class T>
+void format_erased(const void* value, W& out) noexcept {
+  Formatter<T>::format(*static_cast<const T*>(value), out);
+}
+
+/// Writes the format string `fmt[0..len]` to `out`, replacing each `{}` with
+/// the next of `args`. The format string has already been checked at compile
+/// time.
+template <Write W>
+void format_args(W& out, const char* fmt, size_t len,
+                 const Arg<W>* args) noexcept {
+  size_t next_arg = 0u;
+  size_t literal_start = 0u;
+  for (size_t i = 0u; i < len; ++i) {
+    const char c = fmt[i];
+    if (c != '{' && c != '}') continue;
+    if (i > literal_start)
+      out.push_str(str_from_bytes(fmt + literal_start, i - literal_start));
+    if (c == '{' && fmt[i + 1u] == '}') {
+      args[next_arg].format(args[next_arg].value, out);
+      next_arg += 1u;
+      literal_start = i + 2u;
+    } else {
+      // An escaped `{{` or `}}`: the second brace begins the next literal.
+      literal_start = i + 1u;
+    }
+    i += 1u;
+  }
+  if (len > literal_start)
+    out.push_str(str_from_bytes(fmt + literal_start, len - literal_start));
+}
+
+/// Adapts a `Vec<u8>` to the `Write` concept.
+struct VecWriter {
+  ::sus::containers::Vec<u8>& vec;
+
+  void push_str(::sus::string::Str s) noexcept {
+    vec.extend_from_slice(s.as_bytes());
+  }
+};
+
+/// Adapts a `std::string` to the `Write` concept.
+struct StdStringWriter {
+  std::string& str;
+
+  void push_str(::sus::string::Str s) noexcept {
+    str.append(reinterpret_cast<const char*>(s.as_bytes().as_ptr()),
+               size_t{s.len()});
+  }
+};
+
+}  // namespace __private
+
+/// Formats `args` according to the format string `fmt`, and appends the text
+/// to `out`.
+///
+/// Each `{}` in the format string is replaced by the next argument, which is
+/// formatted by its `Formatter` specialization. The format string is checked
+/// against the arguments at compile time.
+///
+/// Nothing is allocated other than to grow `out`, so reusing the same `out`
+/// for many calls avoids allocating at all once it has grown large enough.
+///
+/// # Example
+/// ```
+/// auto s = sus::String();
+/// sus::fmt::format_to(s, "{} + {} = {}", 1_i32, 2_i32, 3_i32);
+/// sus::check(s == sus::String::from("1 + 2 = 3"));
+/// ```
+template <Write W, class... Args>
+  requires(... && Format<Args>)
+void format_to(W& out, FormatString<std::type_identity_t<Args>...> fmt,
+               const Args&... args) noexcept {
+  if constexpr (sizeof...(Args) == 0u) {
+    __private::format_args<W>(out, fmt.data(), fmt.len(), nullptr);
+  } else {
+    const __private::Arg<W> erased[] = {
+        {&args, &__private::format_erased<W, Args>}...};
+    __private::format_args<W>(out, fmt.data(), fmt.len(), erased);
+  }
+}
+
+/// Formats `args` according to the format string `fmt`, and appends the text
+/// to the bytes in `out`.
+template <class... Args>
+  requires(... && Format<Args>)
+void format_to(::sus::containers::Vec<u8>& out,
+               FormatString<std::type_identity_t<Args>...> fmt,
+               const Args&... args) noexcept {
+  auto w = __private::VecWriter{out};
+  format_to(w, fmt, args...);
+}
+
+/// Formats `args` according to the format string `fmt`, and appends the text
+/// to `out`.
+template <class... Args>
+  requires(... && Format<Args>)
+void format_to(std::string& out,
+               FormatString<std::type_identity_t<Args>...> fmt,
+               const Args&... args) noexcept {
+  auto w = __private::StdStringWriter{out};
+  format_to(w, fmt, args...);
+}
+
+/// Formats `args` according to the format string `fmt` into a new `String`.
+///
+/// See `format_to()` for the format string syntax.
+template <class... Args>
+  requires(... && Format<Args>)
+::sus::string::String format(FormatString<std::type_identity_t<Args>...> fmt,
+                             const Args&... args) noexcept {
+  auto s = ::sus::string::String();
+  format_to(s, fmt, args...);
+  return s;
+}
+
+}  // namespace sus::fmt
@@ -0,0 +1,80 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+namespace sus::fmt {
+
+namespace __private {
+// These are not constexpr, so calling one while checking a format string at
+// compile time makes the program ill-formed, with the function's name in the
+// compiler's error message.
+inline void format_string_has_unmatched_brace() {}
+inline void format_string_has_unsupported_format_spec() {}
+inline void format_string_has_too_few_arguments() {}
+inline void format_string_has_too_many_arguments() {}
+}  // namespace __private
+
+/// A format string for formatting `Args`, which is checked at compile time.
+///
+/// Each `{}` in the string is replaced by the next argument, and `{{` and
+/// `}}` are replaced by `{` and `}`. The string must have exactly one `{}` for
+/// each argument, and no other braces, or the program will not compile.
+///
+/// FormatString is constructed implicitly from a string literal when calling
+/// `format()` or `format_to()`.
+template <class... Args>
+class FormatString {
+ public:
+  template <size_t N>
+  consteval FormatString(const char (&s)[N]) noexcept : str_(s), len_(N - 1u) {
+    size_t placeholders = 0u;
+    for (size_t i = 0u; i < len_; ++i) {
+      if (s[i] == '{') {
+        if (i + 1u < len_ && s[i + 1u] == '{') {
+          i += 1u;
+        } else if (i + 1u < len_ && s[i + 1u] == '}') {
+          placeholders += 1u;
+          i += 1u;
+        } else if (i + 1u < len_ && s[i + 1u] == ':') {
+          __private::format_string_has_unsupported_format_spec();
+        } else {
+          __private::format_string_has_unmatched_brace();
+        }
+      } else if (s[i] == '}') {
+        if (i + 1u < len_ && s[i + 1u] == '}')
+          i += 1u;
+        else
+          __private::format_string_has_unmatched_brace();
+      }
+    }
+    if (placeholders > sizeof...(Args))
+      __private::format_string_has_too_few_arguments();
+    if (placeholders < sizeof...(Args))
+      __private::format_string_has_too_many_arguments();
+  }
+
+  /// The characters of the format string, which are not nul-terminated.
+  constexpr const char* data() const noexcept { return str_; }
+  /// The number of characters in the format string.
+  constexpr size_t len() const noexcept { return len_; }
+
+ private:
+  const char* str_;
+  size_t len_;
+};
+
+}  // namespace sus::fmt
@@ -0,0 +1,187 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/fmt/format.h"
+
+#include <string>
+#include <string_view>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/array.h"
+#include "subspace/containers/vec.h"
+#include "subspace/num/fixed.h"
+#include "subspace/option/option.h"
+#include "subspace/prelude.h"
+#include "subspace/result/result.h"
+#include "subspace/string/string.h"
+#include "subspace/tuple/tuple.h"
+
+namespace {
+
+using sus::fmt::format;
+using sus::fmt::format_to;
+using sus::string::Str;
+using sus::string::String;
+
+struct Point {
+  i32 x;
+  i32 y;
+};
+
+}  // namespace
+
+template <>
+struct sus::fmt::Formatter<Point> {
+  template <sus::fmt::Write W>
+  static void format(const Point& p, W& out) noexcept {
+    sus::fmt::format_to(out, "({}, {})", p.x, p.y);
+  }
+};
+
+namespace {
+
+static_assert(sus::fmt::Format<i32>);
+static_assert(sus::fmt::Format<int>);
+static_assert(sus::fmt::Format<sus::Option<sus::Vec<f64>>>);
+static_assert(!sus::fmt::Format<char>);
+static_assert(!sus::fmt::Format<void*>);
+
+TEST(Format, Literal) {
+  EXPECT_EQ(format(""), String());
+  EXPECT_EQ(format("hello"), String::from("hello"));
+  EXPECT_EQ(format("{{}}"), String::from("{}"));
+  EXPECT_EQ(format("a{{b}}c"), String::from("a{b}c"));
+}
+
+TEST(Format, Placeholders) {
+  EXPECT_EQ(format("{}", 1_i32), String::from("1"));
+  EXPECT_EQ(format("{} + {} = {}", 1_u8, 2_u64, 3_isize),
+            String::from("1 + 2 = 3"));
+  EXPECT_EQ(format("{{{}}}", 5_u32), String::from("{5}"));
+  EXPECT_EQ(format("{}{}", Str::from("ab"), Str::from("cd")),
+            String::from("abcd"));
+}
+
+TEST(Format, Numbers) {
+  EXPECT_EQ(format("{}", i32::MIN), String::from("-2147483648"));
+  EXPECT_EQ(format("{}", u64::MAX), String::from("18446744073709551615"));
+  EXPECT_EQ(format("{} {}", -7, 7u), String::from("-7 7"));
+  EXPECT_EQ(format("{}", static_cast<signed char>(-128)),
+            String::from("-128"));
+  EXPECT_EQ(format("{}", size_t{42u}), String::from("42"));
+  EXPECT_EQ(format("{}", 0.1_f64), String::from("0.1"));
+  EXPECT_EQ(format("{}", -2.5_f32), String::from("-2.5"));
+  EXPECT_EQ(format("{}", 1e100), String::from("1e+100"));
+  EXPECT_EQ(format("{} {}", true, false), String::from("true false"));
+  EXPECT_EQ(format("{} {}", sus::num::Fixed<i32, 16>::from_bits(-0x8000),
+                   sus::num::Decimal<i64, 2>::MAX),
+            String::from("-0.5 92233720368547758.07"));
+}
+
+TEST(Format, Strings) {
+  const auto s = String::from("owned");
+  EXPECT_EQ(format("{}", s), String::from("owned"));
+  EXPECT_EQ(format("{}", "literal"), String::from("literal"));
+  const char* ptr = "pointer";
+  EXPECT_EQ(format("{}", ptr), String::from("pointer"));
+  EXPECT_EQ(format("{}", std::string("std")), String::from("std"));
+  EXPECT_EQ(format("{}", std::string_view("view")), String::from("view"));
+  EXPECT_EQ(format("{}", Str::from("é")), String::from("é"));
+}
+
+TEST(Format, Option) {
+  EXPECT_EQ(format("{}", sus::Option<i32>::some(3_i32)),
+            String::from("Some(3)"));
+  EXPECT_EQ(format("{}", sus::Option<i32>::none()), String::from("None"));
+  const auto i = 4_i32;
+  EXPECT_EQ(format("{}", sus::Option<const i32&>::some(i)),
+            String::from("Some(4)"));
+}
+
+TEST(Format, Result) {
+  EXPECT_EQ(format("{}", sus::Result<i32, u8>::with(3_i32)),
+            String::from("Ok(3)"));
+  EXPECT_EQ(format("{}", sus::Result<i32, u8>::with_err(2_u8)),
+            String::from("Err(2)"));
+}
+
+TEST(Format, Lists) {
+  auto v = sus::Vec<i32>();
+  EXPECT_EQ(format("{}", v), String::from("[]"));
+  v.push(1_i32);
+  EXPECT_EQ(format("{}", v), String::from("[1]"));
+  v.push(2_i32);
+  v.push(3_i32);
+  EXPECT_EQ(format("{}", v), String::from("[1, 2, 3]"));
+  EXPECT_EQ(format("{}", v.as_slice()), String::from("[1, 2, 3]"));
+  EXPECT_EQ(format("{}", v.as_mut_slice()), String::from("[1, 2, 3]"));
+  EXPECT_EQ(format("{}", sus::Array<u8, 2>::with_values(4_u8, 5_u8)),
+            String::from("[4, 5]"));
+}
+
+TEST(Format, Tuple) {
+  EXPECT_EQ(format("{}", sus::Tuple<i32>::with(1_i32)), String::from("(1)"));
+  EXPECT_EQ(format("{}", sus::Tuple<i32, bool, Str>::with(1_i32, true,
+                                                          Str::from("s"))),
+            String::from("(1, true, s)"));
+}
+
+TEST(Format, Nested) {
+  auto v = sus::Vec<sus::Option<sus::Tuple<u32, f64>>>();
+  v.push(sus::Option<sus::Tuple<u32, f64>>::some(
+      sus::Tuple<u32, f64>::with(1_u32, 0.5_f64)));
+  v.push(sus::Option<sus::Tuple<u32, f64>>::none());
+  EXPECT_EQ(format("{}", v), String::from("[Some((1, 0.5)), None]"));
+}
+
+TEST(Format, UserType) {
+  EXPECT_EQ(format("p = {}", Point(1_i32, -2_i32)),
+            String::from("p = (1, -2)"));
+  auto v = sus::Vec<Point>();
+  v.push(Point(3_i32, 4_i32));
+  EXPECT_EQ(format("{}", v), String::from("[(3, 4)]"));
+}
+
+TEST(FormatTo, String) {
+  auto s = String::from("x");
+  format_to(s, "={}", 10_i32);
+  format_to(s, ",{}", 20_i32);
+  EXPECT_EQ(s, String::from("x=10,20"));
+  // Reusing a cleared buffer keeps its capacity.
+  for (i32 i = 0_i32; i < 40_i32; i += 1_i32) format_to(s, "{} ", i);
+  const usize capacity = s.capacity();
+  s.clear();
+  format_to(s, "{}", 1_i32);
+  EXPECT_EQ(s, String::from("1"));
+  EXPECT_EQ(s.capacity(), capacity);
+}
+
+TEST(FormatTo, Vec) {
+  auto v = sus::Vec<u8>();
+  v.push(u8('>'));
+  format_to(v, "{}{}", 4_u32, Str::from("2"));
+  ASSERT_EQ(v.len(), 3u);
+  EXPECT_EQ(v[0u], u8('>'));
+  EXPECT_EQ(v[1u], u8('4'));
+  EXPECT_EQ(v[2u], u8('2'));
+}
+
+TEST(FormatTo, StdString) {
+  auto s = std::string("x");
+  format_to(s, "={}", 10_i32);
+  format_to(s, ",{}", std::string("y"));
+  EXPECT_EQ(s, "x=10,y");
+}
+
+}  // namespace
@@ -0,0 +1,357 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "subspace/containers/array.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/__private/to_chars.h"
+#include "subspace/num/fixed.h"
+#include "subspace/num/float.h"
+#include "subspace/num/float_concepts.h"
+#include "subspace/num/int128.h"
+#include "subspace/num/integer_concepts.h"
+#include "subspace/num/signed_integer.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::fmt {
+
+/// A destination for formatted text, such as `String`, which receives the
+/// text through `push_str()`.
+template <class W>
+concept Write = requires(W& w, ::sus::string::Str s) {
+  { w.push_str(s) };
+};
+
+/// The formatting trait, which is specialized for each type that can be
+/// formatted.
+///
+/// A specialization provides a static `format()` function template, which
+/// writes the text for a `T` to any `Write` destination:
+/// ```
+/// template <>
+/// struct sus::fmt::Formatter<Point> {
+///   template <sus::fmt::Write W>
+///   static void format(const Point& p, W& out) noexcept {
+///     sus::fmt::format_to(out, "({}, {})", p.x, p.y);
+///   }
+/// };
+/// ```
+template <class T>
+struct Formatter;
+
+/// A type which can be formatted, as it has a specialization of `Formatter`.
+template <class T>
+concept Format = requires(const T& t, ::sus::string::String& out) {
+  { Formatter<T>::format(t, out) };
+};
+
+namespace __private {
+
+inline ::sus::string::Str str_from_bytes(const void* bytes,
+                                         size_t len) noexcept {
+  return ::sus::string::Str::from_utf8_unchecked(
+      ::sus::marker::unsafe_fn,
+      ::sus::containers::Slice<u8>::from_raw_parts(
+          ::sus::marker::unsafe_fn, static_cast<const u8*>(bytes),
+          ::sus::num::usize::from(len)));
+}
+
+/// Writes the elements of a list as `[a, b, c]`.
+template <class T, Write W>
+void format_list(const T* items, size_t len, W& out) noexcept {
+  out.push_str(::sus::string::Str::from("["));
+  for (size_t i = 0u; i < len; ++i) {
+    if (i > 0u) out.push_str(::sus::string::Str::from(", "));
+    Formatter<T>::format(items[i], out);
+  }
+  out.push_str(::sus::string::Str::from("]"));
+}
+
+}  // namespace __private
+
+/// Primitive integers are written in decimal, with a leading `-` when they
+/// are negative. A `char` is not treated as an integer.
+template <class T>
+  requires(::sus::num::PrimitiveInteger<T> && !std::same_as<T, char>)
+struct Formatter<T> {
+  template <Write W>
+  static void format(const T& t, W& out) noexcept {
+    namespace to_chars = ::sus::num::__private::to_chars;
+    using U = std::make_unsigned_t<T>;
+    bool negative = false;
+    auto abs = static_cast<U>(t);
+    if constexpr (std::is_signed_v<T>) {
+      negative = t < 0;
+      if (negative) abs = static_cast<U>(U{0u} - abs);
+    }
+    uint8_t bytes[to_chars::kMaxIntegerLen];
+    const uint32_t len = to_chars::integer_len(abs, negative);
+    to_chars::write_integer(abs, negative, bytes, len);
+    out.push_str(__private::str_from_bytes(bytes, len));
+  }
+};
+
+/// Integers are written in decimal, as by their `to_string()` method.
+template <::sus::num::Integer T>
+struct Formatter<T> {
+  template <Write W>
+  static void format(const T& t, W& out) noexcept {
+    Formatter<decltype(T::primitive_value)>::format(t.primitive_value, out);
+  }
+};
+
+/// 128-bit integers are written in decimal, as by their `to_string()` method.
+template <class T>
+  requires(std::same_as<T, ::sus::num::u128> ||
+           std::same_as<T, ::sus::num::i128>)
+struct Formatter<T> {
+  template <Write W>
+  static void format(const T& t, W& out) noexcept {
+    namespace int128 = ::sus::num::__private::int128;
+    const auto words = int128::Words{.lo = t.lo_word().primitive_value,
+                                     .hi = t.hi_word().primitive_value};
+    bool negative = false;
+    if constexpr (std::same_as<T, ::sus::num::i128>)
+      negative = int128::is_negative(words);
+    uint8_t bytes[int128::kMaxLen];
+    const uint32_t len = int128::write_integer(
+        negative ? int128::wrapping_neg(words) : words, negative, bytes);
+    out.push_str(__private::str_from_bytes(bytes, len));
+  }
+};
+
+/// Fixed-point numbers are written exactly in decimal, as by their
+/// `to_string()` method.
+template <::sus::num::Integer I, uint64_t One>
+struct Formatter<::sus::num::Scaled<I, One>> {
+  template <Write W>
+  static void format(const ::sus::num::Scaled<I, One>& t, W& out) noexcept {
+    auto bytes = ::sus::containers::Array<
+        u8, ::sus::num::__private::fixed::kMaxLen>();
+    const usize len = t.write_to(bytes.as_mut_slice());
+    out.push_str(__private::str_from_bytes(bytes.as_ptr(), size_t{len}));
+  }
+};
+
+/// Primitive floats are written in the shortest form that parses back to the
+/// same value.
+template <class T>
+  requires(std::same_as<T, float> || std::same_as<T, double>)
+struct Formatter<T> {
+  template <Write W>
+  static void format(const T& t, W& out) noexcept {
+    namespace to_chars = ::sus::num::__private::to_chars;
+    uint8_t bytes[to_chars::kMaxFloatLen];
+    const uint32_t len =
+        to_chars::write_float(t, bytes, to_chars::kMaxFloatLen);
+    out.push_str(__private::str_from_bytes(bytes, len));
+  }
+};
+
+/// Floats are written in the shortest form that parses back to the same
+/// value, as by their `to_string()` method.
+template <::sus::num::Float T>
+struct Formatter<T> {
+  template <Write W>
+  static void format(const T& t, W& out) noexcept {
+    Formatter<decltype(T::primitive_value)>::format(t.primitive_value, out);
+  }
+};
+
+/// Booleans are written as `true` or `false`.
+template <>
+struct Formatter<bool> {
+  template <Write W>
+  static void format(const bool& t, W& out) noexcept {
+    out.push_str(t ? ::sus::string::Str::from("true")
+                   : ::sus::string::Str::from("false"));
+  }
+};
+
+template <>
+struct Formatter<::sus::string::Str> {
+  template <Write W>
+  static void format(const ::sus::string::Str& t, W& out) noexcept {
+    out.push_str(t);
+  }
+};
+
+template <>
+struct Formatter<::sus::string::String> {
+  template <Write W>
+  static void format(const ::sus::string::String& t, W& out) noexcept {
+    out.push_str(t.as_str());
+  }
+};
+
+/// Standard strings are written as is, and must hold UTF-8.
+template <>
+struct Formatter<std::string_view> {
+  template <Write W>
+  static void format(const std::string_view& t, W& out) noexcept {
+    out.push_str(__private::str_from_bytes(t.data(), t.size()));
+  }
+};
+
+/// Standard strings are written as is, and must hold UTF-8.
+template <>
+struct Formatter<std::string> {
+  template <Write W>
+  static void format(const std::string& t, W& out) noexcept {
+    out.push_str(__private::str_from_bytes(t.data(), t.size()));
+  }
+};
+
+/// Nul-terminated strings, including string literals, are written as is, and
+/// must hold UTF-8.
+template <size_t N>
+struct Formatter<char[N]> {
+  template <Write W>
+  static void format(const char (&t)[N], W& out) noexcept {
+    out.push_str(__private::str_from_bytes(t, strnlen(t, N)));
+  }
+};
+
+/// Nul-terminated strings are written as is, and must hold UTF-8.
+template <>
+struct Formatter<const char*> {
+  template <Write W>
+  static void format(const char* const& t, W& out) noexcept {
+    out.push_str(__private::str_from_bytes(t, strlen(t)));
+  }
+};
+
+/// Options are written as `Some(x)` or `None`.
+template <class T>
+  requires(Format<std::remove_cvref_t<T>>)
+struct Formatter<::sus::option::Option<T>> {
+  template <Write W>
+  static void format(const ::sus::option::Option<T>& t, W& out) noexcept {
+    if (t.is_some()) {
+      out.push_str(::sus::string::Str::from("Some("));
+      Formatter<std::remove_cvref_t<T>>::format(*t, out);
+      out.push_str(::sus::string::Str::from(")"));
+    } else {
+      out.push_str(::sus::string::Str::from("None"));
+    }
+  }
+};
+
+/// Results are written as `Ok(x)` or `Err(e)`.
+template <class T, class E>
+  requires(Format<T> && Format<E>)
+struct Formatter<::sus::result::Result<T, E>> {
+  template <Write W>
+  static void format(const ::sus::result::Result<T, E>& t, W& out) noexcept {
+    if (t.is_ok()) {
+      out.push_str(::sus::string::Str::from("Ok("));
+      Formatter<T>::format(t.as_ok(), out);
+    } else {
+      out.push_str(::sus::string::Str::from("Err("));
+      Formatter<E>::format(t.as_err(), out);
+    }
+    out.push_str(::sus::string::Str::from(")"));
+  }
+};
+
+/// Vecs are written as a list, like `[a, b, c]`.
+template <class T>
+  requires(Format<T>)
+struct Formatter<::sus::containers::Vec<T>> {
+  template <Write W>
+  static void format(const ::sus::containers::Vec<T>& t, W& out) noexcept {
+    __private::format_list(t.as_ptr(), size_t{t.len()}, out);
+  }
+};
+
+/// Slices are written as a list, like `[a, b, c]`.
+template <class T>
+  requires(Format<T>)
+struct Formatter<::sus::containers::Slice<T>> {
+  template <Write W>
+  static void format(const ::sus::containers::Slice<T>& t, W& out) noexcept {
+    __private::format_list(t.as_ptr(), size_t{t.len()}, out);
+  }
+};
+
+/// Slices are written as a list, like `[a, b, c]`.
+template <class T>
+  requires(Format<T>)
+struct Formatter<::sus::containers::SliceMut<T>> {
+  template <Write W>
+  static void format(const ::sus::containers::SliceMut<T>& t,
+                     W& out) noexcept {
+    __private::format_list(t.as_ptr(), size_t{t.len()}, out);
+  }
+};
+
+/// Arrays are written as a list, like `[a, b, c]`.
+template <class T, size_t N>
+  requires(Format<T>)
+struct Formatter<::sus::containers::Array<T, N>> {
+  template <Write W>
+  static void format(const ::sus::containers::Array<T, N>& t,
+                     W& out) noexcept {
+    __private::format_list(t.as_ptr(), N, out);
+  }
+};
+
+/// Tuples are written as `(a, b, c)`.
+template <class T, class... Ts>
+  requires(Format<std::remove_cvref_t<T>> &&
+           (... && Format<std::remove_cvref_t<Ts>>))
+struct Formatter<::sus::tuple_type::Tuple<T, Ts...>> {
+  template <Write W>
+  static void format(const ::sus::tuple_type::Tuple<T, Ts...>& t,
+                     W& out) noexcept {
+    out.push_str(::sus::string::Str::from("("));
+    format_elements(t, out, std::index_sequence_for<T, Ts...>());
+    out.push_str(::sus::string::Str::from(")"));
+  }
+
+ private:
+  template <Write W, size_t... Is>
+  static void format_elements(const ::sus::tuple_type::Tuple<T, Ts...>& t,
+                              W& out, std::index_sequence<Is...>) noexcept {
+    (..., format_element<Is>(t, out));
+  }
+
+  template <size_t I, Write W>
+  static void format_element(const ::sus::tuple_type::Tuple<T, Ts...>& t,
+                             W& out) noexcept {
+    if constexpr (I > 0u) out.push_str(::sus::string::Str::from(", "));
+    const auto& element = t.template at<I>();
+    Formatter<std::remove_cvref_t<decltype(element)>>::format(element, out);
+  }
+};
+
+}  // namespace sus::fmt
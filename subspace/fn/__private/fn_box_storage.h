@@ -14,6 +14,11 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include <type_traits>
+
+#include "subspace/mem/relocate.h"
 #include "subspace/option/option.h"
 
 namespace sus::fn::__private {
@@ -58,4 +63,22 @@ class FnBoxStorage final : public FnBoxStorageBase {
   F callable_;
 };
 
+/// The number of bytes in a closure available to hold its storage without a
+/// heap allocation. This is enough for a vtable pointer and two more pointers,
+/// which covers closures that capture one or two pointers or integers.
+inline constexpr size_t kFnBoxInlineStorageSize = 3u * sizeof(void*);
+
+/// Whether the storage for a callable type `F` is held inside the closure
+/// instead of in a heap allocation.
+///
+/// This is a property of the type `F` alone, so every closure built from the
+/// same callable type is stored the same way. The storage must be able to move
+/// with the closure through `memcpy()`, and must have nothing to do when it is
+/// destroyed.
+template <class F>
+concept FnBoxStorageIsInline =
+    sizeof(FnBoxStorage<F>) <= kFnBoxInlineStorageSize &&
+    alignof(FnBoxStorage<F>) <= alignof(void*) &&
+    ::sus::mem::relocate_by_memcpy<F> && std::is_trivially_destructible_v<F>;
+
 }  // namespace sus::fn::__private
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <new>
+
+#include "subspace/fn/__private/fn_box_storage.h"
 #include "subspace/fn/callable.h"
 #include "subspace/mem/forward.h"
 #include "subspace/mem/move.h"
@@ -25,7 +28,7 @@ namespace sus::fn {
 namespace __private {
 
 /// The type-erased type (dropping the type of the internal lambda) of the
-/// closure's heap-allocated storage.
+/// closure's storage.
 struct FnBoxStorageBase;
 
 /// Helper type returned by sus_bind() and used to construct a closure.
@@ -48,13 +51,15 @@ enum StorageConstructionFnMutBoxType { StorageConstructionFnMutBox };
 /// This type indicates the closure can be called from FnBox, FnMutBox or FnOnceBox.
 enum StorageConstructionFnBoxType { StorageConstructionFnBox };
 
-/// Used to indicate if the closure is holding a function pointer or
-/// heap-allocated storage.
+/// Used to indicate if the closure is holding a function pointer, inline
+/// storage, or heap-allocated storage.
 enum FnBoxType {
   /// Holds a function pointer or captureless lambda.
   FnBoxPointer = 1,
   /// Holds the type-erased output of sus_bind() in a heap allocation.
   Storage = 2,
+  /// Holds the type-erased output of sus_bind() inside the closure itself.
+  InlineStorage = 3,
 };
 
 }  // namespace __private
@@ -85,6 +90,14 @@ class FnBox;
 ///
 /// FnBox can be used as a FnMutBox, which can be used as a FnOnceBox.
 ///
+/// # Storage
+///
+/// Bound lambdas that are small (capturing up to two pointers or integers),
+/// trivially relocatable and trivially destructible are stored inside the
+/// FnOnceBox. Other bound lambdas are stored in a heap allocation. Which one is
+/// used depends only on the type of the lambda, and the closure never gives
+/// out pointers to its storage.
+///
 /// Lambdas without captures can be converted into a FnOnceBox, FnMutBox, or FnBox
 /// directly. If the lambda has captured, it must be given to one of:
 ///
@@ -214,15 +227,32 @@ class [[sus_trivial_abi]] FnOnceBox<R(CallArgs...)> {
     // Used when the closure is a lambda with storage, generated by
     // `sus_bind()`. This is a type-erased pointer to the heap storage.
     __private::FnBoxStorageBase* storage_;
+
+    // Used when the closure is a lambda with storage, generated by
+    // `sus_bind()`, which satisfies `__private::FnBoxStorageIsInline`. This
+    // holds the `__private::FnBoxStorage` in place of a heap allocation.
+    alignas(void*) char inline_storage_[__private::kFnBoxInlineStorageSize];
   };
   // TODO: Could we query the allocator to see if the pointer here is heap
   // allocated or not, instead of storing a (pointer-sized, due to alignment)
   // flag here?
   __private::FnBoxType type_;
 
+  // Access to the type-erased storage held in `inline_storage_`. Only valid
+  // when `type_` is `InlineStorage`.
+  __private::FnBoxStorageBase& inline_storage() noexcept {
+    return *std::launder(
+        reinterpret_cast<__private::FnBoxStorageBase*>(inline_storage_));
+  }
+  const __private::FnBoxStorageBase& inline_storage() const noexcept {
+    return *std::launder(
+        reinterpret_cast<const __private::FnBoxStorageBase*>(inline_storage_));
+  }
+
  private:
   // Functions to construct and return a pointer to a static vtable object for
-  // the `__private::FnBoxStorage` being stored in `storage_`.
+  // the `__private::FnBoxStorage` being stored in `storage_` or
+  // `inline_storage_`.
   //
   // A FnOnceBox needs to store only a single pointer, for call_once(). But a FnBox
   // needs to store three, for call(), call_mut() and call_once() since it can
@@ -241,7 +271,8 @@ class [[sus_trivial_abi]] FnOnceBox<R(CallArgs...)> {
                           __private::StorageConstructionFnBoxType) noexcept;
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(fn_ptr_),
-                                  decltype(storage_), decltype(type_));
+                                  decltype(storage_), decltype(inline_storage_),
+                                  decltype(type_));
   // Set the never value field to FnBoxPointer to perform a no-op destruction as
   // there is nothing cleaned up when holding a function pointer.
   sus_class_never_value_field(::sus::marker::unsafe_fn, FnOnceBox, type_,
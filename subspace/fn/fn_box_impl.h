@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <string.h>
+
 #include "subspace/assertions/check.h"
 #include "subspace/assertions/unreachable.h"
 #include "subspace/fn/__private/fn_box_storage.h"
@@ -35,13 +37,19 @@ template <class ConstructionType,
           ::sus::fn::callable::CallableObjectReturns<R, CallArgs...> F>
 FnOnceBox<R(CallArgs...)>::FnOnceBox(ConstructionType construction,
                                F&& lambda) noexcept
-    : type_(__private::Storage) {
+    : type_(__private::FnBoxStorageIsInline<F> ? __private::InlineStorage
+                                                : __private::Storage) {
   using FnBoxStorage = __private::FnBoxStorage<F>;
-  // TODO: Allow overriding the global allocator? Use the allocator in place of
-  // `new` and `delete` directly?
-  auto* s = new FnBoxStorage(::sus::move(lambda));
-  make_vtable(*s, construction);
-  storage_ = s;
+  if constexpr (__private::FnBoxStorageIsInline<F>) {
+    auto* s = new (inline_storage_) FnBoxStorage(::sus::move(lambda));
+    make_vtable(*s, construction);
+  } else {
+    // TODO: Allow overriding the global allocator? Use the allocator in place
+    // of `new` and `delete` directly?
+    auto* s = new FnBoxStorage(::sus::move(lambda));
+    make_vtable(*s, construction);
+    storage_ = s;
+  }
 }
 
 template <class R, class... CallArgs>
@@ -91,6 +99,8 @@ FnOnceBox<R(CallArgs...)>::~FnOnceBox() noexcept {
         delete s;
       break;
     }
+    // Inline storage is trivially destructible.
+    case __private::InlineStorage: break;
   }
 }
 
@@ -105,6 +115,13 @@ FnOnceBox<R(CallArgs...)>::FnOnceBox(FnOnceBox&& o) noexcept : type_(o.type_) {
       ::sus::check(o.storage_);  // Catch use-after-move.
       storage_ = ::sus::mem::replace(mref(o.storage_), nullptr);
       break;
+    case __private::InlineStorage:
+      // Catch use-after-move.
+      ::sus::check(o.inline_storage().vtable.is_some());
+      // Inline storage is trivially relocatable.
+      memcpy(inline_storage_, o.inline_storage_, sizeof(inline_storage_));
+      o.inline_storage().vtable.take();
+      break;
   }
 }
 
@@ -115,6 +132,8 @@ FnOnceBox<R(CallArgs...)>& FnOnceBox<R(CallArgs...)>::operator=(FnOnceBox&& o) n
     case __private::Storage:
       if (auto* s = ::sus::mem::replace(mref(storage_), nullptr); s)
         delete s;
+      break;
+    case __private::InlineStorage: break;
   }
   switch (type_ = o.type_) {
     case __private::FnBoxPointer:
@@ -125,6 +144,13 @@ FnOnceBox<R(CallArgs...)>& FnOnceBox<R(CallArgs...)>::operator=(FnOnceBox&& o) n
       ::sus::check(o.storage_);  // Catch use-after-move.
       storage_ = ::sus::mem::replace(mref(o.storage_), nullptr);
       break;
+    case __private::InlineStorage:
+      // Catch use-after-move.
+      ::sus::check(o.inline_storage().vtable.is_some());
+      // Inline storage is trivially relocatable.
+      memcpy(inline_storage_, o.inline_storage_, sizeof(inline_storage_));
+      o.inline_storage().vtable.take();
+      break;
   }
   return *this;
 }
@@ -158,6 +184,16 @@ R FnOnceBox<R(CallArgs...)>::operator()(CallArgs... args) && noexcept {
       return vtable.call_once(static_cast<__private::FnBoxStorageBase&&>(*storage),
                               forward<CallArgs>(args)...);
     }
+    case __private::InlineStorage: {
+      // Catch use-after-move.
+      ::sus::check(inline_storage().vtable.is_some());
+      auto& vtable =
+          static_cast<const __private::FnBoxStorageVtable<R, CallArgs...>&>(
+              inline_storage().vtable.take().unwrap());
+      return vtable.call_once(
+          static_cast<__private::FnBoxStorageBase&&>(inline_storage()),
+          forward<CallArgs>(args)...);
+    }
   }
   ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
 }
@@ -178,6 +214,15 @@ R FnMutBox<R(CallArgs...)>::operator()(CallArgs... args) & noexcept {
           static_cast<__private::FnBoxStorageBase&>(*Super::storage_),
           ::sus::forward<CallArgs>(args)...);
     }
+    case __private::InlineStorage: {
+      // Catch use-after-move.
+      ::sus::check(Super::inline_storage().vtable.is_some());
+      auto& vtable =
+          static_cast<const __private::FnBoxStorageVtable<R, CallArgs...>&>(
+              Super::inline_storage().vtable.as_mut().unwrap());
+      return vtable.call_mut(Super::inline_storage(),
+                             ::sus::forward<CallArgs>(args)...);
+    }
   }
   ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
 }
@@ -198,6 +243,15 @@ R FnBox<R(CallArgs...)>::operator()(CallArgs... args) const& noexcept {
           static_cast<const __private::FnBoxStorageBase&>(*Super::storage_),
           ::sus::forward<CallArgs>(args)...);
     }
+    case __private::InlineStorage: {
+      // Catch use-after-move.
+      ::sus::check(Super::inline_storage().vtable.is_some());
+      auto& vtable =
+          static_cast<const __private::FnBoxStorageVtable<R, CallArgs...>&>(
+              *Super::inline_storage().vtable);
+      return vtable.call(Super::inline_storage(),
+                         ::sus::forward<CallArgs>(args)...);
+    }
   }
   ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
 }
@@ -60,7 +60,9 @@ struct BaseClass {};
 struct SubClass : public BaseClass {};
 
 static_assert(sizeof(FnOnceBox<void()>) > sizeof(void (*)()));
-static_assert(sizeof(FnOnceBox<void()>) <= sizeof(void (*)()) * 2);
+// Room for inline storage of a vtable pointer and two captured pointers, along
+// with the type of storage.
+static_assert(sizeof(FnOnceBox<void()>) <= sizeof(void (*)()) * 4);
 
 void v_v_function() {}
 int i_f_function(float) { return 0; }
@@ -396,6 +398,57 @@ TEST(FnBox, MoveFnBox) {
   }
 }
 
+TEST(FnBox, InlineStorage) {
+  using sus::fn::__private::FnBoxStorageIsInline;
+
+  // Small captures are held inside the closure.
+  using One = decltype([a = 1]() { return a; });
+  using Two = decltype([a = 1, b = 2]() { return a + b; });
+  static_assert(FnBoxStorageIsInline<One>);
+  static_assert(FnBoxStorageIsInline<Two>);
+  // Large captures, and captures with a destructor, are held on the heap.
+  using Five = decltype([a = 1, b = 2, c = 3, d = 4, e = 5]() {
+    return a + b + c + d + e;
+  });
+  using WithDtor = decltype([c = Copyable(1)]() { return c.i; });
+  static_assert(!FnBoxStorageIsInline<Five>);
+  static_assert(!FnBoxStorageIsInline<WithDtor>);
+
+  // The captured state moves with the closure.
+  {
+    auto fn = FnMutBox<int(int)>(
+        sus_bind0([a = 1, b = 2](int c) { return a + b * c; }));
+    EXPECT_EQ(fn(1), 3);
+    auto fn2 = sus::move(fn);
+    EXPECT_EQ(fn2(2), 5);
+    fn = sus::move(fn2);
+    EXPECT_EQ(fn(3), 7);
+    EXPECT_EQ(sus::move(fn)(4), 9);
+  }
+  {
+    auto fn = FnMutBox<int(int)>(
+        sus_bind0([a = 1, b = 2, c = 3, d = 4, e = 5](int f) {
+          return a + b + c + d + e * f;
+        }));
+    EXPECT_EQ(fn(1), 15);
+    auto fn2 = sus::move(fn);
+    EXPECT_EQ(fn2(2), 20);
+    fn = sus::move(fn2);
+    EXPECT_EQ(fn(3), 25);
+    EXPECT_EQ(sus::move(fn)(4), 30);
+  }
+  // Assigning between closures with different storage.
+  {
+    auto fn = FnBox<int()>(sus_bind0([a = 1]() { return a; }));
+    fn = FnBox<int()>(sus_bind0([a = 1, b = 2, c = 3, d = 4, e = 5]() {
+      return a + b + c + d + e;
+    }));
+    EXPECT_EQ(fn(), 15);
+    fn = FnBox<int()>(sus_bind0([a = 1]() { return a; }));
+    EXPECT_EQ(fn(), 1);
+  }
+}
+
 TEST(FnBox, FnBoxIsFnMutBox) {
   {
     auto fn = FnBox<int(int, int)>([](int a, int b) { return a * 2 + b; });
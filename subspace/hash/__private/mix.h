@@ -0,0 +1,147 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <type_traits>
+
+#include "subspace/assertions/endian.h"
+#include "subspace/macros/always_inline.h"
+#include "subspace/num/__private/intrinsics.h"
+
+namespace sus::hash::__private {
+
+/// The secret from wyhash, which is also used to seed the hashers when no seed
+/// is given.
+constexpr uint64_t kSecret[4u] = {
+    0x2d358dccaa6c78a5u,
+    0x8bb84b93962eacc9u,
+    0x4b33a62ed433d4a3u,
+    0x4d5a2da51de1aa47u,
+};
+
+/// Multiplies `a` and `b` into 128 bits, and folds the high half into the low
+/// half with xor. This is the mixing step of both wyhash and aHash.
+sus_always_inline constexpr uint64_t folded_multiply(uint64_t a,
+                                                     uint64_t b) noexcept {
+  const auto out = ::sus::num::__private::widening_mul(a, b);
+  return out.lo ^ out.hi;
+}
+
+/// Reads `N` bytes from `p` as a little endian integer, one byte at a time,
+/// which can be done in a constant expression.
+template <size_t N>
+constexpr uint64_t read_le_bytes(const uint8_t* p) noexcept {
+  uint64_t v = 0u;
+  for (size_t i = 0u; i < N; ++i) v |= uint64_t{p[i]} << (i * 8u);
+  return v;
+}
+
+/// Reads 8 bytes from `p` as a little endian integer. The pointer need not be
+/// aligned.
+sus_always_inline constexpr uint64_t read_u64(const uint8_t* p) noexcept {
+  if (std::is_constant_evaluated()) return read_le_bytes<8u>(p);
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  if constexpr (::sus::assertions::is_little_endian())
+    return v;
+  else
+    return ::sus::num::__private::swap_bytes(v);
+}
+
+/// Reads 4 bytes from `p` as a little endian integer. The pointer need not be
+/// aligned.
+sus_always_inline constexpr uint64_t read_u32(const uint8_t* p) noexcept {
+  if (std::is_constant_evaluated()) return read_le_bytes<4u>(p);
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  if constexpr (::sus::assertions::is_little_endian())
+    return v;
+  else
+    return ::sus::num::__private::swap_bytes(v);
+}
+
+/// Reads 1 to 3 bytes from `p` into an integer, touching each byte at most
+/// once without branching on the length.
+sus_always_inline constexpr uint64_t read_small(const uint8_t* p,
+                                               size_t len) noexcept {
+  return (uint64_t{p[0u]} << 16u) | (uint64_t{p[len >> 1u]} << 8u) |
+         uint64_t{p[len - 1u]};
+}
+
+/// The wyhash (final version 4) hash of the `len` bytes at `p`.
+///
+/// Inputs of up to 16 bytes are read with at most 4 overlapping loads, and
+/// longer inputs are consumed 48 bytes at a time in three independent lanes.
+constexpr uint64_t wyhash(const uint8_t* p, size_t len,
+                          uint64_t seed) noexcept {
+  seed ^= folded_multiply(seed ^ kSecret[0u], kSecret[1u]);
+  uint64_t a;
+  uint64_t b;
+  if (len <= 16u) {
+    if (len >= 4u) {
+      const size_t mid = (len >> 3u) << 2u;
+      a = (read_u32(p) << 32u) | read_u32(p + mid);
+      b = (read_u32(p + len - 4u) << 32u) | read_u32(p + len - 4u - mid);
+    } else if (len > 0u) {
+      a = read_small(p, len);
+      b = 0u;
+    } else {
+      a = b = 0u;
+    }
+  } else {
+    size_t i = len;
+    if (i > 48u) {
+      uint64_t see1 = seed;
+      uint64_t see2 = seed;
+      do {
+        seed = folded_multiply(read_u64(p) ^ kSecret[1u],
+                               read_u64(p + 8u) ^ seed);
+        see1 = folded_multiply(read_u64(p + 16u) ^ kSecret[2u],
+                               read_u64(p + 24u) ^ see1);
+        see2 = folded_multiply(read_u64(p + 32u) ^ kSecret[3u],
+                               read_u64(p + 40u) ^ see2);
+        p += 48u;
+        i -= 48u;
+      } while (i > 48u);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16u) {
+      seed =
+          folded_multiply(read_u64(p) ^ kSecret[1u], read_u64(p + 8u) ^ seed);
+      i -= 16u;
+      p += 16u;
+    }
+    a = read_u64(p + i - 16u);
+    b = read_u64(p + i - 8u);
+  }
+  const auto ab =
+      ::sus::num::__private::widening_mul(a ^ kSecret[1u], b ^ seed);
+  return folded_multiply(ab.lo ^ kSecret[0u] ^ uint64_t{len},
+                         ab.hi ^ kSecret[1u]);
+}
+
+/// The wyhash mix of two 64-bit integers, which is a fast and well distributed
+/// hash of a single integer `a` with the seed `b`.
+sus_always_inline constexpr uint64_t wyhash64(uint64_t a, uint64_t b) noexcept {
+  const auto ab =
+      ::sus::num::__private::widening_mul(a ^ kSecret[0u], b ^ kSecret[1u]);
+  return folded_multiply(ab.lo ^ kSecret[0u], ab.hi ^ kSecret[1u]);
+}
+
+}  // namespace sus::hash::__private
@@ -0,0 +1,334 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "subspace/choice/__private/nothing.h"
+#include "subspace/choice/choice.h"
+#include "subspace/containers/array.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/hash/hasher.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/fixed.h"
+#include "subspace/num/int128.h"
+#include "subspace/num/integer_concepts.h"
+#include "subspace/num/signed_integer.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::hash {
+
+/// The hashing trait, which is specialized for each type that can be hashed.
+///
+/// A specialization provides a static `hash()` function template, which
+/// writes the value of a `T` into any `Hasher`. Values that compare equal must
+/// write the same things:
+/// ```
+/// template <>
+/// struct sus::hash::HashImpl<Point> {
+///   template <sus::hash::Hasher H>
+///   static constexpr void hash(const Point& p, H& h) noexcept {
+///     sus::hash::hash_into(p.x, h);
+///     sus::hash::hash_into(p.y, h);
+///   }
+/// };
+/// ```
+template <class T>
+struct HashImpl;
+
+/// A type which can be hashed, as it has a specialization of `HashImpl`.
+///
+/// Floating point types are not `Hash`, as they are not `Eq` in a way that
+/// hashing can agree with: `0.0 == -0.0` and `NaN != NaN`.
+template <class T>
+concept Hash = requires(const T& t, DefaultHasher& h) {
+  { HashImpl<T>::hash(t, h) } -> std::same_as<void>;
+};
+
+/// Writes the value of `t` into the hasher `h`.
+template <Hash T, Hasher H>
+constexpr void hash_into(const T& t, H& h) noexcept {
+  HashImpl<T>::hash(t, h);
+}
+
+/// Returns the hash of `t` from a `DefaultHasher` with the default seed.
+template <Hash T>
+[[nodiscard]] constexpr u64 hash(const T& t) noexcept {
+  auto h = DefaultHasher();
+  HashImpl<T>::hash(t, h);
+  return h.finish();
+}
+
+namespace __private {
+
+/// Types whose bytes are a unique representation of their value, so that a
+/// contiguous run of them can be hashed as bytes in a single call.
+template <class T>
+concept HashAsBytes =
+    (::sus::num::Integer<T> || ::sus::num::PrimitiveInteger<T> ||
+     std::same_as<T, bool> || std::is_enum_v<T> ||
+     std::same_as<T, ::sus::num::u128> || std::same_as<T, ::sus::num::i128>) &&
+    std::has_unique_object_representations_v<T>;
+
+/// Writes the length and elements of a slice. Runs of `HashAsBytes` types are
+/// written with one call to `Hasher::write()`.
+///
+/// The same bytes are written in a constant expression, where they are copied
+/// out of each element with `std::bit_cast`, so a hash is the same whether it
+/// is computed at compile time or at runtime.
+template <class T, Hasher H>
+constexpr void hash_slice(const T* items, size_t len, H& h) noexcept {
+  h.write_u64(u64::from(len));
+  if constexpr (HashAsBytes<T>) {
+    if (std::is_constant_evaluated()) {
+      auto* bytes = new u8[len * sizeof(T) + 1u];
+      for (size_t i = 0u; i < len; ++i) {
+        const auto item =
+            std::bit_cast<std::array<uint8_t, sizeof(T)>>(items[i]);
+        for (size_t j = 0u; j < sizeof(T); ++j)
+          bytes[i * sizeof(T) + j] = item[j];
+      }
+      h.write(::sus::containers::Slice<u8>::from_raw_parts(
+          ::sus::marker::unsafe_fn, bytes, usize::from(len * sizeof(T))));
+      delete[] bytes;
+    } else {
+      h.write(::sus::containers::Slice<u8>::from_raw_parts(
+          ::sus::marker::unsafe_fn, reinterpret_cast<const u8*>(items),
+          usize::from(len * sizeof(T))));
+    }
+  } else {
+    for (size_t i = 0u; i < len; ++i) HashImpl<T>::hash(items[i], h);
+  }
+}
+
+/// Choice members are either a `Tuple` of their values, or `Nothing` when they
+/// have no value.
+template <class T>
+concept ChoiceMemberIsHash =
+    std::same_as<T, ::sus::choice_type::__private::Nothing> || Hash<T>;
+
+}  // namespace __private
+
+/// Integers are hashed by their value, widened to 64 bits.
+template <class T>
+  requires(::sus::num::Integer<T> || ::sus::num::PrimitiveInteger<T> ||
+           std::same_as<T, bool>)
+struct HashImpl<T> {
+  template <Hasher H>
+  static constexpr void hash(const T& t, H& h) noexcept {
+    if constexpr (std::same_as<T, bool>) {
+      h.write_u64(t ? 1u : 0u);
+    } else if constexpr (::sus::num::Integer<T>) {
+      HashImpl<decltype(t.primitive_value)>::hash(t.primitive_value, h);
+    } else if constexpr (std::is_signed_v<T>) {
+      h.write_u64(static_cast<uint64_t>(static_cast<int64_t>(t)));
+    } else {
+      h.write_u64(static_cast<uint64_t>(t));
+    }
+  }
+};
+
+/// Enums are hashed by their underlying integer value.
+template <class T>
+  requires(std::is_enum_v<T>)
+struct HashImpl<T> {
+  template <Hasher H>
+  static constexpr void hash(const T& t, H& h) noexcept {
+    HashImpl<std::underlying_type_t<T>>::hash(
+        static_cast<std::underlying_type_t<T>>(t), h);
+  }
+};
+
+/// 128-bit integers are hashed as their low then high word.
+template <class T>
+  requires(std::same_as<T, ::sus::num::u128> ||
+           std::same_as<T, ::sus::num::i128>)
+struct HashImpl<T> {
+  template <Hasher H>
+  static constexpr void hash(const T& t, H& h) noexcept {
+    h.write_u64(t.lo_word());
+    h.write_u64(t.hi_word());
+  }
+};
+
+/// Fixed-point numbers are hashed as their stored integer, which is equal
+/// exactly when the numbers are.
+template <::sus::num::Integer I, uint64_t One>
+struct HashImpl<::sus::num::Scaled<I, One>> {
+  template <Hasher H>
+  static constexpr void hash(const ::sus::num::Scaled<I, One>& t,
+                             H& h) noexcept {
+    HashImpl<I>::hash(t.to_bits(), h);
+  }
+};
+
+/// Strings are hashed as a slice of their bytes, so a string hashes the same
+/// as the `Slice<u8>` of its UTF-8 bytes.
+template <>
+struct HashImpl<::sus::string::Str> {
+  template <Hasher H>
+  static void hash(const ::sus::string::Str& t, H& h) noexcept {
+    const auto bytes = t.as_bytes();
+    __private::hash_slice(bytes.as_ptr(), size_t{bytes.len()}, h);
+  }
+};
+
+/// Strings are hashed as a slice of their bytes, so a string hashes the same
+/// as the `Slice<u8>` of its UTF-8 bytes.
+template <>
+struct HashImpl<::sus::string::String> {
+  template <Hasher H>
+  static void hash(const ::sus::string::String& t, H& h) noexcept {
+    HashImpl<::sus::string::Str>::hash(t.as_str(), h);
+  }
+};
+
+/// Strings are hashed as a slice of their bytes, so a string hashes the same
+/// as the `Slice<u8>` of its UTF-8 bytes.
+template <>
+struct HashImpl<std::string_view> {
+  template <Hasher H>
+  static void hash(const std::string_view& t, H& h) noexcept {
+    __private::hash_slice(reinterpret_cast<const u8*>(t.data()), t.size(), h);
+  }
+};
+
+/// Strings are hashed as a slice of their bytes, so a string hashes the same
+/// as the `Slice<u8>` of its UTF-8 bytes.
+template <>
+struct HashImpl<std::string> {
+  template <Hasher H>
+  static void hash(const std::string& t, H& h) noexcept {
+    HashImpl<std::string_view>::hash(std::string_view(t), h);
+  }
+};
+
+/// Options write whether they hold a value, followed by the value if any.
+template <class T>
+  requires(Hash<std::remove_cvref_t<T>>)
+struct HashImpl<::sus::option::Option<T>> {
+  template <Hasher H>
+  static constexpr void hash(const ::sus::option::Option<T>& t,
+                             H& h) noexcept {
+    if (t.is_some()) {
+      h.write_u64(1u);
+      HashImpl<std::remove_cvref_t<T>>::hash(*t, h);
+    } else {
+      h.write_u64(0u);
+    }
+  }
+};
+
+/// Vecs are hashed as a slice of their elements.
+template <class T>
+  requires(Hash<T>)
+struct HashImpl<::sus::containers::Vec<T>> {
+  template <Hasher H>
+  static constexpr void hash(const ::sus::containers::Vec<T>& t,
+                             H& h) noexcept {
+    __private::hash_slice(t.as_ptr(), size_t{t.len()}, h);
+  }
+};
+
+/// Slices write their length followed by their elements. Slices of integers
+/// are written as a single run of bytes.
+template <class T>
+  requires(Hash<T>)
+struct HashImpl<::sus::containers::Slice<T>> {
+  template <Hasher H>
+  static constexpr void hash(const ::sus::containers::Slice<T>& t,
+                             H& h) noexcept {
+    __private::hash_slice(t.as_ptr(), size_t{t.len()}, h);
+  }
+};
+
+/// Slices write their length followed by their elements. Slices of integers
+/// are written as a single run of bytes.
+template <class T>
+  requires(Hash<T>)
+struct HashImpl<::sus::containers::SliceMut<T>> {
+  template <Hasher H>
+  static constexpr void hash(const ::sus::containers::SliceMut<T>& t,
+                             H& h) noexcept {
+    __private::hash_slice(t.as_ptr(), size_t{t.len()}, h);
+  }
+};
+
+/// Arrays are hashed as a slice of their elements.
+template <class T, size_t N>
+  requires(Hash<T>)
+struct HashImpl<::sus::containers::Array<T, N>> {
+  template <Hasher H>
+  static constexpr void hash(const ::sus::containers::Array<T, N>& t,
+                             H& h) noexcept {
+    HashImpl<::sus::containers::Slice<T>>::hash(t.as_slice(), h);
+  }
+};
+
+/// Tuples write each of their elements in order.
+template <class T, class... Ts>
+  requires(Hash<std::remove_cvref_t<T>> &&
+           (... && Hash<std::remove_cvref_t<Ts>>))
+struct HashImpl<::sus::tuple_type::Tuple<T, Ts...>> {
+  template <Hasher H>
+  static constexpr void hash(const ::sus::tuple_type::Tuple<T, Ts...>& t,
+                             H& h) noexcept {
+    hash_elements(t, h, std::index_sequence_for<T, Ts...>());
+  }
+
+ private:
+  template <Hasher H, size_t... Is>
+  static constexpr void hash_elements(
+      const ::sus::tuple_type::Tuple<T, Ts...>& t, H& h,
+      std::index_sequence<Is...>) noexcept {
+    (..., HashImpl<std::remove_cvref_t<decltype(t.template at<Is>())>>::hash(
+              t.template at<Is>(), h));
+  }
+};
+
+/// Choices write their active tag, followed by the values of the active
+/// member.
+template <class... Ts, auto Tag, auto... Tags>
+  requires(Hash<std::remove_cvref_t<decltype(Tag)>> &&
+           (... && __private::ChoiceMemberIsHash<Ts>))
+struct HashImpl<::sus::choice_type::Choice<
+    ::sus::choice_type::__private::TypeList<Ts...>, Tag, Tags...>> {
+  template <Hasher H>
+  static constexpr void hash(
+      const ::sus::choice_type::Choice<
+          ::sus::choice_type::__private::TypeList<Ts...>, Tag, Tags...>& t,
+      H& h) noexcept {
+    t.visit([&h](auto tag, const auto&... values) {
+      HashImpl<std::remove_cvref_t<decltype(Tag)>>::hash(tag.value, h);
+      (..., HashImpl<std::remove_cvref_t<decltype(values)>>::hash(values, h));
+    });
+  }
+};
+
+}  // namespace sus::hash
@@ -0,0 +1,280 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/hash/hash.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/choice/choice.h"
+#include "subspace/containers/array.h"
+#include "subspace/containers/vec.h"
+#include "subspace/num/fixed.h"
+#include "subspace/option/option.h"
+#include "subspace/prelude.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
+#include "subspace/tuple/tuple.h"
+
+namespace {
+
+using sus::hash::DefaultHasher;
+using sus::hash::Hash;
+using sus::hash::Hasher;
+using sus::string::Str;
+using sus::string::String;
+
+enum class Order {
+  First,
+  Second,
+};
+
+static_assert(Hasher<DefaultHasher>);
+
+static_assert(Hash<u8>);
+static_assert(Hash<i64>);
+static_assert(Hash<usize>);
+static_assert(Hash<int>);
+static_assert(Hash<char>);
+static_assert(Hash<bool>);
+static_assert(Hash<Order>);
+static_assert(Hash<u128>);
+static_assert(Hash<i128>);
+static_assert(Hash<sus::num::Decimal<i64, 4>>);
+static_assert(Hash<Str>);
+static_assert(Hash<String>);
+static_assert(Hash<std::string>);
+static_assert(Hash<sus::Option<u32>>);
+static_assert(Hash<sus::Option<const u32&>>);
+static_assert(Hash<sus::Vec<String>>);
+static_assert(Hash<sus::Slice<i32>>);
+static_assert(Hash<sus::SliceMut<i32>>);
+static_assert(Hash<sus::Array<u8, 3>>);
+static_assert(Hash<sus::Tuple<u32, String>>);
+static_assert(Hash<sus::Choice<sus_choice_types((Order::First, u32),
+                                                (Order::Second, void))>>);
+
+// Floats have no hash that agrees with their equality.
+static_assert(!Hash<f32>);
+static_assert(!Hash<double>);
+static_assert(!Hash<sus::Vec<f64>>);
+static_assert(!Hash<sus::Tuple<u32, f32>>);
+static_assert(!Hash<sus::Choice<sus_choice_types((Order::First, f32))>>);
+
+static_assert(sus::hash::__private::HashAsBytes<u32>);
+static_assert(sus::hash::__private::HashAsBytes<i8>);
+static_assert(sus::hash::__private::HashAsBytes<Order>);
+static_assert(sus::hash::__private::HashAsBytes<u128>);
+static_assert(!sus::hash::__private::HashAsBytes<String>);
+
+// Integers hash in constant expressions.
+static_assert(sus::hash::hash(5_u32) == sus::hash::hash(5_u32));
+static_assert(sus::hash::hash(5_u32) != sus::hash::hash(6_u32));
+static_assert(sus::hash::hash_u64(1u) != sus::hash::hash_u64(2u));
+
+// Slices of integers are written to the hasher as bytes, which gives the same
+// hash in a constant expression as at runtime.
+constexpr sus::Array<u32, 2> kPair = sus::Array<u32, 2>::with_values(1u, 2u);
+constexpr u64 kPairHash = sus::hash::hash(kPair);
+
+template <size_t N>
+constexpr sus::Array<u8, N> counting_bytes() noexcept {
+  auto a = sus::Array<u8, N>();
+  for (auto i = size_t{0u}; i < N; ++i) a[i] = static_cast<uint8_t>(i);
+  return a;
+}
+// Long enough to use every wyhash lane.
+constexpr auto kBytes = counting_bytes<100u>();
+constexpr u64 kBytesHash = sus::hash::hash(kBytes);
+constexpr auto kShortBytes = counting_bytes<3u>();
+constexpr u64 kShortBytesHash = sus::hash::hash(kShortBytes);
+
+TEST(Hash, ConstantEvaluated) {
+  EXPECT_EQ(kPairHash, sus::hash::hash(kPair));
+  auto v = sus::Vec<u32>::with_values(1u, 2u);
+  EXPECT_EQ(kPairHash, sus::hash::hash(v));
+  EXPECT_EQ(kBytesHash, sus::hash::hash(kBytes));
+  EXPECT_EQ(kShortBytesHash, sus::hash::hash(kShortBytes));
+}
+
+TEST(Hash, Integers) {
+  // The same value hashes the same, whatever its type.
+  EXPECT_EQ(sus::hash::hash(7_u8), sus::hash::hash(7_u64));
+  EXPECT_EQ(sus::hash::hash(7_i32), sus::hash::hash(7));
+  EXPECT_EQ(sus::hash::hash(-1_i32), sus::hash::hash(-1_i64));
+  EXPECT_EQ(sus::hash::hash(Order::Second), sus::hash::hash(1));
+  EXPECT_EQ(sus::hash::hash(true), sus::hash::hash(1u));
+
+  // Small inputs, which differ in few bits, still spread out.
+  auto seen = std::unordered_set<uint64_t>();
+  for (auto i = 0_u64; i < 100000u; i += 1u) {
+    seen.insert(sus::hash::hash(i).primitive_value);
+    seen.insert(sus::hash::hash(i << 32u).primitive_value);
+  }
+  EXPECT_EQ(seen.size(), 199999u);  // 0 << 32 == 0.
+}
+
+TEST(Hash, Int128) {
+  EXPECT_EQ(sus::hash::hash(u128::MAX), sus::hash::hash(i128(-1)));
+  EXPECT_NE(sus::hash::hash(u128(1u)),
+            sus::hash::hash(u128::from_words(1u, 0u)));
+}
+
+TEST(Hash, Fixed) {
+  using Price = sus::num::Decimal<i64, 4>;
+  EXPECT_EQ(sus::hash::hash(Price::from_int(3)), sus::hash::hash(30000_i64));
+}
+
+TEST(Hash, Seed) {
+  auto a = DefaultHasher();
+  auto b = DefaultHasher::with_seed(1u);
+  a.write_u64(3u);
+  b.write_u64(3u);
+  EXPECT_NE(a.finish(), b.finish());
+
+  // Finishing doesn't reset the hasher.
+  auto c = DefaultHasher();
+  c.write_u64(3u);
+  EXPECT_EQ(a.finish(), c.finish());
+  EXPECT_EQ(a.finish(), c.finish());
+}
+
+TEST(Hash, Strings) {
+  const auto h = sus::hash::hash(Str::from("hello"));
+  EXPECT_EQ(h, sus::hash::hash(String::from("hello")));
+  EXPECT_EQ(h, sus::hash::hash(std::string("hello")));
+  EXPECT_EQ(h, sus::hash::hash(std::string_view("hello")));
+  EXPECT_EQ(h, sus::hash::hash(Str::from("hello").as_bytes()));
+  EXPECT_NE(h, sus::hash::hash(Str::from("hellp")));
+  EXPECT_NE(h, sus::hash::hash(Str::from("hell")));
+  EXPECT_NE(sus::hash::hash(Str::from("")), sus::hash::hash(0u));
+
+  // Every length goes through a different read pattern, and flipping any one
+  // byte changes the hash.
+  auto seen = std::unordered_set<uint64_t>();
+  auto s = std::string();
+  for (size_t len = 0u; len < 200u; ++len) {
+    seen.insert(sus::hash::hash(s).primitive_value);
+    for (size_t i = 0u; i < len; ++i) {
+      s[i] ^= 1;
+      seen.insert(sus::hash::hash(s).primitive_value);
+      s[i] ^= 1;
+    }
+    s.push_back(static_cast<char>('a' + len % 26u));
+  }
+  EXPECT_EQ(seen.size(), 200u + 199u * 200u / 2u);
+}
+
+TEST(Hash, HashBytes) {
+  const auto bytes = Str::from("the quick brown fox").as_bytes();
+  EXPECT_EQ(sus::hash::hash_bytes(bytes), sus::hash::hash_bytes(bytes));
+  EXPECT_NE(sus::hash::hash_bytes(bytes), sus::hash::hash_bytes(bytes, 1u));
+  EXPECT_NE(sus::hash::hash_bytes(bytes),
+            sus::hash::hash_bytes(bytes["0..18"_r]));
+
+  auto seen = std::unordered_set<uint64_t>();
+  auto v = sus::Vec<u8>();
+  for (auto len = 0_usize; len < 300u; len += 1u) {
+    seen.insert(sus::hash::hash_bytes(v.as_slice()).primitive_value);
+    v.push(u8::from(len % 251u));
+  }
+  EXPECT_EQ(seen.size(), 300u);
+}
+
+TEST(Hash, Slices) {
+  auto v = sus::Vec<u32>::with_values(1_u32, 2_u32, 3_u32);
+  const auto h = sus::hash::hash(v);
+  EXPECT_EQ(h, sus::hash::hash(v.as_slice()));
+  EXPECT_EQ(h, sus::hash::hash(v.as_mut_slice()));
+  EXPECT_EQ(h, sus::hash::hash(
+                   sus::Array<u32, 3>::with_values(1_u32, 2_u32, 3_u32)));
+  EXPECT_NE(h, sus::hash::hash(v["0..2"_r]));
+  EXPECT_NE(h, sus::hash::hash(
+                   sus::Vec<u32>::with_values(3_u32, 2_u32, 1_u32)));
+
+  // Slices of integers are written as one run of bytes.
+  auto expected = DefaultHasher();
+  expected.write_u64(3u);
+  expected.write(sus::Slice<u8>::from_raw_parts(
+      unsafe_fn, reinterpret_cast<const u8*>(v.as_ptr()), 12u));
+  EXPECT_EQ(h, expected.finish());
+
+  // Slices of other types write each element.
+  auto strings = sus::Vec<String>::with_values(String::from("a"));
+  auto expected_strings = DefaultHasher();
+  expected_strings.write_u64(1u);
+  sus::hash::hash_into(Str::from("a"), expected_strings);
+  EXPECT_EQ(sus::hash::hash(strings), expected_strings.finish());
+
+  // Nesting doesn't let elements move between the inner slices.
+  auto a = sus::Vec<sus::Vec<u8>>::with_values(
+      sus::Vec<u8>::with_values(1_u8), sus::Vec<u8>());
+  auto b = sus::Vec<sus::Vec<u8>>::with_values(
+      sus::Vec<u8>(), sus::Vec<u8>::with_values(1_u8));
+  EXPECT_NE(sus::hash::hash(a), sus::hash::hash(b));
+}
+
+TEST(Hash, Option) {
+  EXPECT_EQ(sus::hash::hash(sus::Option<u32>::some(3u)),
+            sus::hash::hash(sus::Option<u32>::some(3u)));
+  EXPECT_NE(sus::hash::hash(sus::Option<u32>::some(0u)),
+            sus::hash::hash(sus::Option<u32>::none()));
+  u32 i = 3u;
+  EXPECT_EQ(sus::hash::hash(sus::Option<const u32&>::some(i)),
+            sus::hash::hash(sus::Option<u32>::some(3u)));
+}
+
+TEST(Hash, Tuple) {
+  EXPECT_EQ(sus::hash::hash(sus::Tuple<u32, i8>::with(1u, 2_i8)),
+            sus::hash::hash(sus::Tuple<u32, i8>::with(1u, 2_i8)));
+  EXPECT_NE(sus::hash::hash(sus::Tuple<u32, u32>::with(1u, 2u)),
+            sus::hash::hash(sus::Tuple<u32, u32>::with(2u, 1u)));
+  const u32 a = 1u;
+  const String s = String::from("s");
+  EXPECT_EQ(sus::hash::hash(sus::Tuple<const u32&, const String&>::with(a, s)),
+            sus::hash::hash(sus::Tuple<u32, String>::with(1u, s.clone())));
+}
+
+TEST(Hash, Choice) {
+  using C = sus::Choice<sus_choice_types(
+      (Order::First, u32), (Order::Second, u32, String))>;
+  const auto first = C::with<Order::First>(2u);
+  EXPECT_EQ(sus::hash::hash(first),
+            sus::hash::hash(C::with<Order::First>(2u)));
+  EXPECT_NE(sus::hash::hash(first),
+            sus::hash::hash(C::with<Order::First>(3u)));
+
+  // The tag is part of the hash.
+  using D = sus::Choice<sus_choice_types((Order::First, u32),
+                                         (Order::Second, u32))>;
+  EXPECT_NE(sus::hash::hash(D::with<Order::First>(2u)),
+            sus::hash::hash(D::with<Order::Second>(2u)));
+
+  const auto second = C::with<Order::Second>(
+      sus::Tuple<u32, String>::with(2u, String::from("two")));
+  auto expected = DefaultHasher();
+  sus::hash::hash_into(Order::Second, expected);
+  sus::hash::hash_into(2u, expected);
+  sus::hash::hash_into(Str::from("two"), expected);
+  EXPECT_EQ(sus::hash::hash(second), expected.finish());
+
+  using E = sus::Choice<sus_choice_types((Order::First, void),
+                                         (Order::Second, void))>;
+  EXPECT_NE(sus::hash::hash(E::with<Order::First>()),
+            sus::hash::hash(E::with<Order::Second>()));
+}
+
+}  // namespace
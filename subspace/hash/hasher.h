@@ -0,0 +1,162 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <concepts>
+#include <type_traits>
+
+#include "subspace/containers/slice.h"
+#include "subspace/hash/__private/mix.h"
+#include "subspace/macros/pure.h"
+#include "subspace/num/__private/intrinsics.h"
+#include "subspace/num/unsigned_integer.h"
+
+namespace sus::hash {
+
+/// A `Hasher` receives a stream of bytes and integers, and produces a single
+/// 64-bit hash of them with `finish()`.
+///
+/// Types that are `Hash` feed their contents to any `Hasher` through
+/// `HashImpl<T>::hash()`.
+///
+/// The hash produced for a stream of writes is only meaningful to compare with
+/// other hashes from the same type of `Hasher`, built with the same seed.
+template <class H>
+concept Hasher = requires(H& h, const H& ch, ::sus::containers::Slice<u8> bytes,
+                          u64 i) {
+  { h.write(bytes) } -> std::same_as<void>;
+  { h.write_u64(i) } -> std::same_as<void>;
+  { ch.finish() } -> std::same_as<u64>;
+};
+
+/// A fast non-cryptographic `Hasher`.
+///
+/// Integers are mixed into the state with a single folded multiply, in the
+/// style of aHash's fallback algorithm. Bytes are hashed with wyhash, so a
+/// contiguous run of data is consumed in one call instead of one write per
+/// element.
+///
+/// The hasher is deterministic: without a seed it produces the same hashes in
+/// every process. It is not resistant to hash flooding from untrusted input,
+/// for which a random seed should be given to `with_seed()`.
+class DefaultHasher final {
+ public:
+  /// Constructs a hasher with the default, fixed, seed.
+  constexpr DefaultHasher() noexcept = default;
+
+  /// Constructs a hasher whose output is perturbed by `seed`.
+  [[nodiscard]] sus_pure static constexpr DefaultHasher with_seed(
+      u64 seed) noexcept {
+    auto h = DefaultHasher();
+    h.buffer_ ^= seed.primitive_value;
+    return h;
+  }
+
+  /// Writes the bytes in `bytes` into the hasher.
+  ///
+  /// The length is mixed in as well, so writing "ab" then "c" differs from
+  /// writing "a" then "bc".
+  constexpr void write(::sus::containers::Slice<u8> bytes) noexcept {
+    const auto len = size_t{bytes.len()};
+    if (std::is_constant_evaluated()) {
+      // The bytes can't be reinterpreted in a constant expression, so they are
+      // copied out to be hashed the same as at runtime.
+      auto* copy = new uint8_t[len + 1u];
+      for (size_t i = 0u; i < len; ++i) copy[i] = bytes[i].primitive_value;
+      write_bytes(copy, len);
+      delete[] copy;
+    } else {
+      write_bytes(reinterpret_cast<const uint8_t*>(bytes.as_ptr()), len);
+    }
+  }
+
+  /// Writes a single integer into the hasher.
+  constexpr void write_u8(u8 i) noexcept { update(i.primitive_value); }
+  /// Writes a single integer into the hasher.
+  constexpr void write_u16(u16 i) noexcept { update(i.primitive_value); }
+  /// Writes a single integer into the hasher.
+  constexpr void write_u32(u32 i) noexcept { update(i.primitive_value); }
+  /// Writes a single integer into the hasher.
+  constexpr void write_u64(u64 i) noexcept { update(i.primitive_value); }
+  /// Writes a single integer into the hasher.
+  constexpr void write_usize(usize i) noexcept { update(i.primitive_value); }
+
+  /// Returns the hash of the values written so far.
+  ///
+  /// This does not reset the hasher, so more values can be written after and
+  /// `finish()` called again.
+  [[nodiscard]] sus_pure constexpr u64 finish() const noexcept {
+    const auto rot = static_cast<uint32_t>(buffer_ & 63u);
+    return ::sus::num::__private::rotate_left(
+        __private::folded_multiply(buffer_, pad_), rot);
+  }
+
+ private:
+  static constexpr uint64_t kMultiple = 6364136223846793005u;
+  static constexpr uint32_t kRotate = 23u;
+
+  constexpr void write_bytes(const uint8_t* p, size_t len) noexcept {
+    buffer_ = (buffer_ + uint64_t{len}) * kMultiple;
+    if (len <= 8u) {
+      // Short inputs skip the wyhash setup and go straight into the state.
+      uint64_t a = 0u;
+      uint64_t b = 0u;
+      if (len >= 4u) {
+        a = __private::read_u32(p);
+        b = __private::read_u32(p + len - 4u);
+      } else if (len > 0u) {
+        a = __private::read_small(p, len);
+      }
+      large_update(a, b);
+    } else {
+      update(__private::wyhash(p, len, buffer_));
+    }
+  }
+
+  constexpr void update(uint64_t i) noexcept {
+    buffer_ = __private::folded_multiply(i ^ buffer_, kMultiple);
+  }
+
+  constexpr void large_update(uint64_t a, uint64_t b) noexcept {
+    const uint64_t combined =
+        __private::folded_multiply(a ^ extra_keys_[0u], b ^ extra_keys_[1u]);
+    buffer_ = ::sus::num::__private::rotate_left((buffer_ + pad_) ^ combined,
+                                                 kRotate);
+  }
+
+  uint64_t buffer_ = __private::kSecret[0u];
+  uint64_t pad_ = __private::kSecret[1u];
+  uint64_t extra_keys_[2u] = {__private::kSecret[2u], __private::kSecret[3u]};
+};
+
+/// Hashes the `bytes` with wyhash, perturbed by `seed`.
+///
+/// This is the fastest way to hash a single contiguous run of bytes, but it
+/// will not match the hash of the same bytes written to a `Hasher`.
+[[nodiscard]] inline u64 hash_bytes(::sus::containers::Slice<u8> bytes,
+                                    u64 seed = 0u) noexcept {
+  return __private::wyhash(reinterpret_cast<const uint8_t*>(bytes.as_ptr()),
+                           size_t{bytes.len()}, seed.primitive_value);
+}
+
+/// Hashes a single integer `i`, perturbed by `seed`, with one wide multiply.
+[[nodiscard]] sus_pure constexpr u64 hash_u64(u64 i, u64 seed = 0u) noexcept {
+  return __private::wyhash64(i.primitive_value, seed.primitive_value);
+}
+
+}  // namespace sus::hash
@@ -0,0 +1,169 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator that links two iterators together, in a chain.
+///
+/// This type is returned from `Iterator::chain()`.
+template <class InnerSizedIter, class OtherSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] Chain final
+    : public IteratorBase<Chain<InnerSizedIter, OtherSizedIter>,
+                          typename InnerSizedIter::Item> {
+  static_assert(std::same_as<typename InnerSizedIter::Item,
+                             typename OtherSizedIter::Item>);
+
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static Chain with(InnerSizedIter&& first_iter,
+                    OtherSizedIter&& second_iter) noexcept {
+    return Chain(::sus::move(first_iter), ::sus::move(second_iter));
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (!first_done_) {
+      Option<Item> item = first_iter_.next();
+      if (item.is_some()) return item;
+      first_done_ = true;
+    }
+    if (second_done_) return Option<Item>::none();
+    Option<Item> item = second_iter_.next();
+    if (item.is_none()) second_done_ = true;
+    return item;
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> nth(usize n) noexcept {
+    if (!first_done_) {
+      if constexpr (InnerSizedIter::ExactSize) {
+        // Skip over the whole first iterator in one step when `n` is past its
+        // end, instead of walking through it.
+        const usize first_len = first_iter_.exact_size_hint();
+        if (n < first_len) return first_iter_.nth(n);
+        n -= first_len;
+      } else {
+        while (true) {
+          Option<Item> item = first_iter_.next();
+          if (item.is_none()) break;
+          if (n == 0u) return item;
+          n -= 1u;
+        }
+      }
+      first_done_ = true;
+    }
+    if (second_done_) return Option<Item>::none();
+    Option<Item> item = second_iter_.nth(n);
+    if (item.is_none()) second_done_ = true;
+    return item;
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept
+    requires(InnerSizedIter::DoubleEnded && OtherSizedIter::DoubleEnded)
+  {
+    if (!second_done_) {
+      Option<Item> item = second_iter_.next_back();
+      if (item.is_some()) return item;
+      second_done_ = true;
+    }
+    if (first_done_) return Option<Item>::none();
+    Option<Item> item = first_iter_.next_back();
+    if (item.is_none()) first_done_ = true;
+    return item;
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> nth_back(usize n) noexcept
+    requires(InnerSizedIter::DoubleEnded && OtherSizedIter::DoubleEnded)
+  {
+    if (!second_done_) {
+      if constexpr (OtherSizedIter::ExactSize) {
+        const usize second_len = second_iter_.exact_size_hint();
+        if (n < second_len) return second_iter_.nth_back(n);
+        n -= second_len;
+      } else {
+        while (true) {
+          Option<Item> item = second_iter_.next_back();
+          if (item.is_none()) break;
+          if (n == 0u) return item;
+          n -= 1u;
+        }
+      }
+      second_done_ = true;
+    }
+    if (first_done_) return Option<Item>::none();
+    Option<Item> item = first_iter_.nth_back(n);
+    if (item.is_none()) first_done_ = true;
+    return item;
+  }
+
+  // sus::iter::Iterator trait.
+  SizeHint size_hint() const noexcept final {
+    if constexpr (InnerSizedIter::ExactSize && OtherSizedIter::ExactSize) {
+      const usize len = exact_size_hint();
+      return SizeHint(len, ::sus::Option<::sus::num::usize>::some(len));
+    } else {
+      // An iterator that has returned None has no elements left.
+      SizeHint first = SizeHint(0_usize, ::sus::Option<usize>::some(0_usize));
+      if (!first_done_) first = first_iter_.size_hint();
+      SizeHint second = SizeHint(0_usize, ::sus::Option<usize>::some(0_usize));
+      if (!second_done_) second = second_iter_.size_hint();
+      auto upper = ::sus::Option<::sus::num::usize>::none();
+      if (first.upper.is_some() && second.upper.is_some())
+        upper = first.upper->checked_add(*second.upper);
+      return SizeHint(first.lower.saturating_add(second.lower),
+                      ::sus::move(upper));
+    }
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept
+    requires(InnerSizedIter::ExactSize && OtherSizedIter::ExactSize)
+  {
+    auto len = 0_usize;
+    if (!first_done_) len += first_iter_.exact_size_hint();
+    if (!second_done_) len += second_iter_.exact_size_hint();
+    return len;
+  }
+
+ private:
+  Chain(InnerSizedIter&& first_iter, OtherSizedIter&& second_iter)
+      : first_iter_(::sus::move(first_iter)),
+        second_iter_(::sus::move(second_iter)) {}
+
+  InnerSizedIter first_iter_;
+  OtherSizedIter second_iter_;
+  // Set once the iterator has returned None, so that it is not polled again.
+  bool first_done_ = false;
+  bool second_done_ = false;
+
+  // The InnerSizedIter and OtherSizedIter are trivially relocatable.
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(first_iter_), decltype(second_iter_),
+                                  decltype(first_done_),
+                                  decltype(second_done_));
+};
+
+}  // namespace sus::iter
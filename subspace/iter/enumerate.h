@@ -75,7 +75,35 @@ class [[nodiscard]] [[sus_trivial_abi]] Enumerate final
     return next_iter_.exact_size_hint();
   }
 
-  // TODO: Implement nth(), nth_back(), etc...
+  // sus::iter::Iterator trait.
+  Option<Item> nth(usize n) noexcept {
+    Option<typename InnerSizedIter::Item> item = next_iter_.nth(n);
+    if (item.is_none()) {
+      return sus::none();
+    } else {
+      usize count = count_ + n;
+      count_ = count + 1u;
+      return sus::some(sus::tuple(
+          count, sus::move(item).unwrap_unchecked(::sus::marker::unsafe_fn)));
+    }
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> nth_back(usize n) noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize)
+  {
+    Option<typename InnerSizedIter::Item> item = next_iter_.nth_back(n);
+    if (item.is_none()) {
+      return sus::none();
+    } else {
+      usize len = next_iter_.exact_size_hint();
+      // Can safely add, `ExactSizeIterator` promises that the number of
+      // elements fits into a `usize`.
+      return sus::some(sus::tuple(
+          count_ + len,
+          sus::move(item).unwrap_unchecked(::sus::marker::unsafe_fn)));
+    }
+  }
 
  private:
   Enumerate(InnerSizedIter&& next_iter) : next_iter_(::sus::move(next_iter)) {}
@@ -0,0 +1,123 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/fn/fn_box_defn.h"
+#include "subspace/iter/into_iterator.h"
+#include "subspace/iter/iterator_concept.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator that maps each element to an iterator, and yields the elements
+/// of the produced iterators.
+///
+/// This type is returned from `Iterator::flat_map()`.
+template <class IntoIterable, class InnerSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] FlatMap final
+    : public IteratorBase<
+          FlatMap<IntoIterable, InnerSizedIter>,
+          typename std::decay_t<decltype(std::declval<IntoIterable&&>()
+                                             .into_iter())>::Item> {
+  using FromItem = InnerSizedIter::Item;
+  using MapFn = ::sus::fn::FnMutBox<IntoIterable(FromItem&&)>;
+  using EachIter =
+      std::decay_t<decltype(std::declval<IntoIterable&&>().into_iter())>;
+
+ public:
+  using Item = EachIter::Item;
+
+  static FlatMap with(MapFn fn, InnerSizedIter&& next_iter) noexcept {
+    return FlatMap(::sus::move(fn), ::sus::move(next_iter));
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    while (true) {
+      if (front_iter_.is_some()) {
+        Option<Item> item = front_iter_->next();
+        if (item.is_some()) return item;
+        front_iter_ = Option<EachIter>::none();
+      }
+      Option<FromItem> from = next_iter_.next();
+      if (from.is_none()) break;
+      front_iter_ = Option<EachIter>::some(
+          fn_(::sus::move(from).unwrap_unchecked(::sus::marker::unsafe_fn))
+              .into_iter());
+    }
+    // The front has caught up to where iteration from the back left off.
+    if (back_iter_.is_some()) {
+      Option<Item> item = back_iter_->next();
+      if (item.is_none()) back_iter_ = Option<EachIter>::none();
+      return item;
+    }
+    return Option<Item>::none();
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept
+    requires(InnerSizedIter::DoubleEnded &&
+             ::sus::iter::DoubleEndedIterator<EachIter, Item>)
+  {
+    while (true) {
+      if (back_iter_.is_some()) {
+        Option<Item> item = back_iter_->next_back();
+        if (item.is_some()) return item;
+        back_iter_ = Option<EachIter>::none();
+      }
+      Option<FromItem> from = next_iter_.next_back();
+      if (from.is_none()) break;
+      back_iter_ = Option<EachIter>::some(
+          fn_(::sus::move(from).unwrap_unchecked(::sus::marker::unsafe_fn))
+              .into_iter());
+    }
+    // The back has caught up to where iteration from the front left off.
+    if (front_iter_.is_some()) {
+      Option<Item> item = front_iter_->next_back();
+      if (item.is_none()) front_iter_ = Option<EachIter>::none();
+      return item;
+    }
+    return Option<Item>::none();
+  }
+
+ private:
+  FlatMap(MapFn fn, InnerSizedIter&& next_iter)
+      : fn_(::sus::move(fn)), next_iter_(::sus::move(next_iter)) {}
+
+  MapFn fn_;
+  InnerSizedIter next_iter_;
+  // The iterators produced by `fn_` which are currently being iterated from
+  // the front and from the back.
+  Option<EachIter> front_iter_;
+  Option<EachIter> back_iter_;
+
+  // The InnerSizedIter is trivially relocatable. Likewise, the map function is
+  // known to be trivially relocatable because the FnMutBox only stores a
+  // callable inline if it is trivially relocatable and trivially destructible,
+  // and otherwise holds it in a heap allocation. The iterators produced by the
+  // map function may not be.
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(fn_), decltype(next_iter_),
+                                           decltype(front_iter_),
+                                           decltype(back_iter_));
+};
+
+}  // namespace sus::iter
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "subspace/iter/iterator_concept.h"
 #include "subspace/mem/forward.h"
 
@@ -35,4 +37,15 @@ concept IntoIterator = requires(T&& t) {
   { ::sus::forward<T>(t).into_iter() } -> Iterator<Item>;
 };
 
+/// Conversion into an `Iterator` over any type of `Item`.
+///
+/// This is satisfied by any type that satisfies `IntoIterator<T, Item>` for
+/// some `Item`, which is found from the `Iterator` returned by `into_iter()`.
+template <class T>
+concept IntoIteratorAny = requires(T&& t) {
+  { ::sus::forward<T>(t).into_iter() };
+  requires IntoIterator<
+      T, typename std::decay_t<decltype(::sus::forward<T>(t).into_iter())>::Item>;
+};
+
 }  // namespace sus::iter
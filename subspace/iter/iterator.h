@@ -30,7 +30,15 @@
 // Headers that define iterators that Iterator can construct and return. They
 // are forward declared in iterator_defn.h so that transitive includes don't get
 // them all every time.
+#include "subspace/iter/chain.h"
 #include "subspace/iter/enumerate.h"
 #include "subspace/iter/filter.h"
+#include "subspace/iter/flat_map.h"
 #include "subspace/iter/map.h"
+#include "subspace/iter/peekable.h"
 #include "subspace/iter/reverse.h"
+#include "subspace/iter/scan.h"
+#include "subspace/iter/skip.h"
+#include "subspace/iter/step_by.h"
+#include "subspace/iter/take.h"
+#include "subspace/iter/zip.h"
@@ -20,11 +20,16 @@
 #include "subspace/iter/__private/iterator_loop.h"
 #include "subspace/iter/boxed_iterator.h"
 #include "subspace/iter/from_iterator.h"
+#include "subspace/iter/into_iterator.h"
+#include "subspace/iter/iterator_concept.h"
+#include "subspace/iter/size_hint.h"
 #include "subspace/iter/sized_iterator.h"
 #include "subspace/macros/__private/compiler_bugs.h"
+#include "subspace/mem/forward.h"
 #include "subspace/mem/move.h"
 #include "subspace/mem/size_of.h"
 #include "subspace/num/unsigned_integer.h"
+#include "subspace/option/__private/is_option_type.h"
 #include "subspace/option/option.h"
 
 namespace sus::containers {
@@ -43,24 +48,35 @@ using ::sus::construct::Into;
 using ::sus::option::Option;
 
 // TODO: Move forward decls somewhere?
+template <class InnerSizedIter, class OtherSizedIter>
+class Chain;
 template <class InnerSizedIter>
 class Enumerate;
 template <class InnerSizedIter>
 class Filter;
+template <class IntoIterable, class InnerSizedIter>
+class FlatMap;
 template <class Item>
 class Generator;
 template <class ToItem, class InnerSizedIter>
 class Map;
 template <class InnerSizedIter>
+class Peekable;
+template <class InnerSizedIter>
 class Reverse;
+template <class OutItem, class State, class InnerSizedIter>
+class Scan;
+template <class InnerSizedIter>
+class Skip;
+template <class InnerSizedIter>
+class StepBy;
+template <class InnerSizedIter>
+class Take;
+template <class InnerSizedIter, class OtherSizedIter>
+class Zip;
 template <class Iter>
 class IteratorRange;
 
-struct SizeHint {
-  ::sus::num::usize lower;
-  ::sus::Option<::sus::num::usize> upper;
-};
-
 template <class Iter, class ItemT>
 class IteratorBase {
  protected:
@@ -153,6 +169,38 @@ class IteratorBase {
   /// and be incorrect. Otherwise, `usize` will catch overflow and panic.
   ::sus::num::usize count() && noexcept;
 
+  /// Consumes the iterator, returning the last element.
+  ///
+  /// This method will evaluate the iterator until it returns None. While doing
+  /// so, it keeps track of the current element. After None is returned,
+  /// `last()` will then return the last element it saw. Iterators that know
+  /// where they end, such as iterators over chunks of a slice, provide their
+  /// own `last()` which does not walk through the other elements.
+  Option<Item> last() && noexcept;
+
+  /// Returns the `n`th element of the iterator, consuming it and every element
+  /// before it.
+  ///
+  /// Like most indexing operations, the count starts from zero, so `nth(0u)`
+  /// returns the first value, `nth(1u)` the second, and so on.
+  ///
+  /// Returns None if `n` is greater than or equal to the length of the
+  /// iterator, in which case the iterator is left empty.
+  ///
+  /// The default implementation calls `next()` `n + 1` times. Iterators that
+  /// can skip ahead without producing each element, such as iterators over a
+  /// slice, provide their own `nth()` which does so in constant time. Adaptors
+  /// such as `skip()` are built on `nth()` to make use of this.
+  Option<Item> nth(::sus::num::usize n) noexcept;
+
+  /// Returns the `n`th element from the end of the iterator, consuming it and
+  /// every element after it.
+  ///
+  /// This is the `nth()` method for `next_back()`, so `nth_back(0u)` returns
+  /// the last element.
+  Option<Item> nth_back(::sus::num::usize n) noexcept
+    requires(::sus::iter::DoubleEndedIterator<Iter, Item>);
+
   // Provided final methods.
 
   /// Wraps the iterator in a new iterator that is trivially relocatable.
@@ -172,6 +220,24 @@ class IteratorBase {
   auto box() && noexcept
     requires(!::sus::mem::relocate_by_memcpy<Iter>);
 
+  /// Takes two iterators and creates a new iterator over both in sequence.
+  ///
+  /// `chain()` will return a new iterator which will first iterate over values
+  /// from the first iterator and then over values from the second iterator.
+  ///
+  /// The `other` argument can be an iterator or anything that satisfies
+  /// `IntoIterator`, with the same `Item` type as this iterator.
+  ///
+  /// The resulting iterator is a `DoubleEndedIterator` if both iterators are,
+  /// and an `ExactSizeIterator` if both iterators are.
+  template <class Other, int&...,
+            class OtherIter =
+                std::decay_t<decltype(std::declval<Other&&>().into_iter())>>
+    requires(::sus::iter::IntoIterator<Other, ItemT> &&
+             ::sus::mem::relocate_by_memcpy<OtherIter>)
+  auto chain(Other&& other) && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
   /// Creates an iterator which gives the current iteration count as well as the
   /// next value.
   ///
@@ -203,6 +269,20 @@ class IteratorBase {
                   pred) && noexcept
     requires(::sus::mem::relocate_by_memcpy<Iter>);
 
+  /// Creates an iterator that works like map, but flattens nested structure.
+  ///
+  /// The closure is called with each element, and must return something that
+  /// satisfies `IntoIterator`. The returned iterator yields every element of
+  /// each of those iterators in turn.
+  ///
+  /// The returned iterator is a `DoubleEndedIterator` if this iterator and the
+  /// iterators returned by the closure are.
+  template <class T, int&..., class R = std::invoke_result_t<T, Item&&>,
+            class B = ::sus::fn::FnMutBox<R(Item&&)>>
+    requires(::sus::iter::IntoIteratorAny<R> && Into<T, B>)
+  auto flat_map(T fn) && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
   /// Creates an iterator from a generator function that consumes the current
   /// iterator.
   template <::sus::fn::FnOnce<::sus::iter::Generator<ItemT>(Iter&&)> GenFn>
@@ -218,6 +298,15 @@ class IteratorBase {
   auto map(T fn) && noexcept
     requires(::sus::mem::relocate_by_memcpy<Iter>);
 
+  /// Creates an iterator which can use the `peek()` and `peek_mut()` methods to
+  /// look at the next element of the iterator without consuming it.
+  ///
+  /// Note that the underlying iterator is still advanced when `peek()` is
+  /// called for the first time: In order to retrieve the next element, `next()`
+  /// is called on the underlying iterator.
+  auto peekable() && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
   /// Converts the iterator into a `std::ranges::range` for use with the std
   /// ranges library.
   ///
@@ -239,6 +328,55 @@ class IteratorBase {
     requires(::sus::mem::relocate_by_memcpy<Iter> &&
              ::sus::iter::DoubleEndedIterator<Iter, Item>);
 
+  /// An iterator adaptor which, like `fold()`, holds internal state, but unlike
+  /// `fold()`, produces a new iterator.
+  ///
+  /// `scan()` takes two arguments: an initial value which seeds the internal
+  /// state, and a closure with two arguments, the first being a mutable
+  /// reference to the internal state and the second an iterator element. The
+  /// closure can assign to the internal state to share state between
+  /// iterations.
+  ///
+  /// On iteration, the closure will be applied to each element of the iterator
+  /// and the return value from the closure, an `Option`, is returned by the
+  /// `next()` method. Thus the closure can return `Some(value)` to yield
+  /// `value`, or `None` to end the iteration.
+  template <class State, class T, int&...,
+            class R = std::invoke_result_t<T, State&, Item&&>,
+            class B = ::sus::fn::FnMutBox<R(State&, Item&&)>>
+    requires(::sus::option::__private::IsOptionType<R>::value && Into<T, B>)
+  auto scan(State initial_state, T fn) && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
+  /// Creates an iterator that skips the first `n` elements.
+  ///
+  /// `skip(n)` skips elements until `n` elements are skipped or the end of the
+  /// iterator is reached (whichever happens first). After that, all the
+  /// remaining elements are yielded. The elements are skipped with a single
+  /// call to `nth()` on the first call to `next()`, so skipping over an
+  /// iterator that provides a constant-time `nth()`, such as a slice iterator,
+  /// is also constant-time.
+  auto skip(::sus::num::usize n) && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
+  /// Creates an iterator starting at the same point, but stepping by the given
+  /// amount at each iteration.
+  ///
+  /// The first element of the iterator will always be returned, regardless of
+  /// the step given. Later elements are found with `nth(step - 1)`, so
+  /// iterators with a constant-time `nth()` step over the skipped elements
+  /// without visiting them.
+  ///
+  /// # Panics
+  /// The method will panic if the given step is `0`.
+  auto step_by(::sus::num::usize step) && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
+  /// Creates an iterator that yields the first `n` elements, or fewer if the
+  /// underlying iterator ends sooner.
+  auto take(::sus::num::usize n) && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
   /// Transforms an iterator into a collection.
   ///
   /// collect() can turn anything iterable into a relevant collection. If this
@@ -275,6 +413,27 @@ class IteratorBase {
   // NonNull.
   ::sus::containers::Vec<ItemT> collect_vec() && noexcept;
 
+  /// "Zips up" two iterators into a single iterator of pairs.
+  ///
+  /// `zip()` returns a new iterator that will iterate over two other iterators,
+  /// returning a Tuple where the first element comes from the first iterator,
+  /// and the second element comes from the second iterator. If either iterator
+  /// returns None, `next()` from the zipped iterator will return None.
+  ///
+  /// The `other` argument can be an iterator or anything that satisfies
+  /// `IntoIterator`.
+  ///
+  /// If both iterators are `ExactSizeIterator`s then so is the zipped iterator,
+  /// and its `nth()` skips ahead in both iterators with their own `nth()`. If
+  /// both are also `DoubleEndedIterator`s, then so is the zipped iterator.
+  template <class Other, int&...,
+            class OtherIter =
+                std::decay_t<decltype(std::declval<Other&&>().into_iter())>>
+    requires(::sus::iter::IntoIterator<Other, typename OtherIter::Item> &&
+             ::sus::mem::relocate_by_memcpy<OtherIter>)
+  auto zip(Other&& other) && noexcept
+    requires(::sus::mem::relocate_by_memcpy<Iter>);
+
   // TODO: cloned().
 };
 
@@ -321,6 +480,63 @@ template <class Iter, class Item>
   return c;
 }
 
+template <class Iter, class Item>
+Option<Item> IteratorBase<Iter, Item>::last() && noexcept {
+  auto last = Option<Item>::none();
+  while (true) {
+    Option<Item> item = as_subclass_mut().next();
+    if (item.is_none()) return last;
+    last = ::sus::move(item);
+  }
+}
+
+template <class Iter, class Item>
+Option<Item> IteratorBase<Iter, Item>::nth(::sus::num::usize n) noexcept {
+  while (true) {
+    Option<Item> item = as_subclass_mut().next();
+    if (item.is_none() || n == 0u) return item;
+    n -= 1u;
+  }
+}
+
+template <class Iter, class Item>
+Option<Item> IteratorBase<Iter, Item>::nth_back(::sus::num::usize n) noexcept
+  requires(::sus::iter::DoubleEndedIterator<Iter, Item>)
+{
+  while (true) {
+    Option<Item> item = as_subclass_mut().next_back();
+    if (item.is_none() || n == 0u) return item;
+    n -= 1u;
+  }
+}
+
+template <class Iter, class Item>
+template <class Other, int&..., class OtherIter>
+  requires(::sus::iter::IntoIterator<Other, Item> &&
+           ::sus::mem::relocate_by_memcpy<OtherIter>)
+auto IteratorBase<Iter, Item>::chain(Other&& other) && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using OtherSized = SizedIteratorType<OtherIter>::type;
+  using Chain = Chain<Sized, OtherSized>;
+  return Chain::with(
+      make_sized_iterator(static_cast<Iter&&>(*this)),
+      make_sized_iterator(::sus::forward<Other>(other).into_iter()));
+}
+
+template <class Iter, class Item>
+template <class T, int&..., class R, class B>
+  requires(::sus::iter::IntoIteratorAny<R> && Into<T, B>)
+auto IteratorBase<Iter, Item>::flat_map(T fn) && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using FlatMap = FlatMap<R, Sized>;
+  return FlatMap::with(sus::into(::sus::move(fn)),
+                       make_sized_iterator(static_cast<Iter&&>(*this)));
+}
+
 template <class Iter, class Item>
 template <class T, int&..., class R, class B>
   requires(!std::is_void_v<R> && Into<T, B>)
@@ -361,6 +577,15 @@ template <::sus::fn::FnOnce<::sus::iter::Generator<Item>(Iter&&)> GenFn>
   return ::sus::move(generator_fn)(static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+auto IteratorBase<Iter, Item>::peekable() && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using Peekable = Peekable<Sized>;
+  return Peekable::with(make_sized_iterator(static_cast<Iter&&>(*this)));
+}
+
 template <class Iter, class Item>
 auto IteratorBase<Iter, Item>::range() && noexcept {
   return ::sus::iter::IteratorRange<Iter>::with(static_cast<Iter&&>(*this));
@@ -376,6 +601,46 @@ auto IteratorBase<Iter, Item>::rev() && noexcept
   return Reverse::with(make_sized_iterator(static_cast<Iter&&>(*this)));
 }
 
+template <class Iter, class Item>
+template <class State, class T, int&..., class R, class B>
+  requires(::sus::option::__private::IsOptionType<R>::value && Into<T, B>)
+auto IteratorBase<Iter, Item>::scan(State initial_state, T fn) && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using Scan = Scan<typename ::sus::option::__private::IsOptionType<R>::inner_type,
+                    State, Sized>;
+  return Scan::with(::sus::move(initial_state), sus::into(::sus::move(fn)),
+                    make_sized_iterator(static_cast<Iter&&>(*this)));
+}
+
+template <class Iter, class Item>
+auto IteratorBase<Iter, Item>::skip(::sus::num::usize n) && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using Skip = Skip<Sized>;
+  return Skip::with(make_sized_iterator(static_cast<Iter&&>(*this)), n);
+}
+
+template <class Iter, class Item>
+auto IteratorBase<Iter, Item>::step_by(::sus::num::usize step) && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using StepBy = StepBy<Sized>;
+  return StepBy::with(make_sized_iterator(static_cast<Iter&&>(*this)), step);
+}
+
+template <class Iter, class Item>
+auto IteratorBase<Iter, Item>::take(::sus::num::usize n) && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using Take = Take<Sized>;
+  return Take::with(make_sized_iterator(static_cast<Iter&&>(*this)), n);
+}
+
 template <class Iter, class Item>
 template <::sus::iter::FromIterator<Item> C>
 ::sus::iter::FromIterator<Item> auto
@@ -389,4 +654,19 @@ IteratorBase<Iter, Item>::collect_vec() && noexcept {
   return ::sus::containers::Vec<Item>::from_iter(static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+template <class Other, int&..., class OtherIter>
+  requires(::sus::iter::IntoIterator<Other, typename OtherIter::Item> &&
+           ::sus::mem::relocate_by_memcpy<OtherIter>)
+auto IteratorBase<Iter, Item>::zip(Other&& other) && noexcept
+  requires(::sus::mem::relocate_by_memcpy<Iter>)
+{
+  using Sized = SizedIteratorType<Iter>::type;
+  using OtherSized = SizedIteratorType<OtherIter>::type;
+  using Zip = Zip<Sized, OtherSized>;
+  return Zip::with(
+      make_sized_iterator(static_cast<Iter&&>(*this)),
+      make_sized_iterator(::sus::forward<Other>(other).into_iter()));
+}
+
 }  // namespace sus::iter
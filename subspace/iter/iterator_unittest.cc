@@ -129,6 +129,35 @@ class EmptyIterator final : public IteratorBase<EmptyIterator<Item>, Item> {
   Option<Item> next() noexcept { return Option<Item>::none(); }
 };
 
+// An iterator over `len` ones which is not ExactSize, and only knows its length
+// to within a factor of 2. Without `bounded`, it has no upper bound at all.
+class LooseSizeIterator final : public IteratorBase<LooseSizeIterator, i32> {
+ public:
+  LooseSizeIterator(usize len, bool bounded = true)
+      : len_(len), bounded_(bounded) {}
+
+  // sus::iter::Iterator trait.
+  Option<i32> next() noexcept {
+    if (len_ == 0u) return sus::none();
+    len_ -= 1u;
+    return Option<i32>::some(1);
+  }
+
+  // sus::iter::Iterator trait.
+  sus::iter::SizeHint size_hint() const noexcept final {
+    return sus::iter::SizeHint(len_ / 2u, bounded_
+                                              ? Option<usize>::some(len_ * 2u)
+                                              : Option<usize>::none());
+  }
+
+ private:
+  usize len_;
+  bool bounded_;
+
+  sus_class_trivially_relocatable(unsafe_fn, decltype(len_),
+                                  decltype(bounded_));
+};
+
 TEST(Iterator, ForLoop) {
   int nums[5] = {1, 2, 3, 4, 5};
 
@@ -442,4 +471,373 @@ TEST(Iterator, Enumerate) {
   }
 }
 
+TEST(Iterator, Nth) {
+  i32 nums[5] = {1, 2, 3, 4, 5};
+
+  // The default nth() steps with next().
+  {
+    auto it = ArrayIterator<i32, 5>::with_array(nums);
+    EXPECT_EQ(it.nth(1u), sus::some(2).construct());
+    EXPECT_EQ(it.nth(0u), sus::some(3).construct());
+    EXPECT_EQ(it.nth_back(1u), sus::some(4).construct());
+    EXPECT_EQ(it.nth(1u), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+
+  // Slices skip ahead in constant time.
+  auto vec = Vec<i32>::with_values(1, 2, 3, 4, 5);
+  {
+    auto it = vec.iter();
+    EXPECT_EQ(it.nth(2u).unwrap(), 3);
+    EXPECT_EQ(it.exact_size_hint(), 2u);
+    EXPECT_EQ(it.nth_back(1u).unwrap(), 4);
+    EXPECT_EQ(it.exact_size_hint(), 0u);
+    EXPECT_EQ(it.nth(0u), sus::None);
+  }
+  {
+    auto it = vec.iter_mut();
+    EXPECT_EQ(it.nth(5u), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = vec.clone().into_iter();
+    EXPECT_EQ(it.nth(1u), sus::some(2).construct());
+    EXPECT_EQ(it.nth_back(2u), sus::some(3).construct());
+    EXPECT_EQ(it.next_back(), sus::None);
+  }
+  {
+    auto it = sus::Array<i32, 5>::with_values(1, 2, 3, 4, 5).into_iter();
+    EXPECT_EQ(it.exact_size_hint(), 5u);
+    EXPECT_EQ(it.nth_back(3u), sus::some(2).construct());
+    EXPECT_EQ(it.nth(0u), sus::some(1).construct());
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  // Through adaptors.
+  {
+    auto it = vec.iter().enumerate();
+    EXPECT_EQ(it.nth(2u).unwrap(), sus::tuple(2u, 3).construct());
+    EXPECT_EQ(it.nth_back(0u).unwrap(), sus::tuple(4u, 5).construct());
+    EXPECT_EQ(it.next().unwrap(), sus::tuple(3u, 4).construct());
+  }
+  {
+    auto it = vec.iter().rev();
+    EXPECT_EQ(it.nth(1u).unwrap(), 4);
+    EXPECT_EQ(it.nth_back(1u).unwrap(), 2);
+    EXPECT_EQ(it.next().unwrap(), 3);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+}
+
+TEST(Iterator, Chain) {
+  auto a = Vec<i32>::with_values(1, 2, 3);
+  auto b = Vec<i32>::with_values(4, 5);
+
+  {
+    auto it = a.iter().chain(b.iter());
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), const i32&>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.exact_size_hint(), 5u);
+    EXPECT_EQ(it.size_hint().lower, 5u);
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next_back().unwrap(), 5);
+    EXPECT_EQ(it.nth(2u).unwrap(), 4);
+    EXPECT_EQ(it.exact_size_hint(), 0u);
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(it.next_back(), sus::None);
+  }
+  {
+    auto it = a.iter().chain(b.iter());
+    EXPECT_EQ(it.nth_back(2u).unwrap(), 3);
+    EXPECT_EQ(it.next_back().unwrap(), 2);
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  // Chaining an IntoIterator.
+  {
+    auto v = a.clone().into_iter().chain(b.clone()).collect_vec();
+    EXPECT_EQ(v, Vec<i32>::with_values(1, 2, 3, 4, 5));
+  }
+  // The bounds of iterators that are not ExactSize are added together.
+  {
+    auto it = LooseSizeIterator(10u).chain(LooseSizeIterator(4u));
+    EXPECT_EQ(it.size_hint().lower, 7u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(28u).construct<usize>());
+    EXPECT_EQ(sus::move(it).count(), 14u);
+  }
+  {
+    auto it = LooseSizeIterator(10u).chain(LooseSizeIterator(4u, false));
+    EXPECT_EQ(it.size_hint().lower, 7u);
+    EXPECT_EQ(it.size_hint().upper, sus::None);
+    // Once the second iterator is done, it no longer counts.
+    EXPECT_EQ(it.nth(13u).unwrap(), 1);
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(it.size_hint().upper, sus::some(0u).construct<usize>());
+  }
+}
+
+TEST(Iterator, Zip) {
+  auto a = Vec<i32>::with_values(1, 2, 3, 4);
+  auto b = Vec<u32>::with_values(10u, 20u, 30u);
+
+  {
+    auto it = a.iter().zip(b.iter());
+    using E = sus::Tuple<const i32&, const u32&>;
+    static_assert(sus::iter::Iterator<decltype(it), E>);
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), E>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), E>);
+    EXPECT_EQ(it.exact_size_hint(), 3u);
+    EXPECT_EQ(it.next().unwrap(), sus::tuple(1, 10u).construct());
+    // The longer iterator is trimmed to match when iterating from the back.
+    EXPECT_EQ(it.next_back().unwrap(), sus::tuple(3, 30u).construct());
+    EXPECT_EQ(it.next().unwrap(), sus::tuple(2, 20u).construct());
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(it.next_back(), sus::None);
+  }
+  {
+    auto it = a.iter().zip(b.iter());
+    EXPECT_EQ(it.nth(2u).unwrap(), sus::tuple(3, 30u).construct());
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = a.iter().zip(b.clone());
+    EXPECT_EQ(it.nth_back(1u).unwrap(), sus::tuple(2, 20u).construct());
+    EXPECT_EQ(it.exact_size_hint(), 1u);
+  }
+  {
+    auto sum = 0_i32;
+    for (auto [x, y] : a.iter().zip(a.iter().skip(1u))) sum += x * y;
+    EXPECT_EQ(sum, 1 * 2 + 2 * 3 + 3 * 4);
+  }
+  // The bounds of iterators that are not ExactSize are the smaller of each.
+  {
+    auto it = LooseSizeIterator(10u).zip(LooseSizeIterator(4u));
+    EXPECT_EQ(it.size_hint().lower, 2u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(8u).construct<usize>());
+  }
+  {
+    auto it = LooseSizeIterator(10u).zip(LooseSizeIterator(4u, false));
+    EXPECT_EQ(it.size_hint().lower, 2u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(20u).construct<usize>());
+  }
+}
+
+TEST(Iterator, Skip) {
+  auto vec = Vec<i32>::with_values(1, 2, 3, 4, 5);
+
+  {
+    auto it = vec.iter().skip(2u);
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), const i32&>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.exact_size_hint(), 3u);
+    EXPECT_EQ(it.next().unwrap(), 3);
+    EXPECT_EQ(it.next_back().unwrap(), 5);
+    EXPECT_EQ(it.next().unwrap(), 4);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = vec.iter().skip(2u);
+    EXPECT_EQ(it.nth(1u).unwrap(), 4);
+    EXPECT_EQ(it.exact_size_hint(), 1u);
+  }
+  {
+    // Iterating from the back doesn't reach into the skipped elements.
+    auto it = vec.iter().skip(3u);
+    EXPECT_EQ(it.next_back().unwrap(), 5);
+    EXPECT_EQ(it.next_back().unwrap(), 4);
+    EXPECT_EQ(it.next_back(), sus::None);
+    EXPECT_EQ(it.nth_back(0u), sus::None);
+  }
+  {
+    auto it = vec.iter().skip(7u);
+    EXPECT_EQ(it.exact_size_hint(), 0u);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  // Skipping a non-sized iterator.
+  {
+    auto it = vec.clone().into_iter().filter(
+        [](const i32& i) { return i % 2 == 1; });
+    auto v = sus::move(it).skip(1u).collect_vec();
+    EXPECT_EQ(v, Vec<i32>::with_values(3, 5));
+  }
+  {
+    auto it = LooseSizeIterator(10u).skip(3u);
+    EXPECT_EQ(it.size_hint().lower, 2u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(17u).construct<usize>());
+  }
+  {
+    auto it = LooseSizeIterator(10u, false).skip(30u);
+    EXPECT_EQ(it.size_hint().lower, 0u);
+    EXPECT_EQ(it.size_hint().upper, sus::None);
+  }
+}
+
+TEST(Iterator, Take) {
+  auto vec = Vec<i32>::with_values(1, 2, 3, 4, 5);
+
+  {
+    auto it = vec.iter().take(3u);
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), const i32&>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.exact_size_hint(), 3u);
+    EXPECT_EQ(it.next_back().unwrap(), 3);
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next_back().unwrap(), 2);
+    EXPECT_EQ(it.next_back(), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = vec.iter().take(3u);
+    EXPECT_EQ(it.nth(1u).unwrap(), 2);
+    EXPECT_EQ(it.nth(1u), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = vec.iter().take(4u);
+    EXPECT_EQ(it.nth_back(1u).unwrap(), 3);
+    EXPECT_EQ(it.exact_size_hint(), 2u);
+  }
+  {
+    auto it = vec.iter().take(9u);
+    EXPECT_EQ(it.exact_size_hint(), 5u);
+    EXPECT_EQ(it.next_back().unwrap(), 5);
+  }
+  {
+    auto it = vec.iter().filter([](const i32&) { return true; }).take(2u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(2u).construct<usize>());
+    EXPECT_EQ(sus::move(it).count(), 2u);
+  }
+  {
+    auto it = LooseSizeIterator(10u).take(4u);
+    EXPECT_EQ(it.size_hint().lower, 4u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(4u).construct<usize>());
+  }
+  {
+    auto it = LooseSizeIterator(10u).take(30u);
+    EXPECT_EQ(it.size_hint().lower, 5u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(20u).construct<usize>());
+  }
+}
+
+TEST(Iterator, StepBy) {
+  auto vec = Vec<i32>::with_values(0, 1, 2, 3, 4, 5, 6, 7);
+
+  {
+    auto it = vec.iter().step_by(3u);
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), const i32&>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), const i32&>);
+    EXPECT_EQ(it.exact_size_hint(), 3u);
+    EXPECT_EQ(it.next().unwrap(), 0);
+    EXPECT_EQ(it.exact_size_hint(), 2u);
+    EXPECT_EQ(it.next().unwrap(), 3);
+    EXPECT_EQ(it.next().unwrap(), 6);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = vec.iter().step_by(3u);
+    EXPECT_EQ(it.next_back().unwrap(), 6);
+    EXPECT_EQ(it.next_back().unwrap(), 3);
+    EXPECT_EQ(it.next().unwrap(), 0);
+    EXPECT_EQ(it.next_back(), sus::None);
+  }
+  {
+    auto it = vec.iter().step_by(2u);
+    EXPECT_EQ(it.nth(2u).unwrap(), 4);
+    EXPECT_EQ(it.nth_back(0u).unwrap(), 6);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = vec.iter().step_by(1u);
+    EXPECT_EQ(it.exact_size_hint(), 8u);
+    EXPECT_EQ(it.nth(usize::MAX), sus::None);
+  }
+}
+
+#if GTEST_HAS_DEATH_TEST
+TEST(IteratorDeathTest, StepByZero) {
+  auto vec = Vec<i32>::with_values(1, 2);
+  EXPECT_DEATH([[maybe_unused]] auto it = vec.iter().step_by(0u), "");
+}
+#endif
+
+TEST(Iterator, FlatMap) {
+  auto vec = Vec<i32>::with_values(1, 2, 3);
+
+  {
+    auto it = vec.iter().flat_map(
+        [](const i32& i) { return Vec<i32>::with_values(i, i * 10); });
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), i32>);
+    EXPECT_EQ(it.next(), sus::some(1).construct());
+    EXPECT_EQ(it.next_back(), sus::some(30).construct());
+    EXPECT_EQ(it.next_back(), sus::some(3).construct());
+    EXPECT_EQ(it.next(), sus::some(10).construct());
+    EXPECT_EQ(it.next(), sus::some(2).construct());
+    EXPECT_EQ(it.next_back(), sus::some(20).construct());
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(it.next_back(), sus::None);
+  }
+  {
+    auto v = vec.iter()
+                 .flat_map([](const i32& i) {
+                   return Vec<i32>::with_values(i, i).into_iter().take(
+                       usize::from(i - 1));
+                 })
+                 .collect_vec();
+    EXPECT_EQ(v, Vec<i32>::with_values(2, 3, 3));
+  }
+}
+
+TEST(Iterator, Scan) {
+  auto vec = Vec<i32>::with_values(1, 2, 3, 4);
+
+  auto v = vec.iter()
+               .scan(0_i32,
+                     [](i32& sum, const i32& i) -> Option<i32> {
+                       sum += i;
+                       if (sum > 6) return sus::none();
+                       return sus::some(sum);
+                     })
+               .collect_vec();
+  EXPECT_EQ(v, Vec<i32>::with_values(1, 3, 6));
+}
+
+TEST(Iterator, Peekable) {
+  auto vec = Vec<i32>::with_values(1, 2, 3);
+
+  {
+    auto it = vec.clone().into_iter().peekable();
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), i32>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), i32>);
+    EXPECT_EQ(it.peek().unwrap(), 1);
+    EXPECT_EQ(it.peek().unwrap(), 1);
+    EXPECT_EQ(it.exact_size_hint(), 3u);
+    it.peek_mut().unwrap() = 5;
+    EXPECT_EQ(it.next(), sus::some(5).construct());
+    EXPECT_EQ(it.next_if([](const i32& i) { return i == 3; }), sus::None);
+    EXPECT_EQ(it.next_if([](const i32& i) { return i == 2; }),
+              sus::some(2).construct());
+    EXPECT_EQ(it.peek().unwrap(), 3);
+    EXPECT_EQ(it.next_back(), sus::some(3).construct());
+    EXPECT_EQ(it.peek(), sus::None);
+    EXPECT_EQ(it.exact_size_hint(), 0u);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = vec.iter().peekable();
+    EXPECT_EQ(it.peek().unwrap(), 1);
+    EXPECT_EQ(it.nth(1u).unwrap(), 2);
+    EXPECT_EQ(it.next().unwrap(), 3);
+    EXPECT_EQ(it.peek(), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+  {
+    auto it = LooseSizeIterator(10u).peekable();
+    EXPECT_EQ(it.size_hint().lower, 5u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(20u).construct<usize>());
+    // The peeked value is counted along with the inner iterator's bounds.
+    EXPECT_EQ(it.peek().unwrap(), 1);
+    EXPECT_EQ(it.size_hint().lower, 5u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(19u).construct<usize>());
+  }
+}
+
 }  // namespace
@@ -77,8 +77,9 @@ class [[nodiscard]] [[sus_trivial_abi]] Map final
   InnerSizedIter next_iter_;
 
   // The InnerSizedIter is trivially relocatable. Likewise, the predicate is
-  // known to be trivially relocatable because the FnMutBox will either be a
-  // function pointer or a heap allocation itself.
+  // known to be trivially relocatable because the FnMutBox only stores a
+  // callable inline if it is trivially relocatable and trivially destructible,
+  // and otherwise holds it in a heap allocation.
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(fn_),
                                   decltype(next_iter_));
 };
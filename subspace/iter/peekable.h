@@ -0,0 +1,159 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/fn/fn_concepts.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/mem/forward.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator with a `peek()` that returns an optional reference to the next
+/// element.
+///
+/// This type is returned from `Iterator::peekable()`.
+template <class InnerSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] Peekable final
+    : public IteratorBase<Peekable<InnerSizedIter>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static Peekable with(InnerSizedIter&& next_iter) noexcept {
+    return Peekable(::sus::move(next_iter));
+  }
+
+  /// Returns a reference to the next() value without advancing the iterator.
+  ///
+  /// Like `next()`, if there is a value, it is wrapped in a `Some`. But if the
+  /// iteration is over, None is returned.
+  Option<const std::remove_reference_t<Item>&> peek() & noexcept
+      sus_lifetimebound {
+    if (peeked_.is_none())
+      peeked_ = Option<Option<Item>>::some(next_iter_.next());
+    return (*peeked_).as_ref();
+  }
+
+  /// Returns a mutable reference to the next() value without advancing the
+  /// iterator.
+  ///
+  /// Like `next()`, if there is a value, it is wrapped in a `Some`. But if the
+  /// iteration is over, None is returned.
+  Option<std::remove_reference_t<Item>&> peek_mut() & noexcept
+      sus_lifetimebound {
+    if (peeked_.is_none())
+      peeked_ = Option<Option<Item>>::some(next_iter_.next());
+    return (*peeked_).as_mut();
+  }
+
+  /// Consume and return the next value of this iterator if `pred` returns true
+  /// for it.
+  ///
+  /// If `pred` returns false, or the iterator is over, the next value is not
+  /// consumed and None is returned.
+  Option<Item> next_if(
+      ::sus::fn::FnOnce<bool(const std::remove_reference_t<Item>&)> auto&&
+          pred) noexcept {
+    Option<Item> item = next();
+    if (item.is_some() && ::sus::forward<decltype(pred)>(pred)(*item))
+      return item;
+    // Put the value back, or remember that the iteration is over.
+    peeked_ = Option<Option<Item>>::some(::sus::move(item));
+    return Option<Item>::none();
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (peeked_.is_some())
+      return peeked_.take().unwrap_unchecked(::sus::marker::unsafe_fn);
+    return next_iter_.next();
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> nth(usize n) noexcept {
+    if (peeked_.is_some()) {
+      Option<Item> peeked =
+          peeked_.take().unwrap_unchecked(::sus::marker::unsafe_fn);
+      if (peeked.is_none() || n == 0u) return peeked;
+      return next_iter_.nth(n - 1u);
+    }
+    return next_iter_.nth(n);
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept
+    requires(InnerSizedIter::DoubleEnded)
+  {
+    if (peeked_.is_some()) {
+      // The peeked value is at the front, so it is the last one to be returned
+      // from the back.
+      if (peeked_->is_none()) return Option<Item>::none();
+      Option<Item> item = next_iter_.next_back();
+      if (item.is_some()) return item;
+      return peeked_->take();
+    }
+    return next_iter_.next_back();
+  }
+
+  // sus::iter::Iterator trait.
+  SizeHint size_hint() const noexcept final {
+    if constexpr (InnerSizedIter::ExactSize) {
+      const usize len = exact_size_hint();
+      return SizeHint(len, ::sus::Option<::sus::num::usize>::some(len));
+    } else {
+      if (peeked_.is_none()) return next_iter_.size_hint();
+      if (peeked_->is_none())
+        return SizeHint(0_usize, ::sus::Option<::sus::num::usize>::some(0u));
+      // The peeked value is in front of the inner iterator's elements.
+      SizeHint hint = next_iter_.size_hint();
+      return SizeHint(hint.lower.saturating_add(1_usize),
+                      ::sus::move(hint.upper).and_then([](usize upper) {
+                        return upper.checked_add(1_usize);
+                      }));
+    }
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept
+    requires(InnerSizedIter::ExactSize)
+  {
+    if (peeked_.is_none()) return next_iter_.exact_size_hint();
+    if (peeked_->is_none()) return 0u;
+    return next_iter_.exact_size_hint() + 1u;
+  }
+
+ private:
+  Peekable(InnerSizedIter&& next_iter) : next_iter_(::sus::move(next_iter)) {}
+
+  InnerSizedIter next_iter_;
+  // Holds Some once the next value has been peeked at. The inner Option is
+  // None if the iteration was over when it was peeked.
+  Option<Option<Item>> peeked_;
+
+  // The InnerSizedIter is trivially relocatable. The peeked value may not be.
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(next_iter_),
+                                           decltype(peeked_));
+};
+
+}  // namespace sus::iter
@@ -48,6 +48,10 @@ class [[nodiscard]] [[sus_trivial_abi]] Reverse final
   Option<Item> next() noexcept { return next_iter_.next_back(); }
   // sus::iter::DoubleEndedIterator trait.
   Option<Item> next_back() noexcept { return next_iter_.next(); }
+  // sus::iter::Iterator trait.
+  Option<Item> nth(usize n) noexcept { return next_iter_.nth_back(n); }
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> nth_back(usize n) noexcept { return next_iter_.nth(n); }
   // sus::iter::ExactSizeIterator trait.
   usize exact_size_hint() const noexcept
     requires(InnerSizedIter::ExactSize)
@@ -0,0 +1,73 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/fn/fn_box_defn.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator to maintain state while iterating another iterator.
+///
+/// This type is returned from `Iterator::scan()`.
+template <class OutItem, class State, class InnerSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] Scan final
+    : public IteratorBase<Scan<OutItem, State, InnerSizedIter>, OutItem> {
+  using FromItem = InnerSizedIter::Item;
+  using ScanFn = ::sus::fn::FnMutBox<Option<OutItem>(State&, FromItem&&)>;
+
+ public:
+  using Item = OutItem;
+
+  static Scan with(State&& state, ScanFn fn,
+                   InnerSizedIter&& next_iter) noexcept {
+    return Scan(::sus::move(state), ::sus::move(fn), ::sus::move(next_iter));
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    Option<FromItem> item = next_iter_.next();
+    if (item.is_none()) {
+      return Option<Item>::none();
+    } else {
+      return fn_(state_,
+                 ::sus::move(item).unwrap_unchecked(::sus::marker::unsafe_fn));
+    }
+  }
+
+ private:
+  Scan(State&& state, ScanFn fn, InnerSizedIter&& next_iter)
+      : state_(::sus::move(state)),
+        fn_(::sus::move(fn)),
+        next_iter_(::sus::move(next_iter)) {}
+
+  State state_;
+  ScanFn fn_;
+  InnerSizedIter next_iter_;
+
+  // The InnerSizedIter is trivially relocatable. Likewise, the scan function is
+  // known to be trivially relocatable because the FnMutBox only stores a
+  // callable inline if it is trivially relocatable and trivially destructible,
+  // and otherwise holds it in a heap allocation. The State may not be.
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(state_), decltype(fn_),
+                                           decltype(next_iter_));
+};
+
+}  // namespace sus::iter
@@ -0,0 +1,31 @@
+// Copyright 2022 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// The bounds on the number of elements remaining in an iterator, as returned
+/// from `Iterator::size_hint()`.
+///
+/// The `upper` bound is None when it is unknown, or larger than a `usize`.
+struct SizeHint {
+  ::sus::num::usize lower;
+  ::sus::Option<::sus::num::usize> upper;
+};
+
+}  // namespace sus::iter
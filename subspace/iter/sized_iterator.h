@@ -15,6 +15,7 @@
 #pragma once
 
 #include "subspace/iter/iterator_concept.h"
+#include "subspace/iter/size_hint.h"
 #include "subspace/mem/relocate.h"
 #include "subspace/mem/size_of.h"
 #include "subspace/option/option.h"
@@ -33,18 +34,27 @@ struct [[sus_trivial_abi]] SizedIterator final {
   constexpr SizedIterator(void (*destroy)(char& sized),
                           Option<Item> (*next)(char& sized),
                           Option<Item> (*next_back)(char& sized),
-                          usize (*exact_size_hint)(const char& sized))
+                          SizeHint (*size_hint)(const char& sized),
+                          usize (*exact_size_hint)(const char& sized),
+                          Option<Item> (*nth)(char& sized, usize n),
+                          Option<Item> (*nth_back)(char& sized, usize n))
       : destroy_(destroy),
         next_(next),
         next_back_(next_back),
-        exact_size_hint_(exact_size_hint) {}
+        size_hint_(size_hint),
+        exact_size_hint_(exact_size_hint),
+        nth_(nth),
+        nth_back_(nth_back) {}
 
   SizedIterator(SizedIterator&& o) noexcept
       : destroy_(::sus::mem::replace(mref(o.destroy_), nullptr)),
         next_(::sus::mem::replace(mref(o.next_), nullptr)),
         next_back_(::sus::mem::replace(mref(o.next_back_), nullptr)),
+        size_hint_(::sus::mem::replace(mref(o.size_hint_), nullptr)),
         exact_size_hint_(
-            ::sus::mem::replace(mref(o.exact_size_hint_), nullptr)) {
+            ::sus::mem::replace(mref(o.exact_size_hint_), nullptr)),
+        nth_(::sus::mem::replace(mref(o.nth_), nullptr)),
+        nth_back_(::sus::mem::replace(mref(o.nth_back_), nullptr)) {
     ::sus::ptr::copy_nonoverlapping(::sus::marker::unsafe_fn, o.sized_, sized_,
                                     SubclassSize);
   }
@@ -53,9 +63,13 @@ struct [[sus_trivial_abi]] SizedIterator final {
     destroy_ = ::sus::mem::replace(mref(o.destroy_), nullptr);
     next_ = ::sus::mem::replace(mref(o.next_), nullptr);
     next_back_ = ::sus::mem::replace(mref(o.next_back_), nullptr);
+    size_hint_ = ::sus::mem::replace(mref(o.size_hint_), nullptr);
     exact_size_hint_ = ::sus::mem::replace(mref(o.exact_size_hint_), nullptr);
+    nth_ = ::sus::mem::replace(mref(o.nth_), nullptr);
+    nth_back_ = ::sus::mem::replace(mref(o.nth_back_), nullptr);
     ::sus::ptr::copy_nonoverlapping(::sus::marker::unsafe_fn, o.sized_, sized_,
                                     SubclassSize);
+    return *this;
   }
 
   ~SizedIterator() noexcept {
@@ -68,11 +82,18 @@ struct [[sus_trivial_abi]] SizedIterator final {
   {
     return next_back_(*sized_);
   }
+  SizeHint size_hint() const noexcept { return size_hint_(*sized_); }
   usize exact_size_hint() const noexcept
     requires(ExactSize)
   {
     return exact_size_hint_(*sized_);
   }
+  Option<Item> nth(usize n) noexcept { return nth_(*sized_, n); }
+  Option<Item> nth_back(usize n) noexcept
+    requires(DoubleEnded)
+  {
+    return nth_back_(*sized_, n);
+  }
 
   char* as_mut_ptr() noexcept { return sized_; }
 
@@ -83,9 +104,18 @@ struct [[sus_trivial_abi]] SizedIterator final {
   // TODO: We could remove this field with a nested struct + template
   // specialization when DoubleEnded is false.
   Option<Item> (*next_back_)(char& sized);
+  // Iterators that know their bounds without being ExactSize provide their own
+  // `size_hint()`, and this calls through to it.
+  SizeHint (*size_hint_)(const char& sized);
   // TODO: We could remove this field with a nested struct + template
   // specialization when ExactSize is false.
   usize (*exact_size_hint_)(const char& sized);
+  // Iterators that can skip ahead without visiting each element provide their
+  // own `nth()`, and this calls through to it.
+  Option<Item> (*nth_)(char& sized, usize n);
+  // TODO: We could remove this field with a nested struct + template
+  // specialization when DoubleEnded is false.
+  Option<Item> (*nth_back_)(char& sized, usize n);
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(sized_),
                                   decltype(destroy_), decltype(next_back_));
@@ -129,6 +159,9 @@ inline SizedIteratorType<Iter>::type make_sized_iterator(Iter&& iter)
   } else {
     next_back = nullptr;
   }
+  SizeHint (*size_hint)(const char& sized) = [](const char& sized) {
+    return reinterpret_cast<const Iter&>(sized).size_hint();
+  };
   usize (*exact_size_hint)(const char& sized);
   if constexpr (SizedIteratorType<Iter>::type::ExactSize) {
     exact_size_hint = [](const char& sized) {
@@ -138,8 +171,20 @@ inline SizedIteratorType<Iter>::type make_sized_iterator(Iter&& iter)
     exact_size_hint = nullptr;
   }
 
-  auto it = typename SizedIteratorType<Iter>::type(destroy, next, next_back,
-                                                   exact_size_hint);
+  Option<Item> (*nth)(char& sized, usize n) = [](char& sized, usize n) {
+    return reinterpret_cast<Iter&>(sized).nth(n);
+  };
+  Option<Item> (*nth_back)(char& sized, usize n);
+  if constexpr (SizedIteratorType<Iter>::type::DoubleEnded) {
+    nth_back = [](char& sized, usize n) {
+      return reinterpret_cast<Iter&>(sized).nth_back(n);
+    };
+  } else {
+    nth_back = nullptr;
+  }
+
+  auto it = typename SizedIteratorType<Iter>::type(
+      destroy, next, next_back, size_hint, exact_size_hint, nth, nth_back);
   new (it.as_mut_ptr()) Iter(::sus::move(iter));
   return it;
 }
@@ -0,0 +1,120 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/mem/replace.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator that skips over `n` elements of another iterator.
+///
+/// This type is returned from `Iterator::skip()`.
+template <class InnerSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] Skip final
+    : public IteratorBase<Skip<InnerSizedIter>, typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static Skip with(InnerSizedIter&& next_iter, usize n) noexcept {
+    return Skip(::sus::move(next_iter), n);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (skip_ > 0u) [[unlikely]]
+      return next_iter_.nth(::sus::mem::replace(mref(skip_), 0_usize));
+    return next_iter_.next();
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> nth(usize n) noexcept {
+    if (skip_ > 0u) [[unlikely]] {
+      const usize skip = ::sus::mem::replace(mref(skip_), 0_usize);
+      Option<usize> total = skip.checked_add(n);
+      if (total.is_some())
+        return next_iter_.nth(
+            ::sus::move(total).unwrap_unchecked(::sus::marker::unsafe_fn));
+      // The combined skip doesn't fit in a usize, so skip in two steps.
+      if (next_iter_.nth(skip - 1u).is_none()) return Option<Item>::none();
+    }
+    return next_iter_.nth(n);
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize)
+  {
+    if (exact_size_hint() > 0u)
+      return next_iter_.next_back();
+    else
+      return Option<Item>::none();
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> nth_back(usize n) noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize)
+  {
+    const usize len = exact_size_hint();
+    if (n < len) return next_iter_.nth_back(n);
+    // Consume what is left without reaching into the skipped elements.
+    if (len > 0u) (void)next_iter_.nth_back(len - 1u);
+    return Option<Item>::none();
+  }
+
+  // sus::iter::Iterator trait.
+  SizeHint size_hint() const noexcept final {
+    if constexpr (InnerSizedIter::ExactSize) {
+      const usize len = exact_size_hint();
+      return SizeHint(len, ::sus::Option<::sus::num::usize>::some(len));
+    } else {
+      // The elements still to be skipped are in the inner iterator's bounds.
+      SizeHint hint = next_iter_.size_hint();
+      const usize skip = skip_;
+      return SizeHint(hint.lower.saturating_sub(skip),
+                      ::sus::move(hint.upper).map([skip](usize upper) {
+                        return upper.saturating_sub(skip);
+                      }));
+    }
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept
+    requires(InnerSizedIter::ExactSize)
+  {
+    return next_iter_.exact_size_hint().saturating_sub(skip_);
+  }
+
+ private:
+  Skip(InnerSizedIter&& next_iter, usize n)
+      : next_iter_(::sus::move(next_iter)), skip_(n) {}
+
+  InnerSizedIter next_iter_;
+  // The number of elements still to be skipped, which is done all at once on
+  // the first call to `next()` or `nth()`.
+  usize skip_;
+
+  // The InnerSizedIter is trivially relocatable.
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(next_iter_), decltype(skip_));
+};
+
+}  // namespace sus::iter
@@ -0,0 +1,147 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/assertions/check.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator for stepping iterators by a custom amount.
+///
+/// This type is returned from `Iterator::step_by()`.
+template <class InnerSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] StepBy final
+    : public IteratorBase<StepBy<InnerSizedIter>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static StepBy with(InnerSizedIter&& next_iter, usize step) noexcept {
+    ::sus::check(step > 0u);
+    return StepBy(::sus::move(next_iter), step);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (first_take_) [[unlikely]] {
+      first_take_ = false;
+      return next_iter_.next();
+    }
+    return next_iter_.nth(skip_);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> nth(usize n) noexcept {
+    if (first_take_) [[unlikely]] {
+      first_take_ = false;
+      Option<Item> first = next_iter_.next();
+      if (n == 0u || first.is_none()) return first;
+      n -= 1u;
+    }
+    // The `n`th element is `(n + 1) * step - 1` elements ahead, which can be
+    // reached with a single `nth()` unless it overflows.
+    const usize step = skip_ + 1u;
+    Option<usize> ahead = n.checked_add(1u);
+    if (ahead.is_some()) {
+      ahead = ::sus::move(ahead)
+                  .unwrap_unchecked(::sus::marker::unsafe_fn)
+                  .checked_mul(step);
+    }
+    if (ahead.is_some()) {
+      return next_iter_.nth(
+          ::sus::move(ahead).unwrap_unchecked(::sus::marker::unsafe_fn) - 1u);
+    }
+    while (true) {
+      Option<Item> item = next_iter_.nth(skip_);
+      if (item.is_none() || n == 0u) return item;
+      n -= 1u;
+    }
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize)
+  {
+    return next_iter_.nth_back(next_back_index());
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> nth_back(usize n) noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize)
+  {
+    // `saturating_mul()` can be used here since, if the step overflows, then
+    // the iterator has fewer elements than the step and `nth_back()` will
+    // return None after consuming it.
+    return next_iter_.nth_back(
+        n.saturating_mul(skip_ + 1u).saturating_add(next_back_index()));
+  }
+
+  // sus::iter::Iterator trait.
+  SizeHint size_hint() const noexcept final {
+    if constexpr (InnerSizedIter::ExactSize) {
+      const usize len = exact_size_hint();
+      return SizeHint(len, ::sus::Option<::sus::num::usize>::some(len));
+    } else {
+      return SizeHint(0_usize, ::sus::Option<::sus::num::usize>::none());
+    }
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept
+    requires(InnerSizedIter::ExactSize)
+  {
+    const usize len = next_iter_.exact_size_hint();
+    const usize step = skip_ + 1u;
+    if (first_take_)
+      return len == 0u ? 0_usize : 1u + (len - 1u) / step;
+    else
+      return len / step;
+  }
+
+ private:
+  StepBy(InnerSizedIter&& next_iter, usize step)
+      : next_iter_(::sus::move(next_iter)), skip_(step - 1u) {}
+
+  // The number of elements at the back of the iterator which are not part of
+  // the steps, and must be skipped when iterating from the back.
+  usize next_back_index() const noexcept
+    requires(InnerSizedIter::ExactSize)
+  {
+    const usize rem = next_iter_.exact_size_hint() % (skip_ + 1u);
+    if (first_take_)
+      return rem == 0u ? skip_ : rem - 1u;
+    else
+      return rem;
+  }
+
+  InnerSizedIter next_iter_;
+  // The number of elements between each step, which is one less than the step.
+  usize skip_;
+  // The first element is always returned, regardless of the step.
+  bool first_take_ = true;
+
+  // The InnerSizedIter is trivially relocatable.
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(next_iter_), decltype(skip_),
+                                  decltype(first_take_));
+};
+
+}  // namespace sus::iter
@@ -0,0 +1,121 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator that only iterates over the first `n` elements of another
+/// iterator.
+///
+/// This type is returned from `Iterator::take()`.
+template <class InnerSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] Take final
+    : public IteratorBase<Take<InnerSizedIter>, typename InnerSizedIter::Item> {
+ public:
+  using Item = InnerSizedIter::Item;
+
+  static Take with(InnerSizedIter&& next_iter, usize n) noexcept {
+    return Take(::sus::move(next_iter), n);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (n_ == 0u) return Option<Item>::none();
+    n_ -= 1u;
+    return next_iter_.next();
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> nth(usize n) noexcept {
+    if (n_ > n) {
+      n_ -= n + 1u;
+      return next_iter_.nth(n);
+    }
+    // Consume the remaining elements, without going past the end of the Take.
+    if (n_ > 0u) {
+      (void)next_iter_.nth(n_ - 1u);
+      n_ = 0u;
+    }
+    return Option<Item>::none();
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize)
+  {
+    if (n_ == 0u) return Option<Item>::none();
+    const usize n = n_;
+    n_ -= 1u;
+    // Skip the elements at the back which are past the end of the Take.
+    return next_iter_.nth_back(next_iter_.exact_size_hint().saturating_sub(n));
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> nth_back(usize n) noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize)
+  {
+    const usize len = next_iter_.exact_size_hint();
+    if (n_ > n) {
+      const usize m = len.saturating_sub(n_) + n;
+      n_ -= n + 1u;
+      return next_iter_.nth_back(m);
+    }
+    if (len > 0u) (void)next_iter_.nth_back(len - 1u);
+    return Option<Item>::none();
+  }
+
+  // sus::iter::Iterator trait.
+  SizeHint size_hint() const noexcept final {
+    if constexpr (InnerSizedIter::ExactSize) {
+      const usize len = exact_size_hint();
+      return SizeHint(len, ::sus::Option<::sus::num::usize>::some(len));
+    } else {
+      const SizeHint hint = next_iter_.size_hint();
+      const usize lower = hint.lower < n_ ? hint.lower : n_;
+      const usize upper =
+          hint.upper.is_some() && *hint.upper < n_ ? *hint.upper : n_;
+      return SizeHint(lower, ::sus::Option<::sus::num::usize>::some(upper));
+    }
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept
+    requires(InnerSizedIter::ExactSize)
+  {
+    const usize len = next_iter_.exact_size_hint();
+    return len < n_ ? len : n_;
+  }
+
+ private:
+  Take(InnerSizedIter&& next_iter, usize n)
+      : next_iter_(::sus::move(next_iter)), n_(n) {}
+
+  InnerSizedIter next_iter_;
+  // The number of elements left to be yielded.
+  usize n_;
+
+  // The InnerSizedIter is trivially relocatable.
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(next_iter_), decltype(n_));
+};
+
+}  // namespace sus::iter
@@ -0,0 +1,157 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/iter/sized_iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::iter {
+
+/// An iterator that iterates two other iterators simultaneously.
+///
+/// This type is returned from `Iterator::zip()`.
+template <class InnerSizedIter, class OtherSizedIter>
+class [[nodiscard]] [[sus_trivial_abi]] Zip final
+    : public IteratorBase<Zip<InnerSizedIter, OtherSizedIter>,
+                          ::sus::Tuple<typename InnerSizedIter::Item,
+                                       typename OtherSizedIter::Item>> {
+ public:
+  using Item = ::sus::Tuple<typename InnerSizedIter::Item,
+                            typename OtherSizedIter::Item>;
+
+  static Zip with(InnerSizedIter&& first_iter,
+                  OtherSizedIter&& second_iter) noexcept {
+    return Zip(::sus::move(first_iter), ::sus::move(second_iter));
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    Option<typename InnerSizedIter::Item> first = first_iter_.next();
+    if (first.is_none()) return Option<Item>::none();
+    Option<typename OtherSizedIter::Item> second = second_iter_.next();
+    if (second.is_none()) return Option<Item>::none();
+    return make_item(::sus::move(first), ::sus::move(second));
+  }
+
+  // sus::iter::Iterator trait.
+  //
+  // Calls `nth()` on each iterator instead of `next()` `n + 1` times. As with
+  // `next()`, the second iterator is not advanced if the first one runs out.
+  Option<Item> nth(usize n) noexcept {
+    Option<typename InnerSizedIter::Item> first = first_iter_.nth(n);
+    if (first.is_none()) return Option<Item>::none();
+    Option<typename OtherSizedIter::Item> second = second_iter_.nth(n);
+    if (second.is_none()) return Option<Item>::none();
+    return make_item(::sus::move(first), ::sus::move(second));
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize &&
+             OtherSizedIter::DoubleEnded && OtherSizedIter::ExactSize)
+  {
+    trim_back();
+    Option<typename InnerSizedIter::Item> first = first_iter_.next_back();
+    if (first.is_none()) return Option<Item>::none();
+    Option<typename OtherSizedIter::Item> second = second_iter_.next_back();
+    if (second.is_none()) return Option<Item>::none();
+    return make_item(::sus::move(first), ::sus::move(second));
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> nth_back(usize n) noexcept
+    requires(InnerSizedIter::DoubleEnded && InnerSizedIter::ExactSize &&
+             OtherSizedIter::DoubleEnded && OtherSizedIter::ExactSize)
+  {
+    trim_back();
+    Option<typename InnerSizedIter::Item> first = first_iter_.nth_back(n);
+    if (first.is_none()) return Option<Item>::none();
+    Option<typename OtherSizedIter::Item> second = second_iter_.nth_back(n);
+    if (second.is_none()) return Option<Item>::none();
+    return make_item(::sus::move(first), ::sus::move(second));
+  }
+
+  // sus::iter::Iterator trait.
+  SizeHint size_hint() const noexcept final {
+    if constexpr (InnerSizedIter::ExactSize && OtherSizedIter::ExactSize) {
+      const usize len = exact_size_hint();
+      return SizeHint(len, ::sus::Option<::sus::num::usize>::some(len));
+    } else {
+      // The Zip ends when either iterator does.
+      const SizeHint first = first_iter_.size_hint();
+      const SizeHint second = second_iter_.size_hint();
+      const usize lower =
+          first.lower < second.lower ? first.lower : second.lower;
+      auto upper = ::sus::Option<::sus::num::usize>::none();
+      if (first.upper.is_some() && second.upper.is_some())
+        upper = ::sus::Option<::sus::num::usize>::some(
+            *first.upper < *second.upper ? *first.upper : *second.upper);
+      else if (first.upper.is_some())
+        upper = first.upper;
+      else if (second.upper.is_some())
+        upper = second.upper;
+      return SizeHint(lower, ::sus::move(upper));
+    }
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept
+    requires(InnerSizedIter::ExactSize && OtherSizedIter::ExactSize)
+  {
+    const usize first_len = first_iter_.exact_size_hint();
+    const usize second_len = second_iter_.exact_size_hint();
+    return first_len < second_len ? first_len : second_len;
+  }
+
+ private:
+  Zip(InnerSizedIter&& first_iter, OtherSizedIter&& second_iter)
+      : first_iter_(::sus::move(first_iter)),
+        second_iter_(::sus::move(second_iter)) {}
+
+  static Option<Item> make_item(
+      Option<typename InnerSizedIter::Item>&& first,
+      Option<typename OtherSizedIter::Item>&& second) noexcept {
+    // SAFETY: Both Options were checked to hold Some by the caller.
+    return Option<Item>::some(Item::with(
+        ::sus::move(first).unwrap_unchecked(::sus::marker::unsafe_fn),
+        ::sus::move(second).unwrap_unchecked(::sus::marker::unsafe_fn)));
+  }
+
+  // Drops elements from the back of the longer iterator so that both end at
+  // the same position, which is where iterating from the back must start.
+  void trim_back() noexcept {
+    const usize first_len = first_iter_.exact_size_hint();
+    const usize second_len = second_iter_.exact_size_hint();
+    if (first_len > second_len)
+      (void)first_iter_.nth_back(first_len - second_len - 1u);
+    else if (second_len > first_len)
+      (void)second_iter_.nth_back(second_len - first_len - 1u);
+  }
+
+  InnerSizedIter first_iter_;
+  OtherSizedIter second_iter_;
+
+  // The InnerSizedIter and OtherSizedIter are trivially relocatable.
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(first_iter_),
+                                  decltype(second_iter_));
+};
+
+}  // namespace sus::iter
@@ -30,27 +30,33 @@ namespace __private {
 
 /// A helper class that constructs and holds a NeverValueField type T.
 ///
-/// Default-constructing NeverValueAccess will trivially default construct T.
-/// The caller should then set the never-value with `set_never_value()`.
+/// Default-constructing NeverValueAccess will default construct T. The caller
+/// should then set the never-value with `set_never_value()`.
 ///
 /// The other constructors allow constructing the T from a parameter (typically
 /// a const T& or T&&).
 ///
 /// Provides methods to see if the T is in the never-value state or not, and to
 /// set the never-value field to:
-/// * the never-value, after trivial default construction.
+/// * the never-value, after default construction.
 /// * the destroy-value before destroying it from the never-value state.
 ///
-/// # Why trivial default construction?
+/// # Requirements on T
 ///
-/// NeverValueAccess requires that `T` is trivially default constructible
-/// because the spec requires this for initializing a union member through
-/// assignment (some discussion here:
-/// https://github.com/llvm/llvm-project/issues/50604).
+/// NeverValueAccess requires that `T` is default constructible (the default
+/// constructor may be private, as NeverValueAccess is a friend through
+/// `sus_class_never_value_field`), and that the object it constructs can be
+/// destroyed after its never-value field is set to the destroy-value. The
+/// default constructor need not be trivial: Vec and Slice, for instance,
+/// initialize their fields.
 ///
-/// We use assignment to initialize a union member with a NeverValueAccess to
-/// implement changing to a never-value state without placement new, which is
-/// not possible in a constant expression.
+/// When `T` is trivially default constructible, the never-value state can be
+/// entered through assignment to a union member, which works in a constant
+/// expression where placement new does not (some discussion here:
+/// https://github.com/llvm/llvm-project/issues/50604). Otherwise, assignment
+/// would run T's assignment operator on a destroyed object, so the never-value
+/// state is entered by constructing the NeverValueAccess in place with
+/// `std::construct_at()`.
 template <class T>
 struct NeverValueAccess {
   /// Whether the type `T` has a never-value field.
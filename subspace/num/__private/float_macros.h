@@ -783,29 +783,120 @@
   }                                                                       \
   static_assert(true)
 
-#define _sus__float(T, PrimitiveT, UnsignedIntT) \
-  _sus__float_storage(PrimitiveT);               \
-  _sus__float_constants(T, PrimitiveT);          \
-  _sus__float_construct(T, PrimitiveT);          \
-  _sus__float_to_primitive(T, PrimitiveT);       \
-  _sus__float_comparison(T);                     \
-  _sus__float_unary_ops(T);                      \
-  _sus__float_binary_ops(T);                     \
-  _sus__float_mutable_ops(T);                    \
-  _sus__float_abs(T, PrimitiveT);                \
-  _sus__float_math(T, PrimitiveT);               \
-  _sus__float_fract_trunc(T);                    \
-  _sus__float_convert_to(T, PrimitiveT);         \
-  _sus__float_bytes(T, UnsignedIntT);            \
-  _sus__float_category(T);                       \
-  _sus__float_clamp(T);                          \
-  _sus__float_euclid(T, PrimitiveT);             \
-  _sus__float_endian(T, ::sus::mem::size_of<PrimitiveT>(), UnsignedIntT)
+#define _sus__float(T, PrimitiveT, UnsignedIntT)                          \
+  _sus__float_storage(PrimitiveT);                                        \
+  _sus__float_constants(T, PrimitiveT);                                   \
+  _sus__float_construct(T, PrimitiveT);                                   \
+  _sus__float_to_primitive(T, PrimitiveT);                                \
+  _sus__float_comparison(T);                                              \
+  _sus__float_unary_ops(T);                                               \
+  _sus__float_binary_ops(T);                                              \
+  _sus__float_mutable_ops(T);                                             \
+  _sus__float_abs(T, PrimitiveT);                                         \
+  _sus__float_math(T, PrimitiveT);                                        \
+  _sus__float_fract_trunc(T);                                             \
+  _sus__float_convert_to(T, PrimitiveT);                                  \
+  _sus__float_bytes(T, UnsignedIntT);                                     \
+  _sus__float_category(T);                                                \
+  _sus__float_clamp(T);                                                   \
+  _sus__float_euclid(T, PrimitiveT);                                      \
+  _sus__float_endian(T, ::sus::mem::size_of<PrimitiveT>(), UnsignedIntT); \
+  _sus__float_to_string(T);                                               \
+  _sus__float_from_str(T)
 
 #define _sus__float_out_of_line(T, PrimitiveT, UnsignedIntT)           \
   _sus__float_constants_out_of_line(T, PrimitiveT);                    \
   _sus__float_endian_out_of_line(T, ::sus::mem::size_of<PrimitiveT>(), \
-                                 UnsignedIntT)
+                                 UnsignedIntT);                        \
+  _sus__float_to_string_out_of_line(T);                                \
+  _sus__float_from_str_out_of_line(T, PrimitiveT)
+
+#define _sus__float_to_string(T)                                             \
+  /** Writes the shortest decimal representation of the number which parses  \
+   * back to the same value to the front of `buf`, and returns the number of \
+   * bytes written.                                                          \
+   *                                                                         \
+   * Large and small magnitudes are written in scientific notation, such as  \
+   * `1e+22`, when that is shorter. Infinities are written as `inf` and      \
+   * `-inf`, and NaN is written as `nan`, or `-nan` if its sign bit is set.  \
+   * No number takes more than 24 bytes, so a buffer of that size can hold   \
+   * any of them.                                                            \
+   *                                                                         \
+   * # Panics                                                                \
+   * Panics if `buf` is shorter than the decimal representation.             \
+   */                                                                        \
+  usize write_to(::sus::containers::SliceMut<u8> buf) const& noexcept;       \
+  /** Returns the shortest decimal representation of the number which        \
+   * parses back to the same value, as written by `write_to()`.              \
+   *                                                                         \
+   * The result always fits in the inline storage of `String`, so this does  \
+   * not allocate.                                                           \
+   */                                                                        \
+  ::sus::string::String to_string() const& noexcept;                         \
+  static_assert(true)
+
+#define _sus__float_to_string_out_of_line(T)                                   \
+  inline usize T::write_to(::sus::containers::SliceMut<u8> buf)                \
+      const& noexcept {                                                        \
+    namespace to_chars = ::sus::num::__private::to_chars;                      \
+    const auto buf_len = size_t{buf.len()};                                    \
+    const uint32_t cap = buf_len < to_chars::kMaxFloatLen                      \
+                             ? static_cast<uint32_t>(buf_len)                  \
+                             : to_chars::kMaxFloatLen;                         \
+    const uint32_t len = to_chars::write_float(                                \
+        primitive_value, reinterpret_cast<uint8_t*>(buf.as_mut_ptr()), cap);   \
+    ::sus::check(len <= cap);                                                  \
+    return usize::from(len);                                                   \
+  }                                                                            \
+                                                                               \
+  inline ::sus::string::String T::to_string() const& noexcept {                \
+    namespace to_chars = ::sus::num::__private::to_chars;                      \
+    uint8_t bytes[to_chars::kMaxFloatLen];                                     \
+    const uint32_t len =                                                       \
+        to_chars::write_float(primitive_value, bytes, to_chars::kMaxFloatLen); \
+    const auto str = ::sus::string::Str::from_utf8_unchecked(                  \
+        ::sus::marker::unsafe_fn,                                              \
+        ::sus::containers::Slice<u8>::from_raw_parts(                          \
+            ::sus::marker::unsafe_fn, reinterpret_cast<const u8*>(bytes),      \
+            usize::from(len)));                                                \
+    return ::sus::string::String::from(str);                                   \
+  }                                                                            \
+  static_assert(true)
+
+#define _sus__float_from_str(T)                                              \
+  /** Parses a floating point number from `src`.                             \
+   *                                                                         \
+   * The accepted format is a decimal number with an optional sign, point    \
+   * and exponent, such as `-12`, `1.5`, `.5`, `2.` or `6.02e23`, or one of  \
+   * `inf`, `infinity` or `nan`, in any case. Nothing else is accepted,      \
+   * including whitespace. Numbers too large for ##T## are parsed as         \
+   * infinity, and numbers too small as zero.                                \
+   *                                                                         \
+   * The result is the nearest ##T## to the decimal number, breaking ties to \
+   * even.                                                                   \
+   */                                                                        \
+  static ::sus::result::Result<T, ::sus::num::ParseFloatError> from_str(     \
+      ::sus::containers::Slice<u8> src) noexcept;                            \
+  static_assert(true)
+
+#define _sus__float_from_str_out_of_line(T, PrimitiveT)                     \
+  inline ::sus::result::Result<T, ::sus::num::ParseFloatError> T::from_str( \
+      ::sus::containers::Slice<u8> src) noexcept {                          \
+    namespace parse = ::sus::num::__private::parse;                         \
+    using R = ::sus::result::Result<T, ::sus::num::ParseFloatError>;        \
+    using Kind = ::sus::num::ParseFloatError::Kind;                         \
+    auto value = PrimitiveT{0};                                             \
+    const auto* bytes = reinterpret_cast<const uint8_t*>(src.as_ptr());     \
+    switch (parse::parse_float(bytes, size_t{src.len()}, value)) {          \
+      case parse::FloatStatus::Ok: return R::with(T(value));                \
+      case parse::FloatStatus::Empty:                                       \
+        return R::with_err(::sus::num::ParseFloatError(Kind::Empty));       \
+      case parse::FloatStatus::Invalid:                                     \
+        return R::with_err(::sus::num::ParseFloatError(Kind::Invalid));     \
+    }                                                                       \
+    ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);     \
+  }                                                                         \
+  static_assert(true)
 
 #define _sus__float_hash_equal_to(T)                                      \
   template <>                                                             \
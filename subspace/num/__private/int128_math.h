@@ -0,0 +1,397 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "subspace/macros/always_inline.h"
+#include "subspace/macros/pure.h"
+#include "subspace/num/__private/intrinsics.h"
+#include "subspace/num/__private/to_chars.h"
+
+// Arithmetic on 128-bit integers stored as two 64-bit words, which backs
+// `u128` and `i128`.
+//
+// Where the compiler has a native 128-bit integer, multiplication and
+// division use it, as they compile to far better code than the portable
+// versions. Everything else is written on the two words directly, which
+// compiles to the same add-with-carry and double-shift instructions.
+namespace sus::num::__private::int128 {
+
+/// A 128-bit integer as two 64-bit words. Signed values are stored in two's
+/// complement.
+struct Words final {
+  uint64_t lo;
+  uint64_t hi;
+
+  friend constexpr bool operator==(const Words&, const Words&) = default;
+};
+
+inline constexpr Words kZero = Words{.lo = 0u, .hi = 0u};
+inline constexpr Words kOne = Words{.lo = 1u, .hi = 0u};
+inline constexpr Words kUnsignedMax = Words{.lo = ~uint64_t{0u},
+                                            .hi = ~uint64_t{0u}};
+inline constexpr Words kSignedMin = Words{.lo = 0u, .hi = uint64_t{1u} << 63u};
+inline constexpr Words kSignedMax = Words{.lo = ~uint64_t{0u},
+                                          .hi = ~uint64_t{0u} >> 1u};
+
+/// The largest number of bytes written by `write_integer()`, which is the
+/// length of `-170141183460469231731687303715884105728`.
+inline constexpr uint32_t kMaxLen = 40u;
+
+#if !_MSC_VER
+[[nodiscard]] sus_pure_const sus_always_inline constexpr __uint128_t to_native(
+    Words w) noexcept {
+  return (__uint128_t{w.hi} << 64u) | __uint128_t{w.lo};
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words from_native(
+    __uint128_t n) noexcept {
+  return Words{.lo = static_cast<uint64_t>(n),
+               .hi = static_cast<uint64_t>(n >> 64u)};
+}
+#endif
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words from_signed(
+    int64_t v) noexcept {
+  return Words{.lo = static_cast<uint64_t>(v),
+               .hi = v < 0 ? ~uint64_t{0u} : uint64_t{0u}};
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr bool is_negative(
+    Words w) noexcept {
+  return (w.hi >> 63u) != 0u;
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr bool
+unsigned_lt(Words l, Words r) noexcept {
+  return l.hi < r.hi || (l.hi == r.hi && l.lo < r.lo);
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr bool signed_lt(
+    Words l, Words r) noexcept {
+  const auto lh = static_cast<int64_t>(l.hi);
+  const auto rh = static_cast<int64_t>(r.hi);
+  return lh < rh || (lh == rh && l.lo < r.lo);
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words bit_not(
+    Words w) noexcept {
+  return Words{.lo = ~w.lo, .hi = ~w.hi};
+}
+
+/// Unsigned addition, where `overflow` is the carry out of the high word.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr OverflowOut<Words>
+add_with_overflow(Words l, Words r) noexcept {
+  const auto lo = __private::add_with_overflow(l.lo, r.lo);
+  const auto hi = carrying_add(l.hi, r.hi, lo.overflow);
+  return OverflowOut<Words>{.overflow = hi.overflow,
+                            .value = Words{.lo = lo.value, .hi = hi.value}};
+}
+
+/// Unsigned subtraction, where `overflow` is the borrow out of the high word.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr OverflowOut<Words>
+sub_with_overflow(Words l, Words r) noexcept {
+  const auto lo = __private::sub_with_overflow(l.lo, r.lo);
+  const auto hi = borrowing_sub(l.hi, r.hi, lo.overflow);
+  return OverflowOut<Words>{.overflow = hi.overflow,
+                            .value = Words{.lo = lo.value, .hi = hi.value}};
+}
+
+/// Two's complement addition, where `overflow` is set if the sum doesn't fit
+/// in a signed 128-bit integer.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr OverflowOut<Words>
+signed_add_with_overflow(Words l, Words r) noexcept {
+  const auto out = add_with_overflow(l, r).value;
+  // Overflow when both inputs have the same sign and the output doesn't.
+  const bool overflow = (((l.hi ^ out.hi) & (r.hi ^ out.hi)) >> 63u) != 0u;
+  return OverflowOut<Words>{.overflow = overflow, .value = out};
+}
+
+/// Two's complement subtraction, where `overflow` is set if the difference
+/// doesn't fit in a signed 128-bit integer.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr OverflowOut<Words>
+signed_sub_with_overflow(Words l, Words r) noexcept {
+  const auto out = sub_with_overflow(l, r).value;
+  // Overflow when the inputs have different signs and the output's sign
+  // differs from `l`.
+  const bool overflow = (((l.hi ^ r.hi) & (l.hi ^ out.hi)) >> 63u) != 0u;
+  return OverflowOut<Words>{.overflow = overflow, .value = out};
+}
+
+/// Two's complement negation, wrapping MIN to itself.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words wrapping_neg(
+    Words w) noexcept {
+  return sub_with_overflow(kZero, w).value;
+}
+
+/// The magnitude of a signed value, which always fits in unsigned 128 bits.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words unsigned_abs(
+    Words w) noexcept {
+  return is_negative(w) ? wrapping_neg(w) : w;
+}
+
+/// Multiplication modulo 2^128 on the two words, for compilers without a
+/// native 128-bit integer. It is used by `wrapping_mul()` there, and tested
+/// against the native multiplication elsewhere.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words
+portable_wrapping_mul(Words l, Words r) noexcept {
+  const auto lo = widening_mul(l.lo, r.lo);
+  return Words{.lo = lo.lo, .hi = lo.hi + l.lo * r.hi + l.hi * r.lo};
+}
+
+/// Multiplication modulo 2^128, which is the same for signed and unsigned
+/// values.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words wrapping_mul(
+    Words l, Words r) noexcept {
+#if _MSC_VER
+  return portable_wrapping_mul(l, r);
+#else
+  return from_native(to_native(l) * to_native(r));
+#endif
+}
+
+/// Unsigned multiplication, where `overflow` is set if the product doesn't fit
+/// in 128 bits.
+[[nodiscard]] sus_pure_const inline constexpr OverflowOut<Words>
+mul_with_overflow(Words l, Words r) noexcept {
+  // The product of the high words is at least 2^128, so one of them must be
+  // zero, and then at most one of the cross products is non-zero.
+  bool overflow = l.hi != 0u && r.hi != 0u;
+  const auto cross = widening_mul(l.hi | r.hi, l.hi != 0u ? r.lo : l.lo);
+  overflow |= cross.hi != 0u;
+  const auto lo_hi = widening_mul(l.lo, r.lo).hi;
+  overflow |= __private::add_with_overflow(lo_hi, cross.lo).overflow;
+  return OverflowOut<Words>{.overflow = overflow, .value = wrapping_mul(l, r)};
+}
+
+/// Two's complement multiplication, where `overflow` is set if the product
+/// doesn't fit in a signed 128-bit integer.
+[[nodiscard]] sus_pure_const inline constexpr OverflowOut<Words>
+signed_mul_with_overflow(Words l, Words r) noexcept {
+  const bool negative = is_negative(l) != is_negative(r);
+  const auto abs = mul_with_overflow(unsigned_abs(l), unsigned_abs(r));
+  // The magnitude of MIN is one more than MAX.
+  const Words limit = negative ? kSignedMin : kSignedMax;
+  const bool overflow = abs.overflow || unsigned_lt(limit, abs.value);
+  return OverflowOut<Words>{
+      .overflow = overflow,
+      .value = negative ? wrapping_neg(abs.value) : abs.value};
+}
+
+struct DivRem final {
+  Words quot;
+  Words rem;
+};
+
+/// Unsigned division and remainder on the two words, for compilers without a
+/// native 128-bit integer. It is used by `unsigned_div_rem()` there, and
+/// tested against the native division elsewhere. The divisor must not be
+/// zero.
+[[nodiscard]] sus_pure_const inline constexpr DivRem portable_unsigned_div_rem(
+    Words l, Words r) noexcept {
+  if (l.hi == 0u && r.hi == 0u) {
+    return DivRem{.quot = Words{.lo = l.lo / r.lo, .hi = 0u},
+                  .rem = Words{.lo = l.lo % r.lo, .hi = 0u}};
+  }
+  if (unsigned_lt(l, r)) return DivRem{.quot = kZero, .rem = l};
+  // Binary long division, starting from the highest set bit of `l` since the
+  // quotient bits above it are all zero.
+  const uint32_t top = l.hi != 0u ? 127u - __private::leading_zeros(l.hi)
+                                  : 63u - __private::leading_zeros(l.lo);
+  auto quot = kZero;
+  auto rem = kZero;
+  for (uint32_t i = top + 1u; i > 0u; --i) {
+    const uint32_t bit = i - 1u;
+    const uint64_t in = bit >= 64u ? (l.hi >> (bit - 64u)) & 1u
+                                   : (l.lo >> bit) & 1u;
+    rem = Words{.lo = (rem.lo << 1u) | in,
+                .hi = (rem.hi << 1u) | (rem.lo >> 63u)};
+    if (!unsigned_lt(rem, r)) {
+      rem = sub_with_overflow(rem, r).value;
+      if (bit >= 64u)
+        quot.hi |= uint64_t{1u} << (bit - 64u);
+      else
+        quot.lo |= uint64_t{1u} << bit;
+    }
+  }
+  return DivRem{.quot = quot, .rem = rem};
+}
+
+/// Unsigned division and remainder. The divisor must not be zero.
+[[nodiscard]] sus_pure_const inline constexpr DivRem unsigned_div_rem(
+    Words l, Words r) noexcept {
+#if _MSC_VER
+  return portable_unsigned_div_rem(l, r);
+#else
+  const auto n = to_native(l);
+  const auto d = to_native(r);
+  return DivRem{.quot = from_native(n / d), .rem = from_native(n % d)};
+#endif
+}
+
+/// Two's complement division and remainder, rounding towards zero. The
+/// divisor must not be zero, and the division must not be `MIN / -1`.
+[[nodiscard]] sus_pure_const inline constexpr DivRem signed_div_rem(
+    Words l, Words r) noexcept {
+  const auto out = unsigned_div_rem(unsigned_abs(l), unsigned_abs(r));
+  // The remainder takes the sign of the dividend.
+  return DivRem{.quot = is_negative(l) != is_negative(r)
+                            ? wrapping_neg(out.quot)
+                            : out.quot,
+                .rem = is_negative(l) ? wrapping_neg(out.rem) : out.rem};
+}
+
+/// Shifts left by `n`, which must be less than 128.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words shl(
+    Words w, uint32_t n) noexcept {
+  if (n == 0u) return w;
+  if (n >= 64u) return Words{.lo = 0u, .hi = w.lo << (n - 64u)};
+  return Words{.lo = w.lo << n, .hi = (w.hi << n) | (w.lo >> (64u - n))};
+}
+
+/// Logical shift right by `n`, which must be less than 128.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words lshr(
+    Words w, uint32_t n) noexcept {
+  if (n == 0u) return w;
+  if (n >= 64u) return Words{.lo = w.hi >> (n - 64u), .hi = 0u};
+  return Words{.lo = (w.lo >> n) | (w.hi << (64u - n)), .hi = w.hi >> n};
+}
+
+/// Arithmetic shift right by `n`, which must be less than 128.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words ashr(
+    Words w, uint32_t n) noexcept {
+  const uint64_t fill = is_negative(w) ? ~uint64_t{0u} : uint64_t{0u};
+  if (n == 0u) return w;
+  if (n >= 64u) {
+    const auto hi = static_cast<int64_t>(w.hi);
+    return Words{.lo = static_cast<uint64_t>(hi >> (n - 64u)), .hi = fill};
+  }
+  return Words{.lo = (w.lo >> n) | (w.hi << (64u - n)),
+               .hi = static_cast<uint64_t>(static_cast<int64_t>(w.hi) >> n)};
+}
+
+/// Rotates left by `n`, which may be any value.
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words rotate_left(
+    Words w, uint32_t n) noexcept {
+  n %= 128u;
+  if (n == 0u) return w;
+  const auto l = shl(w, n);
+  const auto r = lshr(w, 128u - n);
+  return Words{.lo = l.lo | r.lo, .hi = l.hi | r.hi};
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr uint32_t count_ones(
+    Words w) noexcept {
+  return __private::count_ones(w.lo) + __private::count_ones(w.hi);
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr uint32_t
+leading_zeros(Words w) noexcept {
+  return w.hi != 0u ? __private::leading_zeros(w.hi)
+                   : 64u + __private::leading_zeros(w.lo);
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr uint32_t
+trailing_zeros(Words w) noexcept {
+  return w.lo != 0u ? __private::trailing_zeros(w.lo)
+                   : 64u + __private::trailing_zeros(w.hi);
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words swap_bytes(
+    Words w) noexcept {
+  return Words{.lo = __private::swap_bytes(w.hi),
+               .hi = __private::swap_bytes(w.lo)};
+}
+
+[[nodiscard]] sus_pure_const sus_always_inline constexpr Words reverse_bits(
+    Words w) noexcept {
+  return Words{.lo = __private::reverse_bits(w.hi),
+               .hi = __private::reverse_bits(w.lo)};
+}
+
+/// Computes `base^exp`, where `overflow` is set if any step of the
+/// computation overflowed.
+template <bool kSigned>
+[[nodiscard]] sus_pure_const inline constexpr OverflowOut<Words>
+pow_with_overflow(Words base, uint32_t exp) noexcept {
+  auto mul = [](Words l, Words r) {
+    if constexpr (kSigned)
+      return signed_mul_with_overflow(l, r);
+    else
+      return mul_with_overflow(l, r);
+  };
+  auto acc = kOne;
+  bool overflow = false;
+  while (exp > 1u) {
+    if ((exp & 1u) != 0u) {
+      const auto out = mul(acc, base);
+      overflow |= out.overflow;
+      acc = out.value;
+    }
+    exp /= 2u;
+    const auto sq = mul(base, base);
+    overflow |= sq.overflow;
+    base = sq.value;
+  }
+  if (exp == 1u) {
+    const auto out = mul(acc, base);
+    overflow |= out.overflow;
+    acc = out.value;
+  }
+  return OverflowOut<Words>{.overflow = overflow, .value = acc};
+}
+
+/// 10^19, the largest power of 10 that fits in 64 bits.
+inline constexpr uint64_t kTenToThe19 = 10000000000000000000u;
+
+/// Writes the decimal representation of an integer with absolute value `abs`,
+/// and a leading `-` if `negative`, to the front of `out`. Returns the number
+/// of bytes written.
+///
+/// The value is split into 19-digit chunks, so that all but the first
+/// division are done on 64 bits.
+inline uint32_t write_integer(Words abs, bool negative,
+                              uint8_t (&out)[kMaxLen]) noexcept {
+  constexpr auto kChunk = Words{.lo = kTenToThe19, .hi = 0u};
+  uint64_t chunks[3u];
+  uint32_t num_chunks = 0u;
+  while (abs.hi != 0u) {
+    const auto d = unsigned_div_rem(abs, kChunk);
+    chunks[num_chunks++] = d.rem.lo;
+    abs = d.quot;
+  }
+  // The rest fits in 64 bits. It may have 20 digits, which is fine as the
+  // leading chunk is written without padding.
+  chunks[num_chunks++] = abs.lo;
+  uint32_t len = 0u;
+  if (negative) out[len++] = static_cast<uint8_t>('-');
+  // The leading chunk has no leading zeros, the others are zero-padded.
+  const uint64_t lead = chunks[num_chunks - 1u];
+  const uint32_t lead_len = to_chars::decimal_len(lead);
+  to_chars::write_decimal(lead, out + len, lead_len);
+  len += lead_len;
+  for (uint32_t i = num_chunks - 1u; i > 0u; --i) {
+    const uint64_t chunk = chunks[i - 1u];
+    const uint32_t chunk_len = to_chars::decimal_len(chunk);
+    for (uint32_t z = chunk_len; z < 19u; ++z)
+      out[len++] = static_cast<uint8_t>('0');
+    to_chars::write_decimal(chunk, out + len, chunk_len);
+    len += chunk_len;
+  }
+  return len;
+}
+
+}  // namespace sus::num::__private::int128
@@ -778,6 +778,69 @@ template <class T>
 #endif
 }
 
+template <class T>
+struct WideningOut final {
+  T lo;
+  T hi;
+};
+
+template <class T>
+  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 4)
+[[nodiscard]] sus_pure_const inline constexpr WideningOut<T> widening_mul(
+    T x, T y) noexcept {
+  const auto out = unchecked_mul(into_widened(x), into_widened(y));
+  return WideningOut sus_clang_bug_56394(<T>){
+      .lo = static_cast<T>(out),
+      .hi = static_cast<T>(out >> (::sus::mem::size_of<T>() * 8u))};
+}
+
+template <class T>
+  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 8)
+[[nodiscard]] sus_pure_const inline constexpr WideningOut<T> widening_mul(
+    T x, T y) noexcept {
+#if _MSC_VER
+  // Multiplies 32-bit halves, which can't overflow 64 bits.
+  const uint64_t x_lo = x & 0xffffffffu, x_hi = x >> 32u;
+  const uint64_t y_lo = y & 0xffffffffu, y_hi = y >> 32u;
+  const uint64_t p0 = x_lo * y_lo;
+  const uint64_t p1 = x_lo * y_hi;
+  const uint64_t p2 = x_hi * y_lo;
+  const uint64_t p3 = x_hi * y_hi;
+  const uint64_t mid = (p0 >> 32u) + (p1 & 0xffffffffu) + (p2 & 0xffffffffu);
+  return WideningOut sus_clang_bug_56394(<T>){
+      .lo = static_cast<T>((p0 & 0xffffffffu) | (mid << 32u)),
+      .hi = static_cast<T>(p3 + (p1 >> 32u) + (p2 >> 32u) + (mid >> 32u))};
+#else
+  const auto out = __uint128_t{x} * __uint128_t{y};
+  return WideningOut sus_clang_bug_56394(<T>){
+      .lo = static_cast<T>(out), .hi = static_cast<T>(out >> 64u)};
+#endif
+}
+
+template <class T>
+  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 8)
+[[nodiscard]] sus_pure_const inline constexpr OverflowOut<T> carrying_add(
+    T x, T y, bool carry) noexcept {
+  const auto a = add_with_overflow(x, y);
+  const auto b = add_with_overflow(a.value, static_cast<T>(carry));
+  return OverflowOut sus_clang_bug_56394(<T>){
+      .overflow = a.overflow || b.overflow, .value = b.value};
+}
+
+template <class T>
+  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 8)
+[[nodiscard]] sus_pure_const inline constexpr OverflowOut<T> borrowing_sub(
+    T x, T y, bool borrow) noexcept {
+  const auto a = sub_with_overflow(x, y);
+  const auto b = sub_with_overflow(a.value, static_cast<T>(borrow));
+  return OverflowOut sus_clang_bug_56394(<T>){
+      .overflow = a.overflow || b.overflow, .value = b.value};
+}
+
 template <class T>
   requires(std::is_integral_v<T> && ::sus::mem::size_of<T>() <= 8)
 [[nodiscard]] sus_pure_const inline constexpr OverflowOut<T> pow_with_overflow(
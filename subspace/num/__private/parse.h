@@ -0,0 +1,379 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <charconv>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+#include "subspace/assertions/endian.h"
+#include "subspace/macros/always_inline.h"
+#include "subspace/num/__private/intrinsics.h"
+
+// Parsing of primitive integers and floats from ASCII bytes.
+//
+// Runs of decimal digits are parsed eight at a time by treating them as a
+// single 64-bit word (SWAR), which takes three multiplies instead of eight
+// dependent multiply-adds. The technique is from
+// https://github.com/fastfloat/fast_float.
+namespace sus::num::__private::parse {
+
+enum class IntStatus {
+  Ok,
+  Empty,
+  InvalidDigit,
+  Overflow,
+};
+
+/// Returns the value of the digit `c` in any radix up to 36, or a value of at
+/// least 36 if `c` is not a digit in any radix.
+constexpr sus_always_inline uint32_t digit_value(uint8_t c) noexcept {
+  if (c >= '0' && c <= '9') return uint32_t{c} - '0';
+  // Folds upper case to lower case. Other characters stay out of range.
+  const uint32_t lower = uint32_t{c} | 0x20u;
+  if (lower >= 'a' && lower <= 'z') return lower - 'a' + 10u;
+  return 255u;
+}
+
+/// Reads 8 bytes as a little endian word, so the first byte is the lowest.
+sus_always_inline uint64_t load_eight(const uint8_t* p) noexcept {
+  uint64_t w;
+  memcpy(&w, p, 8u);
+  if (!::sus::assertions::is_little_endian()) w = swap_bytes(w);
+  return w;
+}
+
+/// Returns whether each byte in `w` is an ASCII decimal digit.
+constexpr sus_always_inline bool is_eight_digits(uint64_t w) noexcept {
+  // The high nibble of each byte must be 3, and adding 6 to the low nibble
+  // must not carry into the high nibble.
+  return ((w & 0xF0F0F0F0F0F0F0F0u) |
+          (((w + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4u)) ==
+         0x3333333333333333u;
+}
+
+/// Returns the value of the 8 decimal digits in `w`, where the first digit is
+/// in the lowest byte. Each byte must be a digit.
+constexpr sus_always_inline uint32_t parse_eight_digits(uint64_t w) noexcept {
+  constexpr uint64_t kMask = 0x000000FF000000FFu;
+  constexpr uint64_t kMul1 = 100u + (uint64_t{1000000u} << 32u);
+  constexpr uint64_t kMul2 = 1u + (uint64_t{10000u} << 32u);
+  w -= 0x3030303030303030u;
+  // Each pair of adjacent digits is combined into a 2-digit value, then each
+  // pair of those into 4-digit values, then those into the final 8 digits.
+  w = (w * 10u) + (w >> 8u);
+  w = (((w & kMask) * kMul1) + (((w >> 16u) & kMask) * kMul2)) >> 32u;
+  return static_cast<uint32_t>(w);
+}
+
+/// Parses the digits in `p[0..n]` in `radix` into `out`, failing if the value
+/// is larger than `limit`.
+///
+/// The first `safe_decimal_digits` decimal digits can not exceed `limit`, so
+/// they are accumulated without overflow checks.
+template <class U>
+  requires(std::is_unsigned_v<U>)
+constexpr IntStatus parse_digits(const uint8_t* p, size_t n, uint32_t radix,
+                                 U limit, size_t safe_decimal_digits,
+                                 U& out) noexcept {
+  if (n == 0u) return IntStatus::InvalidDigit;
+  // Smaller types are accumulated in 32 bits so that the arithmetic below is
+  // not done on promoted signed ints.
+  using W = std::conditional_t<(sizeof(U) < sizeof(uint32_t)), uint32_t, U>;
+  auto acc = W{0u};
+  size_t i = 0u;
+  if (radix == 10u) {
+    const size_t safe = n < safe_decimal_digits ? n : safe_decimal_digits;
+    if (!std::is_constant_evaluated()) {
+      if constexpr (sizeof(W) >= sizeof(uint32_t)) {
+        while (i + 8u <= safe) {
+          const uint64_t w = load_eight(p + i);
+          if (!is_eight_digits(w)) break;
+          acc = acc * W{100000000u} + W{parse_eight_digits(w)};
+          i += 8u;
+        }
+      }
+    }
+    for (; i < safe; ++i) {
+      const uint32_t d = uint32_t{p[i]} - uint32_t{'0'};
+      if (d > 9u) return IntStatus::InvalidDigit;
+      acc = acc * W{10u} + W{d};
+    }
+  }
+  for (; i < n; ++i) {
+    const uint32_t d = digit_value(p[i]);
+    if (d >= radix) return IntStatus::InvalidDigit;
+    const auto mul = mul_with_overflow(acc, W{radix});
+    if (mul.overflow) return IntStatus::Overflow;
+    const auto add = add_with_overflow(mul.value, W{d});
+    if (add.overflow || add.value > W{limit}) return IntStatus::Overflow;
+    acc = add.value;
+  }
+  out = static_cast<U>(acc);
+  return IntStatus::Ok;
+}
+
+/// Parses an unsigned integer in `radix`, with an optional leading `+`.
+template <class U>
+  requires(std::is_unsigned_v<U>)
+constexpr IntStatus parse_unsigned(const uint8_t* p, size_t n, uint32_t radix,
+                                   size_t safe_decimal_digits,
+                                   U& out) noexcept {
+  if (n == 0u) return IntStatus::Empty;
+  if (p[0u] == '+') {
+    p += 1u;
+    n -= 1u;
+  }
+  return parse_digits(p, n, radix, std::numeric_limits<U>::max(),
+                      safe_decimal_digits, out);
+}
+
+/// Parses a signed integer in `radix`, with an optional leading `+` or `-`.
+/// On success, the magnitude is written to `out` and `negative` says if the
+/// value is negative. On overflow, `negative` says in which direction.
+template <class S>
+  requires(std::is_signed_v<S> && std::is_integral_v<S>)
+constexpr IntStatus parse_signed(const uint8_t* p, size_t n, uint32_t radix,
+                                 size_t safe_decimal_digits,
+                                 std::make_unsigned_t<S>& out,
+                                 bool& negative) noexcept {
+  using U = std::make_unsigned_t<S>;
+  negative = false;
+  if (n == 0u) return IntStatus::Empty;
+  if (p[0u] == '+' || p[0u] == '-') {
+    negative = p[0u] == '-';
+    p += 1u;
+    n -= 1u;
+  }
+  // The magnitude of MIN is one more than MAX.
+  constexpr auto kMax = static_cast<U>(std::numeric_limits<S>::max());
+  const auto limit = static_cast<U>(kMax + (negative ? 1u : 0u));
+  return parse_digits(p, n, radix, limit, safe_decimal_digits, out);
+}
+
+/// Properties of a primitive float type for the exact conversion fast path.
+template <class F>
+struct FloatTraits;
+
+template <>
+struct FloatTraits<float> {
+  /// Integers up to this value are exactly representable.
+  static constexpr uint64_t kMaxExactMantissa = uint64_t{1u} << 24u;
+  /// Powers of 10 up to this exponent are exactly representable.
+  static constexpr int64_t kMaxExactPow10 = 10;
+  static constexpr float kPow10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                     1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+template <>
+struct FloatTraits<double> {
+  /// Integers up to this value are exactly representable.
+  static constexpr uint64_t kMaxExactMantissa = uint64_t{1u} << 53u;
+  /// Powers of 10 up to this exponent are exactly representable.
+  static constexpr int64_t kMaxExactPow10 = 22;
+  static constexpr double kPow10[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+inline constexpr uint64_t kIntPow10[] = {1u,
+                                         10u,
+                                         100u,
+                                         1000u,
+                                         10000u,
+                                         100000u,
+                                         1000000u,
+                                         10000000u,
+                                         100000000u,
+                                         1000000000u,
+                                         10000000000u,
+                                         100000000000u,
+                                         1000000000000u,
+                                         10000000000000u,
+                                         100000000000000u,
+                                         1000000000000000u};
+
+enum class FloatStatus {
+  Ok,
+  Empty,
+  Invalid,
+};
+
+/// Returns whether `p[0..n]` is `word`, ignoring ASCII case. The `word` must
+/// be lower case.
+template <size_t N>
+constexpr bool equals_ignore_case(const uint8_t* p, size_t n,
+                                  const char (&word)[N]) noexcept {
+  if (n != N - 1u) return false;
+  for (size_t i = 0u; i < n; ++i) {
+    if ((p[i] | 0x20u) != static_cast<uint8_t>(word[i])) return false;
+  }
+  return true;
+}
+
+/// Parses a decimal float, with an optional sign and exponent, or one of
+/// `inf`, `infinity` or `nan` ignoring case.
+///
+/// Numbers with at most 19 significant digits whose mantissa and power of 10
+/// are both exactly representable in `F` are converted with a single multiply
+/// or divide, which is correctly rounded (Clinger's fast path). These cover
+/// most numbers seen in practice, such as prices and measurements. Others are
+/// converted by `std::from_chars()`.
+template <class F>
+  requires(std::is_floating_point_v<F>)
+FloatStatus parse_float(const uint8_t* p, size_t n, F& out) noexcept {
+  using Traits = FloatTraits<F>;
+  if (n == 0u) return FloatStatus::Empty;
+  const uint8_t* const end = p + n;
+  bool negative = false;
+  if (*p == '+' || *p == '-') {
+    negative = *p == '-';
+    p += 1u;
+  }
+  const uint8_t* const unsigned_start = p;
+  const auto sign = [negative](F f) { return negative ? -f : f; };
+
+  if (p != end && digit_value(*p) >= 10u && *p != '.') {
+    const auto rest = static_cast<size_t>(end - p);
+    if (equals_ignore_case(p, rest, "inf") ||
+        equals_ignore_case(p, rest, "infinity")) {
+      out = sign(std::numeric_limits<F>::infinity());
+      return FloatStatus::Ok;
+    }
+    if (equals_ignore_case(p, rest, "nan")) {
+      out = std::numeric_limits<F>::quiet_NaN();
+      return FloatStatus::Ok;
+    }
+    return FloatStatus::Invalid;
+  }
+
+  // The first 19 significant digits are accumulated into `mantissa`, which
+  // can not overflow. `exponent` is the power of 10 to scale it by.
+  uint64_t mantissa = 0u;
+  int64_t exponent = 0;
+  size_t significant = 0u;
+  size_t leading_zeros = 0u;
+  bool any_digits = false;
+  const auto take_digits = [&](bool fraction) {
+    // Leading zeros are not significant, but zeros after the point still
+    // move it.
+    if (significant == 0u) {
+      while (p != end && *p == '0') {
+        any_digits = true;
+        if (fraction) leading_zeros += 1u;
+        p += 1u;
+      }
+    }
+    while (end - p >= 8 && significant + 8u <= 19u) {
+      const uint64_t w = load_eight(p);
+      if (!is_eight_digits(w)) break;
+      mantissa = mantissa * 100000000u + parse_eight_digits(w);
+      significant += 8u;
+      any_digits = true;
+      if (fraction) exponent -= 8;
+      p += 8u;
+    }
+    while (p != end && uint32_t{*p} - uint32_t{'0'} <= 9u) {
+      any_digits = true;
+      if (significant < 19u) {
+        mantissa = mantissa * 10u + (uint32_t{*p} - uint32_t{'0'});
+        if (fraction) exponent -= 1;
+      } else if (!fraction) {
+        // Dropped digits before the point scale the value.
+        exponent += 1;
+      }
+      significant += 1u;
+      p += 1u;
+    }
+  };
+  take_digits(false);
+  // The value is in [10^(magnitude-1), 10^magnitude). This is only needed to
+  // pick between overflow and underflow.
+  auto magnitude = static_cast<int64_t>(significant);
+  if (p != end && *p == '.') {
+    p += 1u;
+    take_digits(true);
+    exponent -= static_cast<int64_t>(leading_zeros);
+    if (magnitude == 0) magnitude = -static_cast<int64_t>(leading_zeros);
+  }
+  if (!any_digits) return FloatStatus::Invalid;
+
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    p += 1u;
+    bool exp_negative = false;
+    if (p != end && (*p == '+' || *p == '-')) {
+      exp_negative = *p == '-';
+      p += 1u;
+    }
+    if (p == end) return FloatStatus::Invalid;
+    int64_t explicit_exp = 0;
+    while (p != end && uint32_t{*p} - uint32_t{'0'} <= 9u) {
+      // Saturates far outside the range of any float.
+      if (explicit_exp < 0x10000)
+        explicit_exp = explicit_exp * 10 + (uint32_t{*p} - uint32_t{'0'});
+      p += 1u;
+    }
+    if (exp_negative) explicit_exp = -explicit_exp;
+    exponent += explicit_exp;
+    magnitude += explicit_exp;
+  }
+  if (p != end) return FloatStatus::Invalid;
+
+  if (mantissa == 0u) {
+    out = sign(F{0});
+    return FloatStatus::Ok;
+  }
+  if (significant <= 19u && mantissa <= Traits::kMaxExactMantissa) {
+    if (exponent >= -Traits::kMaxExactPow10 &&
+        exponent <= Traits::kMaxExactPow10) {
+      const auto m = static_cast<F>(mantissa);
+      if (exponent >= 0)
+        out = sign(m * Traits::kPow10[exponent]);
+      else
+        out = sign(m / Traits::kPow10[-exponent]);
+      return FloatStatus::Ok;
+    }
+    // A larger exponent may still work if some of it can be moved into the
+    // mantissa, as in `123e25`.
+    const int64_t shift = exponent - Traits::kMaxExactPow10;
+    if (shift > 0 && shift < 16 &&
+        mantissa <= Traits::kMaxExactMantissa / kIntPow10[shift]) {
+      const auto m = static_cast<F>(mantissa * kIntPow10[shift]);
+      out = sign(m * Traits::kPow10[Traits::kMaxExactPow10]);
+      return FloatStatus::Ok;
+    }
+  }
+
+  // The syntax has been checked above, and the sign is applied separately
+  // since `std::from_chars()` does not accept a leading `+`.
+  F value;
+  const auto [ptr, ec] =
+      std::from_chars(reinterpret_cast<const char*>(unsigned_start),
+                      reinterpret_cast<const char*>(end), value);
+  if (ptr != reinterpret_cast<const char*>(end)) return FloatStatus::Invalid;
+  if (ec == std::errc::result_out_of_range) {
+    // Numbers of magnitude 1 or more overflow, smaller ones underflow.
+    value = magnitude > 0 ? std::numeric_limits<F>::infinity() : F{0};
+  }
+  out = sign(value);
+  return FloatStatus::Ok;
+}
+
+}  // namespace sus::num::__private::parse
@@ -18,6 +18,14 @@ namespace sus::containers {
 template <class T, size_t N>
   requires(N <= size_t{PTRDIFF_MAX})
 class Array;
+template <class T>
+class Slice;
+template <class T>
+class SliceMut;
+}
+
+namespace sus::string {
+class String;
 }
 
 namespace sus::tuple_type {
@@ -25,35 +33,39 @@ template <class T, class... Ts>
 class Tuple;
 }
 
-#define _sus__signed_impl(T, PrimitiveT, UnsignedT) \
-  _sus__signed_storage(PrimitiveT);                 \
-  _sus__signed_constants_defn(T, PrimitiveT);       \
-  _sus__signed_construct(T, PrimitiveT);            \
-  _sus__signed_from(T, PrimitiveT);                 \
-  _sus__signed_to_primitive(T, PrimitiveT);         \
-  _sus__signed_integer_comparison(T, PrimitiveT);   \
-  _sus__signed_unary_ops(T);                        \
-  _sus__signed_binary_logic_ops(T, PrimitiveT);     \
-  _sus__signed_binary_bit_ops(T, PrimitiveT);       \
-  _sus__signed_mutable_logic_ops(T);                \
-  _sus__signed_mutable_bit_ops(T);                  \
-  _sus__signed_abs(T, PrimitiveT, UnsignedT);       \
-  _sus__signed_add(T, UnsignedT);                   \
-  _sus__signed_div(T);                              \
-  _sus__signed_mul(T);                              \
-  _sus__signed_neg(T);                              \
-  _sus__signed_rem(T, PrimitiveT);                  \
-  _sus__signed_euclid(T, PrimitiveT);               \
-  _sus__signed_shift(T);                            \
-  _sus__signed_sub(T, PrimitiveT, UnsignedT);       \
-  _sus__signed_bits(T);                             \
-  _sus__signed_pow(T);                              \
-  _sus__signed_log(T);                              \
-  _sus__signed_endian(T, UnsignedT, ::sus::mem::size_of<PrimitiveT>())
+#define _sus__signed_impl(T, PrimitiveT, UnsignedT)                     \
+  _sus__signed_storage(PrimitiveT);                                     \
+  _sus__signed_constants_defn(T, PrimitiveT);                           \
+  _sus__signed_construct(T, PrimitiveT);                                \
+  _sus__signed_from(T, PrimitiveT);                                     \
+  _sus__signed_to_primitive(T, PrimitiveT);                             \
+  _sus__signed_integer_comparison(T, PrimitiveT);                       \
+  _sus__signed_unary_ops(T);                                            \
+  _sus__signed_binary_logic_ops(T, PrimitiveT);                         \
+  _sus__signed_binary_bit_ops(T, PrimitiveT);                           \
+  _sus__signed_mutable_logic_ops(T);                                    \
+  _sus__signed_mutable_bit_ops(T);                                      \
+  _sus__signed_abs(T, PrimitiveT, UnsignedT);                           \
+  _sus__signed_add(T, UnsignedT);                                       \
+  _sus__signed_div(T);                                                  \
+  _sus__signed_mul(T);                                                  \
+  _sus__signed_neg(T);                                                  \
+  _sus__signed_rem(T, PrimitiveT);                                      \
+  _sus__signed_euclid(T, PrimitiveT);                                   \
+  _sus__signed_shift(T);                                                \
+  _sus__signed_sub(T, PrimitiveT, UnsignedT);                           \
+  _sus__signed_bits(T);                                                 \
+  _sus__signed_pow(T);                                                  \
+  _sus__signed_log(T);                                                  \
+  _sus__signed_endian(T, UnsignedT, ::sus::mem::size_of<PrimitiveT>()); \
+  _sus__signed_to_string(T);                                            \
+  _sus__signed_from_str(T)
 
-#define _sus__signed_out_of_line_impl(T, PrimitiveT, UnsignedT) \
-  _sus__signed_endian_out_of_line(T, UnsignedT,                 \
-                                  ::sus::mem::size_of<PrimitiveT>())
+#define _sus__signed_out_of_line_impl(T, PrimitiveT, UnsignedT)       \
+  _sus__signed_endian_out_of_line(T, UnsignedT,                       \
+                                  ::sus::mem::size_of<PrimitiveT>()); \
+  _sus__signed_out_of_line_to_string(T);                              \
+  _sus__signed_out_of_line_from_str(T, PrimitiveT)
 
 #define _sus__signed_storage(PrimitiveT)                                      \
   /** The inner primitive value, in case it needs to be unwrapped from the    \
@@ -2267,6 +2279,102 @@ class Tuple;
   }                                                                           \
   static_assert(true)
 
+#define _sus__signed_to_string(T)                                            \
+  /** Writes the decimal representation of the integer to the front of `buf` \
+   * and returns the number of bytes written.                                \
+   *                                                                         \
+   * Negative values begin with a `-`. No integer takes more than 20 bytes,  \
+   * so a buffer of that size can hold any of them.                          \
+   *                                                                         \
+   * # Panics                                                                \
+   * Panics if `buf` is shorter than the decimal representation.             \
+   */                                                                        \
+  usize write_to(::sus::containers::SliceMut<u8> buf) const& noexcept;       \
+  /** Returns the decimal representation of the integer.                     \
+   *                                                                         \
+   * The result always fits in the inline storage of `String`, so this does  \
+   * not allocate.                                                           \
+   */                                                                        \
+  ::sus::string::String to_string() const& noexcept;                         \
+  static_assert(true)
+
+#define _sus__signed_out_of_line_to_string(T)                             \
+  inline usize T::write_to(::sus::containers::SliceMut<u8> buf)           \
+      const& noexcept {                                                   \
+    namespace to_chars = ::sus::num::__private::to_chars;                 \
+    const auto abs = unsigned_abs().primitive_value;                      \
+    const bool negative = primitive_value < 0;                            \
+    const uint32_t len = to_chars::integer_len(abs, negative);            \
+    ::sus::check(size_t{buf.len()} >= len);                               \
+    to_chars::write_integer(abs, negative,                                \
+                            reinterpret_cast<uint8_t*>(buf.as_mut_ptr()), \
+                            len);                                         \
+    return usize::from(len);                                              \
+  }                                                                       \
+                                                                          \
+  inline ::sus::string::String T::to_string() const& noexcept {           \
+    namespace to_chars = ::sus::num::__private::to_chars;                 \
+    uint8_t bytes[to_chars::kMaxIntegerLen];                              \
+    const auto abs = unsigned_abs().primitive_value;                      \
+    const bool negative = primitive_value < 0;                            \
+    const uint32_t len = to_chars::integer_len(abs, negative);            \
+    to_chars::write_integer(abs, negative, bytes, len);                   \
+    const auto str = ::sus::string::Str::from_utf8_unchecked(             \
+        ::sus::marker::unsafe_fn,                                         \
+        ::sus::containers::Slice<u8>::from_raw_parts(                     \
+            ::sus::marker::unsafe_fn, reinterpret_cast<const u8*>(bytes), \
+            usize::from(len)));                                           \
+    return ::sus::string::String::from(str);                              \
+  }                                                                       \
+  static_assert(true)
+
+#define _sus__signed_from_str(T)                                               \
+  /** Parses an integer from the digits in `src`, in the given `radix`.        \
+   *                                                                           \
+   * The digits may be preceded by a `+` or `-`. Digits past 9 are the letters \
+   * `a` to `z`, in either case. Nothing else is accepted, including           \
+   * whitespace.                                                               \
+   * Decimal digits are parsed 8 at a time where possible.                     \
+   *                                                                           \
+   * # Panics                                                                  \
+   * Panics if `radix` is not in the range from 2 to 36.                       \
+   */                                                                          \
+  static ::sus::result::Result<T, ::sus::num::ParseIntError> from_str_radix(   \
+      ::sus::containers::Slice<u8> src, u32 radix) noexcept;                   \
+  static_assert(true)
+
+#define _sus__signed_out_of_line_from_str(T, PrimitiveT)                     \
+  inline ::sus::result::Result<T, ::sus::num::ParseIntError>                 \
+  T::from_str_radix(::sus::containers::Slice<u8> src, u32 radix) noexcept {  \
+    ::sus::check(radix >= 2u && radix <= 36u);                               \
+    namespace parse = ::sus::num::__private::parse;                          \
+    using R = ::sus::result::Result<T, ::sus::num::ParseIntError>;           \
+    using Kind = ::sus::num::ParseIntError::Kind;                            \
+    constexpr auto kSafeDigits =                                             \
+        size_t{__private::int_log10::T(MAX_PRIMITIVE)};                      \
+    auto magnitude = std::make_unsigned_t<PrimitiveT>{0u};                   \
+    bool negative;                                                           \
+    switch (parse::parse_signed<PrimitiveT>(                                 \
+        reinterpret_cast<const uint8_t*>(src.as_ptr()), size_t{src.len()},   \
+        radix.primitive_value, kSafeDigits, magnitude, negative)) {          \
+      case parse::IntStatus::Ok:                                             \
+        /* Negating in unsigned wraps to the two's complement. */            \
+        if (negative)                                                        \
+          magnitude =                                                        \
+              static_cast<std::make_unsigned_t<PrimitiveT>>(0u - magnitude); \
+        return R::with(T(static_cast<PrimitiveT>(magnitude)));               \
+      case parse::IntStatus::Empty:                                          \
+        return R::with_err(::sus::num::ParseIntError(Kind::Empty));          \
+      case parse::IntStatus::InvalidDigit:                                   \
+        return R::with_err(::sus::num::ParseIntError(Kind::InvalidDigit));   \
+      case parse::IntStatus::Overflow:                                       \
+        return R::with_err(::sus::num::ParseIntError(                        \
+            negative ? Kind::NegOverflow : Kind::PosOverflow));              \
+    }                                                                        \
+    ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);      \
+  }                                                                          \
+  static_assert(true)
+
 #define _sus__signed_hash_equal_to(Type)                                    \
   template <>                                                               \
   struct hash<Type> {                                                       \
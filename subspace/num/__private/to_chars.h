@@ -0,0 +1,131 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <charconv>
+#include <system_error>
+#include <type_traits>
+
+#include "subspace/macros/always_inline.h"
+#include "subspace/num/__private/int_log10.h"
+
+// Decimal formatting of primitive integers, writing two digits at a time from
+// a lookup table, which halves the number of divisions compared to the naive
+// digit-at-a-time loop. Floats are formatted by `std::to_chars()`, which gives
+// the shortest representation that round-trips.
+namespace sus::num::__private::to_chars {
+
+/// The decimal representation of each value in 0..100, as pairs of
+/// characters.
+inline constexpr char kDigitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// The largest number of bytes written by formatting any integer, which is
+/// the length of `i64::MIN` or `u64::MAX`.
+inline constexpr uint32_t kMaxIntegerLen = 20u;
+
+/// The largest number of bytes written by formatting any float, which is the
+/// length of `-2.2250738585072014e-308`.
+inline constexpr uint32_t kMaxFloatLen = 24u;
+
+/// Returns the number of decimal digits in `val`.
+template <class U>
+  requires(std::is_unsigned_v<U>)
+constexpr sus_always_inline uint32_t decimal_len(U val) noexcept {
+  if (val == 0u) return 1u;
+  if constexpr (sizeof(U) <= sizeof(uint32_t))
+    return int_log10::u32(static_cast<uint32_t>(val)) + 1u;
+  else
+    return int_log10::u64(static_cast<uint64_t>(val)) + 1u;
+}
+
+/// Writes the `len` decimal digits of `val` into `out[0..len]`, where `len`
+/// is `decimal_len(val)`.
+template <class U>
+  requires(std::is_unsigned_v<U>)
+constexpr sus_always_inline void write_decimal(U val, uint8_t* out,
+                                               uint32_t len) noexcept {
+  // Smaller types are promoted to 32 bits, where the division by 100 is as
+  // cheap as it gets.
+  using W = std::conditional_t<(sizeof(U) <= sizeof(uint32_t)), uint32_t,
+                               uint64_t>;
+  auto w = W{val};
+  uint8_t* cur = out + len;
+  while (w >= 100u) {
+    const auto pair = static_cast<uint32_t>(w % 100u) * 2u;
+    w /= 100u;
+    cur -= 2;
+    cur[0] = static_cast<uint8_t>(kDigitPairs[pair]);
+    cur[1] = static_cast<uint8_t>(kDigitPairs[pair + 1u]);
+  }
+  if (w >= 10u) {
+    const auto pair = static_cast<uint32_t>(w) * 2u;
+    cur -= 2;
+    cur[0] = static_cast<uint8_t>(kDigitPairs[pair]);
+    cur[1] = static_cast<uint8_t>(kDigitPairs[pair + 1u]);
+  } else {
+    cur -= 1;
+    cur[0] = static_cast<uint8_t>('0' + static_cast<uint32_t>(w));
+  }
+}
+
+/// Returns the number of bytes in the decimal representation of an integer
+/// with absolute value `abs`, and a leading `-` if `negative`.
+template <class U>
+  requires(std::is_unsigned_v<U>)
+constexpr sus_always_inline uint32_t integer_len(U abs,
+                                                 bool negative) noexcept {
+  return decimal_len(abs) + (negative ? 1u : 0u);
+}
+
+/// Writes the decimal representation of an integer with absolute value `abs`
+/// into `out[0..len]`, where `len` is `integer_len(abs, negative)`.
+template <class U>
+  requires(std::is_unsigned_v<U>)
+constexpr sus_always_inline void write_integer(U abs, bool negative,
+                                               uint8_t* out,
+                                               uint32_t len) noexcept {
+  if (negative) {
+    *out = static_cast<uint8_t>('-');
+    write_decimal(abs, out + 1u, len - 1u);
+  } else {
+    write_decimal(abs, out, len);
+  }
+}
+
+/// Writes the shortest decimal representation of `val` which parses back to
+/// the same value into `out[0..cap]`, returning the number of bytes written,
+/// or `cap + 1` if they did not fit.
+template <class F>
+  requires(std::is_floating_point_v<F>)
+inline uint32_t write_float(F val, uint8_t* out, uint32_t cap) noexcept {
+  char* const begin = reinterpret_cast<char*>(out);
+  const auto [end, ec] = std::to_chars(begin, begin + cap, val);
+  if (ec != std::errc()) return cap + 1u;
+  return static_cast<uint32_t>(end - begin);
+}
+
+}  // namespace sus::num::__private::to_chars
@@ -18,6 +18,14 @@ namespace sus::containers {
 template <class T, size_t N>
   requires(N <= size_t{PTRDIFF_MAX})
 class Array;
+template <class T>
+class Slice;
+template <class T>
+class SliceMut;
+}
+
+namespace sus::string {
+class String;
 }
 
 namespace sus::num {
@@ -29,36 +37,40 @@ template <class T, class... Ts>
 class Tuple;
 }
 
-#define _sus__unsigned_impl(T, PrimitiveT, SignedT) \
-  _sus__unsigned_storage(PrimitiveT);               \
-  _sus__unsigned_constants_defn(T, PrimitiveT);     \
-  _sus__unsigned_construct(T, PrimitiveT);          \
-  _sus__unsigned_from(T, PrimitiveT);               \
-  _sus__unsigned_to_primitive(T, PrimitiveT);       \
-  _sus__unsigned_integer_comparison(T);             \
-  _sus__unsigned_unary_ops(T);                      \
-  _sus__unsigned_binary_logic_ops(T);               \
-  _sus__unsigned_binary_bit_ops(T);                 \
-  _sus__unsigned_mutable_logic_ops(T);              \
-  _sus__unsigned_mutable_bit_ops(T);                \
-  _sus__unsigned_abs(T);                            \
-  _sus__unsigned_add(T, SignedT);                   \
-  _sus__unsigned_div(T);                            \
-  _sus__unsigned_mul(T);                            \
-  _sus__unsigned_neg(T, PrimitiveT);                \
-  _sus__unsigned_rem(T);                            \
-  _sus__unsigned_euclid(T);                         \
-  _sus__unsigned_shift(T);                          \
-  _sus__unsigned_sub(T);                            \
-  _sus__unsigned_bits(T);                           \
-  _sus__unsigned_pow(T);                            \
-  _sus__unsigned_log(T);                            \
-  _sus__unsigned_power_of_two(T, PrimitiveT);       \
-  _sus__unsigned_endian(T, PrimitiveT, ::sus::mem::size_of<PrimitiveT>())
+#define _sus__unsigned_impl(T, PrimitiveT, SignedT)                        \
+  _sus__unsigned_storage(PrimitiveT);                                      \
+  _sus__unsigned_constants_defn(T, PrimitiveT);                            \
+  _sus__unsigned_construct(T, PrimitiveT);                                 \
+  _sus__unsigned_from(T, PrimitiveT);                                      \
+  _sus__unsigned_to_primitive(T, PrimitiveT);                              \
+  _sus__unsigned_integer_comparison(T);                                    \
+  _sus__unsigned_unary_ops(T);                                             \
+  _sus__unsigned_binary_logic_ops(T);                                      \
+  _sus__unsigned_binary_bit_ops(T);                                        \
+  _sus__unsigned_mutable_logic_ops(T);                                     \
+  _sus__unsigned_mutable_bit_ops(T);                                       \
+  _sus__unsigned_abs(T);                                                   \
+  _sus__unsigned_add(T, SignedT);                                          \
+  _sus__unsigned_div(T);                                                   \
+  _sus__unsigned_mul(T);                                                   \
+  _sus__unsigned_neg(T, PrimitiveT);                                       \
+  _sus__unsigned_rem(T);                                                   \
+  _sus__unsigned_euclid(T);                                                \
+  _sus__unsigned_shift(T);                                                 \
+  _sus__unsigned_sub(T);                                                   \
+  _sus__unsigned_bits(T);                                                  \
+  _sus__unsigned_pow(T);                                                   \
+  _sus__unsigned_log(T);                                                   \
+  _sus__unsigned_power_of_two(T, PrimitiveT);                              \
+  _sus__unsigned_endian(T, PrimitiveT, ::sus::mem::size_of<PrimitiveT>()); \
+  _sus__unsigned_to_string(T);                                             \
+  _sus__unsigned_from_str(T)
 
-#define _sus__unsigned_out_of_line_impl(T, PrimitiveT, SignedT) \
-  _sus__unsigned_out_of_line_endian(T, PrimitiveT,              \
-                                    ::sus::mem::size_of<PrimitiveT>())
+#define _sus__unsigned_out_of_line_impl(T, PrimitiveT, SignedT)         \
+  _sus__unsigned_out_of_line_endian(T, PrimitiveT,                      \
+                                    ::sus::mem::size_of<PrimitiveT>()); \
+  _sus__unsigned_out_of_line_to_string(T);                              \
+  _sus__unsigned_out_of_line_from_str(T, PrimitiveT)
 
 #define _sus__unsigned_storage(PrimitiveT)                                    \
   /** The inner primitive value, in case it needs to be unwrapped from the    \
@@ -1172,6 +1184,21 @@ class Tuple;
     return __private::add_with_overflow_signed(primitive_value,                \
                                                rhs.primitive_value)            \
         .value;                                                                \
+  }                                                                            \
+                                                                               \
+  /** Calculates `self + rhs + carry`, returning the sum and the carry out.    \
+   *                                                                           \
+   * This can be chained to add integers that are wider than ##T##, one word   \
+   * at a time from the least significant word, passing the carry out of       \
+   * each addition into the next.                                              \
+   */                                                                          \
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<T, bool>>          \
+  [[nodiscard]] sus_pure constexpr Tuple carrying_add(const T& rhs,            \
+                                                      bool carry)              \
+      const& noexcept {                                                        \
+    const auto out =                                                           \
+        __private::carrying_add(primitive_value, rhs.primitive_value, carry);  \
+    return Tuple::with(out.value, out.overflow);                               \
   }                                                                            \
   static_assert(true)
 
@@ -1291,6 +1318,40 @@ class Tuple;
   [[nodiscard]] sus_pure constexpr T wrapping_mul(const T& rhs)                \
       const& noexcept {                                                        \
     return __private::wrapping_mul(primitive_value, rhs.primitive_value);      \
+  }                                                                            \
+                                                                               \
+  /** Calculates the complete product `self * rhs` without the possibility of  \
+   * overflow, returning the low and high halves of the product.               \
+   *                                                                           \
+   * For u64 this is a single 64x64->128 bit multiply instruction where the    \
+   * target has one.                                                           \
+   */                                                                          \
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<T, T>>             \
+  [[nodiscard]] sus_pure constexpr Tuple widening_mul(const T& rhs)            \
+      const& noexcept {                                                        \
+    const auto out =                                                           \
+        __private::widening_mul(primitive_value, rhs.primitive_value);         \
+    return Tuple::with(out.lo, out.hi);                                        \
+  }                                                                            \
+                                                                               \
+  /** Calculates `self * rhs + carry` without the possibility of overflow,     \
+   * returning the low and high halves of the result.                          \
+   *                                                                           \
+   * This can be chained to multiply an integer that is wider than ##T## by    \
+   * a ##T##, passing the high half of each product into the next as `carry`.  \
+   */                                                                          \
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<T, T>>             \
+  [[nodiscard]] sus_pure constexpr Tuple carrying_mul(const T& rhs,            \
+                                                      const T& carry)          \
+      const& noexcept {                                                        \
+    const auto out =                                                           \
+        __private::widening_mul(primitive_value, rhs.primitive_value);         \
+    const auto lo =                                                            \
+        __private::add_with_overflow(out.lo, carry.primitive_value);           \
+    /* Can't overflow, as MAX * MAX + MAX < 2^(2 * BITS). */                   \
+    const auto hi = static_cast<decltype(primitive_value)>(                    \
+        out.hi + (lo.overflow ? 1u : 0u));                                     \
+    return Tuple::with(lo.value, hi);                                          \
   }                                                                            \
   static_assert(true)
 
@@ -1667,6 +1728,22 @@ class Tuple;
   [[nodiscard]] sus_pure constexpr T wrapping_sub(const T& rhs)                \
       const& noexcept {                                                        \
     return __private::wrapping_sub(primitive_value, rhs.primitive_value);      \
+  }                                                                            \
+                                                                               \
+  /** Calculates `self - rhs - borrow`, returning the difference and the       \
+   * borrow out.                                                               \
+   *                                                                           \
+   * This can be chained to subtract integers that are wider than ##T##, one   \
+   * word at a time from the least significant word, passing the borrow out of \
+   * each subtraction into the next.                                           \
+   */                                                                          \
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<T, bool>>          \
+  [[nodiscard]] sus_pure constexpr Tuple borrowing_sub(const T& rhs,           \
+                                                       bool borrow)            \
+      const& noexcept {                                                        \
+    const auto out = __private::borrowing_sub(primitive_value,                 \
+                                              rhs.primitive_value, borrow);    \
+    return Tuple::with(out.value, out.overflow);                               \
   }                                                                            \
   static_assert(true)
 
@@ -2078,6 +2155,90 @@ class Tuple;
   }                                                                           \
   static_assert(true)
 
+#define _sus__unsigned_to_string(T)                                          \
+  /** Writes the decimal representation of the integer to the front of `buf` \
+   * and returns the number of bytes written.                                \
+   *                                                                         \
+   * No integer takes more than 20 bytes, so a buffer of that size can hold  \
+   * any of them.                                                            \
+   *                                                                         \
+   * # Panics                                                                \
+   * Panics if `buf` is shorter than the decimal representation.             \
+   */                                                                        \
+  usize write_to(::sus::containers::SliceMut<u8> buf) const& noexcept;       \
+  /** Returns the decimal representation of the integer.                     \
+   *                                                                         \
+   * The result always fits in the inline storage of `String`, so this does  \
+   * not allocate.                                                           \
+   */                                                                        \
+  ::sus::string::String to_string() const& noexcept;                         \
+  static_assert(true)
+
+#define _sus__unsigned_out_of_line_to_string(T)                           \
+  inline usize T::write_to(::sus::containers::SliceMut<u8> buf)           \
+      const& noexcept {                                                   \
+    namespace to_chars = ::sus::num::__private::to_chars;                 \
+    const uint32_t len = to_chars::integer_len(primitive_value, false);   \
+    ::sus::check(size_t{buf.len()} >= len);                               \
+    to_chars::write_integer(primitive_value, false,                       \
+                            reinterpret_cast<uint8_t*>(buf.as_mut_ptr()), \
+                            len);                                         \
+    return usize::from(len);                                              \
+  }                                                                       \
+                                                                          \
+  inline ::sus::string::String T::to_string() const& noexcept {           \
+    namespace to_chars = ::sus::num::__private::to_chars;                 \
+    uint8_t bytes[to_chars::kMaxIntegerLen];                              \
+    const uint32_t len = to_chars::integer_len(primitive_value, false);   \
+    to_chars::write_integer(primitive_value, false, bytes, len);          \
+    const auto str = ::sus::string::Str::from_utf8_unchecked(             \
+        ::sus::marker::unsafe_fn,                                         \
+        ::sus::containers::Slice<u8>::from_raw_parts(                     \
+            ::sus::marker::unsafe_fn, reinterpret_cast<const u8*>(bytes), \
+            usize::from(len)));                                           \
+    return ::sus::string::String::from(str);                              \
+  }                                                                       \
+  static_assert(true)
+
+#define _sus__unsigned_from_str(T)                                           \
+  /** Parses an integer from the digits in `src`, in the given `radix`.      \
+   *                                                                         \
+   * The digits may be preceded by a `+`. Digits past 9 are the letters `a`  \
+   * to `z`, in either case. Nothing else is accepted, including whitespace. \
+   * Decimal digits are parsed 8 at a time where possible.                   \
+   *                                                                         \
+   * # Panics                                                                \
+   * Panics if `radix` is not in the range from 2 to 36.                     \
+   */                                                                        \
+  static ::sus::result::Result<T, ::sus::num::ParseIntError> from_str_radix( \
+      ::sus::containers::Slice<u8> src, u32 radix) noexcept;                 \
+  static_assert(true)
+
+#define _sus__unsigned_out_of_line_from_str(T, PrimitiveT)                  \
+  inline ::sus::result::Result<T, ::sus::num::ParseIntError>                \
+  T::from_str_radix(::sus::containers::Slice<u8> src, u32 radix) noexcept { \
+    ::sus::check(radix >= 2u && radix <= 36u);                              \
+    namespace parse = ::sus::num::__private::parse;                         \
+    using R = ::sus::result::Result<T, ::sus::num::ParseIntError>;          \
+    using Kind = ::sus::num::ParseIntError::Kind;                           \
+    constexpr auto kSafeDigits =                                            \
+        size_t{__private::int_log10::T(MAX_PRIMITIVE)};                     \
+    auto value = PrimitiveT{0u};                                            \
+    switch (parse::parse_unsigned(                                          \
+        reinterpret_cast<const uint8_t*>(src.as_ptr()), size_t{src.len()},  \
+        radix.primitive_value, kSafeDigits, value)) {                       \
+      case parse::IntStatus::Ok: return R::with(T(value));                  \
+      case parse::IntStatus::Empty:                                         \
+        return R::with_err(::sus::num::ParseIntError(Kind::Empty));         \
+      case parse::IntStatus::InvalidDigit:                                  \
+        return R::with_err(::sus::num::ParseIntError(Kind::InvalidDigit));  \
+      case parse::IntStatus::Overflow:                                      \
+        return R::with_err(::sus::num::ParseIntError(Kind::PosOverflow));   \
+    }                                                                       \
+    ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);     \
+  }                                                                         \
+  static_assert(true)
+
 #define _sus__unsigned_hash_equal_to(Type)                                 \
   template <>                                                              \
   struct hash<Type> {                                                      \
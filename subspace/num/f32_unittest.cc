@@ -23,6 +23,7 @@
 #include "subspace/ops/eq.h"
 #include "subspace/ops/ord.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 
 #define F32_NEAR(a, b, c) \
   EXPECT_NEAR((a).primitive_value, (b).primitive_value, (c).primitive_value);
@@ -1069,4 +1070,29 @@ TEST(f32, FromNeBytes) {
   }
 }
 
+TEST(f32, ToString) {
+  EXPECT_EQ((0_f32).to_string(), sus::string::String::from("0"));
+  EXPECT_EQ((-0_f32).to_string(), sus::string::String::from("-0"));
+  EXPECT_EQ((1_f32).to_string(), sus::string::String::from("1"));
+  EXPECT_EQ((0.3_f32).to_string(), sus::string::String::from("0.3"));
+  EXPECT_EQ((-12.5_f32).to_string(), sus::string::String::from("-12.5"));
+  EXPECT_EQ(f32::MAX.to_string(), sus::string::String::from("3.4028235e+38"));
+  EXPECT_EQ(f32::INFINITY.to_string(), sus::string::String::from("inf"));
+  EXPECT_EQ(f32::NAN.to_string(), sus::string::String::from("nan"));
+}
+
+TEST(f32, FromStr) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseFloatError::Kind;
+  const auto parse = [](Str s) { return f32::from_str(s.as_bytes()); };
+  EXPECT_EQ(parse(Str::from("0.3")).unwrap(), 0.3_f32);
+  EXPECT_EQ(parse(Str::from("-12.5")).unwrap(), -12.5_f32);
+  EXPECT_EQ(parse(Str::from("16777217")).unwrap(), 16777216_f32);
+  EXPECT_EQ(parse(Str::from("3.4028235e38")).unwrap(), f32::MAX);
+  EXPECT_EQ(parse(Str::from("1e39")).unwrap(), f32::INFINITY);
+  EXPECT_EQ(parse(Str::from("1e-50")).unwrap(), 0_f32);
+  EXPECT_EQ(parse(Str::from("")).unwrap_err().kind(), Kind::Empty);
+  EXPECT_EQ(parse(Str::from("1.5f")).unwrap_err().kind(), Kind::Invalid);
+}
+
 }  // namespace
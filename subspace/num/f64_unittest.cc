@@ -13,6 +13,10 @@
 // limitations under the License.
 
 #include <math.h>
+#include <stdio.h>
+
+#include <bit>
+#include <charconv>
 
 #include "googletest/include/gtest/gtest.h"
 #include "subspace/containers/array.h"
@@ -20,6 +24,7 @@
 #include "subspace/ops/eq.h"
 #include "subspace/ops/ord.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 
 #define F64_NEAR(a, b, c) \
   EXPECT_NEAR((a).primitive_value, (b).primitive_value, (c).primitive_value);
@@ -1048,4 +1053,118 @@ TEST(f64, FromNeBytes) {
   }
 }
 
+TEST(f64, ToString) {
+  EXPECT_EQ((0_f64).to_string(), sus::string::String::from("0"));
+  EXPECT_EQ((0.1_f64).to_string(), sus::string::String::from("0.1"));
+  EXPECT_EQ((123456_f64).to_string(), sus::string::String::from("123456"));
+  EXPECT_EQ((1e22_f64).to_string(), sus::string::String::from("1e+22"));
+  EXPECT_EQ(f64::MIN.to_string(),
+            sus::string::String::from("-1.7976931348623157e+308"));
+  EXPECT_EQ(f64::NEG_INFINITY.to_string(),
+            sus::string::String::from("-inf"));
+  // Every representation parses back to the same value.
+  for (f64 v : {0.1_f64, 1_f64 / 3_f64, f64::EPSILON, f64::MIN_POSITIVE,
+                f64::MAX, -2.5e-300_f64}) {
+    const auto s = v.to_string();
+    const auto* begin = reinterpret_cast<const char*>(s.as_bytes().as_ptr());
+    double parsed;
+    std::from_chars(begin, begin + size_t{s.len()}, parsed);
+    EXPECT_EQ(parsed, v.primitive_value);
+  }
+}
+
+TEST(f64, WriteTo) {
+  auto buf = sus::Array<u8, 24>();
+  EXPECT_EQ((-f64::MIN_POSITIVE).write_to(buf.as_mut_slice()), 24u);
+  EXPECT_EQ(sus::string::Str::from_utf8(buf.as_slice()).unwrap(),
+            sus::string::Str::from("-2.2250738585072014e-308"));
+}
+
+TEST(f64DeathTest, WriteToTooShort) {
+  auto buf = sus::Array<u8, 3>();
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH((0.25_f64).write_to(buf.as_mut_slice()), "");
+#endif
+  EXPECT_EQ((0.5_f64).write_to(buf.as_mut_slice()), 3u);
+}
+
+TEST(f64, FromStr) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseFloatError::Kind;
+  const auto parse = [](Str s) { return f64::from_str(s.as_bytes()); };
+  EXPECT_EQ(parse(Str::from("0")).unwrap(), 0_f64);
+  EXPECT_TRUE(parse(Str::from("-0")).unwrap().is_sign_negative());
+  EXPECT_EQ(parse(Str::from("1")).unwrap(), 1_f64);
+  EXPECT_EQ(parse(Str::from("+1.5")).unwrap(), 1.5_f64);
+  EXPECT_EQ(parse(Str::from("-.5")).unwrap(), -0.5_f64);
+  EXPECT_EQ(parse(Str::from("2.")).unwrap(), 2_f64);
+  EXPECT_EQ(parse(Str::from("0.1")).unwrap(), 0.1_f64);
+  EXPECT_EQ(parse(Str::from("1234.5678")).unwrap(), 1234.5678_f64);
+  EXPECT_EQ(parse(Str::from("6.02E23")).unwrap(), 6.02e23_f64);
+  EXPECT_EQ(parse(Str::from("123e25")).unwrap(), 123e25_f64);
+  EXPECT_EQ(parse(Str::from("1e-7")).unwrap(), 1e-7_f64);
+  EXPECT_EQ(parse(Str::from("0.000000000000000000000000000001")).unwrap(),
+            1e-30_f64);
+  EXPECT_EQ(parse(Str::from("9007199254740993")).unwrap(),
+            9007199254740992_f64);
+  EXPECT_EQ(parse(Str::from("1.7976931348623157e308")).unwrap(), f64::MAX);
+  EXPECT_EQ(parse(Str::from("4.9406564584124654e-324")).unwrap(),
+            f64::from_bits(1u));
+  EXPECT_EQ(parse(Str::from("1e400")).unwrap(), f64::INFINITY);
+  EXPECT_EQ(parse(Str::from("-1e400")).unwrap(), f64::NEG_INFINITY);
+  EXPECT_EQ(parse(Str::from("1e-400")).unwrap(), 0_f64);
+  EXPECT_EQ(parse(Str::from("0.00000000000000000001e-400")).unwrap(), 0_f64);
+  EXPECT_EQ(parse(Str::from("inf")).unwrap(), f64::INFINITY);
+  EXPECT_EQ(parse(Str::from("-Infinity")).unwrap(), f64::NEG_INFINITY);
+  EXPECT_TRUE(parse(Str::from("NaN")).unwrap().is_nan());
+
+  EXPECT_EQ(parse(Str::from("")).unwrap_err().kind(), Kind::Empty);
+  for (Str s : {Str::from("+"), Str::from("."), Str::from("-."),
+                Str::from("e5"), Str::from("1e"), Str::from("1e+"),
+                Str::from(" 1"), Str::from("1 "), Str::from("1.2.3"),
+                Str::from("0x10"), Str::from("infinit"), Str::from("nana"),
+                Str::from("++1"), Str::from("1e5.5")}) {
+    EXPECT_EQ(parse(s).unwrap_err().kind(), Kind::Invalid);
+  }
+}
+
+TEST(f64, FromStrRoundTrip) {
+  // Values which take the fast path and the fallback alike parse to the
+  // nearest double.
+  uint64_t state = 0x9E3779B97F4A7C15u;
+  for (int i = 0; i < 20000; ++i) {
+    state ^= state << 13u;
+    state ^= state >> 7u;
+    state ^= state << 17u;
+    char text[64];
+    int len;
+    switch (i % 3) {
+      case 0:
+        len = snprintf(text, sizeof(text), "%llu.%llu",
+                       static_cast<unsigned long long>(state % 1000000u),
+                       static_cast<unsigned long long>(state >> 40u));
+        break;
+      case 1:
+        len = snprintf(text, sizeof(text), "%.17g",
+                       std::bit_cast<double>(state));
+        break;
+      default:
+        len = snprintf(text, sizeof(text), "%llue%d",
+                       static_cast<unsigned long long>(state >> (state % 64u)),
+                       static_cast<int>(state % 80u) - 40);
+        break;
+    }
+    double expected;
+    std::from_chars(text, text + len, expected);
+    auto r = f64::from_str(sus::Slice<u8>::from_raw_parts(
+        unsafe_fn, reinterpret_cast<const u8*>(text),
+        usize::from(static_cast<uint32_t>(len))));
+    if (isnan(expected)) {
+      EXPECT_TRUE(sus::move(r).unwrap().is_nan());
+    } else {
+      EXPECT_EQ(sus::move(r).unwrap(), f64(expected)) << text;
+    }
+  }
+}
+
 }  // namespace
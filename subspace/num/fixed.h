@@ -0,0 +1,603 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <compare>
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/assertions/unreachable.h"
+#include "subspace/containers/slice.h"
+#include "subspace/macros/pure.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/__private/to_chars.h"
+#include "subspace/num/integer_concepts.h"
+#include "subspace/num/parse_int_error.h"
+#include "subspace/num/types.h"
+#include "subspace/option/option.h"
+#include "subspace/ptr/copy.h"
+#include "subspace/result/result.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::num {
+
+namespace __private::fixed {
+
+/// The longest decimal representation of a `Scaled` number: a sign, 20
+/// integer digits, a point and 63 fractional digits.
+inline constexpr uint32_t kMaxLen = 85u;
+
+/// The integer type with twice the bits of `I`, which holds the product of
+/// any two values of `I`. Integers of 32 bits or less use 64-bit math, which
+/// every target has natively.
+template <Integer I>
+using Wide = std::conditional_t<
+    (sizeof(I) <= 4u), std::conditional_t<Signed<I>, i64, u64>,
+    std::conditional_t<Signed<I>, ::sus::num::i128, ::sus::num::u128>>;
+
+template <Integer I>
+sus_pure_const constexpr Wide<I> widen(I i) noexcept {
+  using W = Wide<I>;
+  if constexpr (sizeof(I) <= 4u)
+    return W(static_cast<decltype(W::primitive_value)>(i.primitive_value));
+  else
+    return W::from(i);
+}
+
+/// Truncates `w` to the low bits which fit in `I`.
+template <Integer I, class W>
+sus_pure constexpr I truncate(const W& w) noexcept {
+  using P = decltype(I::primitive_value);
+  if constexpr (sizeof(I) <= 4u)
+    return I(static_cast<P>(w.primitive_value));
+  else
+    return I(static_cast<P>(w.lo_word().primitive_value));
+}
+
+template <Integer I, class W>
+sus_pure constexpr bool fits(const W& w) noexcept {
+  return widen(I::MIN) <= w && w <= widen(I::MAX);
+}
+
+/// Returns whether 10 to the power of `exp` is no larger than `I::MAX`.
+template <Integer I>
+consteval bool pow10_fits(uint32_t exp) noexcept {
+  const auto max = static_cast<uint64_t>(I::MAX_PRIMITIVE);
+  uint64_t v = 1u;
+  for (uint32_t i = 0u; i < exp; ++i) {
+    if (v > max / 10u) return false;
+    v *= 10u;
+  }
+  return true;
+}
+
+consteval uint64_t pow10(uint32_t exp) noexcept {
+  uint64_t v = 1u;
+  for (uint32_t i = 0u; i < exp; ++i) v *= 10u;
+  return v;
+}
+
+sus_pure_const constexpr uint64_t low_u64(uint64_t v) noexcept { return v; }
+sus_pure constexpr uint64_t low_u64(const ::sus::num::u128& v) noexcept {
+  return v.lo_word().primitive_value;
+}
+
+/// Writes the decimal digits of `frac / one`, which is less than 1, to `out`
+/// and returns how many were written. The digits stop at the last non-zero
+/// one, which is always reached: a fraction over a power of 2 or 10 has a
+/// finite decimal expansion.
+///
+/// `T` must hold `10 * one`.
+template <class T>
+constexpr uint32_t write_fraction(T frac, T one, uint8_t* out) noexcept {
+  uint32_t len = 0u;
+  while (frac != T(0u)) {
+    frac *= T(10u);
+    out[len] = static_cast<uint8_t>('0' + low_u64(frac / one));
+    frac %= one;
+    len += 1u;
+  }
+  return len;
+}
+
+/// Returns `floor(2 * one * f)` where `f` is the fraction `0.d1d2d3...` from
+/// the decimal digits in `p[0..n]`, and sets `inexact` if the floor dropped
+/// anything.
+///
+/// Working from the last digit to the first, each step divides by 10. The
+/// floor of nested floors is the floor of the exact value, so only the
+/// quotient needs to be kept, along with whether any remainder was dropped.
+///
+/// `T` must hold `20 * one`.
+template <class T>
+constexpr T parse_fraction(const uint8_t* p, size_t n, T one,
+                           bool& inexact) noexcept {
+  const T twice_one = one * T(2u);
+  T q = T(0u);
+  while (n > 0u) {
+    n -= 1u;
+    const T t = T(static_cast<uint64_t>(p[n] - '0')) * twice_one + q;
+    q = t / T(10u);
+    inexact |= t % T(10u) != T(0u);
+  }
+  return q;
+}
+
+}  // namespace __private::fixed
+
+/// A number with a fixed number of fractional digits, stored as an integer
+/// count of `1 / One`.
+///
+/// Addition and subtraction are exact integer arithmetic on the stored
+/// values, so they are as fast as the integer `I` and never lose precision.
+/// Each arithmetic operation has `checked_`, `overflowing_`, `saturating_` and
+/// `wrapping_` forms, which match those of the integer `I`. The operators
+/// panic on overflow.
+///
+/// Multiplication and division round the exact result toward zero to a
+/// multiple of `1 / One`. They are done in the integer `I` when the
+/// intermediate product fits, and otherwise in an integer of twice the bits.
+///
+/// `Scaled` is not normally named directly, instead use `Fixed` for a binary
+/// fraction or `Decimal` for a decimal fraction.
+template <Integer I, uint64_t One>
+  requires(One > 0u && One <= uint64_t{1u} << (sizeof(I) * 8u - 1u))
+class Scaled final {
+  using P = decltype(I::primitive_value);
+  using W = __private::fixed::Wide<I>;
+  // When `One` fits in `I`, multiplication and division can first be tried
+  // without widening.
+  static constexpr bool kOneFits =
+      One <= static_cast<uint64_t>(I::MAX_PRIMITIVE);
+
+ public:
+  /// The smallest value that can be represented by this type.
+  static const Scaled MIN;
+  /// The largest value that can be represented by this type.
+  static const Scaled MAX;
+  /// The difference between a value and the next largest value, which is
+  /// `1 / One`.
+  static const Scaled DELTA;
+
+  /// Default constructor, which sets the number to 0.
+  constexpr Scaled() noexcept = default;
+
+  /// Constructs a number from its stored value, which counts the number of
+  /// `DELTA` in the number.
+  [[nodiscard]] sus_pure static constexpr Scaled from_bits(I bits) noexcept {
+    return Scaled(bits);
+  }
+  /// Returns the stored value, which counts the number of `DELTA` in the
+  /// number.
+  [[nodiscard]] sus_pure constexpr I to_bits() const& noexcept { return raw_; }
+
+  /// Constructs a number with the value of the integer `i`.
+  ///
+  /// # Panics
+  /// Panics if `i` is out of range for the type.
+  [[nodiscard]] sus_pure static constexpr Scaled from_int(I i) noexcept {
+    return checked_from_int(i).unwrap();
+  }
+  /// Constructs a number with the value of the integer `i`, or returns `None`
+  /// if it is out of range for the type.
+  [[nodiscard]] sus_pure static constexpr Option<Scaled> checked_from_int(
+      I i) noexcept {
+    if constexpr (kOneFits) {
+      return wrap(i.checked_mul(I(static_cast<P>(One))));
+    } else {
+      return checked(__private::fixed::widen(i) * W::from(One));
+    }
+  }
+  /// Returns the integer part of the number, discarding the fraction, which
+  /// rounds toward zero.
+  [[nodiscard]] sus_pure constexpr I to_int() const& noexcept {
+    if constexpr (kOneFits)
+      return raw_ / I(static_cast<P>(One));
+    else
+      return __private::fixed::truncate<I>(__private::fixed::widen(raw_) /
+                                           W::from(One));
+  }
+  /// Returns an approximation of the number as an `f64`.
+  ///
+  /// When `One` is a power of two, as for `Fixed`, the division is exact and
+  /// this is the nearest `f64`. Otherwise, as for `Decimal`, the raw value and
+  /// the quotient are each rounded, so the result may differ slightly from the
+  /// nearest `f64`.
+  [[nodiscard]] sus_pure constexpr f64 to_f64() const& noexcept {
+    return f64(static_cast<double>(raw_.primitive_value) /
+               static_cast<double>(One));
+  }
+
+  [[nodiscard]] friend sus_pure constexpr bool operator==(
+      const Scaled& l, const Scaled& r) noexcept {
+    return l.raw_ == r.raw_;
+  }
+  [[nodiscard]] friend sus_pure constexpr std::strong_ordering operator<=>(
+      const Scaled& l, const Scaled& r) noexcept {
+    return l.raw_ <=> r.raw_;
+  }
+
+  /// #[doc.overloads=scaled.neg]
+  [[nodiscard]] sus_pure constexpr Scaled operator-() const& noexcept
+    requires(Signed<I>)
+  {
+    return Scaled(-raw_);
+  }
+  /// #[doc.overloads=scaled.+]
+  [[nodiscard]] friend sus_pure constexpr Scaled operator+(
+      const Scaled& l, const Scaled& r) noexcept {
+    return Scaled(l.raw_ + r.raw_);
+  }
+  /// #[doc.overloads=scaled.-]
+  [[nodiscard]] friend sus_pure constexpr Scaled operator-(
+      const Scaled& l, const Scaled& r) noexcept {
+    return Scaled(l.raw_ - r.raw_);
+  }
+  /// #[doc.overloads=scaled.*]
+  [[nodiscard]] friend sus_pure constexpr Scaled operator*(
+      const Scaled& l, const Scaled& r) noexcept {
+    return l.checked_mul(r).unwrap();
+  }
+  /// #[doc.overloads=scaled./]
+  [[nodiscard]] friend sus_pure constexpr Scaled operator/(
+      const Scaled& l, const Scaled& r) noexcept {
+    ::sus::check(r.raw_ != I());
+    return l.checked_div(r).unwrap();
+  }
+
+  constexpr void operator+=(const Scaled& r) & noexcept { *this = *this + r; }
+  constexpr void operator-=(const Scaled& r) & noexcept { *this = *this - r; }
+  constexpr void operator*=(const Scaled& r) & noexcept { *this = *this * r; }
+  constexpr void operator/=(const Scaled& r) & noexcept { *this = *this / r; }
+
+  /// Checked addition. Returns `None` if overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<Scaled> checked_add(
+      const Scaled& rhs) const& noexcept {
+    return wrap(raw_.checked_add(rhs.raw_));
+  }
+  /// Returns the sum and whether an arithmetic overflow occurred. If one did,
+  /// the wrapped value is returned.
+  [[nodiscard]] sus_pure constexpr Tuple<Scaled, bool> overflowing_add(
+      const Scaled& rhs) const& noexcept {
+    const auto [v, overflow] = raw_.overflowing_add(rhs.raw_);
+    return Tuple<Scaled, bool>::with(Scaled(v), overflow);
+  }
+  /// Saturating addition, which returns `MIN` or `MAX` instead of
+  /// overflowing.
+  [[nodiscard]] sus_pure constexpr Scaled saturating_add(
+      const Scaled& rhs) const& noexcept {
+    return Scaled(raw_.saturating_add(rhs.raw_));
+  }
+  /// Wrapping (modular) addition, which wraps around at the boundary of the
+  /// type.
+  [[nodiscard]] sus_pure constexpr Scaled wrapping_add(
+      const Scaled& rhs) const& noexcept {
+    return Scaled(raw_.wrapping_add(rhs.raw_));
+  }
+
+  /// Checked subtraction. Returns `None` if overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<Scaled> checked_sub(
+      const Scaled& rhs) const& noexcept {
+    return wrap(raw_.checked_sub(rhs.raw_));
+  }
+  /// Returns the difference and whether an arithmetic overflow occurred. If
+  /// one did, the wrapped value is returned.
+  [[nodiscard]] sus_pure constexpr Tuple<Scaled, bool> overflowing_sub(
+      const Scaled& rhs) const& noexcept {
+    const auto [v, overflow] = raw_.overflowing_sub(rhs.raw_);
+    return Tuple<Scaled, bool>::with(Scaled(v), overflow);
+  }
+  /// Saturating subtraction, which returns `MIN` or `MAX` instead of
+  /// overflowing.
+  [[nodiscard]] sus_pure constexpr Scaled saturating_sub(
+      const Scaled& rhs) const& noexcept {
+    return Scaled(raw_.saturating_sub(rhs.raw_));
+  }
+  /// Wrapping (modular) subtraction, which wraps around at the boundary of
+  /// the type.
+  [[nodiscard]] sus_pure constexpr Scaled wrapping_sub(
+      const Scaled& rhs) const& noexcept {
+    return Scaled(raw_.wrapping_sub(rhs.raw_));
+  }
+
+  /// Checked multiplication. Returns `None` if overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<Scaled> checked_mul(
+      const Scaled& rhs) const& noexcept {
+    if constexpr (kOneFits) {
+      const auto [p, overflow] = raw_.overflowing_mul(rhs.raw_);
+      if (!overflow)
+        return Option<Scaled>::some(Scaled(p / I(static_cast<P>(One))));
+    }
+    return checked(wide_mul(rhs));
+  }
+  /// Returns the product and whether an arithmetic overflow occurred. If one
+  /// did, the wrapped value is returned.
+  [[nodiscard]] sus_pure constexpr Tuple<Scaled, bool> overflowing_mul(
+      const Scaled& rhs) const& noexcept {
+    return overflowing(wide_mul(rhs));
+  }
+  /// Saturating multiplication, which returns `MIN` or `MAX` instead of
+  /// overflowing.
+  [[nodiscard]] sus_pure constexpr Scaled saturating_mul(
+      const Scaled& rhs) const& noexcept {
+    return saturating(wide_mul(rhs));
+  }
+  /// Wrapping (modular) multiplication, which wraps around at the boundary of
+  /// the type.
+  [[nodiscard]] sus_pure constexpr Scaled wrapping_mul(
+      const Scaled& rhs) const& noexcept {
+    return Scaled(__private::fixed::truncate<I>(wide_mul(rhs)));
+  }
+
+  /// Checked division. Returns `None` if `rhs` is zero or overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<Scaled> checked_div(
+      const Scaled& rhs) const& noexcept {
+    if (rhs.raw_ == I()) return Option<Scaled>::none();
+    if constexpr (kOneFits) {
+      const auto [p, overflow] = raw_.overflowing_mul(I(static_cast<P>(One)));
+      if (!overflow) {
+        // This fails only for `MIN / -1`, which may still fit once widened.
+        auto q = p.checked_div(rhs.raw_);
+        if (q.is_some()) return Option<Scaled>::some(Scaled(*q));
+      }
+    }
+    return checked(wide_div(rhs));
+  }
+  /// Returns the quotient and whether an arithmetic overflow occurred. If one
+  /// did, the wrapped value is returned.
+  ///
+  /// # Panics
+  /// Panics if `rhs` is zero.
+  [[nodiscard]] sus_pure constexpr Tuple<Scaled, bool> overflowing_div(
+      const Scaled& rhs) const& noexcept {
+    ::sus::check(rhs.raw_ != I());
+    return overflowing(wide_div(rhs));
+  }
+  /// Saturating division, which returns `MIN` or `MAX` instead of
+  /// overflowing.
+  ///
+  /// # Panics
+  /// Panics if `rhs` is zero.
+  [[nodiscard]] sus_pure constexpr Scaled saturating_div(
+      const Scaled& rhs) const& noexcept {
+    ::sus::check(rhs.raw_ != I());
+    return saturating(wide_div(rhs));
+  }
+  /// Wrapping (modular) division, which wraps around at the boundary of the
+  /// type.
+  ///
+  /// # Panics
+  /// Panics if `rhs` is zero.
+  [[nodiscard]] sus_pure constexpr Scaled wrapping_div(
+      const Scaled& rhs) const& noexcept {
+    ::sus::check(rhs.raw_ != I());
+    return Scaled(__private::fixed::truncate<I>(wide_div(rhs)));
+  }
+
+  /// Writes the exact decimal representation of the number to the front of
+  /// `buf` and returns the number of bytes written.
+  ///
+  /// The representation is as for `to_string()`, and is never more than 85
+  /// bytes long.
+  ///
+  /// # Panics
+  /// Panics if `buf` is shorter than the decimal representation.
+  usize write_to(::sus::containers::SliceMut<u8> buf) const& noexcept {
+    uint8_t bytes[__private::fixed::kMaxLen];
+    const uint32_t len = write_decimal(bytes);
+    ::sus::check(size_t{buf.len()} >= len);
+    ::sus::ptr::copy_nonoverlapping(::sus::marker::unsafe_fn,
+                                    reinterpret_cast<const u8*>(bytes),
+                                    buf.as_mut_ptr(), usize::from(len));
+    return usize::from(len);
+  }
+  /// Returns the exact decimal representation of the number.
+  ///
+  /// Every binary or decimal fraction has a finite decimal expansion, so no
+  /// rounding happens. The fraction is written up to its last non-zero digit,
+  /// and is omitted along with the point when it is zero, such as `-12`,
+  /// `0.5` or `3.140625`. Parsing the result with `from_str()` gives back the
+  /// same number.
+  ::sus::string::String to_string() const& noexcept {
+    uint8_t bytes[__private::fixed::kMaxLen];
+    const uint32_t len = write_decimal(bytes);
+    return ::sus::string::String::from(::sus::string::Str::from_utf8_unchecked(
+        ::sus::marker::unsafe_fn,
+        ::sus::containers::Slice<u8>::from_raw_parts(
+            ::sus::marker::unsafe_fn, reinterpret_cast<const u8*>(bytes),
+            usize::from(len))));
+  }
+
+  /// Parses a number from the decimal representation in `src`.
+  ///
+  /// The accepted format is decimal digits with an optional sign and point,
+  /// such as `-12`, `1.25`, `.5` or `2.`. A `-` is only accepted for signed
+  /// types. Nothing else is accepted, including whitespace and exponents.
+  ///
+  /// Any number of fractional digits may be given. When the number falls
+  /// between two values of the type, the result is the nearest one, breaking
+  /// ties to even. The errors are as for parsing an integer, where overflow
+  /// is a number out of range for the type.
+  static ::sus::result::Result<Scaled, ::sus::num::ParseIntError> from_str(
+      ::sus::containers::Slice<u8> src) noexcept {
+    using R = ::sus::result::Result<Scaled, ::sus::num::ParseIntError>;
+    using Kind = ::sus::num::ParseIntError::Kind;
+    using U = std::make_unsigned_t<P>;
+    auto p = reinterpret_cast<const uint8_t*>(src.as_ptr());
+    auto n = size_t{src.len()};
+    if (n == 0u) return R::with_err(::sus::num::ParseIntError(Kind::Empty));
+    bool negative = false;
+    if (p[0u] == '+' || (Signed<I> && p[0u] == '-')) {
+      negative = p[0u] == '-';
+      p += 1u;
+      n -= 1u;
+    }
+    size_t int_len = n;
+    for (size_t i = 0u; i < n; ++i) {
+      if (p[i] == '.' && int_len == n) {
+        int_len = i;
+      } else if (p[i] < '0' || p[i] > '9') {
+        return R::with_err(::sus::num::ParseIntError(Kind::InvalidDigit));
+      }
+    }
+    const uint8_t* frac_digits = p + int_len + (int_len < n ? 1u : 0u);
+    const size_t frac_len = size_t(p + n - frac_digits);
+    if (int_len == 0u && frac_len == 0u)
+      return R::with_err(::sus::num::ParseIntError(Kind::InvalidDigit));
+
+    // The magnitude of MIN is one more than MAX.
+    const uint64_t limit =
+        negative
+            ? uint64_t{static_cast<U>(U{0u} - static_cast<U>(I::MIN_PRIMITIVE))}
+            : static_cast<uint64_t>(I::MAX_PRIMITIVE);
+    const auto overflow = [&]() {
+      return R::with_err(::sus::num::ParseIntError(
+          negative ? Kind::NegOverflow : Kind::PosOverflow));
+    };
+    const uint64_t int_limit = limit / One;
+    uint64_t int_part = 0u;
+    for (size_t i = 0u; i < int_len; ++i) {
+      const auto d = static_cast<uint64_t>(p[i] - '0');
+      if (d > int_limit || int_part > (int_limit - d) / 10u) return overflow();
+      int_part = int_part * 10u + d;
+    }
+
+    bool inexact = false;
+    uint64_t twice_frac;
+    if constexpr (One <= UINT64_MAX / 20u) {
+      twice_frac =
+          __private::fixed::parse_fraction(frac_digits, frac_len, One, inexact);
+    } else {
+      twice_frac = __private::fixed::low_u64(__private::fixed::parse_fraction(
+          frac_digits, frac_len, ::sus::num::u128(One), inexact));
+    }
+    // `int_part * One` is at most `limit`, so neither can overflow.
+    uint64_t mag = int_part * One;
+    if (twice_frac / 2u > limit - mag) return overflow();
+    mag += twice_frac / 2u;
+    // The dropped bit is one half of `DELTA`, so round up past a half, and at
+    // exactly a half round to the even value.
+    if ((twice_frac & 1u) != 0u && (inexact || (mag & 1u) != 0u)) {
+      if (mag == limit) return overflow();
+      mag += 1u;
+    }
+    auto bits = static_cast<U>(mag);
+    if (negative) bits = static_cast<U>(U{0u} - bits);
+    return R::with(Scaled(I(static_cast<P>(bits))));
+  }
+
+ private:
+  explicit constexpr Scaled(I raw) noexcept : raw_(raw) {}
+
+  static constexpr Option<Scaled> wrap(Option<I> o) noexcept {
+    if (o.is_some()) return Option<Scaled>::some(Scaled(*o));
+    return Option<Scaled>::none();
+  }
+  static constexpr Option<Scaled> checked(const W& w) noexcept {
+    if (__private::fixed::fits<I>(w))
+      return Option<Scaled>::some(Scaled(__private::fixed::truncate<I>(w)));
+    return Option<Scaled>::none();
+  }
+  static constexpr Tuple<Scaled, bool> overflowing(const W& w) noexcept {
+    return Tuple<Scaled, bool>::with(Scaled(__private::fixed::truncate<I>(w)),
+                                     !__private::fixed::fits<I>(w));
+  }
+  static constexpr Scaled saturating(const W& w) noexcept {
+    if (w < __private::fixed::widen(I::MIN)) return Scaled(I::MIN);
+    if (w > __private::fixed::widen(I::MAX)) return Scaled(I::MAX);
+    return Scaled(__private::fixed::truncate<I>(w));
+  }
+
+  /// The exact product with `rhs`, rounded toward zero to a multiple of
+  /// `DELTA`, which can not overflow in `W`.
+  constexpr W wide_mul(const Scaled& rhs) const noexcept {
+    return __private::fixed::widen(raw_) * __private::fixed::widen(rhs.raw_) /
+           W::from(One);
+  }
+  /// The exact quotient by `rhs`, rounded toward zero to a multiple of
+  /// `DELTA`, which can not overflow in `W`. The `rhs` must not be zero.
+  constexpr W wide_div(const Scaled& rhs) const noexcept {
+    return __private::fixed::widen(raw_) * W::from(One) /
+           __private::fixed::widen(rhs.raw_);
+  }
+
+  uint32_t write_decimal(
+      uint8_t (&out)[__private::fixed::kMaxLen]) const noexcept {
+    namespace to_chars = ::sus::num::__private::to_chars;
+    using U = std::make_unsigned_t<P>;
+    const bool negative = raw_.primitive_value < P{0};
+    auto mag = static_cast<U>(raw_.primitive_value);
+    if (negative) mag = static_cast<U>(U{0u} - mag);
+    const uint64_t int_part = uint64_t{mag} / One;
+    const uint64_t frac = uint64_t{mag} % One;
+
+    uint32_t len = to_chars::integer_len(int_part, negative);
+    to_chars::write_integer(int_part, negative, out, len);
+    if (frac != 0u) {
+      out[len] = '.';
+      len += 1u;
+      if constexpr (One <= UINT64_MAX / 10u) {
+        len += __private::fixed::write_fraction(frac, One, out + len);
+      } else {
+        len += __private::fixed::write_fraction(
+            ::sus::num::u128(frac), ::sus::num::u128(One), out + len);
+      }
+    }
+    return len;
+  }
+
+  I raw_;
+};
+
+template <Integer I, uint64_t One>
+  requires(One > 0u && One <= uint64_t{1u} << (sizeof(I) * 8u - 1u))
+inline constexpr Scaled<I, One> Scaled<I, One>::MIN =
+    Scaled<I, One>::from_bits(I::MIN);
+template <Integer I, uint64_t One>
+  requires(One > 0u && One <= uint64_t{1u} << (sizeof(I) * 8u - 1u))
+inline constexpr Scaled<I, One> Scaled<I, One>::MAX =
+    Scaled<I, One>::from_bits(I::MAX);
+template <Integer I, uint64_t One>
+  requires(One > 0u && One <= uint64_t{1u} << (sizeof(I) * 8u - 1u))
+inline constexpr Scaled<I, One> Scaled<I, One>::DELTA =
+    Scaled<I, One>::from_bits(I(static_cast<decltype(I::primitive_value)>(1)));
+
+/// A binary fixed-point number, stored in the integer `I` with `FracBits` of
+/// its bits after the point.
+///
+/// For example, `Fixed<i32, 16>` has 16 integer and 16 fractional bits,
+/// holding values from -32768 to 32767.99998 in steps of 1/65536. Arithmetic
+/// on binary fractions is the fastest, but most decimal fractions, like 0.1,
+/// can not be represented exactly; use `Decimal` for those.
+template <Integer I, uint32_t FracBits>
+  requires(FracBits < sizeof(I) * 8u)
+using Fixed = Scaled<I, uint64_t{1u} << FracBits>;
+
+/// A decimal fixed-point number, stored in the integer `I` as a count of
+/// `1 / 10^Scale`.
+///
+/// For example, `Decimal<i64, 4>` holds prices to a hundredth of a cent, and
+/// every number written with 4 or fewer decimal places is represented
+/// exactly, unlike in a binary `f64` or `Fixed`.
+template <Integer I, uint32_t Scale>
+  requires(__private::fixed::pow10_fits<I>(Scale))
+using Decimal = Scaled<I, __private::fixed::pow10(Scale)>;
+
+}  // namespace sus::num
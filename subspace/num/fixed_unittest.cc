@@ -0,0 +1,328 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/num/fixed.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+#include "subspace/string/str.h"
+#include "subspace/test/ensure_use.h"
+
+namespace {
+
+using sus::num::Decimal;
+using sus::num::Fixed;
+using sus::num::ParseIntError;
+
+using Q16 = Fixed<i32, 16>;
+using Price = Decimal<i64, 4>;
+
+static_assert(sizeof(Q16) == sizeof(i32));
+static_assert(sizeof(Price) == sizeof(i64));
+static_assert(std::same_as<Decimal<u8, 0>, Fixed<u8, 0>>);
+
+// Conversions and arithmetic run in constant expressions.
+static_assert(Q16::from_int(3) / Q16::from_int(4) ==
+              Q16::from_bits(0xc000));
+static_assert(Price::from_int(2).to_bits() == 20000);
+
+/// Parses `chars`, which must be valid.
+template <class T, size_t N>
+T parse(const char (&chars)[N]) {
+  const auto s = sus::Str::from(chars);
+  return T::from_str(s.as_bytes()).unwrap();
+}
+
+/// Parses `chars`, which must be invalid, and returns the kind of error.
+template <class T, size_t N>
+ParseIntError::Kind parse_err(const char (&chars)[N]) {
+  const auto s = sus::Str::from(chars);
+  return T::from_str(s.as_bytes()).unwrap_err().kind();
+}
+
+TEST(Fixed, Bits) {
+  EXPECT_EQ(Q16().to_bits(), 0);
+  EXPECT_EQ(Q16::from_int(1).to_bits(), 0x10000);
+  EXPECT_EQ(Q16::from_int(-2).to_bits(), -0x20000);
+  EXPECT_EQ(Q16::DELTA.to_bits(), 1);
+  EXPECT_EQ(Q16::MIN.to_bits(), i32::MIN);
+  EXPECT_EQ(Q16::MAX.to_bits(), i32::MAX);
+  EXPECT_EQ(Q16::from_bits(0x18000).to_int(), 1);
+  EXPECT_EQ(Q16::from_bits(-0x18000).to_int(), -1);
+  EXPECT_EQ(Q16::from_bits(-0x8000).to_int(), 0);
+  EXPECT_EQ(Q16::from_bits(0x18000).to_f64(), 1.5);
+  EXPECT_EQ(Q16::from_bits(-0x4000).to_f64(), -0.25);
+
+  EXPECT_EQ(Q16::checked_from_int(32767).unwrap(), Q16::from_int(32767));
+  EXPECT_EQ(Q16::checked_from_int(32768), sus::None);
+  EXPECT_EQ(Q16::checked_from_int(-32768).unwrap(), Q16::MIN);
+  EXPECT_EQ(Q16::checked_from_int(-32769), sus::None);
+
+  // A fixed point with no integer bits can still hold some integers.
+  using Q31 = Fixed<i32, 31>;
+  EXPECT_EQ(Q31::checked_from_int(-1).unwrap(), Q31::MIN);
+  EXPECT_EQ(Q31::checked_from_int(1), sus::None);
+  EXPECT_EQ(Q31::MIN.to_int(), -1);
+  EXPECT_EQ(Q31::MAX.to_int(), 0);
+}
+
+TEST(Fixed, Compare) {
+  EXPECT_LT(Q16::from_int(-1), Q16());
+  EXPECT_LT(Q16(), Q16::DELTA);
+  EXPECT_GT(Q16::MAX, Q16::from_int(32767));
+  EXPECT_EQ(Price::from_int(5), parse<Price>("5.0000"));
+  EXPECT_NE(Price::from_int(5), Price::from_int(5) + Price::DELTA);
+}
+
+TEST(Fixed, AddSub) {
+  const auto a = parse<Price>("1.25");
+  const auto b = parse<Price>("0.1");
+  EXPECT_EQ(a + b, parse<Price>("1.35"));
+  EXPECT_EQ(b - a, parse<Price>("-1.15"));
+  EXPECT_EQ(-a, parse<Price>("-1.25"));
+  auto c = a;
+  c += b;
+  c -= a;
+  EXPECT_EQ(c, b);
+
+  EXPECT_EQ(Q16::MAX.checked_add(Q16::DELTA), sus::None);
+  EXPECT_EQ(Q16::MAX.checked_sub(Q16::DELTA).unwrap().to_bits(),
+            i32::MAX - 1);
+  EXPECT_EQ(Q16::MIN.checked_sub(Q16::DELTA), sus::None);
+  EXPECT_EQ(Q16::MAX.overflowing_add(Q16::DELTA),
+            (sus::Tuple<Q16, bool>::with(Q16::MIN, true)));
+  EXPECT_EQ(Q16::MIN.overflowing_sub(Q16::DELTA),
+            (sus::Tuple<Q16, bool>::with(Q16::MAX, true)));
+  EXPECT_EQ(Q16::MAX.saturating_add(Q16::DELTA), Q16::MAX);
+  EXPECT_EQ(Q16::MIN.saturating_sub(Q16::DELTA), Q16::MIN);
+  EXPECT_EQ(Q16::MAX.wrapping_add(Q16::DELTA), Q16::MIN);
+  EXPECT_EQ(Q16::MIN.wrapping_sub(Q16::DELTA), Q16::MAX);
+
+  using UQ8 = Fixed<u16, 8>;
+  EXPECT_EQ(UQ8().checked_sub(UQ8::DELTA), sus::None);
+  EXPECT_EQ(UQ8().saturating_sub(UQ8::DELTA), UQ8());
+}
+
+TEST(Fixed, Mul) {
+  EXPECT_EQ(parse<Q16>("1.5") * parse<Q16>("-2.25"), parse<Q16>("-3.375"));
+  // The exact product is rounded toward zero.
+  EXPECT_EQ(Q16::DELTA * parse<Q16>("0.5"), Q16());
+  EXPECT_EQ(-Q16::DELTA * parse<Q16>("0.5"), Q16());
+  EXPECT_EQ(parse<Price>("19.99") * parse<Price>("3"), parse<Price>("59.97"));
+  EXPECT_EQ(parse<Price>("0.0001") * parse<Price>("0.5"), Price());
+  auto m = parse<Price>("1.5");
+  m *= parse<Price>("1.5");
+  EXPECT_EQ(m, parse<Price>("2.25"));
+
+  // Products whose bits overflow `I` before rescaling are computed in wider
+  // integers.
+  EXPECT_EQ(Q16::from_int(200) * Q16::from_int(100), Q16::from_int(20000));
+  EXPECT_EQ(Price::from_int(3000000) * Price::from_int(-3000000),
+            Price::from_int(-9000000000000));
+  const auto big = Price::from_int(900000000000000);
+  EXPECT_EQ(big * parse<Price>("0.0001"), Price::from_int(90000000000));
+
+  EXPECT_EQ(Q16::from_int(200).checked_mul(Q16::from_int(200)), sus::None);
+  EXPECT_EQ(Q16::from_int(-256).checked_mul(Q16::from_int(128)).unwrap(),
+            Q16::MIN);
+  EXPECT_EQ(Q16::from_int(200).saturating_mul(Q16::from_int(200)), Q16::MAX);
+  EXPECT_EQ(Q16::from_int(200).saturating_mul(Q16::from_int(-200)), Q16::MIN);
+  // 40000 wraps around 65536 to -25536.
+  EXPECT_EQ(Q16::from_int(200).wrapping_mul(Q16::from_int(200)),
+            Q16::from_int(-25536));
+  EXPECT_EQ(Q16::from_int(200).overflowing_mul(Q16::from_int(200)),
+            (sus::Tuple<Q16, bool>::with(Q16::from_int(-25536), true)));
+  EXPECT_EQ(Q16::from_int(2).overflowing_mul(Q16::from_int(3)),
+            (sus::Tuple<Q16, bool>::with(Q16::from_int(6), false)));
+
+  EXPECT_EQ(Price::MAX.checked_mul(parse<Price>("1.0001")), sus::None);
+  EXPECT_EQ(Price::MAX.saturating_mul(parse<Price>("-2")), Price::MIN);
+  EXPECT_EQ(Price::MAX.checked_mul(parse<Price>("0.5")).unwrap(),
+            Price::from_bits(i64::MAX / 2));
+
+  using UQ32 = Fixed<u64, 32>;
+  const auto u = UQ32::from_int(0xffffffff_u64);
+  EXPECT_EQ(u * parse<UQ32>("0.5"), parse<UQ32>("2147483647.5"));
+  EXPECT_EQ(u.checked_mul(UQ32::from_int(2u)), sus::None);
+  EXPECT_EQ(u.saturating_mul(UQ32::from_int(2u)), UQ32::MAX);
+}
+
+TEST(Fixed, Div) {
+  EXPECT_EQ(Q16::from_int(3) / Q16::from_int(4), parse<Q16>("0.75"));
+  EXPECT_EQ(Q16::from_int(-3) / Q16::from_int(4), parse<Q16>("-0.75"));
+  // The exact quotient is rounded toward zero.
+  EXPECT_EQ(Price::from_int(1) / Price::from_int(3), parse<Price>("0.3333"));
+  EXPECT_EQ(Price::from_int(-2) / Price::from_int(3), parse<Price>("-0.6666"));
+  auto d = Price::from_int(10);
+  d /= Price::from_int(4);
+  EXPECT_EQ(d, parse<Price>("2.5"));
+
+  EXPECT_EQ(Q16::from_int(1).checked_div(Q16()), sus::None);
+  EXPECT_EQ(Q16::from_int(1).checked_div(Q16::DELTA), sus::None);
+  EXPECT_EQ(Q16::MIN.checked_div(Q16::from_int(-1)), sus::None);
+  EXPECT_EQ(Q16::MIN.checked_div(Q16::from_int(2)).unwrap(),
+            Q16::from_int(-16384));
+  EXPECT_EQ(Q16::from_int(1).saturating_div(Q16::DELTA), Q16::MAX);
+  EXPECT_EQ(Q16::from_int(-1).saturating_div(Q16::DELTA), Q16::MIN);
+  EXPECT_EQ(Q16::MIN.overflowing_div(Q16::from_int(-1)),
+            (sus::Tuple<Q16, bool>::with(Q16::MIN, true)));
+  EXPECT_EQ(Q16::MIN.wrapping_div(Q16::from_int(-1)), Q16::MIN);
+
+  // Large dividends are scaled up in wider integers.
+  EXPECT_EQ(Price::MAX / Price::MAX, Price::from_int(1));
+  EXPECT_EQ(Price::from_int(900000000000000) / Price::from_int(3),
+            Price::from_int(300000000000000));
+}
+
+TEST(FixedDeathTest, Overflow) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto x = Q16::MAX + Q16::DELTA;
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = Q16::from_int(200) * Q16::from_int(200);
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = Q16::from_int(1) / Q16();
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = -Q16::MIN;
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = Q16::from_int(40000);
+        ensure_use(&x);
+      },
+      "");
+#endif
+}
+
+TEST(Fixed, ToString) {
+  EXPECT_EQ(Q16().to_string(), sus::String::from("0"));
+  EXPECT_EQ(Q16::from_int(-12).to_string(), sus::String::from("-12"));
+  EXPECT_EQ(Q16::from_bits(0x8000).to_string(), sus::String::from("0.5"));
+  EXPECT_EQ(Q16::from_bits(-0x324000).to_string(), sus::String::from("-50.25"));
+  // Every binary fraction is written exactly.
+  EXPECT_EQ(Q16::DELTA.to_string(), sus::String::from("0.0000152587890625"));
+  EXPECT_EQ(Q16::MAX.to_string(), sus::String::from("32767.9999847412109375"));
+  EXPECT_EQ(Q16::MIN.to_string(), sus::String::from("-32768"));
+  EXPECT_EQ(parse<Q16>("0.1").to_string(),
+            sus::String::from("0.100006103515625"));
+
+  // Decimal fractions stop at their last non-zero digit.
+  EXPECT_EQ(parse<Price>("19.9900").to_string(), sus::String::from("19.99"));
+  EXPECT_EQ(Price::DELTA.to_string(), sus::String::from("0.0001"));
+  EXPECT_EQ(Price::MIN.to_string(), sus::String::from("-922337203685477.5808"));
+  EXPECT_EQ(Price::MAX.to_string(), sus::String::from("922337203685477.5807"));
+
+  // The widest fractions need 128-bit math.
+  using UQ63 = Fixed<u64, 63>;
+  EXPECT_EQ(UQ63::MAX.to_string(),
+            sus::String::from("1.999999999999999999"
+                              "891579782751449556599254719913005828857421875"));
+  using Q63 = Fixed<i64, 63>;
+  EXPECT_EQ(Q63::MIN.to_string(), sus::String::from("-1"));
+  using Atto = Decimal<u64, 18>;
+  EXPECT_EQ(Atto::MAX.to_string(), sus::String::from("18.446744073709551615"));
+  using Cents = Decimal<u8, 2>;
+  EXPECT_EQ(Cents::MAX.to_string(), sus::String::from("2.55"));
+
+  auto buf = sus::Array<u8, 85>();
+  const usize len = Price::MIN.write_to(buf.as_mut_slice());
+  EXPECT_EQ(len, 21u);
+  EXPECT_EQ(buf[0u], uint8_t{'-'});
+  EXPECT_EQ(buf[20u], uint8_t{'8'});
+}
+
+TEST(Fixed, FromStr) {
+  EXPECT_EQ(parse<Q16>("0"), Q16());
+  EXPECT_EQ(parse<Q16>("-0"), Q16());
+  EXPECT_EQ(parse<Q16>("+1.5"), Q16::from_bits(0x18000));
+  EXPECT_EQ(parse<Q16>(".5"), Q16::from_bits(0x8000));
+  EXPECT_EQ(parse<Q16>("2."), Q16::from_int(2));
+  EXPECT_EQ(parse<Q16>("-32768"), Q16::MIN);
+  EXPECT_EQ(parse<Price>("0012.3400000000"), Price::from_bits(123400));
+
+  // Numbers between two values round to the nearest, with ties to even.
+  EXPECT_EQ(parse<Price>("0.00014"), Price::from_bits(1));
+  EXPECT_EQ(parse<Price>("0.00016"), Price::from_bits(2));
+  EXPECT_EQ(parse<Price>("0.00015"), Price::from_bits(2));
+  EXPECT_EQ(parse<Price>("0.00025"), Price::from_bits(2));
+  EXPECT_EQ(parse<Price>("0.000250000000000000000001"), Price::from_bits(3));
+  EXPECT_EQ(parse<Price>("-0.00025"), Price::from_bits(-2));
+  EXPECT_EQ(parse<Price>("-0.00035"), Price::from_bits(-4));
+  EXPECT_EQ(parse<Q16>("0.1"), Q16::from_bits(6554));
+  EXPECT_EQ(parse<Q16>("0.00000762939453125"), Q16());
+  EXPECT_EQ(parse<Q16>("0.00000762939453126"), Q16::DELTA);
+  EXPECT_EQ(parse<Q16>("0.00002288818359375"), Q16::from_bits(2));
+  using Whole = Fixed<u8, 0>;
+  EXPECT_EQ(parse<Whole>("2.5"), Whole::from_int(2u));
+  EXPECT_EQ(parse<Whole>("3.5"), Whole::from_int(4u));
+
+  // Every value round trips through its string.
+  for (i32 bits : {0_i32, 1_i32, -1_i32, 6554_i32, -0x12345_i32, i32::MAX,
+                   i32::MIN}) {
+    const auto f = Q16::from_bits(bits);
+    const auto s = f.to_string();
+    EXPECT_EQ(Q16::from_str(s.as_bytes()).unwrap(), f);
+  }
+  using UQ63 = Fixed<u64, 63>;
+  const auto s = UQ63::MAX.to_string();
+  EXPECT_EQ(UQ63::from_str(s.as_bytes()).unwrap(), UQ63::MAX);
+  using Atto = Decimal<u64, 18>;
+  EXPECT_EQ(parse<Atto>("18.446744073709551615"), Atto::MAX);
+  EXPECT_EQ(parse<Atto>("0.0000000000000000005"), Atto());
+  EXPECT_EQ(parse<Atto>("0.0000000000000000015"), Atto::from_bits(2u));
+}
+
+TEST(Fixed, FromStrErrors) {
+  EXPECT_EQ(parse_err<Price>(""), ParseIntError::Kind::Empty);
+  EXPECT_EQ(parse_err<Price>("-"), ParseIntError::Kind::InvalidDigit);
+  EXPECT_EQ(parse_err<Price>("."), ParseIntError::Kind::InvalidDigit);
+  EXPECT_EQ(parse_err<Price>("1.2.3"), ParseIntError::Kind::InvalidDigit);
+  EXPECT_EQ(parse_err<Price>(" 1"), ParseIntError::Kind::InvalidDigit);
+  EXPECT_EQ(parse_err<Price>("1e5"), ParseIntError::Kind::InvalidDigit);
+  EXPECT_EQ(parse_err<Price>("922337203685477.5808"),
+            ParseIntError::Kind::PosOverflow);
+  EXPECT_EQ(parse_err<Price>("922337203685477.58075"),
+            ParseIntError::Kind::PosOverflow);
+  EXPECT_EQ(parse_err<Price>("1000000000000000"),
+            ParseIntError::Kind::PosOverflow);
+  EXPECT_EQ(parse_err<Price>("99999999999999999999999"),
+            ParseIntError::Kind::PosOverflow);
+  EXPECT_EQ(parse_err<Price>("-922337203685477.5809"),
+            ParseIntError::Kind::NegOverflow);
+  EXPECT_EQ(parse<Price>("922337203685477.58074"), Price::MAX);
+  EXPECT_EQ(parse<Price>("-922337203685477.5808"), Price::MIN);
+
+  using UQ8 = Fixed<u16, 8>;
+  EXPECT_EQ(parse_err<UQ8>("-1"), ParseIntError::Kind::InvalidDigit);
+  EXPECT_EQ(parse_err<UQ8>("256"), ParseIntError::Kind::PosOverflow);
+  EXPECT_EQ(parse<UQ8>("255.998"), UQ8::MAX);
+  EXPECT_EQ(parse_err<UQ8>("255.999"), ParseIntError::Kind::PosOverflow);
+}
+
+}  // namespace
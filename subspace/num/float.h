@@ -29,6 +29,7 @@
 #include "subspace/num/cmath_macros.h"
 #include "subspace/num/float_concepts.h"
 #include "subspace/num/fp_category.h"
+#include "subspace/num/parse_float_error.h"
 #include "subspace/num/signed_integer.h"
 #include "subspace/num/unsigned_integer.h"
 
@@ -14,8 +14,15 @@
 
 #pragma once
 
+#include "subspace/assertions/unreachable.h"
 #include "subspace/containers/array.h"
+#include "subspace/containers/slice.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/__private/parse.h"
+#include "subspace/num/__private/to_chars.h"
 #include "subspace/num/float.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
 
 namespace sus::num {
 
@@ -0,0 +1,306 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <type_traits>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/array.h"
+#include "subspace/fmt/format.h"
+#include "subspace/num/int128.h"
+#include "subspace/prelude.h"
+#include "subspace/string/string.h"
+#include "subspace/test/ensure_use.h"
+#include "subspace/tuple/tuple.h"
+
+namespace {
+
+using sus::None;
+using sus::Option;
+using sus::Tuple;
+
+static_assert(sizeof(i128) == 16);
+static_assert(sus::mem::Copy<i128>);
+static_assert(sus::mem::TrivialCopy<i128>);
+static_assert(sus::mem::relocate_by_memcpy<i128>);
+
+// 2^64, the first positive value that needs the high word.
+constexpr auto kTwo64 = i128::from_words(1_u64, 0_u64);
+
+TEST(i128, Construct) {
+  constexpr i128 a = -5;
+  static_assert(a.hi_word() == u64::MAX);
+  static_assert(a.lo_word() == u64::MAX - 4u);
+  EXPECT_EQ(i128(i64::MIN).hi_word(), u64::MAX);
+  EXPECT_EQ(i128(u64::MAX).hi_word(), 0u);
+  EXPECT_EQ(i128(u64::MAX).lo_word(), u64::MAX);
+  EXPECT_EQ(5_i128, i128(5));
+
+  EXPECT_EQ(i128::MIN.hi_word(), 1_u64 << 63u);
+  EXPECT_EQ(i128::MIN.lo_word(), 0u);
+  EXPECT_EQ(i128::MAX, i128::MIN.wrapping_sub(1));
+  EXPECT_EQ(i128::BITS, 128u);
+
+  EXPECT_EQ(i128::from(-3_i8), i128(-3));
+  EXPECT_EQ(i128::from(u128::MAX >> 1u), i128::MAX);
+  EXPECT_EQ(i128::try_from(u128::MAX).is_err(), true);
+  EXPECT_EQ(i128::try_from(1_u128 << 127u).is_err(), true);
+  EXPECT_EQ(i128::try_from(-7_i64).unwrap(), i128(-7));
+}
+
+TEST(i128, Compare) {
+  EXPECT_LT(i128(-1), i128(0));
+  EXPECT_LT(i128::MIN, i128(i64::MIN));
+  EXPECT_GT(i128::MAX, kTwo64);
+  EXPECT_LT(i128(-1), kTwo64);
+  EXPECT_GT(i128(u64::MAX), i128(i64::MAX));
+}
+
+TEST(i128, Sign) {
+  EXPECT_EQ(i128(-3).is_negative(), true);
+  EXPECT_EQ(i128(0).is_negative(), false);
+  EXPECT_EQ(i128(0).is_positive(), false);
+  EXPECT_EQ(kTwo64.is_positive(), true);
+  EXPECT_EQ(i128::MIN.signum(), i128(-1));
+  EXPECT_EQ(i128(0).signum(), i128(0));
+  EXPECT_EQ(kTwo64.signum(), i128(1));
+
+  EXPECT_EQ(i128(-3).abs(), i128(3));
+  EXPECT_EQ(i128::MIN.checked_abs(), None);
+  EXPECT_EQ(i128::MIN.overflowing_abs(),
+            (Tuple<i128, bool>::with(i128::MIN, true)));
+  EXPECT_EQ(i128::MIN.saturating_abs(), i128::MAX);
+  EXPECT_EQ(i128::MIN.wrapping_abs(), i128::MIN);
+  EXPECT_EQ(i128::MIN.unsigned_abs(), 1_u128 << 127u);
+  EXPECT_EQ(i128::MIN.abs_diff(i128::MAX), u128::MAX);
+  EXPECT_EQ(i128(-5).abs_diff(i128(5)), 10_u128);
+
+  EXPECT_EQ(-kTwo64, i128::from_words(u64::MAX, 0_u64));
+  EXPECT_EQ(i128::MIN.checked_neg(), None);
+  EXPECT_EQ(i128::MIN.saturating_neg(), i128::MAX);
+  EXPECT_EQ(i128::MIN.wrapping_neg(), i128::MIN);
+  EXPECT_EQ(i128::MAX.overflowing_neg(),
+            (Tuple<i128, bool>::with(i128::MIN + 1, false)));
+}
+
+TEST(i128, AddSub) {
+  EXPECT_EQ(i128(i64::MAX) + i128(i64::MAX), i128(u64::MAX - 1u));
+  EXPECT_EQ(i128(-1) + kTwo64, i128(u64::MAX));
+  EXPECT_EQ(i128(0) - kTwo64, -kTwo64);
+  EXPECT_EQ(i128::MAX.checked_add(1), None);
+  EXPECT_EQ(i128::MIN.checked_add(-1), None);
+  EXPECT_EQ(i128::MIN.checked_add(i128::MAX), sus::some(i128(-1)));
+  EXPECT_EQ(i128::MAX.overflowing_add(1),
+            (Tuple<i128, bool>::with(i128::MIN, true)));
+  EXPECT_EQ(i128::MAX.saturating_add(1), i128::MAX);
+  EXPECT_EQ(i128::MIN.saturating_add(-1), i128::MIN);
+  EXPECT_EQ(i128::MAX.wrapping_add(1), i128::MIN);
+
+  EXPECT_EQ(i128::MIN.checked_sub(1), None);
+  EXPECT_EQ(i128::MAX.checked_sub(-1), None);
+  EXPECT_EQ(i128(-1).checked_sub(i128::MAX), sus::some(i128::MIN));
+  EXPECT_EQ(i128::MIN.overflowing_sub(1),
+            (Tuple<i128, bool>::with(i128::MAX, true)));
+  EXPECT_EQ(i128::MIN.saturating_sub(1), i128::MIN);
+  EXPECT_EQ(i128::MAX.saturating_sub(-1), i128::MAX);
+  EXPECT_EQ(i128::MIN.wrapping_sub(1), i128::MAX);
+}
+
+TEST(i128, Mul) {
+  EXPECT_EQ(i128(-3) * i128(4), i128(-12));
+  EXPECT_EQ(i128(i64::MIN) * i128(i64::MIN),
+            i128::from_words(1_u64 << 62u, 0_u64));
+  EXPECT_EQ(kTwo64 * i128(-2), i128::from_words(u64::MAX - 1u, 0_u64));
+  // MIN is reachable from a negative product, but MAX + 1 is not.
+  EXPECT_EQ((-kTwo64).checked_mul(i128(1_u64 << 63u)), sus::some(i128::MIN));
+  EXPECT_EQ(kTwo64.checked_mul(i128(1_u64 << 63u)), None);
+  EXPECT_EQ(i128::MIN.checked_mul(-1), None);
+  EXPECT_EQ(i128::MIN.checked_mul(1), sus::some(i128::MIN));
+  EXPECT_EQ(i128::MAX.overflowing_mul(2),
+            (Tuple<i128, bool>::with(i128(-2), true)));
+  EXPECT_EQ(i128::MAX.saturating_mul(-2), i128::MIN);
+  EXPECT_EQ(i128::MIN.saturating_mul(-2), i128::MAX);
+  EXPECT_EQ(i128::MIN.wrapping_mul(-1), i128::MIN);
+  EXPECT_EQ(i128(-5).checked_mul(0), sus::some(i128(0)));
+}
+
+TEST(i128, DivRem) {
+  // Division rounds towards zero, and the remainder takes the sign of the
+  // dividend.
+  EXPECT_EQ(i128(-7) / i128(2), i128(-3));
+  EXPECT_EQ(i128(-7) % i128(2), i128(-1));
+  EXPECT_EQ(i128(7) / i128(-2), i128(-3));
+  EXPECT_EQ(i128(7) % i128(-2), i128(1));
+  EXPECT_EQ(i128::MIN / kTwo64, i128(i64::MIN));
+  EXPECT_EQ(i128::MIN % kTwo64, i128(0));
+  EXPECT_EQ(i128::MIN.checked_div(-1), None);
+  EXPECT_EQ(i128::MIN.checked_div(0), None);
+  EXPECT_EQ(i128::MIN.checked_rem(-1), None);
+  EXPECT_EQ(i128::MIN.overflowing_div(-1),
+            (Tuple<i128, bool>::with(i128::MIN, true)));
+  EXPECT_EQ(i128::MIN.overflowing_rem(-1),
+            (Tuple<i128, bool>::with(i128(0), true)));
+  EXPECT_EQ(i128::MIN.saturating_div(-1), i128::MAX);
+  EXPECT_EQ(i128::MIN.wrapping_div(-1), i128::MIN);
+  EXPECT_EQ(i128::MIN.wrapping_rem(-1), i128(0));
+}
+
+TEST(i128DeathTest, Overflow) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto x = i128::MAX + i128(1);
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = -i128::MIN;
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = i128::MIN / i128(-1);
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = i128::MIN.abs();
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = i128::from(u128::MAX);
+        ensure_use(&x);
+      },
+      "");
+#endif
+}
+
+TEST(i128, Shift) {
+  EXPECT_EQ(i128(1) << 127u, i128::MIN);
+  EXPECT_EQ(i128::MIN >> 127u, i128(-1));
+  EXPECT_EQ(i128::MIN >> 64u, i128(i64::MIN));
+  EXPECT_EQ(i128(-4) >> 1u, i128(-2));
+  EXPECT_EQ(kTwo64 >> 1u, i128(1_u64 << 63u));
+  EXPECT_EQ(i128(-1).checked_shr(128_u32), None);
+  EXPECT_EQ(i128::MIN.wrapping_shr(255_u32), i128(-1));
+  EXPECT_EQ(i128::MIN.wrapping_shr(191_u32), -kTwo64);
+  EXPECT_EQ(i128(1).overflowing_shl(128_u32),
+            (Tuple<i128, bool>::with(i128(1), true)));
+}
+
+TEST(i128, Pow) {
+  EXPECT_EQ(i128(-2).pow(127_u32), i128::MIN);
+  EXPECT_EQ(i128(2).checked_pow(127_u32), None);
+  EXPECT_EQ(i128(-2).checked_pow(128_u32), None);
+  EXPECT_EQ(i128(-3).saturating_pow(81_u32), i128::MIN);
+  EXPECT_EQ(i128(-3).saturating_pow(82_u32), i128::MAX);
+  EXPECT_EQ(i128(2).wrapping_pow(127_u32), i128::MIN);
+  EXPECT_EQ(i128(-10).pow(3_u32), i128(-1000));
+}
+
+TEST(i128, Bits) {
+  EXPECT_EQ(i128(-1).count_ones(), 128u);
+  EXPECT_EQ(i128::MIN.leading_zeros(), 0u);
+  EXPECT_EQ(i128::MAX.leading_zeros(), 1u);
+  EXPECT_EQ(i128(-1).leading_ones(), 128u);
+  EXPECT_EQ(i128::MIN.trailing_zeros(), 127u);
+  EXPECT_EQ(i128(1).reverse_bits(), i128::MIN);
+  EXPECT_EQ(i128::MIN.rotate_left(1_u32), i128(1));
+  EXPECT_EQ(i128(1).rotate_right(1_u32), i128::MIN);
+  EXPECT_EQ(i128(-1).swap_bytes(), i128(-1));
+  EXPECT_EQ(~i128(0), i128(-1));
+  EXPECT_EQ(i128(-1) & kTwo64, kTwo64);
+  EXPECT_EQ(i128(-1) ^ kTwo64, ~kTwo64);
+}
+
+TEST(i128, Bytes) {
+  const auto x = i128(-2);
+  const auto be = x.to_be_bytes();
+  EXPECT_EQ(be[0u], u8::MAX);
+  EXPECT_EQ(be[15u], 0xfe_u8);
+  const auto le = x.to_le_bytes();
+  EXPECT_EQ(le[0u], 0xfe_u8);
+  EXPECT_EQ(i128::from_be_bytes(be), x);
+  EXPECT_EQ(i128::from_le_bytes(x.to_le_bytes()), x);
+  EXPECT_EQ(i128::from_ne_bytes(i128::MIN.to_ne_bytes()), i128::MIN);
+}
+
+TEST(i128, ToString) {
+  using sus::string::String;
+  EXPECT_EQ(i128(0).to_string(), String::from("0"));
+  EXPECT_EQ(i128(-1).to_string(), String::from("-1"));
+  EXPECT_EQ((-kTwo64).to_string(), String::from("-18446744073709551616"));
+  EXPECT_EQ(i128::MAX.to_string(),
+            String::from("170141183460469231731687303715884105727"));
+  EXPECT_EQ(i128::MIN.to_string(),
+            String::from("-170141183460469231731687303715884105728"));
+  EXPECT_EQ(sus::fmt::format("{}", i128::MIN),
+            String::from("-170141183460469231731687303715884105728"));
+
+  auto buf = sus::Array<u8, 40>();
+  EXPECT_EQ(i128::MIN.write_to(buf.as_mut_slice()), 40u);
+  EXPECT_EQ(buf[0u].primitive_value, '-');
+}
+
+TEST(i128DeathTest, WriteToShortBuffer) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto buf = (sus::Array<u8, 39>());
+        auto x = i128::MIN.write_to(buf.as_mut_slice());
+        ensure_use(&x);
+      },
+      "");
+#endif
+}
+
+TEST(i128, FromStrRadix) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseIntError::Kind;
+  const auto parse = [](Str s, u32 radix = 10u) {
+    return i128::from_str_radix(s.as_bytes(), radix);
+  };
+  EXPECT_EQ(
+      parse(Str::from("-170141183460469231731687303715884105728")).unwrap(),
+      i128::MIN);
+  EXPECT_EQ(
+      parse(Str::from("+170141183460469231731687303715884105727")).unwrap(),
+      i128::MAX);
+  EXPECT_EQ(
+      parse(Str::from("-170141183460469231731687303715884105729"))
+          .unwrap_err()
+          .kind(),
+      Kind::NegOverflow);
+  EXPECT_EQ(
+      parse(Str::from("170141183460469231731687303715884105728"))
+          .unwrap_err()
+          .kind(),
+      Kind::PosOverflow);
+  EXPECT_EQ(parse(Str::from("-")).unwrap_err().kind(), Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("-ff"), 16u).unwrap(), i128(-255));
+  EXPECT_EQ(parse(Str::from("-1" "0000000000000000"), 16u).unwrap(), -kTwo64);
+  // Round-trips through the decimal representation.
+  auto x = i128(-1);
+  for (u32 i = 0u; i < 40u; i += 1u) {
+    const auto s = x.to_string();
+    EXPECT_EQ(parse(s.as_str()).unwrap(), x);
+    x = x.wrapping_mul(i128(7));
+  }
+}
+
+}  // namespace
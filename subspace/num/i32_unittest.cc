@@ -27,6 +27,7 @@
 #include "subspace/ops/ord.h"
 #include "subspace/option/option.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 #include "subspace/tuple/tuple.h"
 #include "subspace/test/ensure_use.h"
 
@@ -2984,4 +2985,57 @@ TEST(i32DeathTest, WrappingRemEuclidOverflow) {
 #endif
 }
 
+TEST(i32, ToString) {
+  EXPECT_EQ((0_i32).to_string(), sus::string::String::from("0"));
+  EXPECT_EQ((9_i32).to_string(), sus::string::String::from("9"));
+  EXPECT_EQ((-9_i32).to_string(), sus::string::String::from("-9"));
+  EXPECT_EQ((-1234_i32).to_string(), sus::string::String::from("-1234"));
+  EXPECT_EQ(i32::MAX.to_string(), sus::string::String::from("2147483647"));
+  EXPECT_EQ(i32::MIN.to_string(), sus::string::String::from("-2147483648"));
+}
+
+TEST(i32, WriteTo) {
+  auto buf = sus::Array<u8, 11>();
+  EXPECT_EQ(i32::MIN.write_to(buf.as_mut_slice()), 11u);
+  EXPECT_EQ(sus::string::Str::from_utf8(buf.as_slice()).unwrap(),
+            sus::string::Str::from("-2147483648"));
+}
+
+TEST(i32DeathTest, WriteToTooShort) {
+  auto buf = sus::Array<u8, 3>();
+#if GTEST_HAS_DEATH_TEST
+  // The sign needs room too.
+  EXPECT_DEATH((-123_i32).write_to(buf.as_mut_slice()), "");
+#endif
+  EXPECT_EQ((-12_i32).write_to(buf.as_mut_slice()), 3u);
+}
+
+TEST(i32, FromStrRadix) {
+  using sus::num::ParseIntError;
+  using sus::string::Str;
+  using Kind = ParseIntError::Kind;
+  const auto parse = [](Str s, u32 radix) {
+    return i32::from_str_radix(s.as_bytes(), radix);
+  };
+  EXPECT_EQ(parse(Str::from("0"), 10u).unwrap(), 0_i32);
+  EXPECT_EQ(parse(Str::from("-0"), 10u).unwrap(), 0_i32);
+  EXPECT_EQ(parse(Str::from("+12"), 10u).unwrap(), 12_i32);
+  EXPECT_EQ(parse(Str::from("-12345678"), 10u).unwrap(), -12345678_i32);
+  EXPECT_EQ(parse(Str::from("2147483647"), 10u).unwrap(), i32::MAX);
+  EXPECT_EQ(parse(Str::from("-2147483648"), 10u).unwrap(), i32::MIN);
+  EXPECT_EQ(parse(Str::from("-7fffffff"), 16u).unwrap(), -i32::MAX);
+
+  EXPECT_EQ(parse(Str::from(""), 10u).unwrap_err().kind(), Kind::Empty);
+  EXPECT_EQ(parse(Str::from("-"), 10u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("--1"), 10u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("2147483648"), 10u).unwrap_err().kind(),
+            Kind::PosOverflow);
+  EXPECT_EQ(parse(Str::from("-2147483649"), 10u).unwrap_err().kind(),
+            Kind::NegOverflow);
+  EXPECT_EQ(parse(Str::from("-9999999999"), 10u).unwrap_err(),
+            ParseIntError(Kind::NegOverflow));
+}
+
 }  // namespace
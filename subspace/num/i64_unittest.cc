@@ -25,6 +25,7 @@
 #include "subspace/ops/eq.h"
 #include "subspace/ops/ord.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 #include "subspace/test/ensure_use.h"
 #include "subspace/tuple/tuple.h"
 
@@ -745,4 +746,25 @@ TEST(i64, InvokeEverything) {
   [[maybe_unused]] auto z = i >= j;
 }
 
+TEST(i64, ToString) {
+  EXPECT_EQ(i64::MAX.to_string(),
+            sus::string::String::from("9223372036854775807"));
+  EXPECT_EQ(i64::MIN.to_string(),
+            sus::string::String::from("-9223372036854775808"));
+}
+
+TEST(i64, FromStrRadix) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseIntError::Kind;
+  const auto parse = [](Str s) {
+    return i64::from_str_radix(s.as_bytes(), 10u);
+  };
+  EXPECT_EQ(parse(Str::from("9223372036854775807")).unwrap(), i64::MAX);
+  EXPECT_EQ(parse(Str::from("-9223372036854775808")).unwrap(), i64::MIN);
+  EXPECT_EQ(parse(Str::from("9223372036854775808")).unwrap_err().kind(),
+            Kind::PosOverflow);
+  EXPECT_EQ(parse(Str::from("-9223372036854775809")).unwrap_err().kind(),
+            Kind::NegOverflow);
+}
+
 }  // namespace
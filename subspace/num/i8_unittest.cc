@@ -24,6 +24,7 @@
 #include "subspace/ops/eq.h"
 #include "subspace/ops/ord.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 #include "subspace/test/ensure_use.h"
 #include "subspace/tuple/tuple.h"
 
@@ -807,4 +808,28 @@ TEST(i8, InvokeEverything) {
   [[maybe_unused]] auto b = i == j;
   [[maybe_unused]] auto z = i >= j;
 }
+TEST(i8, ToString) {
+  EXPECT_EQ((-1_i8).to_string(), sus::string::String::from("-1"));
+  EXPECT_EQ(i8::MAX.to_string(), sus::string::String::from("127"));
+  EXPECT_EQ(i8::MIN.to_string(), sus::string::String::from("-128"));
+}
+
+TEST(i8, FromStrRadix) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseIntError::Kind;
+  EXPECT_EQ(i8::from_str_radix(Str::from("-128").as_bytes(), 10u).unwrap(),
+            i8::MIN);
+  EXPECT_EQ(i8::from_str_radix(Str::from("127").as_bytes(), 10u).unwrap(),
+            i8::MAX);
+  EXPECT_EQ(
+      i8::from_str_radix(Str::from("128").as_bytes(), 10u).unwrap_err().kind(),
+      Kind::PosOverflow);
+  EXPECT_EQ(
+      i8::from_str_radix(Str::from("-129").as_bytes(), 10u).unwrap_err().kind(),
+      Kind::NegOverflow);
+  EXPECT_EQ(
+      i8::from_str_radix(Str::from("200x").as_bytes(), 10u).unwrap_err().kind(),
+      Kind::PosOverflow);
+}
+
 }  // namespace
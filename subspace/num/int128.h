@@ -0,0 +1,1577 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <compare>
+#include <functional>
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/assertions/panic.h"
+#include "subspace/macros/pure.h"
+#include "subspace/num/__private/int128_math.h"
+#include "subspace/num/__private/int_log10.h"
+#include "subspace/num/integer_concepts.h"
+#include "subspace/num/parse_int_error.h"
+#include "subspace/num/signed_integer.h"
+#include "subspace/num/try_from_int_error.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+
+namespace sus::num {
+
+struct i128;
+
+namespace __private::int128 {
+
+/// Sign- or zero-extends any integer of 64 bits or less to 128 bits.
+template <class I>
+  requires(Integer<I> || PrimitiveInteger<I>)
+[[nodiscard]] sus_pure_const constexpr Words from_integer(I i) noexcept {
+  if constexpr (Integer<I>) {
+    return from_integer(i.primitive_value);
+  } else if constexpr (std::is_signed_v<I>) {
+    return from_signed(int64_t{i});
+  } else {
+    return Words{.lo = uint64_t{i}, .hi = 0u};
+  }
+}
+
+}  // namespace __private::int128
+
+/// A 128-bit unsigned integer.
+///
+/// The value is stored as two 64-bit words, and the arithmetic is done with
+/// the compiler's native 128-bit integer where it has one. The API matches
+/// the other unsigned integers, with `checked_`, `overflowing_`,
+/// `saturating_` and `wrapping_` forms of each arithmetic operation.
+///
+/// Unlike the other unsigned integers, there is no `primitive_value` since
+/// not every compiler has a 128-bit primitive. The two words of the value are
+/// available from `hi_word()` and `lo_word()`, and a u128 can be built from
+/// them with `from_words()`.
+struct u128 final {
+ private:
+  using Words = __private::int128::Words;
+
+ public:
+  /// The smallest value that can be represented by this integer type.
+  static const u128 MIN;
+  /// The largest value that can be represented by this integer type.
+  static const u128 MAX;
+  /// The size of this integer type in bits.
+  static const u32 BITS;
+
+  /// Default constructor, which sets the integer to 0.
+  constexpr u128() noexcept = default;
+
+  /// Construction from unsigned types, which always fit.
+  ///
+  /// #[doc.overloads=u128.ctor.unsigned.typed]
+  template <Unsigned U>
+  constexpr u128(U v) noexcept : lo_(uint64_t{v.primitive_value}) {}
+
+  /// Construction from unsigned primitive types, which always fit.
+  ///
+  /// #[doc.overloads=u128.ctor.unsigned.primitive]
+  template <UnsignedPrimitiveInteger P>
+  constexpr u128(P v) noexcept : lo_(uint64_t{v}) {}
+
+  /// Construction from signed types, where it can be checked at compile time
+  /// that the value is not negative.
+  ///
+  /// For runtime conversion, use `from()`.
+  ///
+  /// #[doc.overloads=u128.ctor.signed.typed]
+  template <Signed S>
+  consteval u128(S v) noexcept
+      : lo_(static_cast<uint64_t>(v.primitive_value)) {
+    if (v.primitive_value < decltype(S::primitive_value){0}) {
+      ::sus::panic_with_message(
+          *"Cannot construct unsigned integer from negative value.");
+    }
+  }
+
+  /// Construction from signed primitive types, where it can be checked at
+  /// compile time that the value is not negative.
+  ///
+  /// For runtime conversion, use `from()`.
+  ///
+  /// #[doc.overloads=u128.ctor.signed.primitive]
+  template <SignedPrimitiveInteger P>
+  consteval u128(P v) noexcept : lo_(static_cast<uint64_t>(v)) {
+    if (v < P{0}) {
+      ::sus::panic_with_message(
+          *"Cannot construct unsigned integer from negative value.");
+    }
+  }
+
+  /// Constructs a u128 from its high and low 64-bit words.
+  [[nodiscard]] sus_pure static constexpr u128 from_words(u64 hi,
+                                                          u64 lo) noexcept {
+    return u128(Words{.lo = lo.primitive_value, .hi = hi.primitive_value});
+  }
+  /// Returns the high 64 bits of the value.
+  [[nodiscard]] sus_pure constexpr u64 hi_word() const& noexcept {
+    return hi_;
+  }
+  /// Returns the low 64 bits of the value.
+  [[nodiscard]] sus_pure constexpr u64 lo_word() const& noexcept {
+    return lo_;
+  }
+
+  /// Constructs a u128 from any other integer type.
+  ///
+  /// # Panics
+  /// The function will panic if the input value is negative.
+  ///
+  /// #[doc.overloads=u128.from.integer]
+  template <class I>
+    requires(Integer<I> || PrimitiveInteger<I>)
+  [[nodiscard]] sus_pure static constexpr u128 from(I i) noexcept {
+    const auto w = __private::int128::from_integer(i);
+    ::sus::check(!__private::int128::is_negative(w));
+    return u128(w);
+  }
+  /// #[doc.overloads=u128.from.i128]
+  [[nodiscard]] sus_pure static constexpr u128 from(const i128& i) noexcept;
+
+  /// Tries to construct a u128 from any other integer type.
+  ///
+  /// Returns an error if the input value is negative.
+  ///
+  /// #[doc.overloads=u128.tryfrom.integer]
+  template <class I>
+    requires(Integer<I> || PrimitiveInteger<I>)
+  [[nodiscard]] sus_pure static constexpr ::sus::result::Result<
+      u128, ::sus::num::TryFromIntError>
+  try_from(I i) noexcept {
+    return try_from_words(__private::int128::from_integer(i));
+  }
+  /// #[doc.overloads=u128.tryfrom.i128]
+  [[nodiscard]] sus_pure static constexpr ::sus::result::Result<
+      u128, ::sus::num::TryFromIntError>
+  try_from(const i128& i) noexcept;
+
+  /// sus::ops::Eq<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr bool operator==(
+      const u128& l, const u128& r) noexcept = default;
+  /// sus::ops::Ord<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr std::strong_ordering operator<=>(
+      const u128& l, const u128& r) noexcept {
+    if (l.hi_ != r.hi_) return l.hi_ <=> r.hi_;
+    return l.lo_ <=> r.lo_;
+  }
+
+  /// sus::num::BitNot trait.
+  [[nodiscard]] sus_pure constexpr u128 operator~() const& noexcept {
+    return u128(__private::int128::bit_not(words()));
+  }
+
+  /// sus::num::Add<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator+(
+      const u128& l, const u128& r) noexcept {
+    const auto out = __private::int128::add_with_overflow(l.words(), r.words());
+    ::sus::check(!out.overflow);
+    return u128(out.value);
+  }
+  /// sus::num::Sub<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator-(
+      const u128& l, const u128& r) noexcept {
+    const auto out = __private::int128::sub_with_overflow(l.words(), r.words());
+    ::sus::check(!out.overflow);
+    return u128(out.value);
+  }
+  /// sus::num::Mul<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator*(
+      const u128& l, const u128& r) noexcept {
+    const auto out = __private::int128::mul_with_overflow(l.words(), r.words());
+    ::sus::check(!out.overflow);
+    return u128(out.value);
+  }
+  /// sus::num::Div<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator/(
+      const u128& l, const u128& r) noexcept {
+    ::sus::check(r != u128());
+    return u128(__private::int128::unsigned_div_rem(l.words(), r.words()).quot);
+  }
+  /// sus::num::Rem<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator%(
+      const u128& l, const u128& r) noexcept {
+    ::sus::check(r != u128());
+    return u128(__private::int128::unsigned_div_rem(l.words(), r.words()).rem);
+  }
+  /// sus::num::BitAnd<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator&(
+      const u128& l, const u128& r) noexcept {
+    return u128(Words{.lo = l.lo_ & r.lo_, .hi = l.hi_ & r.hi_});
+  }
+  /// sus::num::BitOr<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator|(
+      const u128& l, const u128& r) noexcept {
+    return u128(Words{.lo = l.lo_ | r.lo_, .hi = l.hi_ | r.hi_});
+  }
+  /// sus::num::BitXor<u128> trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator^(
+      const u128& l, const u128& r) noexcept {
+    return u128(Words{.lo = l.lo_ ^ r.lo_, .hi = l.hi_ ^ r.hi_});
+  }
+  /// sus::num::Shl trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator<<(
+      const u128& l, const u32& r) noexcept {
+    ::sus::check(r < 128u);
+    return u128(__private::int128::shl(l.words(), r.primitive_value));
+  }
+  /// sus::num::Shr trait.
+  [[nodiscard]] friend sus_pure constexpr u128 operator>>(
+      const u128& l, const u32& r) noexcept {
+    ::sus::check(r < 128u);
+    return u128(__private::int128::lshr(l.words(), r.primitive_value));
+  }
+
+  /// sus::num::AddAssign<u128> trait.
+  constexpr void operator+=(const u128& r) & noexcept { *this = *this + r; }
+  /// sus::num::SubAssign<u128> trait.
+  constexpr void operator-=(const u128& r) & noexcept { *this = *this - r; }
+  /// sus::num::MulAssign<u128> trait.
+  constexpr void operator*=(const u128& r) & noexcept { *this = *this * r; }
+  /// sus::num::DivAssign<u128> trait.
+  constexpr void operator/=(const u128& r) & noexcept { *this = *this / r; }
+  /// sus::num::RemAssign<u128> trait.
+  constexpr void operator%=(const u128& r) & noexcept { *this = *this % r; }
+  /// sus::num::BitAndAssign<u128> trait.
+  constexpr void operator&=(const u128& r) & noexcept { *this = *this & r; }
+  /// sus::num::BitOrAssign<u128> trait.
+  constexpr void operator|=(const u128& r) & noexcept { *this = *this | r; }
+  /// sus::num::BitXorAssign<u128> trait.
+  constexpr void operator^=(const u128& r) & noexcept { *this = *this ^ r; }
+  /// sus::num::ShlAssign trait.
+  constexpr void operator<<=(const u32& r) & noexcept { *this = *this << r; }
+  /// sus::num::ShrAssign trait.
+  constexpr void operator>>=(const u32& r) & noexcept { *this = *this >> r; }
+
+  /// Checked integer addition. Computes self + rhs, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_add(
+      const u128& rhs) const& noexcept {
+    return checked(__private::int128::add_with_overflow(words(), rhs.words()));
+  }
+  /// Calculates self + rhs, returning the wrapped sum along with a boolean
+  /// indicating whether an arithmetic overflow occurred.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_add(
+      const u128& rhs) const& noexcept {
+    const auto out = __private::int128::add_with_overflow(words(), rhs.words());
+    return Tuple::with(u128(out.value), out.overflow);
+  }
+  /// Saturating integer addition. Computes self + rhs, saturating at the
+  /// numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr u128 saturating_add(
+      const u128& rhs) const& noexcept {
+    const auto out = __private::int128::add_with_overflow(words(), rhs.words());
+    return out.overflow ? MAX : u128(out.value);
+  }
+  /// Wrapping (modular) addition. Computes self + rhs, wrapping around at the
+  /// boundary of the type.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_add(
+      const u128& rhs) const& noexcept {
+    return u128(
+        __private::int128::add_with_overflow(words(), rhs.words()).value);
+  }
+  /// Calculates `self + rhs + carry`, returning the sum and the carry out.
+  ///
+  /// This can be chained to add integers that are wider than u128.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple carrying_add(
+      const u128& rhs, bool carry) const& noexcept {
+    const auto a = __private::int128::add_with_overflow(words(), rhs.words());
+    const auto b = __private::int128::add_with_overflow(
+        a.value, Words{.lo = carry ? 1u : 0u, .hi = 0u});
+    return Tuple::with(u128(b.value), a.overflow || b.overflow);
+  }
+
+  /// Checked integer subtraction. Computes self - rhs, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_sub(
+      const u128& rhs) const& noexcept {
+    return checked(__private::int128::sub_with_overflow(words(), rhs.words()));
+  }
+  /// Calculates self - rhs, returning the wrapped difference along with a
+  /// boolean indicating whether an arithmetic overflow occurred.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_sub(
+      const u128& rhs) const& noexcept {
+    const auto out = __private::int128::sub_with_overflow(words(), rhs.words());
+    return Tuple::with(u128(out.value), out.overflow);
+  }
+  /// Saturating integer subtraction. Computes self - rhs, saturating at the
+  /// numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr u128 saturating_sub(
+      const u128& rhs) const& noexcept {
+    const auto out = __private::int128::sub_with_overflow(words(), rhs.words());
+    return out.overflow ? MIN : u128(out.value);
+  }
+  /// Wrapping (modular) subtraction. Computes self - rhs, wrapping around at
+  /// the boundary of the type.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_sub(
+      const u128& rhs) const& noexcept {
+    return u128(
+        __private::int128::sub_with_overflow(words(), rhs.words()).value);
+  }
+  /// Calculates `self - rhs - borrow`, returning the difference and the
+  /// borrow out.
+  ///
+  /// This can be chained to subtract integers that are wider than u128.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple borrowing_sub(
+      const u128& rhs, bool borrow) const& noexcept {
+    const auto a = __private::int128::sub_with_overflow(words(), rhs.words());
+    const auto b = __private::int128::sub_with_overflow(
+        a.value, Words{.lo = borrow ? 1u : 0u, .hi = 0u});
+    return Tuple::with(u128(b.value), a.overflow || b.overflow);
+  }
+
+  /// Checked integer multiplication. Computes self * rhs, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_mul(
+      const u128& rhs) const& noexcept {
+    return checked(__private::int128::mul_with_overflow(words(), rhs.words()));
+  }
+  /// Calculates self * rhs, returning the wrapped product along with a
+  /// boolean indicating whether an arithmetic overflow occurred.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_mul(
+      const u128& rhs) const& noexcept {
+    const auto out = __private::int128::mul_with_overflow(words(), rhs.words());
+    return Tuple::with(u128(out.value), out.overflow);
+  }
+  /// Saturating integer multiplication. Computes self * rhs, saturating at
+  /// the numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr u128 saturating_mul(
+      const u128& rhs) const& noexcept {
+    const auto out = __private::int128::mul_with_overflow(words(), rhs.words());
+    return out.overflow ? MAX : u128(out.value);
+  }
+  /// Wrapping (modular) multiplication. Computes self * rhs, wrapping around
+  /// at the boundary of the type.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_mul(
+      const u128& rhs) const& noexcept {
+    return u128(__private::int128::wrapping_mul(words(), rhs.words()));
+  }
+
+  /// Checked integer division. Computes self / rhs, returning None if
+  /// `rhs == 0`.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_div(
+      const u128& rhs) const& noexcept {
+    if (rhs == u128()) [[unlikely]]
+      return Option<u128>::none();
+    else
+      return Option<u128>::some(*this / rhs);
+  }
+  /// Calculates self / rhs. The boolean is always false, as unsigned
+  /// division can not overflow.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_div(
+      const u128& rhs) const& noexcept {
+    return Tuple::with(*this / rhs, false);
+  }
+  /// Saturating integer division. Computes self / rhs, which can not
+  /// overflow for unsigned integers.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  [[nodiscard]] sus_pure constexpr u128 saturating_div(
+      const u128& rhs) const& noexcept {
+    return *this / rhs;
+  }
+  /// Wrapping division. Computes self / rhs, which can not overflow for
+  /// unsigned integers.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_div(
+      const u128& rhs) const& noexcept {
+    return *this / rhs;
+  }
+
+  /// Checked integer remainder. Computes self % rhs, returning None if
+  /// `rhs == 0`.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_rem(
+      const u128& rhs) const& noexcept {
+    if (rhs == u128()) [[unlikely]]
+      return Option<u128>::none();
+    else
+      return Option<u128>::some(*this % rhs);
+  }
+  /// Calculates self % rhs. The boolean is always false, as unsigned
+  /// division can not overflow.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_rem(
+      const u128& rhs) const& noexcept {
+    return Tuple::with(*this % rhs, false);
+  }
+  /// Wrapping remainder. Computes self % rhs, which can not overflow for
+  /// unsigned integers.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_rem(
+      const u128& rhs) const& noexcept {
+    return *this % rhs;
+  }
+
+  /// Checked negation. Computes -self, returning None unless `self == 0`.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_neg() const& noexcept {
+    if (*this == u128())
+      return Option<u128>::some(u128());
+    else
+      return Option<u128>::none();
+  }
+  /// Negates self in a wrapping fashion, returning the wrapped value along
+  /// with a boolean that is true unless `self == 0`.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_neg() const& noexcept {
+    return Tuple::with(wrapping_neg(), *this != u128());
+  }
+  /// Wrapping (modular) negation. Computes `-self`, wrapping around at the
+  /// boundary of the type.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_neg() const& noexcept {
+    return u128(__private::int128::wrapping_neg(words()));
+  }
+
+  /// Checked shift left. Computes `*this << rhs`, returning None if rhs is
+  /// larger than or equal to 128.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_shl(
+      const u32& rhs) const& noexcept {
+    if (rhs >= 128u) [[unlikely]]
+      return Option<u128>::none();
+    else
+      return Option<u128>::some(*this << rhs);
+  }
+  /// Shifts self left by rhs bits, masking rhs to the range 0 to 127. The
+  /// boolean indicates whether rhs was larger than or equal to 128.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_shl(
+      const u32& rhs) const& noexcept {
+    return Tuple::with(wrapping_shl(rhs), rhs >= 128u);
+  }
+  /// Panic-free bitwise shift-left; yields `self << (rhs % 128)`.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_shl(
+      const u32& rhs) const& noexcept {
+    return u128(__private::int128::shl(words(), rhs.primitive_value & 127u));
+  }
+  /// Checked shift right. Computes `*this >> rhs`, returning None if rhs is
+  /// larger than or equal to 128.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_shr(
+      const u32& rhs) const& noexcept {
+    if (rhs >= 128u) [[unlikely]]
+      return Option<u128>::none();
+    else
+      return Option<u128>::some(*this >> rhs);
+  }
+  /// Shifts self right by rhs bits, masking rhs to the range 0 to 127. The
+  /// boolean indicates whether rhs was larger than or equal to 128.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_shr(
+      const u32& rhs) const& noexcept {
+    return Tuple::with(wrapping_shr(rhs), rhs >= 128u);
+  }
+  /// Panic-free bitwise shift-right; yields `self >> (rhs % 128)`.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_shr(
+      const u32& rhs) const& noexcept {
+    return u128(__private::int128::lshr(words(), rhs.primitive_value & 127u));
+  }
+
+  /// Raises self to the power of `exp`, using exponentiation by squaring.
+  ///
+  /// # Panics
+  /// This function will panic if the result overflows.
+  [[nodiscard]] sus_pure constexpr u128 pow(const u32& exp) const& noexcept {
+    const auto out = __private::int128::pow_with_overflow<false>(
+        words(), exp.primitive_value);
+    ::sus::check(!out.overflow);
+    return u128(out.value);
+  }
+  /// Checked exponentiation. Computes `self.pow(exp)`, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_pow(
+      const u32& exp) const& noexcept {
+    return checked(__private::int128::pow_with_overflow<false>(
+        words(), exp.primitive_value));
+  }
+  /// Raises self to the power of `exp`, returning the wrapped result along
+  /// with a boolean indicating whether an overflow happened.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<u128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_pow(
+      const u32& exp) const& noexcept {
+    const auto out = __private::int128::pow_with_overflow<false>(
+        words(), exp.primitive_value);
+    return Tuple::with(u128(out.value), out.overflow);
+  }
+  /// Saturating integer exponentiation. Computes `self.pow(exp)`, saturating
+  /// at the numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr u128 saturating_pow(
+      const u32& exp) const& noexcept {
+    const auto out = __private::int128::pow_with_overflow<false>(
+        words(), exp.primitive_value);
+    return out.overflow ? MAX : u128(out.value);
+  }
+  /// Wrapping (modular) exponentiation. Computes `self.pow(exp)`, wrapping
+  /// around at the boundary of the type.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_pow(
+      const u32& exp) const& noexcept {
+    return u128(__private::int128::pow_with_overflow<false>(
+                    words(), exp.primitive_value)
+                    .value);
+  }
+
+  /// Computes the absolute difference between self and other.
+  [[nodiscard]] sus_pure constexpr u128 abs_diff(
+      const u128& r) const& noexcept {
+    return *this >= r ? wrapping_sub(r) : r.wrapping_sub(*this);
+  }
+
+  /// Returns the number of ones in the binary representation of the current
+  /// value.
+  [[nodiscard]] sus_pure constexpr u32 count_ones() const& noexcept {
+    return __private::int128::count_ones(words());
+  }
+  /// Returns the number of zeros in the binary representation of the current
+  /// value.
+  [[nodiscard]] sus_pure constexpr u32 count_zeros() const& noexcept {
+    return 128u - __private::int128::count_ones(words());
+  }
+  /// Returns the number of leading ones in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 leading_ones() const& noexcept {
+    return (~*this).leading_zeros();
+  }
+  /// Returns the number of leading zeros in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 leading_zeros() const& noexcept {
+    return __private::int128::leading_zeros(words());
+  }
+  /// Returns the number of trailing ones in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 trailing_ones() const& noexcept {
+    return (~*this).trailing_zeros();
+  }
+  /// Returns the number of trailing zeros in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 trailing_zeros() const& noexcept {
+    return __private::int128::trailing_zeros(words());
+  }
+  /// Reverses the order of bits in the integer. The least significant bit
+  /// becomes the most significant bit, second least-significant bit becomes
+  /// second most-significant bit, etc.
+  [[nodiscard]] sus_pure constexpr u128 reverse_bits() const& noexcept {
+    return u128(__private::int128::reverse_bits(words()));
+  }
+  /// Shifts the bits to the left by a specified amount, `n`, wrapping the
+  /// truncated bits to the end of the resulting integer.
+  [[nodiscard]] sus_pure constexpr u128 rotate_left(
+      const u32& n) const& noexcept {
+    return u128(__private::int128::rotate_left(words(), n.primitive_value));
+  }
+  /// Shifts the bits to the right by a specified amount, `n`, wrapping the
+  /// truncated bits to the beginning of the resulting integer.
+  [[nodiscard]] sus_pure constexpr u128 rotate_right(
+      const u32& n) const& noexcept {
+    return u128(__private::int128::rotate_left(
+        words(), 128u - n.primitive_value % 128u));
+  }
+  /// Reverses the byte order of the integer.
+  [[nodiscard]] sus_pure constexpr u128 swap_bytes() const& noexcept {
+    return u128(__private::int128::swap_bytes(words()));
+  }
+
+  /// Returns the base 2 logarithm of the number, rounded down, or None if
+  /// the number is zero.
+  [[nodiscard]] sus_pure constexpr Option<u32> checked_log2() const& noexcept {
+    if (*this == u128())
+      return Option<u32>::none();
+    else
+      return Option<u32>::some(127u - leading_zeros());
+  }
+  /// Returns the base 2 logarithm of the number, rounded down.
+  ///
+  /// # Panics
+  /// When the number is zero the function will panic.
+  [[nodiscard]] sus_pure constexpr u32 log2() const& noexcept {
+    return checked_log2().unwrap();
+  }
+  /// Returns the base 10 logarithm of the number, rounded down, or None if
+  /// the number is zero.
+  [[nodiscard]] sus_pure constexpr Option<u32> checked_log10()
+      const& noexcept {
+    if (*this == u128()) return Option<u32>::none();
+    // Each division by 10^19 leaves a value of 19 fewer digits.
+    constexpr auto kChunk =
+        Words{.lo = __private::int128::kTenToThe19, .hi = 0u};
+    auto w = words();
+    uint32_t log = 0u;
+    while (w.hi != 0u) {
+      w = __private::int128::unsigned_div_rem(w, kChunk).quot;
+      log += 19u;
+    }
+    return Option<u32>::some(log + __private::int_log10::u64(w.lo));
+  }
+  /// Returns the base 10 logarithm of the number, rounded down.
+  ///
+  /// # Panics
+  /// When the number is zero the function will panic.
+  [[nodiscard]] sus_pure constexpr u32 log10() const& noexcept {
+    return checked_log10().unwrap();
+  }
+
+  /// Returns true if and only if self == 2^k for some k.
+  [[nodiscard]] sus_pure constexpr bool is_power_of_two() const& noexcept {
+    return count_ones() == 1u;
+  }
+  /// Returns the smallest power of two greater than or equal to self.
+  ///
+  /// # Panics
+  /// The function panics if the result overflows.
+  [[nodiscard]] sus_pure constexpr u128 next_power_of_two() const& noexcept {
+    return checked_next_power_of_two().unwrap();
+  }
+  /// Returns the smallest power of two greater than or equal to self, or
+  /// None if the result overflows.
+  [[nodiscard]] sus_pure constexpr Option<u128> checked_next_power_of_two()
+      const& noexcept {
+    if (*this <= u128(1u)) return Option<u128>::some(u128(1u));
+    const u32 bits = 128u - (*this - u128(1u)).leading_zeros();
+    if (bits == 128u) return Option<u128>::none();
+    return Option<u128>::some(u128(1u) << bits);
+  }
+  /// Returns the smallest power of two greater than or equal to self, or 0
+  /// if the result overflows.
+  [[nodiscard]] sus_pure constexpr u128 wrapping_next_power_of_two()
+      const& noexcept {
+    return checked_next_power_of_two().unwrap_or_default();
+  }
+
+  /// Converts an integer from big endian to the target's endianness.
+  [[nodiscard]] static sus_pure constexpr u128 from_be(const u128& x) noexcept {
+    if (::sus::assertions::is_big_endian())
+      return x;
+    else
+      return x.swap_bytes();
+  }
+  /// Converts an integer from little endian to the target's endianness.
+  [[nodiscard]] static sus_pure constexpr u128 from_le(const u128& x) noexcept {
+    if (::sus::assertions::is_little_endian())
+      return x;
+    else
+      return x.swap_bytes();
+  }
+  /// Converts self to big endian from the target's endianness.
+  [[nodiscard]] sus_pure constexpr u128 to_be() const& noexcept {
+    return from_be(*this);
+  }
+  /// Converts self to little endian from the target's endianness.
+  [[nodiscard]] sus_pure constexpr u128 to_le() const& noexcept {
+    return from_le(*this);
+  }
+
+  /// Return the memory representation of this integer as a byte array in
+  /// big-endian (network) byte order.
+  [[nodiscard]] sus_pure constexpr ::sus::containers::Array<u8, 16>
+  to_be_bytes() const& noexcept;
+  /// Return the memory representation of this integer as a byte array in
+  /// little-endian byte order.
+  [[nodiscard]] sus_pure constexpr ::sus::containers::Array<u8, 16>
+  to_le_bytes() const& noexcept;
+  /// Return the memory representation of this integer as a byte array in
+  /// native byte order.
+  [[nodiscard]] sus_pure constexpr ::sus::containers::Array<u8, 16>
+  to_ne_bytes() const& noexcept;
+  /// Create an integer value from its representation as a byte array in big
+  /// endian.
+  [[nodiscard]] static sus_pure constexpr u128 from_be_bytes(
+      const ::sus::containers::Array<u8, 16>& bytes) noexcept;
+  /// Create an integer value from its representation as a byte array in
+  /// little endian.
+  [[nodiscard]] static sus_pure constexpr u128 from_le_bytes(
+      const ::sus::containers::Array<u8, 16>& bytes) noexcept;
+  /// Create an integer value from its memory representation as a byte array
+  /// in native endianness.
+  [[nodiscard]] static sus_pure constexpr u128 from_ne_bytes(
+      const ::sus::containers::Array<u8, 16>& bytes) noexcept;
+
+  /// Writes the decimal representation of the integer to the front of `buf`
+  /// and returns the number of bytes written.
+  ///
+  /// No u128 takes more than 39 bytes, so a buffer of that size can hold any
+  /// of them.
+  ///
+  /// # Panics
+  /// Panics if `buf` is shorter than the decimal representation.
+  usize write_to(::sus::containers::SliceMut<u8> buf) const& noexcept;
+  /// Returns the decimal representation of the integer.
+  ::sus::string::String to_string() const& noexcept;
+
+  /// Parses an integer from the digits in `src`, in the given `radix`.
+  ///
+  /// The digits may be preceded by a `+`. Digits past 9 are the letters `a`
+  /// to `z`, in either case. Nothing else is accepted, including whitespace.
+  ///
+  /// # Panics
+  /// Panics if `radix` is not in the range from 2 to 36.
+  static ::sus::result::Result<u128, ::sus::num::ParseIntError> from_str_radix(
+      ::sus::containers::Slice<u8> src, u32 radix) noexcept;
+
+ private:
+  friend struct i128;
+
+  explicit constexpr u128(Words w) noexcept : lo_(w.lo), hi_(w.hi) {}
+  constexpr Words words() const noexcept {
+    return Words{.lo = lo_, .hi = hi_};
+  }
+
+  static constexpr Option<u128> checked(
+      __private::OverflowOut<Words> out) noexcept {
+    if (!out.overflow) [[likely]]
+      return Option<u128>::some(u128(out.value));
+    else
+      return Option<u128>::none();
+  }
+  static constexpr ::sus::result::Result<u128, ::sus::num::TryFromIntError>
+  try_from_words(Words w) noexcept {
+    using R = ::sus::result::Result<u128, ::sus::num::TryFromIntError>;
+    if (__private::int128::is_negative(w)) {
+      return R::with_err(::sus::num::TryFromIntError(
+          ::sus::num::TryFromIntError::Kind::OutOfBounds));
+    }
+    return R::with(u128(w));
+  }
+
+  uint64_t lo_ = 0u;
+  uint64_t hi_ = 0u;
+};
+
+inline constexpr u128 u128::MIN = u128();
+inline constexpr u128 u128::MAX = u128::from_words(u64::MAX, u64::MAX);
+inline constexpr u32 u128::BITS = 128u;
+
+/// A 128-bit signed integer.
+///
+/// The value is stored as two 64-bit words in two's complement, and the
+/// arithmetic is done with the compiler's native 128-bit integer where it has
+/// one. The API matches the other signed integers, with `checked_`,
+/// `overflowing_`, `saturating_` and `wrapping_` forms of each arithmetic
+/// operation.
+///
+/// Unlike the other signed integers, there is no `primitive_value` since not
+/// every compiler has a 128-bit primitive. The two words of the value are
+/// available from `hi_word()` and `lo_word()`, and an i128 can be built from
+/// them with `from_words()`.
+struct i128 final {
+ private:
+  using Words = __private::int128::Words;
+
+ public:
+  /// The smallest value that can be represented by this integer type.
+  static const i128 MIN;
+  /// The largest value that can be represented by this integer type.
+  static const i128 MAX;
+  /// The size of this integer type in bits.
+  static const u32 BITS;
+
+  /// Default constructor, which sets the integer to 0.
+  constexpr i128() noexcept = default;
+
+  /// Construction from any other integer type, which always fits.
+  ///
+  /// #[doc.overloads=i128.ctor.integer]
+  template <class I>
+    requires(Integer<I> || PrimitiveInteger<I>)
+  constexpr i128(I v) noexcept
+      : i128(__private::int128::from_integer(v)) {}
+
+  /// Constructs an i128 from the two's complement bits of its high and low
+  /// 64-bit words.
+  [[nodiscard]] sus_pure static constexpr i128 from_words(u64 hi,
+                                                          u64 lo) noexcept {
+    return i128(Words{.lo = lo.primitive_value, .hi = hi.primitive_value});
+  }
+  /// Returns the high 64 bits of the value's two's complement representation.
+  [[nodiscard]] sus_pure constexpr u64 hi_word() const& noexcept {
+    return hi_;
+  }
+  /// Returns the low 64 bits of the value's two's complement representation.
+  [[nodiscard]] sus_pure constexpr u64 lo_word() const& noexcept {
+    return lo_;
+  }
+
+  /// Constructs an i128 from any other integer type, which always fits.
+  ///
+  /// #[doc.overloads=i128.from.integer]
+  template <class I>
+    requires(Integer<I> || PrimitiveInteger<I>)
+  [[nodiscard]] sus_pure static constexpr i128 from(I i) noexcept {
+    return i128(i);
+  }
+  /// Constructs an i128 from a u128.
+  ///
+  /// # Panics
+  /// The function will panic if the input value is larger than `i128::MAX`.
+  ///
+  /// #[doc.overloads=i128.from.u128]
+  [[nodiscard]] sus_pure static constexpr i128 from(const u128& u) noexcept {
+    ::sus::check(!__private::int128::is_negative(u.words()));
+    return i128(u.words());
+  }
+
+  /// Tries to construct an i128 from any other integer type, which always
+  /// succeeds.
+  ///
+  /// #[doc.overloads=i128.tryfrom.integer]
+  template <class I>
+    requires(Integer<I> || PrimitiveInteger<I>)
+  [[nodiscard]] sus_pure static constexpr ::sus::result::Result<
+      i128, ::sus::num::TryFromIntError>
+  try_from(I i) noexcept {
+    return ::sus::result::Result<i128, ::sus::num::TryFromIntError>::with(
+        i128(i));
+  }
+  /// Tries to construct an i128 from a u128.
+  ///
+  /// Returns an error if the input value is larger than `i128::MAX`.
+  ///
+  /// #[doc.overloads=i128.tryfrom.u128]
+  [[nodiscard]] sus_pure static constexpr ::sus::result::Result<
+      i128, ::sus::num::TryFromIntError>
+  try_from(const u128& u) noexcept {
+    using R = ::sus::result::Result<i128, ::sus::num::TryFromIntError>;
+    if (__private::int128::is_negative(u.words())) {
+      return R::with_err(::sus::num::TryFromIntError(
+          ::sus::num::TryFromIntError::Kind::OutOfBounds));
+    }
+    return R::with(i128(u.words()));
+  }
+
+  /// sus::ops::Eq<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr bool operator==(
+      const i128& l, const i128& r) noexcept = default;
+  /// sus::ops::Ord<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr std::strong_ordering operator<=>(
+      const i128& l, const i128& r) noexcept {
+    if (l.hi_ != r.hi_)
+      return static_cast<int64_t>(l.hi_) <=> static_cast<int64_t>(r.hi_);
+    return l.lo_ <=> r.lo_;
+  }
+
+  /// sus::num::Neg trait.
+  ///
+  /// # Panics
+  /// Panics if the value is `i128::MIN`, as its negation is out of range.
+  [[nodiscard]] sus_pure constexpr i128 operator-() const& noexcept {
+    ::sus::check(*this != MIN);
+    return wrapping_neg();
+  }
+  /// sus::num::BitNot trait.
+  [[nodiscard]] sus_pure constexpr i128 operator~() const& noexcept {
+    return i128(__private::int128::bit_not(words()));
+  }
+
+  /// sus::num::Add<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator+(
+      const i128& l, const i128& r) noexcept {
+    const auto out =
+        __private::int128::signed_add_with_overflow(l.words(), r.words());
+    ::sus::check(!out.overflow);
+    return i128(out.value);
+  }
+  /// sus::num::Sub<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator-(
+      const i128& l, const i128& r) noexcept {
+    const auto out =
+        __private::int128::signed_sub_with_overflow(l.words(), r.words());
+    ::sus::check(!out.overflow);
+    return i128(out.value);
+  }
+  /// sus::num::Mul<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator*(
+      const i128& l, const i128& r) noexcept {
+    const auto out =
+        __private::int128::signed_mul_with_overflow(l.words(), r.words());
+    ::sus::check(!out.overflow);
+    return i128(out.value);
+  }
+  /// sus::num::Div<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator/(
+      const i128& l, const i128& r) noexcept {
+    ::sus::check(r != i128());
+    ::sus::check(l != MIN || r != i128(-1));
+    return i128(__private::int128::signed_div_rem(l.words(), r.words()).quot);
+  }
+  /// sus::num::Rem<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator%(
+      const i128& l, const i128& r) noexcept {
+    ::sus::check(r != i128());
+    ::sus::check(l != MIN || r != i128(-1));
+    return i128(__private::int128::signed_div_rem(l.words(), r.words()).rem);
+  }
+  /// sus::num::BitAnd<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator&(
+      const i128& l, const i128& r) noexcept {
+    return i128(Words{.lo = l.lo_ & r.lo_, .hi = l.hi_ & r.hi_});
+  }
+  /// sus::num::BitOr<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator|(
+      const i128& l, const i128& r) noexcept {
+    return i128(Words{.lo = l.lo_ | r.lo_, .hi = l.hi_ | r.hi_});
+  }
+  /// sus::num::BitXor<i128> trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator^(
+      const i128& l, const i128& r) noexcept {
+    return i128(Words{.lo = l.lo_ ^ r.lo_, .hi = l.hi_ ^ r.hi_});
+  }
+  /// sus::num::Shl trait.
+  [[nodiscard]] friend sus_pure constexpr i128 operator<<(
+      const i128& l, const u32& r) noexcept {
+    ::sus::check(r < 128u);
+    return i128(__private::int128::shl(l.words(), r.primitive_value));
+  }
+  /// sus::num::Shr trait. This is an arithmetic shift, which fills the high
+  /// bits with the sign bit.
+  [[nodiscard]] friend sus_pure constexpr i128 operator>>(
+      const i128& l, const u32& r) noexcept {
+    ::sus::check(r < 128u);
+    return i128(__private::int128::ashr(l.words(), r.primitive_value));
+  }
+
+  /// sus::num::AddAssign<i128> trait.
+  constexpr void operator+=(const i128& r) & noexcept { *this = *this + r; }
+  /// sus::num::SubAssign<i128> trait.
+  constexpr void operator-=(const i128& r) & noexcept { *this = *this - r; }
+  /// sus::num::MulAssign<i128> trait.
+  constexpr void operator*=(const i128& r) & noexcept { *this = *this * r; }
+  /// sus::num::DivAssign<i128> trait.
+  constexpr void operator/=(const i128& r) & noexcept { *this = *this / r; }
+  /// sus::num::RemAssign<i128> trait.
+  constexpr void operator%=(const i128& r) & noexcept { *this = *this % r; }
+  /// sus::num::BitAndAssign<i128> trait.
+  constexpr void operator&=(const i128& r) & noexcept { *this = *this & r; }
+  /// sus::num::BitOrAssign<i128> trait.
+  constexpr void operator|=(const i128& r) & noexcept { *this = *this | r; }
+  /// sus::num::BitXorAssign<i128> trait.
+  constexpr void operator^=(const i128& r) & noexcept { *this = *this ^ r; }
+  /// sus::num::ShlAssign trait.
+  constexpr void operator<<=(const u32& r) & noexcept { *this = *this << r; }
+  /// sus::num::ShrAssign trait.
+  constexpr void operator>>=(const u32& r) & noexcept { *this = *this >> r; }
+
+  /// Returns true if self is negative and false if the number is zero or
+  /// positive.
+  [[nodiscard]] sus_pure constexpr bool is_negative() const& noexcept {
+    return __private::int128::is_negative(words());
+  }
+  /// Returns true if self is positive and false if the number is zero or
+  /// negative.
+  [[nodiscard]] sus_pure constexpr bool is_positive() const& noexcept {
+    return !is_negative() && *this != i128();
+  }
+  /// Returns a number representing sign of the current value: 0 if the
+  /// number is zero, 1 if the number is positive, and -1 if the number is
+  /// negative.
+  [[nodiscard]] sus_pure constexpr i128 signum() const& noexcept {
+    if (is_negative()) return i128(-1);
+    return i128(*this != i128() ? 1 : 0);
+  }
+
+  /// Computes the absolute value of itself.
+  ///
+  /// # Panics
+  /// Panics if the value is `i128::MIN`, as its absolute value is out of
+  /// range.
+  [[nodiscard]] sus_pure constexpr i128 abs() const& noexcept {
+    ::sus::check(*this != MIN);
+    return wrapping_abs();
+  }
+  /// Checked absolute value. Computes `abs()`, returning None if the value is
+  /// `i128::MIN`.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_abs() const& noexcept {
+    if (*this == MIN) [[unlikely]]
+      return Option<i128>::none();
+    else
+      return Option<i128>::some(wrapping_abs());
+  }
+  /// Computes the absolute value of self, returning the wrapped value along
+  /// with a boolean indicating whether an overflow happened, which is only
+  /// for `i128::MIN`.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_abs() const& noexcept {
+    return Tuple::with(wrapping_abs(), *this == MIN);
+  }
+  /// Saturating absolute value. Computes `abs()`, returning `i128::MAX` if
+  /// the value is `i128::MIN`.
+  [[nodiscard]] sus_pure constexpr i128 saturating_abs() const& noexcept {
+    return *this == MIN ? MAX : wrapping_abs();
+  }
+  /// Wrapping (modular) absolute value. Computes `abs()`, wrapping around at
+  /// the boundary of the type.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_abs() const& noexcept {
+    return i128(__private::int128::unsigned_abs(words()));
+  }
+  /// Computes the absolute value of self without any wrapping or panicking.
+  [[nodiscard]] sus_pure constexpr u128 unsigned_abs() const& noexcept {
+    return u128(__private::int128::unsigned_abs(words()));
+  }
+  /// Computes the absolute difference between self and other, which always
+  /// fits in a u128.
+  [[nodiscard]] sus_pure constexpr u128 abs_diff(
+      const i128& r) const& noexcept {
+    // The wrapped difference has the right bits when read as unsigned.
+    if (*this >= r)
+      return u128(__private::int128::sub_with_overflow(words(), r.words())
+                      .value);
+    else
+      return u128(__private::int128::sub_with_overflow(r.words(), words())
+                      .value);
+  }
+
+  /// Checked integer addition. Computes self + rhs, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_add(
+      const i128& rhs) const& noexcept {
+    return checked(
+        __private::int128::signed_add_with_overflow(words(), rhs.words()));
+  }
+  /// Calculates self + rhs, returning the wrapped sum along with a boolean
+  /// indicating whether an arithmetic overflow occurred.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_add(
+      const i128& rhs) const& noexcept {
+    const auto out =
+        __private::int128::signed_add_with_overflow(words(), rhs.words());
+    return Tuple::with(i128(out.value), out.overflow);
+  }
+  /// Saturating integer addition. Computes self + rhs, saturating at the
+  /// numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr i128 saturating_add(
+      const i128& rhs) const& noexcept {
+    const auto out =
+        __private::int128::signed_add_with_overflow(words(), rhs.words());
+    if (!out.overflow) [[likely]]
+      return i128(out.value);
+    // Overflow is in the direction of the operands, which share a sign.
+    return rhs.is_negative() ? MIN : MAX;
+  }
+  /// Wrapping (modular) addition. Computes self + rhs, wrapping around at the
+  /// boundary of the type.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_add(
+      const i128& rhs) const& noexcept {
+    return i128(
+        __private::int128::add_with_overflow(words(), rhs.words()).value);
+  }
+
+  /// Checked integer subtraction. Computes self - rhs, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_sub(
+      const i128& rhs) const& noexcept {
+    return checked(
+        __private::int128::signed_sub_with_overflow(words(), rhs.words()));
+  }
+  /// Calculates self - rhs, returning the wrapped difference along with a
+  /// boolean indicating whether an arithmetic overflow occurred.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_sub(
+      const i128& rhs) const& noexcept {
+    const auto out =
+        __private::int128::signed_sub_with_overflow(words(), rhs.words());
+    return Tuple::with(i128(out.value), out.overflow);
+  }
+  /// Saturating integer subtraction. Computes self - rhs, saturating at the
+  /// numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr i128 saturating_sub(
+      const i128& rhs) const& noexcept {
+    const auto out =
+        __private::int128::signed_sub_with_overflow(words(), rhs.words());
+    if (!out.overflow) [[likely]]
+      return i128(out.value);
+    // Subtracting a negative overflows upward, and a positive downward.
+    return rhs.is_negative() ? MAX : MIN;
+  }
+  /// Wrapping (modular) subtraction. Computes self - rhs, wrapping around at
+  /// the boundary of the type.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_sub(
+      const i128& rhs) const& noexcept {
+    return i128(
+        __private::int128::sub_with_overflow(words(), rhs.words()).value);
+  }
+
+  /// Checked integer multiplication. Computes self * rhs, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_mul(
+      const i128& rhs) const& noexcept {
+    return checked(
+        __private::int128::signed_mul_with_overflow(words(), rhs.words()));
+  }
+  /// Calculates self * rhs, returning the wrapped product along with a
+  /// boolean indicating whether an arithmetic overflow occurred.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_mul(
+      const i128& rhs) const& noexcept {
+    const auto out =
+        __private::int128::signed_mul_with_overflow(words(), rhs.words());
+    return Tuple::with(i128(out.value), out.overflow);
+  }
+  /// Saturating integer multiplication. Computes self * rhs, saturating at
+  /// the numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr i128 saturating_mul(
+      const i128& rhs) const& noexcept {
+    const auto out =
+        __private::int128::signed_mul_with_overflow(words(), rhs.words());
+    if (!out.overflow) [[likely]]
+      return i128(out.value);
+    return is_negative() != rhs.is_negative() ? MIN : MAX;
+  }
+  /// Wrapping (modular) multiplication. Computes self * rhs, wrapping around
+  /// at the boundary of the type.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_mul(
+      const i128& rhs) const& noexcept {
+    return i128(__private::int128::wrapping_mul(words(), rhs.words()));
+  }
+
+  /// Checked integer division. Computes self / rhs, returning None if
+  /// `rhs == 0` or the division results in overflow.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_div(
+      const i128& rhs) const& noexcept {
+    if (rhs == i128() || (*this == MIN && rhs == i128(-1))) [[unlikely]]
+      return Option<i128>::none();
+    else
+      return Option<i128>::some(*this / rhs);
+  }
+  /// Calculates self / rhs, returning the wrapped quotient along with a
+  /// boolean indicating whether an arithmetic overflow occurred, which is
+  /// only for `i128::MIN / -1`.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_div(
+      const i128& rhs) const& noexcept {
+    if (*this == MIN && rhs == i128(-1)) [[unlikely]]
+      return Tuple::with(MIN, true);
+    return Tuple::with(*this / rhs, false);
+  }
+  /// Saturating integer division. Computes self / rhs, saturating at the
+  /// numeric bounds instead of overflowing.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  [[nodiscard]] sus_pure constexpr i128 saturating_div(
+      const i128& rhs) const& noexcept {
+    if (*this == MIN && rhs == i128(-1)) [[unlikely]]
+      return MAX;
+    return *this / rhs;
+  }
+  /// Wrapping (modular) division. Computes self / rhs, wrapping around at the
+  /// boundary of the type, which is only for `i128::MIN / -1`.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_div(
+      const i128& rhs) const& noexcept {
+    if (*this == MIN && rhs == i128(-1)) [[unlikely]]
+      return MIN;
+    return *this / rhs;
+  }
+
+  /// Checked integer remainder. Computes self % rhs, returning None if
+  /// `rhs == 0` or the division results in overflow.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_rem(
+      const i128& rhs) const& noexcept {
+    if (rhs == i128() || (*this == MIN && rhs == i128(-1))) [[unlikely]]
+      return Option<i128>::none();
+    else
+      return Option<i128>::some(*this % rhs);
+  }
+  /// Calculates self % rhs, returning the remainder along with a boolean
+  /// indicating whether the division would overflow, which is only for
+  /// `i128::MIN % -1`, where the remainder is 0.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_rem(
+      const i128& rhs) const& noexcept {
+    if (*this == MIN && rhs == i128(-1)) [[unlikely]]
+      return Tuple::with(i128(), true);
+    return Tuple::with(*this % rhs, false);
+  }
+  /// Wrapping (modular) remainder. Computes self % rhs, which is 0 for
+  /// `i128::MIN % -1`.
+  ///
+  /// # Panics
+  /// This function will panic if rhs is 0.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_rem(
+      const i128& rhs) const& noexcept {
+    if (*this == MIN && rhs == i128(-1)) [[unlikely]]
+      return i128();
+    return *this % rhs;
+  }
+
+  /// Checked negation. Computes -self, returning None if `self == MIN`.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_neg() const& noexcept {
+    if (*this == MIN) [[unlikely]]
+      return Option<i128>::none();
+    else
+      return Option<i128>::some(wrapping_neg());
+  }
+  /// Negates self, returning the wrapped value along with a boolean
+  /// indicating whether an overflow happened, which is only for
+  /// `i128::MIN`.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_neg() const& noexcept {
+    return Tuple::with(wrapping_neg(), *this == MIN);
+  }
+  /// Saturating integer negation. Computes -self, returning `i128::MAX` if
+  /// `self == MIN` instead of overflowing.
+  [[nodiscard]] sus_pure constexpr i128 saturating_neg() const& noexcept {
+    return *this == MIN ? MAX : wrapping_neg();
+  }
+  /// Wrapping (modular) negation. Computes -self, wrapping around at the
+  /// boundary of the type.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_neg() const& noexcept {
+    return i128(__private::int128::wrapping_neg(words()));
+  }
+
+  /// Checked shift left. Computes `*this << rhs`, returning None if rhs is
+  /// larger than or equal to 128.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_shl(
+      const u32& rhs) const& noexcept {
+    if (rhs >= 128u) [[unlikely]]
+      return Option<i128>::none();
+    else
+      return Option<i128>::some(*this << rhs);
+  }
+  /// Shifts self left by rhs bits, masking rhs to the range 0 to 127. The
+  /// boolean indicates whether rhs was larger than or equal to 128.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_shl(
+      const u32& rhs) const& noexcept {
+    return Tuple::with(wrapping_shl(rhs), rhs >= 128u);
+  }
+  /// Panic-free bitwise shift-left; yields `self << (rhs % 128)`.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_shl(
+      const u32& rhs) const& noexcept {
+    return i128(__private::int128::shl(words(), rhs.primitive_value & 127u));
+  }
+  /// Checked shift right. Computes `*this >> rhs`, returning None if rhs is
+  /// larger than or equal to 128.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_shr(
+      const u32& rhs) const& noexcept {
+    if (rhs >= 128u) [[unlikely]]
+      return Option<i128>::none();
+    else
+      return Option<i128>::some(*this >> rhs);
+  }
+  /// Shifts self right by rhs bits, masking rhs to the range 0 to 127. The
+  /// boolean indicates whether rhs was larger than or equal to 128.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_shr(
+      const u32& rhs) const& noexcept {
+    return Tuple::with(wrapping_shr(rhs), rhs >= 128u);
+  }
+  /// Panic-free bitwise shift-right; yields `self >> (rhs % 128)`.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_shr(
+      const u32& rhs) const& noexcept {
+    return i128(__private::int128::ashr(words(), rhs.primitive_value & 127u));
+  }
+
+  /// Raises self to the power of `exp`, using exponentiation by squaring.
+  ///
+  /// # Panics
+  /// This function will panic if the result overflows.
+  [[nodiscard]] sus_pure constexpr i128 pow(const u32& exp) const& noexcept {
+    const auto out = __private::int128::pow_with_overflow<true>(
+        words(), exp.primitive_value);
+    ::sus::check(!out.overflow);
+    return i128(out.value);
+  }
+  /// Checked exponentiation. Computes `self.pow(exp)`, returning None if
+  /// overflow occurred.
+  [[nodiscard]] sus_pure constexpr Option<i128> checked_pow(
+      const u32& exp) const& noexcept {
+    return checked(__private::int128::pow_with_overflow<true>(
+        words(), exp.primitive_value));
+  }
+  /// Raises self to the power of `exp`, returning the wrapped result along
+  /// with a boolean indicating whether an overflow happened.
+  template <int&..., class Tuple = ::sus::tuple_type::Tuple<i128, bool>>
+  [[nodiscard]] sus_pure constexpr Tuple overflowing_pow(
+      const u32& exp) const& noexcept {
+    const auto out = __private::int128::pow_with_overflow<true>(
+        words(), exp.primitive_value);
+    return Tuple::with(i128(out.value), out.overflow);
+  }
+  /// Saturating integer exponentiation. Computes `self.pow(exp)`, saturating
+  /// at the numeric bounds instead of overflowing.
+  [[nodiscard]] sus_pure constexpr i128 saturating_pow(
+      const u32& exp) const& noexcept {
+    const auto out = __private::int128::pow_with_overflow<true>(
+        words(), exp.primitive_value);
+    if (!out.overflow) [[likely]]
+      return i128(out.value);
+    // The result is only negative for a negative base and an odd exponent.
+    return is_negative() && (exp.primitive_value & 1u) != 0u ? MIN : MAX;
+  }
+  /// Wrapping (modular) exponentiation. Computes `self.pow(exp)`, wrapping
+  /// around at the boundary of the type.
+  [[nodiscard]] sus_pure constexpr i128 wrapping_pow(
+      const u32& exp) const& noexcept {
+    return i128(__private::int128::pow_with_overflow<true>(
+                    words(), exp.primitive_value)
+                    .value);
+  }
+
+  /// Returns the number of ones in the binary representation of the current
+  /// value.
+  [[nodiscard]] sus_pure constexpr u32 count_ones() const& noexcept {
+    return __private::int128::count_ones(words());
+  }
+  /// Returns the number of zeros in the binary representation of the current
+  /// value.
+  [[nodiscard]] sus_pure constexpr u32 count_zeros() const& noexcept {
+    return 128u - __private::int128::count_ones(words());
+  }
+  /// Returns the number of leading ones in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 leading_ones() const& noexcept {
+    return (~*this).leading_zeros();
+  }
+  /// Returns the number of leading zeros in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 leading_zeros() const& noexcept {
+    return __private::int128::leading_zeros(words());
+  }
+  /// Returns the number of trailing ones in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 trailing_ones() const& noexcept {
+    return (~*this).trailing_zeros();
+  }
+  /// Returns the number of trailing zeros in the binary representation of the
+  /// current value.
+  [[nodiscard]] sus_pure constexpr u32 trailing_zeros() const& noexcept {
+    return __private::int128::trailing_zeros(words());
+  }
+  /// Reverses the order of bits in the integer. The least significant bit
+  /// becomes the most significant bit, second least-significant bit becomes
+  /// second most-significant bit, etc.
+  [[nodiscard]] sus_pure constexpr i128 reverse_bits() const& noexcept {
+    return i128(__private::int128::reverse_bits(words()));
+  }
+  /// Shifts the bits to the left by a specified amount, `n`, wrapping the
+  /// truncated bits to the end of the resulting integer.
+  [[nodiscard]] sus_pure constexpr i128 rotate_left(
+      const u32& n) const& noexcept {
+    return i128(__private::int128::rotate_left(words(), n.primitive_value));
+  }
+  /// Shifts the bits to the right by a specified amount, `n`, wrapping the
+  /// truncated bits to the beginning of the resulting integer.
+  [[nodiscard]] sus_pure constexpr i128 rotate_right(
+      const u32& n) const& noexcept {
+    return i128(__private::int128::rotate_left(
+        words(), 128u - n.primitive_value % 128u));
+  }
+  /// Reverses the byte order of the integer.
+  [[nodiscard]] sus_pure constexpr i128 swap_bytes() const& noexcept {
+    return i128(__private::int128::swap_bytes(words()));
+  }
+
+  /// Converts an integer from big endian to the target's endianness.
+  [[nodiscard]] static sus_pure constexpr i128 from_be(const i128& x) noexcept {
+    if (::sus::assertions::is_big_endian())
+      return x;
+    else
+      return x.swap_bytes();
+  }
+  /// Converts an integer from little endian to the target's endianness.
+  [[nodiscard]] static sus_pure constexpr i128 from_le(const i128& x) noexcept {
+    if (::sus::assertions::is_little_endian())
+      return x;
+    else
+      return x.swap_bytes();
+  }
+  /// Converts self to big endian from the target's endianness.
+  [[nodiscard]] sus_pure constexpr i128 to_be() const& noexcept {
+    return from_be(*this);
+  }
+  /// Converts self to little endian from the target's endianness.
+  [[nodiscard]] sus_pure constexpr i128 to_le() const& noexcept {
+    return from_le(*this);
+  }
+
+  /// Return the memory representation of this integer as a byte array in
+  /// big-endian (network) byte order.
+  [[nodiscard]] sus_pure constexpr ::sus::containers::Array<u8, 16>
+  to_be_bytes() const& noexcept;
+  /// Return the memory representation of this integer as a byte array in
+  /// little-endian byte order.
+  [[nodiscard]] sus_pure constexpr ::sus::containers::Array<u8, 16>
+  to_le_bytes() const& noexcept;
+  /// Return the memory representation of this integer as a byte array in
+  /// native byte order.
+  [[nodiscard]] sus_pure constexpr ::sus::containers::Array<u8, 16>
+  to_ne_bytes() const& noexcept;
+  /// Create an integer value from its representation as a byte array in big
+  /// endian.
+  [[nodiscard]] static sus_pure constexpr i128 from_be_bytes(
+      const ::sus::containers::Array<u8, 16>& bytes) noexcept;
+  /// Create an integer value from its representation as a byte array in
+  /// little endian.
+  [[nodiscard]] static sus_pure constexpr i128 from_le_bytes(
+      const ::sus::containers::Array<u8, 16>& bytes) noexcept;
+  /// Create an integer value from its memory representation as a byte array
+  /// in native endianness.
+  [[nodiscard]] static sus_pure constexpr i128 from_ne_bytes(
+      const ::sus::containers::Array<u8, 16>& bytes) noexcept;
+
+  /// Writes the decimal representation of the integer to the front of `buf`
+  /// and returns the number of bytes written.
+  ///
+  /// No i128 takes more than 40 bytes, so a buffer of that size can hold any
+  /// of them.
+  ///
+  /// # Panics
+  /// Panics if `buf` is shorter than the decimal representation.
+  usize write_to(::sus::containers::SliceMut<u8> buf) const& noexcept;
+  /// Returns the decimal representation of the integer.
+  ::sus::string::String to_string() const& noexcept;
+
+  /// Parses an integer from the digits in `src`, in the given `radix`.
+  ///
+  /// The digits may be preceded by a `+` or `-`. Digits past 9 are the
+  /// letters `a` to `z`, in either case. Nothing else is accepted, including
+  /// whitespace.
+  ///
+  /// # Panics
+  /// Panics if `radix` is not in the range from 2 to 36.
+  static ::sus::result::Result<i128, ::sus::num::ParseIntError> from_str_radix(
+      ::sus::containers::Slice<u8> src, u32 radix) noexcept;
+
+ private:
+  friend struct u128;
+
+  explicit constexpr i128(Words w) noexcept : lo_(w.lo), hi_(w.hi) {}
+  constexpr Words words() const noexcept {
+    return Words{.lo = lo_, .hi = hi_};
+  }
+
+  static constexpr Option<i128> checked(
+      __private::OverflowOut<Words> out) noexcept {
+    if (!out.overflow) [[likely]]
+      return Option<i128>::some(i128(out.value));
+    else
+      return Option<i128>::none();
+  }
+
+  uint64_t lo_ = 0u;
+  uint64_t hi_ = 0u;
+};
+
+inline constexpr i128 i128::MIN = i128::from_words(
+    u64(uint64_t{1u} << 63u), u64(0u));
+inline constexpr i128 i128::MAX = i128::from_words(
+    u64(~uint64_t{0u} >> 1u), u64::MAX);
+inline constexpr u32 i128::BITS = 128u;
+
+constexpr u128 u128::from(const i128& i) noexcept {
+  ::sus::check(!i.is_negative());
+  return u128(i.words());
+}
+
+constexpr ::sus::result::Result<u128, ::sus::num::TryFromIntError>
+u128::try_from(const i128& i) noexcept {
+  return try_from_words(i.words());
+}
+
+}  // namespace sus::num
+
+namespace std {
+template <>
+struct hash<::sus::num::u128> {
+  [[nodiscard]] sus_pure auto operator()(
+      const ::sus::num::u128& u) const noexcept {
+    // Mixes the high word in with an odd multiplier so that values which
+    // differ only in the high word don't collide.
+    return std::hash<uint64_t>()(
+        u.lo_word().primitive_value ^
+        (u.hi_word().primitive_value * uint64_t{0x9e3779b97f4a7c15u}));
+  }
+};
+template <>
+struct equal_to<::sus::num::u128> {
+  [[nodiscard]] sus_pure constexpr auto operator()(
+      const ::sus::num::u128& l, const ::sus::num::u128& r) const noexcept {
+    return l == r;
+  }
+};
+template <>
+struct hash<::sus::num::i128> {
+  [[nodiscard]] sus_pure auto operator()(
+      const ::sus::num::i128& i) const noexcept {
+    return std::hash<uint64_t>()(
+        i.lo_word().primitive_value ^
+        (i.hi_word().primitive_value * uint64_t{0x9e3779b97f4a7c15u}));
+  }
+};
+template <>
+struct equal_to<::sus::num::i128> {
+  [[nodiscard]] sus_pure constexpr auto operator()(
+      const ::sus::num::i128& l, const ::sus::num::i128& r) const noexcept {
+    return l == r;
+  }
+};
+}  // namespace std
+
+#if _MSC_VER && !defined(__clang__)
+// A `constexpr` workaround for the MSVC bug described in `literals.h`.
+inline constexpr ::sus::num::u128 operator""_u128(
+    unsigned long long val) noexcept {
+  return ::sus::num::u128(val);
+}
+inline constexpr ::sus::num::i128 operator""_i128(
+    unsigned long long val) noexcept {
+  return ::sus::num::i128(val);
+}
+#else
+/// Literal integer value. Every integer literal fits in a u128.
+inline consteval ::sus::num::u128 operator""_u128(unsigned long long val) {
+  return ::sus::num::u128(val);
+}
+/// Literal integer value. Every integer literal fits in an i128.
+inline consteval ::sus::num::i128 operator""_i128(unsigned long long val) {
+  return ::sus::num::i128(val);
+}
+#endif
+
+// Promote 128-bit integer types into the `sus` namespace.
+namespace sus {
+using sus::num::i128;
+using sus::num::u128;
+}  // namespace sus
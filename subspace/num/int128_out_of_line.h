@@ -0,0 +1,277 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/assertions/endian.h"
+#include "subspace/assertions/unreachable.h"
+#include "subspace/containers/array.h"
+#include "subspace/containers/slice.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/__private/parse.h"
+#include "subspace/num/int128.h"
+#include "subspace/num/unsigned_integer_out_of_line.h"
+#include "subspace/ptr/copy.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
+
+namespace sus::num {
+
+namespace __private::int128 {
+
+/// Returns the bytes of the 128-bit integer with words `hi` and `lo` in
+/// native byte order.
+constexpr ::sus::containers::Array<u8, 16> to_ne_bytes(u64 hi,
+                                                       u64 lo) noexcept {
+  const bool little = ::sus::assertions::is_little_endian();
+  const auto first = (little ? lo : hi).to_ne_bytes();
+  const auto second = (little ? hi : lo).to_ne_bytes();
+  auto bytes = ::sus::containers::Array<u8, 16>();
+  for (auto i = size_t{0}; i < 8u; ++i) {
+    bytes[i] = first[i];
+    bytes[i + 8u] = second[i];
+  }
+  return bytes;
+}
+
+/// Reads the words of a 128-bit integer from `bytes` in native byte order.
+constexpr Words from_ne_bytes(
+    const ::sus::containers::Array<u8, 16>& bytes) noexcept {
+  auto first = ::sus::containers::Array<u8, 8>();
+  auto second = ::sus::containers::Array<u8, 8>();
+  for (auto i = size_t{0}; i < 8u; ++i) {
+    first[i] = bytes[i];
+    second[i] = bytes[i + 8u];
+  }
+  const uint64_t a = u64::from_ne_bytes(first).primitive_value;
+  const uint64_t b = u64::from_ne_bytes(second).primitive_value;
+  if (::sus::assertions::is_little_endian())
+    return Words{.lo = a, .hi = b};
+  else
+    return Words{.lo = b, .hi = a};
+}
+
+/// Parses the digits in `p[0..n]` in `radix` into `out`, failing if the value
+/// is larger than `limit`.
+///
+/// The digits are parsed in chunks that fit in 64 bits, which are then
+/// accumulated with 128-bit math, so there is one 128-bit multiply per 19
+/// decimal digits.
+inline parse::IntStatus parse_digits(const uint8_t* p, size_t n,
+                                     uint32_t radix, Words limit,
+                                     Words& out) noexcept {
+  if (n == 0u) return parse::IntStatus::InvalidDigit;
+  // The largest number of digits whose value always fits in 64 bits.
+  uint32_t chunk_digits = 0u;
+  uint64_t chunk_scale = 1u;
+  while (chunk_scale <= ~uint64_t{0u} / radix) {
+    chunk_scale *= radix;
+    chunk_digits += 1u;
+  }
+  auto acc = kZero;
+  size_t i = 0u;
+  while (i < n) {
+    const size_t len = n - i < chunk_digits ? n - i : chunk_digits;
+    uint64_t chunk = 0u;
+    // The chunk can't overflow, so every digit of it is safe to accumulate
+    // without checks.
+    const auto status = parse::parse_digits(p + i, len, radix, ~uint64_t{0u},
+                                            len, chunk);
+    if (status != parse::IntStatus::Ok) return status;
+    uint64_t scale = chunk_scale;
+    if (len < chunk_digits) {
+      scale = 1u;
+      for (size_t d = 0u; d < len; ++d) scale *= radix;
+    }
+    const auto mul = mul_with_overflow(acc, Words{.lo = scale, .hi = 0u});
+    const auto add = add_with_overflow(mul.value, Words{.lo = chunk, .hi = 0u});
+    if (mul.overflow || add.overflow || unsigned_lt(limit, add.value))
+      return parse::IntStatus::Overflow;
+    acc = add.value;
+    i += len;
+  }
+  out = acc;
+  return parse::IntStatus::Ok;
+}
+
+/// Copies the decimal representation in `bytes[0..len]` to the front of
+/// `buf`.
+inline usize write_to(const uint8_t* bytes, uint32_t len,
+                      ::sus::containers::SliceMut<u8> buf) noexcept {
+  ::sus::check(size_t{buf.len()} >= len);
+  ::sus::ptr::copy_nonoverlapping(::sus::marker::unsafe_fn,
+                                  reinterpret_cast<const u8*>(bytes),
+                                  buf.as_mut_ptr(), usize::from(len));
+  return usize::from(len);
+}
+
+/// Makes a `String` from the decimal representation in `bytes[0..len]`.
+inline ::sus::string::String to_string(const uint8_t* bytes,
+                                       uint32_t len) noexcept {
+  const auto str = ::sus::string::Str::from_utf8_unchecked(
+      ::sus::marker::unsafe_fn,
+      ::sus::containers::Slice<u8>::from_raw_parts(
+          ::sus::marker::unsafe_fn, reinterpret_cast<const u8*>(bytes),
+          usize::from(len)));
+  return ::sus::string::String::from(str);
+}
+
+}  // namespace __private::int128
+
+constexpr ::sus::containers::Array<u8, 16> u128::to_be_bytes() const& noexcept {
+  return to_be().to_ne_bytes();
+}
+
+constexpr ::sus::containers::Array<u8, 16> u128::to_le_bytes() const& noexcept {
+  return to_le().to_ne_bytes();
+}
+
+constexpr ::sus::containers::Array<u8, 16> u128::to_ne_bytes() const& noexcept {
+  return __private::int128::to_ne_bytes(hi_word(), lo_word());
+}
+
+constexpr u128 u128::from_be_bytes(
+    const ::sus::containers::Array<u8, 16>& bytes) noexcept {
+  return from_be(from_ne_bytes(bytes));
+}
+
+constexpr u128 u128::from_le_bytes(
+    const ::sus::containers::Array<u8, 16>& bytes) noexcept {
+  return from_le(from_ne_bytes(bytes));
+}
+
+constexpr u128 u128::from_ne_bytes(
+    const ::sus::containers::Array<u8, 16>& bytes) noexcept {
+  return u128(__private::int128::from_ne_bytes(bytes));
+}
+
+inline usize u128::write_to(
+    ::sus::containers::SliceMut<u8> buf) const& noexcept {
+  uint8_t bytes[__private::int128::kMaxLen];
+  const uint32_t len = __private::int128::write_integer(words(), false, bytes);
+  return __private::int128::write_to(bytes, len, buf);
+}
+
+inline ::sus::string::String u128::to_string() const& noexcept {
+  uint8_t bytes[__private::int128::kMaxLen];
+  const uint32_t len = __private::int128::write_integer(words(), false, bytes);
+  return __private::int128::to_string(bytes, len);
+}
+
+inline ::sus::result::Result<u128, ::sus::num::ParseIntError>
+u128::from_str_radix(::sus::containers::Slice<u8> src, u32 radix) noexcept {
+  ::sus::check(radix >= 2u && radix <= 36u);
+  namespace parse = ::sus::num::__private::parse;
+  using R = ::sus::result::Result<u128, ::sus::num::ParseIntError>;
+  using Kind = ::sus::num::ParseIntError::Kind;
+  auto p = reinterpret_cast<const uint8_t*>(src.as_ptr());
+  auto n = size_t{src.len()};
+  if (n == 0u) return R::with_err(::sus::num::ParseIntError(Kind::Empty));
+  if (p[0u] == '+') {
+    p += 1u;
+    n -= 1u;
+  }
+  auto value = __private::int128::kZero;
+  switch (__private::int128::parse_digits(p, n, radix.primitive_value,
+                                          __private::int128::kUnsignedMax,
+                                          value)) {
+    case parse::IntStatus::Ok: return R::with(u128(value));
+    case parse::IntStatus::Empty:
+      return R::with_err(::sus::num::ParseIntError(Kind::Empty));
+    case parse::IntStatus::InvalidDigit:
+      return R::with_err(::sus::num::ParseIntError(Kind::InvalidDigit));
+    case parse::IntStatus::Overflow:
+      return R::with_err(::sus::num::ParseIntError(Kind::PosOverflow));
+  }
+  ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);
+}
+
+constexpr ::sus::containers::Array<u8, 16> i128::to_be_bytes() const& noexcept {
+  return to_be().to_ne_bytes();
+}
+
+constexpr ::sus::containers::Array<u8, 16> i128::to_le_bytes() const& noexcept {
+  return to_le().to_ne_bytes();
+}
+
+constexpr ::sus::containers::Array<u8, 16> i128::to_ne_bytes() const& noexcept {
+  return __private::int128::to_ne_bytes(hi_word(), lo_word());
+}
+
+constexpr i128 i128::from_be_bytes(
+    const ::sus::containers::Array<u8, 16>& bytes) noexcept {
+  return from_be(from_ne_bytes(bytes));
+}
+
+constexpr i128 i128::from_le_bytes(
+    const ::sus::containers::Array<u8, 16>& bytes) noexcept {
+  return from_le(from_ne_bytes(bytes));
+}
+
+constexpr i128 i128::from_ne_bytes(
+    const ::sus::containers::Array<u8, 16>& bytes) noexcept {
+  return i128(__private::int128::from_ne_bytes(bytes));
+}
+
+inline usize i128::write_to(
+    ::sus::containers::SliceMut<u8> buf) const& noexcept {
+  uint8_t bytes[__private::int128::kMaxLen];
+  const uint32_t len = __private::int128::write_integer(
+      __private::int128::unsigned_abs(words()), is_negative(), bytes);
+  return __private::int128::write_to(bytes, len, buf);
+}
+
+inline ::sus::string::String i128::to_string() const& noexcept {
+  uint8_t bytes[__private::int128::kMaxLen];
+  const uint32_t len = __private::int128::write_integer(
+      __private::int128::unsigned_abs(words()), is_negative(), bytes);
+  return __private::int128::to_string(bytes, len);
+}
+
+inline ::sus::result::Result<i128, ::sus::num::ParseIntError>
+i128::from_str_radix(::sus::containers::Slice<u8> src, u32 radix) noexcept {
+  ::sus::check(radix >= 2u && radix <= 36u);
+  namespace parse = ::sus::num::__private::parse;
+  using R = ::sus::result::Result<i128, ::sus::num::ParseIntError>;
+  using Kind = ::sus::num::ParseIntError::Kind;
+  auto p = reinterpret_cast<const uint8_t*>(src.as_ptr());
+  auto n = size_t{src.len()};
+  if (n == 0u) return R::with_err(::sus::num::ParseIntError(Kind::Empty));
+  bool negative = false;
+  if (p[0u] == '+' || p[0u] == '-') {
+    negative = p[0u] == '-';
+    p += 1u;
+    n -= 1u;
+  }
+  // The magnitude of MIN is one more than MAX.
+  const auto limit = negative ? __private::int128::kSignedMin
+                              : __private::int128::kSignedMax;
+  auto value = __private::int128::kZero;
+  switch (__private::int128::parse_digits(p, n, radix.primitive_value, limit,
+                                          value)) {
+    case parse::IntStatus::Ok:
+      return R::with(
+          i128(negative ? __private::int128::wrapping_neg(value) : value));
+    case parse::IntStatus::Empty:
+      return R::with_err(::sus::num::ParseIntError(Kind::Empty));
+    case parse::IntStatus::InvalidDigit:
+      return R::with_err(::sus::num::ParseIntError(Kind::InvalidDigit));
+    case parse::IntStatus::Overflow:
+      return R::with_err(::sus::num::ParseIntError(
+          negative ? Kind::NegOverflow : Kind::PosOverflow));
+  }
+  ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);
+}
+
+}  // namespace sus::num
@@ -0,0 +1,111 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+
+#include "subspace/assertions/check.h"
+#include "subspace/macros/pure.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/never_value.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/integer_concepts.h"
+#include "subspace/num/signed_integer.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/eq.h"
+#include "subspace/ops/ord.h"
+#include "subspace/option/option.h"
+
+namespace sus::num {
+
+/// An integer that is known not to equal zero.
+///
+/// This enables some memory layout optimization. For example,
+/// `Option<NonZero<u32>>` is the same size as `u32`, as the zero value is used
+/// to represent `None`.
+///
+/// The NonZero type is trivially copyable and moveable.
+template <Integer T>
+class [[sus_trivial_abi]] NonZero final {
+ public:
+  /// Constructs a `NonZero<T>` if the given value is not zero, or returns
+  /// None if it is.
+  static constexpr inline ::sus::option::Option<NonZero> with(
+      T value) noexcept {
+    if (value != T()) [[likely]]
+      return ::sus::option::Option<NonZero>::some(NonZero(value));
+    else
+      return ::sus::option::Option<NonZero>::none();
+  }
+
+  /// Constructs a `NonZero<T>` without checking if the value is zero.
+  ///
+  /// # Safety
+  /// This method must not be called with a zero value, or Undefined Behaviour
+  /// results.
+  static constexpr inline NonZero with_unchecked(::sus::marker::UnsafeFnMarker,
+                                                 T value) noexcept {
+    return NonZero(value);
+  }
+
+  /// sus::construct::From<NonZero<T>, T> trait.
+  ///
+  /// # Panics
+  /// The method will panic if the value is zero.
+  static constexpr inline NonZero from(T value) noexcept {
+    ::sus::check(value != T());
+    return NonZero(value);
+  }
+
+  /// NonZero<T> is copyable, so this is the copy constructor.
+  constexpr NonZero(const NonZero&) noexcept = default;
+  /// NonZero<T> is copyable, so this is the copy assignment operator.
+  constexpr NonZero& operator=(const NonZero&) noexcept = default;
+
+  /// Returns the value as its integer type.
+  sus_pure constexpr inline T get() const noexcept { return value_; }
+
+ private:
+  explicit constexpr inline NonZero(T value) noexcept : value_(value) {}
+
+  T value_;
+
+  // Declare that this type can always be trivially relocated for library
+  // optimizations.
+  sus_class_trivially_relocatable_unchecked(::sus::marker::unsafe_fn);
+  // Declare that the `value_` field is never set to zero for library
+  // optimizations.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, NonZero, value_, T(),
+                              T());
+  constexpr NonZero() = default;  // For the NeverValueField.
+};
+
+/// sus::ops::Eq<NonZero<T>> trait.
+template <class T, class U>
+  requires(::sus::ops::Eq<T, U>)
+constexpr inline bool operator==(const NonZero<T>& l,
+                                 const NonZero<U>& r) noexcept {
+  return l.get() == r.get();
+}
+
+/// sus::ops::Ord<NonZero<T>> trait.
+template <class T, class U>
+  requires(::sus::ops::Ord<T, U>)
+constexpr inline auto operator<=>(const NonZero<T>& l,
+                                  const NonZero<U>& r) noexcept {
+  return l.get() <=> r.get();
+}
+
+}  // namespace sus::num
@@ -0,0 +1,105 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/num/nonzero.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/construct/into.h"
+#include "subspace/mem/never_value.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/types.h"
+#include "subspace/option/option.h"
+#include "subspace/prelude.h"
+
+using sus::num::NonZero;
+
+static_assert(sus::mem::relocate_by_memcpy<NonZero<u32>>);
+
+static_assert(sus::mem::NeverValueField<NonZero<u8>>);
+static_assert(sizeof(sus::Option<NonZero<u8>>) == sizeof(u8));
+static_assert(sizeof(sus::Option<NonZero<u16>>) == sizeof(u16));
+static_assert(sizeof(sus::Option<NonZero<u32>>) == sizeof(u32));
+static_assert(sizeof(sus::Option<NonZero<u64>>) == sizeof(u64));
+static_assert(sizeof(sus::Option<NonZero<usize>>) == sizeof(usize));
+static_assert(sizeof(sus::Option<NonZero<i8>>) == sizeof(i8));
+static_assert(sizeof(sus::Option<NonZero<i16>>) == sizeof(i16));
+static_assert(sizeof(sus::Option<NonZero<i32>>) == sizeof(i32));
+static_assert(sizeof(sus::Option<NonZero<i64>>) == sizeof(i64));
+static_assert(sizeof(sus::Option<NonZero<isize>>) == sizeof(isize));
+
+namespace {
+
+TEST(NonZero, With) {
+  constexpr auto n = NonZero<u32>::with(3u);
+  static_assert(n.is_some());
+  static_assert(n.as_ref().unwrap().get() == 3u);
+
+  EXPECT_EQ(NonZero<u32>::with(0u), sus::None);
+  EXPECT_EQ(NonZero<u32>::with(1u).unwrap().get(), 1u);
+  EXPECT_EQ(NonZero<i32>::with(0), sus::None);
+  EXPECT_EQ(NonZero<i32>::with(-1).unwrap().get(), -1);
+  EXPECT_EQ(NonZero<u8>::with(u8::MAX).unwrap().get(), u8::MAX);
+}
+
+TEST(NonZero, WithUnchecked) {
+  auto n = NonZero<u64>::with_unchecked(unsafe_fn, 7u);
+  EXPECT_EQ(n.get(), 7u);
+}
+
+TEST(NonZero, From) {
+  static_assert(sus::construct::From<NonZero<u32>, u32>);
+  NonZero<u32> n = sus::into(2_u32);
+  EXPECT_EQ(n.get(), 2u);
+}
+
+TEST(NonZeroDeathTest, FromZero) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH([[maybe_unused]] auto n = NonZero<u32>::from(0u), "");
+#endif
+}
+
+TEST(NonZero, Copy) {
+  auto a = NonZero<i16>::from(5);
+  auto b = a;
+  EXPECT_EQ(a, b);
+  b = NonZero<i16>::from(6);
+  EXPECT_EQ(b.get(), 6);
+}
+
+TEST(NonZero, Eq) {
+  static_assert(sus::ops::Eq<NonZero<u32>>);
+  EXPECT_EQ(NonZero<u32>::from(1u), NonZero<u32>::from(1u));
+  EXPECT_NE(NonZero<u32>::from(1u), NonZero<u32>::from(2u));
+}
+
+TEST(NonZero, Ord) {
+  static_assert(sus::ops::Ord<NonZero<i32>>);
+  EXPECT_LT(NonZero<i32>::from(-1), NonZero<i32>::from(1));
+  EXPECT_GT(NonZero<i32>::from(3), NonZero<i32>::from(2));
+}
+
+TEST(NonZero, Option) {
+  auto o = sus::Option<NonZero<u32>>::none();
+  EXPECT_EQ(o, sus::None);
+  o.insert(NonZero<u32>::from(4u));
+  EXPECT_EQ(o, sus::Some);
+  EXPECT_EQ(o.as_ref().unwrap().get(), 4u);
+  EXPECT_EQ(o.take().unwrap().get(), 4u);
+  EXPECT_EQ(o, sus::None);
+
+  constexpr auto c = sus::Option<NonZero<u32>>::some(NonZero<u32>::from(9u));
+  static_assert(c.is_some());
+}
+
+}  // namespace
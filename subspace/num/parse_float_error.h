@@ -0,0 +1,57 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "subspace/assertions/unreachable.h"
+#include "subspace/macros/pure.h"
+
+namespace sus::num {
+
+/// The error type returned when parsing a floating point number from a string
+/// fails, such as from `f64::from_str()`.
+class ParseFloatError {
+ public:
+  /// The type of error which occured.
+  enum class Kind {
+    /// The string was empty.
+    Empty,
+    /// The string was not a valid floating point number.
+    Invalid,
+  };
+
+  /// Constructs a ParseFloatError with a `kind`.
+  explicit constexpr ParseFloatError(Kind kind) : kind_(kind) {}
+
+  /// Returns the type of error which occured.
+  [[nodiscard]] sus_pure constexpr Kind kind() const noexcept { return kind_; }
+
+  [[nodiscard]] sus_pure constexpr std::string to_string() const noexcept {
+    switch (kind_) {
+      case Kind::Empty:
+        return std::string("cannot parse float from empty string");
+      case Kind::Invalid: return std::string("invalid float literal");
+    }
+    ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);
+  }
+
+  constexpr bool operator==(const ParseFloatError&) const noexcept = default;
+
+ private:
+  Kind kind_;
+};
+
+}  // namespace sus::num
@@ -0,0 +1,67 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "subspace/assertions/unreachable.h"
+#include "subspace/macros/pure.h"
+
+namespace sus::num {
+
+/// The error type returned when parsing an integer from a string fails, such
+/// as from `u32::from_str_radix()`.
+class ParseIntError {
+ public:
+  /// The type of error which occured.
+  enum class Kind {
+    /// The string was empty.
+    Empty,
+    /// The string contained a character which is not a digit in the radix,
+    /// or was only a sign.
+    InvalidDigit,
+    /// The value was too large to be stored in the target type.
+    PosOverflow,
+    /// The value was too small to be stored in the target type.
+    NegOverflow,
+  };
+
+  /// Constructs a ParseIntError with a `kind`.
+  explicit constexpr ParseIntError(Kind kind) : kind_(kind) {}
+
+  /// Returns the type of error which occured.
+  [[nodiscard]] sus_pure constexpr Kind kind() const noexcept { return kind_; }
+
+  [[nodiscard]] sus_pure constexpr std::string to_string() const noexcept {
+    switch (kind_) {
+      case Kind::Empty:
+        return std::string("cannot parse integer from empty string");
+      case Kind::InvalidDigit:
+        return std::string("invalid digit found in string");
+      case Kind::PosOverflow:
+        return std::string("number too large to fit in target type");
+      case Kind::NegOverflow:
+        return std::string("number too small to fit in target type");
+    }
+    ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);
+  }
+
+  constexpr bool operator==(const ParseIntError&) const noexcept = default;
+
+ private:
+  Kind kind_;
+};
+
+}  // namespace sus::num
@@ -30,6 +30,7 @@
 #include "subspace/num/__private/literals.h"
 #include "subspace/num/__private/signed_integer_macros.h"
 #include "subspace/num/integer_concepts.h"
+#include "subspace/num/parse_int_error.h"
 #include "subspace/num/try_from_int_error.h"
 #include "subspace/num/unsigned_integer.h"
 #include "subspace/option/option.h"
@@ -38,8 +39,6 @@
 
 namespace sus::num {
 
-// TODO: from_str_radix(). Need Result type and Errors.
-
 // TODO: div_ceil() and div_floor()? Lots of discussion still on
 // https://github.com/rust-lang/rust/issues/88581 for signed types.
 
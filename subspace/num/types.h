@@ -16,6 +16,8 @@
 
 #include "subspace/num/float.h"
 #include "subspace/num/float_out_of_line.h"
+#include "subspace/num/int128.h"
+#include "subspace/num/int128_out_of_line.h"
 #include "subspace/num/signed_integer.h"
 #include "subspace/num/signed_integer_out_of_line.h"
 #include "subspace/num/unsigned_integer.h"
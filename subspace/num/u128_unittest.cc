@@ -0,0 +1,372 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <type_traits>
+#include <unordered_set>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/array.h"
+#include "subspace/fmt/format.h"
+#include "subspace/num/int128.h"
+#include "subspace/prelude.h"
+#include "subspace/string/string.h"
+#include "subspace/test/ensure_use.h"
+#include "subspace/tuple/tuple.h"
+
+namespace {
+
+using sus::None;
+using sus::Option;
+using sus::Tuple;
+
+static_assert(sizeof(u128) == 16);
+static_assert(sus::mem::Copy<u128>);
+static_assert(sus::mem::TrivialCopy<u128>);
+static_assert(sus::mem::relocate_by_memcpy<u128>);
+static_assert(std::is_trivially_copy_constructible_v<u128>);
+static_assert(std::is_trivially_destructible_v<u128>);
+
+// 2^64, the first value that needs the high word.
+constexpr auto kTwo64 = u128::from_words(1_u64, 0_u64);
+
+TEST(u128, Construct) {
+  constexpr u128 a = 5_u32;
+  static_assert(a.lo_word() == 5u && a.hi_word() == 0u);
+  constexpr u128 b = 7;
+  static_assert(b == 7_u128);
+  EXPECT_EQ(u128(u64::MAX).lo_word(), u64::MAX);
+  EXPECT_EQ(u128(u64::MAX).hi_word(), 0u);
+
+  EXPECT_EQ(u128::MIN, 0_u128);
+  EXPECT_EQ(u128::MAX.hi_word(), u64::MAX);
+  EXPECT_EQ(u128::MAX.lo_word(), u64::MAX);
+  EXPECT_EQ(u128::BITS, 128u);
+
+  EXPECT_EQ(u128::from(3_i32), 3_u128);
+  EXPECT_EQ(u128::from(i128::MAX), u128::MAX >> 1u);
+  EXPECT_EQ(u128::try_from(-1_i64).is_err(), true);
+  EXPECT_EQ(u128::try_from(i128(-1)).is_err(), true);
+  EXPECT_EQ(u128::try_from(size_t{9}).unwrap(), 9_u128);
+}
+
+TEST(u128DeathTest, FromOutOfRange) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto x = u128::from(-1_i32);
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = u128::from(i128(-1));
+        ensure_use(&x);
+      },
+      "");
+#endif
+}
+
+TEST(u128, Compare) {
+  EXPECT_LT(u128(u64::MAX), kTwo64);
+  EXPECT_GT(kTwo64, u128(u64::MAX));
+  EXPECT_LT(u128::from_words(1_u64, 5_u64), u128::from_words(2_u64, 0_u64));
+  EXPECT_EQ(kTwo64, u128(u64::MAX) + 1u);
+  EXPECT_NE(kTwo64, 1_u128);
+}
+
+TEST(u128, Add) {
+  EXPECT_EQ(u128(u64::MAX) + u128(u64::MAX),
+            u128::from_words(1_u64, u64::MAX - 1u));
+  EXPECT_EQ(u128::MAX.checked_add(1_u128), None);
+  EXPECT_EQ(kTwo64.checked_add(1_u128), sus::some(kTwo64 + 1u));
+  EXPECT_EQ(u128::MAX.overflowing_add(2_u128),
+            (Tuple<u128, bool>::with(1_u128, true)));
+  EXPECT_EQ(u128::MAX.saturating_add(2_u128), u128::MAX);
+  EXPECT_EQ(u128::MAX.wrapping_add(2_u128), 1_u128);
+
+  // Chains a 256-bit addition.
+  const auto lo = u128::MAX.carrying_add(1_u128, false);
+  const auto hi = (1_u128).carrying_add(2_u128, lo.at<1>());
+  EXPECT_EQ(lo, (Tuple<u128, bool>::with(0_u128, true)));
+  EXPECT_EQ(hi, (Tuple<u128, bool>::with(4_u128, false)));
+
+  auto x = 1_u128;
+  x += u128(u64::MAX);
+  EXPECT_EQ(x, kTwo64);
+}
+
+TEST(u128, Sub) {
+  EXPECT_EQ(kTwo64 - 1u, u128(u64::MAX));
+  EXPECT_EQ((0_u128).checked_sub(1_u128), None);
+  EXPECT_EQ((0_u128).overflowing_sub(1_u128),
+            (Tuple<u128, bool>::with(u128::MAX, true)));
+  EXPECT_EQ((0_u128).saturating_sub(1_u128), 0_u128);
+  EXPECT_EQ((0_u128).wrapping_sub(1_u128), u128::MAX);
+  EXPECT_EQ((0_u128).borrowing_sub(0_u128, true),
+            (Tuple<u128, bool>::with(u128::MAX, true)));
+  EXPECT_EQ(kTwo64.abs_diff(1_u128), u128(u64::MAX));
+  EXPECT_EQ((1_u128).abs_diff(kTwo64), u128(u64::MAX));
+}
+
+TEST(u128, Mul) {
+  EXPECT_EQ(u128(u64::MAX) * u128(u64::MAX),
+            u128::from_words(u64::MAX - 1u, 1_u64));
+  EXPECT_EQ(kTwo64.checked_mul(kTwo64), None);
+  EXPECT_EQ(kTwo64.checked_mul(u128(u64::MAX)),
+            sus::some(u128::from_words(u64::MAX, 0_u64)));
+  // Only the cross product overflows.
+  EXPECT_EQ(u128::from_words(2_u64, 0_u64).checked_mul(u128(1_u64 << 63u)),
+            None);
+  // Only the carry from the low product into the high word overflows.
+  EXPECT_EQ(u128::from_words(u64::MAX, u64::MAX).checked_mul(1_u128),
+            sus::some(u128::MAX));
+  EXPECT_EQ(u128::from_words(u64::MAX, 1_u64).checked_mul(u128(u64::MAX)),
+            None);
+  EXPECT_EQ(u128::MAX.overflowing_mul(2_u128),
+            (Tuple<u128, bool>::with(u128::MAX - 1u, true)));
+  EXPECT_EQ(u128::MAX.saturating_mul(2_u128), u128::MAX);
+  EXPECT_EQ(u128::MAX.wrapping_mul(u128::MAX), 1_u128);
+}
+
+TEST(u128, DivRem) {
+  const auto big = u128::from_words(123456789_u64, 987654321_u64);
+  EXPECT_EQ(big / 1_u128, big);
+  EXPECT_EQ(big / big, 1_u128);
+  EXPECT_EQ(big % big, 0_u128);
+  EXPECT_EQ((big * 10u + 7u) / 10u, big);
+  EXPECT_EQ((big * 10u + 7u) % 10u, 7_u128);
+  EXPECT_EQ(u128::MAX / kTwo64, u128(u64::MAX));
+  EXPECT_EQ(u128::MAX % kTwo64, u128(u64::MAX));
+  EXPECT_EQ(big.checked_div(0_u128), None);
+  EXPECT_EQ(big.checked_rem(0_u128), None);
+  EXPECT_EQ(big.checked_div(2_u128), sus::some(big >> 1u));
+  EXPECT_EQ(big.overflowing_div(big), (Tuple<u128, bool>::with(1_u128, false)));
+}
+
+// The two-word multiplication and division are only used by compilers without
+// a native 128-bit integer, so they are checked against the native ones here.
+#if !_MSC_VER
+TEST(u128, PortableMulDivRem) {
+  namespace int128 = sus::num::__private::int128;
+  using int128::Words;
+  const Words values[] = {
+      int128::kZero,
+      int128::kOne,
+      Words{.lo = 2u, .hi = 0u},
+      Words{.lo = 10u, .hi = 0u},
+      Words{.lo = 0xfedcba9876543210u, .hi = 0u},
+      Words{.lo = ~uint64_t{0u}, .hi = 0u},
+      Words{.lo = 0u, .hi = 1u},
+      Words{.lo = 1u, .hi = 1u},
+      Words{.lo = 0x0123456789abcdefu, .hi = 0x00000000deadbeefu},
+      Words{.lo = 0x8000000000000000u, .hi = 0x7fffffffffffffffu},
+      int128::kSignedMin,
+      Words{.lo = 1u, .hi = 0x8000000000000000u},
+      Words{.lo = 0x0123456789abcdefu, .hi = 0xfedcba9876543210u},
+      Words{.lo = ~uint64_t{0u} - 1u, .hi = ~uint64_t{0u}},
+      int128::kUnsignedMax,
+  };
+  for (const Words& l : values) {
+    for (const Words& r : values) {
+      EXPECT_EQ(int128::portable_wrapping_mul(l, r),
+                int128::from_native(int128::to_native(l) *
+                                    int128::to_native(r)));
+      if (r == int128::kZero) continue;
+      const auto out = int128::portable_unsigned_div_rem(l, r);
+      EXPECT_EQ(out.quot, int128::from_native(int128::to_native(l) /
+                                              int128::to_native(r)));
+      EXPECT_EQ(out.rem, int128::from_native(int128::to_native(l) %
+                                             int128::to_native(r)));
+    }
+  }
+}
+#endif
+
+TEST(u128DeathTest, Overflow) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto x = u128::MAX + 1_u128;
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = 0_u128 - 1_u128;
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = kTwo64 * kTwo64;
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = kTwo64 / 0_u128;
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = kTwo64 << 128_u32;
+        ensure_use(&x);
+      },
+      "");
+#endif
+}
+
+TEST(u128, Shift) {
+  EXPECT_EQ(1_u128 << 64u, kTwo64);
+  EXPECT_EQ(1_u128 << 127u, u128::from_words(1_u64 << 63u, 0_u64));
+  EXPECT_EQ(kTwo64 >> 64u, 1_u128);
+  EXPECT_EQ(u128::MAX >> 127u, 1_u128);
+  EXPECT_EQ(u128::from_words(1_u64, 1_u64 << 63u) >> 63u, 3_u128);
+  EXPECT_EQ(u128::from_words(0_u64, 3_u64 << 62u) << 1u,
+            u128::from_words(1_u64, 1_u64 << 63u));
+  EXPECT_EQ(kTwo64.checked_shl(128_u32), None);
+  EXPECT_EQ(kTwo64.checked_shr(1_u32), sus::some(1_u128 << 63u));
+  EXPECT_EQ(kTwo64.wrapping_shl(129_u32), kTwo64 << 1u);
+  EXPECT_EQ(kTwo64.overflowing_shr(129_u32),
+            (Tuple<u128, bool>::with(1_u128 << 63u, true)));
+}
+
+TEST(u128, Pow) {
+  EXPECT_EQ((2_u128).pow(64_u32), kTwo64);
+  EXPECT_EQ((10_u128).pow(38_u32),
+            u128::from_str_radix(
+                sus::string::Str::from("1" "00000000000000000000"
+                                       "000000000000000000")
+                    .as_bytes(),
+                10u)
+                .unwrap());
+  EXPECT_EQ((2_u128).checked_pow(128_u32), None);
+  EXPECT_EQ((2_u128).checked_pow(127_u32), sus::some(1_u128 << 127u));
+  EXPECT_EQ((3_u128).overflowing_pow(81_u32),
+            (Tuple<u128, bool>::with((3_u128).wrapping_pow(81_u32), true)));
+  EXPECT_EQ((3_u128).saturating_pow(81_u32), u128::MAX);
+  EXPECT_EQ((2_u128).wrapping_pow(128_u32), 0_u128);
+  EXPECT_EQ((7_u128).pow(0_u32), 1_u128);
+}
+
+TEST(u128, Bits) {
+  EXPECT_EQ(u128::MAX.count_ones(), 128u);
+  EXPECT_EQ(kTwo64.count_ones(), 1u);
+  EXPECT_EQ(kTwo64.count_zeros(), 127u);
+  EXPECT_EQ(kTwo64.leading_zeros(), 63u);
+  EXPECT_EQ(kTwo64.trailing_zeros(), 64u);
+  EXPECT_EQ((0_u128).leading_zeros(), 128u);
+  EXPECT_EQ((0_u128).trailing_zeros(), 128u);
+  EXPECT_EQ(u128::MAX.leading_ones(), 128u);
+  EXPECT_EQ((7_u128).trailing_ones(), 3u);
+  EXPECT_EQ((1_u128).reverse_bits(), 1_u128 << 127u);
+  EXPECT_EQ((1_u128).rotate_right(1_u32), 1_u128 << 127u);
+  EXPECT_EQ((1_u128 << 127u).rotate_left(1_u32), 1_u128);
+  EXPECT_EQ((1_u128).rotate_left(128_u32), 1_u128);
+  EXPECT_EQ((0xff_u128).swap_bytes(), u128::from_words(0xff_u64 << 56u, 0_u64));
+  EXPECT_EQ(kTwo64.is_power_of_two(), true);
+  EXPECT_EQ((kTwo64 + 1u).next_power_of_two(), kTwo64 << 1u);
+  EXPECT_EQ(u128::MAX.checked_next_power_of_two(), None);
+  EXPECT_EQ(kTwo64.log2(), 64u);
+  EXPECT_EQ(u128::MAX.log10(), 38u);
+  EXPECT_EQ((999_u128).log10(), 2u);
+  EXPECT_EQ((0_u128).checked_log2(), None);
+}
+
+TEST(u128, Bytes) {
+  const auto x = u128::from_words(0x0102030405060708_u64,
+                                  0x090a0b0c0d0e0f10_u64);
+  const auto be = x.to_be_bytes();
+  const auto le = x.to_le_bytes();
+  for (usize i; i < 16u; i += 1u) {
+    EXPECT_EQ(be[i], u8::from(i + 1u));
+    EXPECT_EQ(le[i], u8::from(16u - i));
+  }
+  EXPECT_EQ(u128::from_be_bytes(be), x);
+  EXPECT_EQ(u128::from_le_bytes(le), x);
+  EXPECT_EQ(u128::from_ne_bytes(x.to_ne_bytes()), x);
+  EXPECT_EQ(u128::from_be(x.to_be()), x);
+}
+
+TEST(u128, ToString) {
+  using sus::string::String;
+  EXPECT_EQ((0_u128).to_string(), String::from("0"));
+  EXPECT_EQ(u128(u64::MAX).to_string(), String::from("18446744073709551615"));
+  EXPECT_EQ(kTwo64.to_string(), String::from("18446744073709551616"));
+  // Chunks of 19 digits with leading zeros.
+  EXPECT_EQ((10_u128).pow(19_u32).to_string(),
+            String::from("10000000000000000000"));
+  EXPECT_EQ(((10_u128).pow(38_u32) + 5u).to_string(),
+            String::from("100000000000000000000000000000000000005"));
+  EXPECT_EQ(u128::MAX.to_string(),
+            String::from("340282366920938463463374607431768211455"));
+  EXPECT_EQ(sus::fmt::format("{}", u128::MAX),
+            String::from("340282366920938463463374607431768211455"));
+
+  auto buf = sus::Array<u8, 39>();
+  EXPECT_EQ(u128::MAX.write_to(buf.as_mut_slice()), 39u);
+  EXPECT_EQ(buf[0u].primitive_value, '3');
+  EXPECT_EQ(buf[38u].primitive_value, '5');
+}
+
+TEST(u128, FromStrRadix) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseIntError::Kind;
+  const auto parse = [](Str s, u32 radix = 10u) {
+    return u128::from_str_radix(s.as_bytes(), radix);
+  };
+  EXPECT_EQ(
+      parse(Str::from("340282366920938463463374607431768211455")).unwrap(),
+      u128::MAX);
+  EXPECT_EQ(parse(Str::from("+18446744073709551616")).unwrap(), kTwo64);
+  EXPECT_EQ(
+      parse(Str::from("340282366920938463463374607431768211456")).unwrap_err()
+          .kind(),
+      Kind::PosOverflow);
+  EXPECT_EQ(parse(Str::from("")).unwrap_err().kind(), Kind::Empty);
+  EXPECT_EQ(parse(Str::from("+")).unwrap_err().kind(), Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("-1")).unwrap_err().kind(), Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("12345678901234567890x")).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("ffffffffffffffffffffffffffffffff"), 16u).unwrap(),
+            u128::MAX);
+  EXPECT_EQ(parse(Str::from("1" "0000000000000000"), 16u).unwrap(), kTwo64);
+  EXPECT_EQ(
+      parse(Str::from("100000000000000000000000000000000"), 16u).unwrap_err()
+          .kind(),
+      Kind::PosOverflow);
+  // Every length, so each chunk boundary is crossed.
+  auto expected = 0_u128;
+  auto s = sus::string::String();
+  for (u32 i = 1u; i <= 38u; i += 1u) {
+    const u32 digit = i % 10u;
+    s.push(U'0' + char32_t{digit.primitive_value});
+    expected = expected * 10u + u128(digit);
+    EXPECT_EQ(parse(s.as_str()).unwrap(), expected);
+    const auto s = expected.to_string();
+    EXPECT_EQ(parse(s.as_str()).unwrap(), expected);
+  }
+}
+
+TEST(u128, Hash) {
+  std::unordered_set<u128> set;
+  set.insert(kTwo64);
+  set.insert(1_u128);
+  set.insert(kTwo64);
+  EXPECT_EQ(set.size(), 2u);
+  EXPECT_EQ(set.contains(u128::from_words(1_u64, 0_u64)), true);
+}
+
+}  // namespace
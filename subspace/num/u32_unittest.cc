@@ -27,6 +27,7 @@
 #include "subspace/ops/ord.h"
 #include "subspace/option/option.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 #include "subspace/test/ensure_use.h"
 #include "subspace/tuple/tuple.h"
 
@@ -2200,4 +2201,102 @@ TEST(u32DeathTest, WrappingRemEuclidOverflow) {
 #endif
 }
 
+TEST(u32, ToString) {
+  EXPECT_EQ((0_u32).to_string(), sus::string::String::from("0"));
+  EXPECT_EQ((7_u32).to_string(), sus::string::String::from("7"));
+  EXPECT_EQ((10_u32).to_string(), sus::string::String::from("10"));
+  EXPECT_EQ((4096_u32).to_string(), sus::string::String::from("4096"));
+  EXPECT_EQ((12345_u32).to_string(), sus::string::String::from("12345"));
+  EXPECT_EQ(u32::MAX.to_string(), sus::string::String::from("4294967295"));
+  // Every length, and every digit in every position.
+  auto v = 1_u32;
+  auto expected = sus::string::String::from("1");
+  for (u32 i = 0u; i < 9u; i += 1u) {
+    v = v * 10_u32 + (i % 10_u32);
+    expected.push(U'0' + char32_t{i.primitive_value % 10u});
+    EXPECT_EQ(v.to_string(), expected);
+  }
+}
+
+TEST(u32, WriteTo) {
+  auto buf = sus::Array<u8, 10>();
+  EXPECT_EQ((0_u32).write_to(buf.as_mut_slice()), 1u);
+  EXPECT_EQ(buf[0u], u8('0'));
+  EXPECT_EQ(u32::MAX.write_to(buf.as_mut_slice()), 10u);
+  EXPECT_EQ(sus::string::Str::from_utf8(buf.as_slice()).unwrap(),
+            sus::string::Str::from("4294967295"));
+  // Only the front of the buffer is written.
+  EXPECT_EQ((35_u32).write_to(buf.as_mut_slice()), 2u);
+  EXPECT_EQ(sus::string::Str::from_utf8(buf.as_slice()).unwrap(),
+            sus::string::Str::from("3594967295"));
+}
+
+TEST(u32DeathTest, WriteToTooShort) {
+  auto buf = sus::Array<u8, 3>();
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH((1234_u32).write_to(buf.as_mut_slice()), "");
+#endif
+  EXPECT_EQ((123_u32).write_to(buf.as_mut_slice()), 3u);
+}
+
+TEST(u32, FromStrRadix) {
+  using sus::num::ParseIntError;
+  using sus::string::Str;
+  using Kind = ParseIntError::Kind;
+  const auto parse = [](Str s, u32 radix) {
+    return u32::from_str_radix(s.as_bytes(), radix);
+  };
+  EXPECT_EQ(parse(Str::from("0"), 10u).unwrap(), 0_u32);
+  EXPECT_EQ(parse(Str::from("+7"), 10u).unwrap(), 7_u32);
+  EXPECT_EQ(parse(Str::from("0042"), 10u).unwrap(), 42_u32);
+  EXPECT_EQ(parse(Str::from("12345678"), 10u).unwrap(), 12345678_u32);
+  EXPECT_EQ(parse(Str::from("123456789"), 10u).unwrap(), 123456789_u32);
+  EXPECT_EQ(parse(Str::from("4294967295"), 10u).unwrap(), u32::MAX);
+  EXPECT_EQ(parse(Str::from("00000000004294967295"), 10u).unwrap(), u32::MAX);
+  EXPECT_EQ(parse(Str::from("ffFF"), 16u).unwrap(), 0xffff_u32);
+  EXPECT_EQ(parse(Str::from("101"), 2u).unwrap(), 5_u32);
+  EXPECT_EQ(parse(Str::from("zz"), 36u).unwrap(), 1295_u32);
+
+  EXPECT_EQ(parse(Str::from(""), 10u).unwrap_err().kind(), Kind::Empty);
+  EXPECT_EQ(parse(Str::from("+"), 10u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("-1"), 10u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from(" 1"), 10u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("12"), 2u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  // Invalid digits are found inside a run of 8 digits.
+  EXPECT_EQ(parse(Str::from("1234:678"), 10u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("1234/678"), 10u).unwrap_err().kind(),
+            Kind::InvalidDigit);
+  EXPECT_EQ(parse(Str::from("4294967296"), 10u).unwrap_err().kind(),
+            Kind::PosOverflow);
+  EXPECT_EQ(parse(Str::from("100000000"), 16u).unwrap_err().kind(),
+            Kind::PosOverflow);
+  // Overflow is reported where it happens, before a later invalid digit.
+  EXPECT_EQ(parse(Str::from("99999999999x"), 10u).unwrap_err().kind(),
+            Kind::PosOverflow);
+}
+
+TEST(u32DeathTest, FromStrRadixInvalidRadix) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto r = u32::from_str_radix(sus::string::Str::from("1").as_bytes(),
+                                     37u);
+        ensure_use(&r);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto r = u32::from_str_radix(sus::string::Str::from("1").as_bytes(),
+                                     1u);
+        ensure_use(&r);
+      },
+      "");
+#endif
+}
+
 }  // namespace
@@ -24,6 +24,7 @@
 #include "subspace/ops/eq.h"
 #include "subspace/ops/ord.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 #include "subspace/test/ensure_use.h"
 #include "subspace/tuple/tuple.h"
 
@@ -762,4 +763,74 @@ TEST(u64, InvokeEverything) {
   [[maybe_unused]] auto z = i >= j;
 }
 
+TEST(u64, ToString) {
+  EXPECT_EQ((0_u64).to_string(), sus::string::String::from("0"));
+  EXPECT_EQ((4294967296_u64).to_string(),
+            sus::string::String::from("4294967296"));
+  EXPECT_EQ(u64::MAX.to_string(),
+            sus::string::String::from("18446744073709551615"));
+
+  auto buf = sus::Array<u8, 20>();
+  EXPECT_EQ(u64::MAX.write_to(buf.as_mut_slice()), 20u);
+}
+
+TEST(u64, FromStrRadix) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseIntError::Kind;
+  const auto parse = [](Str s) {
+    return u64::from_str_radix(s.as_bytes(), 10u);
+  };
+  EXPECT_EQ(parse(Str::from("1234567890123456789")).unwrap(),
+            1234567890123456789_u64);
+  EXPECT_EQ(parse(Str::from("18446744073709551615")).unwrap(), u64::MAX);
+  EXPECT_EQ(parse(Str::from("18446744073709551616")).unwrap_err().kind(),
+            Kind::PosOverflow);
+  EXPECT_EQ(parse(Str::from("99999999999999999999")).unwrap_err().kind(),
+            Kind::PosOverflow);
+  // Every length, so each mix of 8-digit runs and single digits is used.
+  auto expected = 0_u64;
+  auto s = sus::string::String();
+  for (u32 i = 1u; i <= 19u; i += 1u) {
+    const u32 digit = i % 10u;
+    s.push(U'0' + char32_t{digit.primitive_value});
+    expected = expected * 10u + u64::from(digit);
+    EXPECT_EQ(parse(s.as_str()).unwrap(), expected);
+  }
+}
+
+TEST(u64, WideningMul) {
+  EXPECT_EQ((3_u64).widening_mul(4_u64), (Tuple<u64, u64>::with(12u, 0u)));
+  // (2^64 - 1)^2 = 2^128 - 2^65 + 1.
+  EXPECT_EQ(u64::MAX.widening_mul(u64::MAX),
+            (Tuple<u64, u64>::with(1u, u64::MAX - 1u)));
+  EXPECT_EQ((1_u64 << 63u).widening_mul(4_u64),
+            (Tuple<u64, u64>::with(0u, 2u)));
+  // The carry is added in without overflowing the high word.
+  EXPECT_EQ(u64::MAX.carrying_mul(u64::MAX, u64::MAX),
+            (Tuple<u64, u64>::with(0u, u64::MAX)));
+  EXPECT_EQ((200_u8).widening_mul(200_u8), (Tuple<u8, u8>::with(64_u8, 156_u8)));
+}
+
+TEST(u64, CarryingAdd) {
+  EXPECT_EQ((1_u64).carrying_add(2_u64, false),
+            (Tuple<u64, bool>::with(3u, false)));
+  EXPECT_EQ((1_u64).carrying_add(2_u64, true),
+            (Tuple<u64, bool>::with(4u, false)));
+  EXPECT_EQ(u64::MAX.carrying_add(0_u64, true),
+            (Tuple<u64, bool>::with(0u, true)));
+  EXPECT_EQ(u64::MAX.carrying_add(u64::MAX, true),
+            (Tuple<u64, bool>::with(u64::MAX, true)));
+
+  EXPECT_EQ((3_u64).borrowing_sub(2_u64, true),
+            (Tuple<u64, bool>::with(0u, false)));
+  EXPECT_EQ((0_u64).borrowing_sub(0_u64, true),
+            (Tuple<u64, bool>::with(u64::MAX, true)));
+
+  // Adds two 128-bit numbers as pairs of words.
+  const auto lo = u64::MAX.carrying_add(1_u64, false);
+  const auto hi = (5_u64).carrying_add(6_u64, lo.at<1>());
+  EXPECT_EQ(lo.at<0>(), 0u);
+  EXPECT_EQ(hi, (Tuple<u64, bool>::with(12u, false)));
+}
+
 }  // namespace
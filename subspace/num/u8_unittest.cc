@@ -24,6 +24,7 @@
 #include "subspace/ops/eq.h"
 #include "subspace/ops/ord.h"
 #include "subspace/prelude.h"
+#include "subspace/string/string.h"
 #include "subspace/test/ensure_use.h"
 #include "subspace/tuple/tuple.h"
 
@@ -786,4 +787,25 @@ TEST(u8, InvokeEverything) {
   [[maybe_unused]] auto z = i >= j;
 }
 
+TEST(u8, ToString) {
+  EXPECT_EQ((0_u8).to_string(), sus::string::String::from("0"));
+  EXPECT_EQ((42_u8).to_string(), sus::string::String::from("42"));
+  EXPECT_EQ(u8::MAX.to_string(), sus::string::String::from("255"));
+}
+
+TEST(u8, FromStrRadix) {
+  using sus::string::Str;
+  using Kind = sus::num::ParseIntError::Kind;
+  EXPECT_EQ(u8::from_str_radix(Str::from("255").as_bytes(), 10u).unwrap(),
+            u8::MAX);
+  EXPECT_EQ(u8::from_str_radix(Str::from("FF").as_bytes(), 16u).unwrap(),
+            u8::MAX);
+  EXPECT_EQ(
+      u8::from_str_radix(Str::from("256").as_bytes(), 10u).unwrap_err().kind(),
+      Kind::PosOverflow);
+  EXPECT_EQ(
+      u8::from_str_radix(Str::from("300x").as_bytes(), 10u).unwrap_err().kind(),
+      Kind::PosOverflow);
+}
+
 }  // namespace
@@ -31,14 +31,13 @@
 #include "subspace/num/__private/ptr_type.h"
 #include "subspace/num/__private/unsigned_integer_macros.h"
 #include "subspace/num/integer_concepts.h"
+#include "subspace/num/parse_int_error.h"
 #include "subspace/num/try_from_int_error.h"
 #include "subspace/option/option.h"
 #include "subspace/result/result.h"
 
 namespace sus::num {
 
-// TODO: from_str_radix(). Need Result type and Errors.
-
 // TODO: Split apart the declarations and the definitions? Then they can be in
 // u32_defn.h and u32_impl.h, allowing most of the library to just use
 // u32_defn.h which will keep some headers smaller. But then the combined
@@ -14,9 +14,16 @@
 
 #pragma once
 
+#include "subspace/assertions/unreachable.h"
 #include "subspace/containers/array.h"
+#include "subspace/containers/slice.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/num/__private/parse.h"
+#include "subspace/num/__private/to_chars.h"
 #include "subspace/num/unsigned_integer.h"
 #include "subspace/ptr/copy.h"
+#include "subspace/string/str.h"
+#include "subspace/string/string.h"
 
 namespace sus::num {
 
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <memory>
+#include <type_traits>
+
 #include "subspace/macros/always_inline.h"
 #include "subspace/marker/unsafe.h"
 #include "subspace/mem/addressof.h"
@@ -243,15 +246,13 @@ struct Storage<T, true> final {
   [[nodiscard]] constexpr inline T take_and_set_none() noexcept {
     auto t = T(::sus::move(access_.as_inner_mut()));
     access_.~NeverValueAccess();
-    access_ = NeverValueAccess();
-    access_.set_never_value(::sus::marker::unsafe_fn);
+    construct_never_value();
     return t;
   }
 
   constexpr inline void set_none() noexcept {
     access_.~NeverValueAccess();
-    access_ = NeverValueAccess();
-    access_.set_never_value(::sus::marker::unsafe_fn);
+    construct_never_value();
   }
 
   constexpr inline void destroy() noexcept { access_.~NeverValueAccess(); }
@@ -259,6 +260,18 @@ struct Storage<T, true> final {
  private:
   using NeverValueAccess = ::sus::mem::__private::NeverValueAccess<T>;
 
+  // Constructs `access_` in the never-value state, after it was destroyed.
+  constexpr inline void construct_never_value() noexcept {
+    if constexpr (std::is_trivially_default_constructible_v<NeverValueAccess>) {
+      access_ = NeverValueAccess();
+    } else {
+      // Assignment would run T's assignment operator on a destroyed object,
+      // which for a type like Vec would try to free its old storage again.
+      std::construct_at(&access_);
+    }
+    access_.set_never_value(::sus::marker::unsafe_fn);
+  }
+
   union {
     NeverValueAccess access_;
   };
@@ -30,11 +30,13 @@ using sus::marker::unsafe_fn;
 using ::sus::mem::mref;
 using sus::num::f32;
 using sus::num::f64;
+using sus::num::i128;
 using sus::num::i16;
 using sus::num::i32;
 using sus::num::i64;
 using sus::num::i8;
 using sus::num::isize;
+using sus::num::u128;
 using sus::num::u16;
 using sus::num::u32;
 using sus::num::u64;
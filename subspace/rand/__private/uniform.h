@@ -0,0 +1,45 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "subspace/num/__private/intrinsics.h"
+#include "subspace/rand/rng_concept.h"
+
+namespace sus::rand::__private {
+
+/// Returns a uniformly distributed integer in `[0, n)`, which must not be
+/// empty.
+///
+/// This is Lemire's nearly divisionless method: the random value is scaled
+/// into the range with one wide multiply, and the `%` needed to reject the
+/// biased low values is only computed when the value lands in the band where
+/// rejection is possible, which happens with probability `n / 2^64`.
+template <Rng R>
+constexpr uint64_t uniform_below(R& rng, uint64_t n) noexcept {
+  auto m = ::sus::num::__private::widening_mul(rng.next_u64().primitive_value,
+                                               n);
+  if (m.lo < n) {
+    const uint64_t threshold = (uint64_t{0u} - n) % n;
+    while (m.lo < threshold) {
+      m = ::sus::num::__private::widening_mul(rng.next_u64().primitive_value,
+                                              n);
+    }
+  }
+  return m.hi;
+}
+
+}  // namespace sus::rand::__private
@@ -0,0 +1,87 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "subspace/macros/pure.h"
+#include "subspace/num/__private/intrinsics.h"
+#include "subspace/num/int128.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/rand/rng.h"
+#include "subspace/rand/splitmix64.h"
+
+namespace sus::rand {
+
+/// The PCG64 generator (PCG XSL RR 128/64), with a 128-bit LCG state.
+///
+/// Each step is one 128-bit multiply and add, and the output permutes the
+/// state down to 64 bits. Generators with different `stream`s produce
+/// unrelated sequences from the same state, which makes it easy to give each
+/// thread or shard its own generator.
+class Pcg64 final : public RngBase<Pcg64> {
+ public:
+  /// Constructs the generator from a `seed`, which is expanded into the state
+  /// and stream with `SplitMix64`. Every seed is valid.
+  [[nodiscard]] sus_pure static constexpr Pcg64 with_seed(u64 seed) noexcept {
+    auto sm = SplitMix64::with_seed(seed);
+    const u64 s0 = sm.next_u64();
+    const u64 s1 = sm.next_u64();
+    const u64 s2 = sm.next_u64();
+    const u64 s3 = sm.next_u64();
+    return with_state_and_stream(u128::from_words(s0, s1),
+                                 u128::from_words(s2, s3));
+  }
+
+  /// Constructs the generator with the initial `state` and the `stream`
+  /// selector, matching the reference PCG implementation. Every value of each
+  /// is valid.
+  [[nodiscard]] sus_pure static constexpr Pcg64 with_state_and_stream(
+      u128 state, u128 stream) noexcept {
+    // The increment must be odd, and the top bit of the stream is lost.
+    const u128 increment = (stream << 1u) | u128(1u);
+    auto pcg = Pcg64(state.wrapping_add(increment), increment);
+    pcg.step();
+    return pcg;
+  }
+
+  /// Returns the next 64 random bits and advances the generator.
+  ///
+  /// sus::rand::Rng trait.
+  constexpr u64 next_u64() noexcept {
+    step();
+    const auto rot = static_cast<uint32_t>(
+        (state_ >> 122u).lo_word().primitive_value);
+    const uint64_t xsl =
+        state_.hi_word().primitive_value ^ state_.lo_word().primitive_value;
+    return ::sus::num::__private::rotate_right(xsl, rot);
+  }
+
+ private:
+  static constexpr u128 kMultiple =
+      u128::from_words(0x2360ed051fc65da4_u64, 0x4385df649fccf645_u64);
+
+  constexpr Pcg64(u128 state, u128 increment) noexcept
+      : state_(state), increment_(increment) {}
+
+  constexpr void step() noexcept {
+    state_ = state_.wrapping_mul(kMultiple).wrapping_add(increment_);
+  }
+
+  u128 state_;
+  u128 increment_;
+};
+
+}  // namespace sus::rand
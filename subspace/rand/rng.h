@@ -0,0 +1,127 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/assertions/endian.h"
+#include "subspace/containers/slice.h"
+#include "subspace/num/__private/intrinsics.h"
+#include "subspace/num/integer_concepts.h"
+#include "subspace/num/signed_integer.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/range.h"
+#include "subspace/rand/__private/uniform.h"
+#include "subspace/rand/rng_concept.h"
+
+namespace sus::rand {
+
+/// The methods provided to every random number generator, built on top of its
+/// `next_u64()` method.
+///
+/// Generators subclass from `RngBase` with themselves as the template
+/// parameter, in the same way as iterators subclass from
+/// `sus::iter::IteratorBase`.
+template <class R>
+class RngBase {
+ protected:
+  constexpr RngBase() noexcept {
+    static_assert(std::is_final_v<R>,
+                  "Rng implementations must be `final`, as the provided "
+                  "methods must know the complete type.");
+  }
+
+ public:
+  /// Returns the next 32 random bits from the generator.
+  ///
+  /// These are the high bits of `next_u64()`, which are the strongest bits of
+  /// the generators in `sus::rand`.
+  constexpr u32 next_u32() noexcept {
+    return u32(static_cast<uint32_t>(
+        static_cast<R&>(*this).next_u64().primitive_value >> 32u));
+  }
+
+  /// Fills `dest` with random bytes.
+  ///
+  /// Each call to `next_u64()` fills 8 bytes, which are written in little
+  /// endian order so that the bytes for a given seed are the same on every
+  /// platform.
+  void fill_bytes(::sus::containers::SliceMut<u8> dest) noexcept {
+    auto* p = reinterpret_cast<uint8_t*>(dest.as_mut_ptr());
+    size_t n = size_t{dest.len()};
+    while (n >= 8u) {
+      const uint64_t v = next_le();
+      memcpy(p, &v, 8u);
+      p += 8u;
+      n -= 8u;
+    }
+    if (n > 0u) {
+      const uint64_t v = next_le();
+      memcpy(p, &v, n);
+    }
+  }
+
+  /// Returns an integer chosen uniformly at random from the `range`.
+  ///
+  /// Every value in the range is equally likely: values are never produced by
+  /// taking a remainder of the random bits, which would favour the low end of
+  /// the range.
+  ///
+  /// # Panics
+  /// Panics if the range is empty.
+  template <::sus::num::Integer T>
+  constexpr T gen_range(::sus::ops::Range<T> range) noexcept {
+    ::sus::check(range.start < range.finish);
+    using P = decltype(range.start.primitive_value);
+    // Signed values are offset from `start` in unsigned math, which wraps to
+    // the right value.
+    const auto start = static_cast<uint64_t>(
+        static_cast<std::conditional_t<std::is_signed_v<P>, int64_t, uint64_t>>(
+            range.start.primitive_value));
+    const auto finish = static_cast<uint64_t>(
+        static_cast<std::conditional_t<std::is_signed_v<P>, int64_t, uint64_t>>(
+            range.finish.primitive_value));
+    const uint64_t offset = __private::uniform_below(
+        static_cast<R&>(*this), finish - start);
+    return T(static_cast<P>(start + offset));
+  }
+
+  /// Returns `true` with probability `numerator / denominator`.
+  ///
+  /// # Panics
+  /// Panics if `denominator` is zero or `numerator > denominator`.
+  constexpr bool gen_ratio(u64 numerator, u64 denominator) noexcept {
+    ::sus::check(denominator > 0u && numerator <= denominator);
+    return __private::uniform_below(static_cast<R&>(*this),
+                                    denominator.primitive_value) <
+           numerator.primitive_value;
+  }
+
+ private:
+  uint64_t next_le() noexcept {
+    const uint64_t v = static_cast<R&>(*this).next_u64().primitive_value;
+    if constexpr (::sus::assertions::is_little_endian())
+      return v;
+    else
+      return ::sus::num::__private::swap_bytes(v);
+  }
+};
+
+}  // namespace sus::rand
@@ -0,0 +1,39 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <concepts>
+
+namespace sus::num {
+struct u64;
+}
+
+namespace sus::rand {
+
+/// A concept for random number generators.
+///
+/// A generator has one required method, `next_u64()`, which returns the next
+/// 64 random bits from its sequence and advances it. Every bit of the output
+/// is expected to be uniformly distributed.
+///
+/// Generators which subclass from `sus::rand::RngBase` get all the methods
+/// built on top of `next_u64()`, such as `gen_range()` and `fill_bytes()`, for
+/// free.
+template <class R>
+concept Rng = requires(R& r) {
+  { r.next_u64() } noexcept -> std::same_as<::sus::num::u64>;
+};
+
+}  // namespace sus::rand
@@ -0,0 +1,222 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/rand/rng.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/array.h"
+#include "subspace/containers/vec.h"
+#include "subspace/num/int128.h"
+#include "subspace/ops/range_literals.h"
+#include "subspace/prelude.h"
+#include "subspace/rand/pcg64.h"
+#include "subspace/rand/splitmix64.h"
+#include "subspace/rand/xoshiro256.h"
+#include "subspace/test/ensure_use.h"
+
+namespace {
+
+using sus::rand::Pcg64;
+using sus::rand::Rng;
+using sus::rand::SplitMix64;
+using sus::rand::Xoshiro256StarStar;
+
+static_assert(Rng<SplitMix64>);
+static_assert(Rng<Xoshiro256StarStar>);
+static_assert(Rng<Pcg64>);
+static_assert(!Rng<u64>);
+
+static_assert(sizeof(SplitMix64) == 8u);
+static_assert(sizeof(Xoshiro256StarStar) == 32u);
+static_assert(sizeof(Pcg64) == 32u);
+
+// Generators can run in constant expressions.
+static_assert([]() {
+  auto rng = SplitMix64::with_seed(0u);
+  return rng.next_u64();
+}() == 0xe220a8397b1dcdaf_u64);
+
+TEST(Rng, SplitMix64) {
+  auto rng = SplitMix64::with_seed(0u);
+  EXPECT_EQ(rng.next_u64(), 0xe220a8397b1dcdaf_u64);
+  EXPECT_EQ(rng.next_u64(), 0x6e789e6aa1b965f4_u64);
+  EXPECT_EQ(rng.next_u64(), 0x06c45d188009454f_u64);
+  EXPECT_EQ(rng.next_u64(), 0xf88bb8a8724c81ec_u64);
+}
+
+TEST(Rng, Xoshiro256StarStar) {
+  auto rng = Xoshiro256StarStar::from_state(1u, 2u, 3u, 4u);
+  EXPECT_EQ(rng.next_u64(), 11520_u64);
+  EXPECT_EQ(rng.next_u64(), 0_u64);
+  EXPECT_EQ(rng.next_u64(), 1509978240_u64);
+  EXPECT_EQ(rng.next_u64(), 1215971899390074240_u64);
+  EXPECT_EQ(rng.next_u64(), 1216172134540287360_u64);
+  EXPECT_EQ(rng.next_u64(), 607988272756665600_u64);
+
+  // Seeding expands the seed through SplitMix64.
+  auto sm = SplitMix64::with_seed(9u);
+  const u64 s0 = sm.next_u64(), s1 = sm.next_u64(), s2 = sm.next_u64(),
+            s3 = sm.next_u64();
+  auto a = Xoshiro256StarStar::with_seed(9u);
+  auto b = Xoshiro256StarStar::from_state(s0, s1, s2, s3);
+  for (auto i = 0_usize; i < 10u; i += 1u)
+    EXPECT_EQ(a.next_u64(), b.next_u64());
+}
+
+TEST(RngDeathTest, Xoshiro256StarStarZeroState) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto rng = Xoshiro256StarStar::from_state(0u, 0u, 0u, 0u);
+        ensure_use(&rng);
+      },
+      "");
+#endif
+}
+
+TEST(Rng, Pcg64) {
+  // The reference sequence for the state 42 on stream 54.
+  auto rng = Pcg64::with_state_and_stream(42u, 54u);
+  EXPECT_EQ(rng.next_u64(), 0x86b1da1d72062b68_u64);
+  EXPECT_EQ(rng.next_u64(), 0x1304aa46c9853d39_u64);
+  EXPECT_EQ(rng.next_u64(), 0xa3670e9e0dd50358_u64);
+  EXPECT_EQ(rng.next_u64(), 0xf9090e529a7dae00_u64);
+  EXPECT_EQ(rng.next_u64(), 0xc85b9fd837996f2c_u64);
+  EXPECT_EQ(rng.next_u64(), 0x606121f8e3919196_u64);
+
+  // Streams are independent sequences from the same state.
+  auto other = Pcg64::with_state_and_stream(42u, 55u);
+  EXPECT_NE(other.next_u64(), 0x86b1da1d72062b68_u64);
+
+  auto a = Pcg64::with_seed(1u);
+  auto b = Pcg64::with_seed(1u);
+  auto c = Pcg64::with_seed(2u);
+  const u64 x = a.next_u64();
+  EXPECT_EQ(x, b.next_u64());
+  EXPECT_NE(x, c.next_u64());
+}
+
+TEST(Rng, NextU32) {
+  auto a = SplitMix64::with_seed(0u);
+  auto b = SplitMix64::with_seed(0u);
+  EXPECT_EQ(a.next_u32(), u32::from(b.next_u64() >> 32u));
+}
+
+TEST(Rng, GenRange) {
+  auto rng = Xoshiro256StarStar::with_seed(1u);
+  u32 counts[6u] = {};
+  for (auto i = 0_usize; i < 60000u; i += 1u) {
+    const u64 v = rng.gen_range(sus::ops::Range<u64>(10u, 16u));
+    ASSERT_GE(v, 10u);
+    ASSERT_LT(v, 16u);
+    counts[size_t{v - 10u}] += 1u;
+  }
+  // Each value is expected 10000 times, with a standard deviation of ~91.
+  for (u32 c : counts) {
+    EXPECT_GT(c, 9600u);
+    EXPECT_LT(c, 10400u);
+  }
+
+  // A range of one value.
+  EXPECT_EQ(rng.gen_range(sus::ops::Range<u64>(7u, 8u)), 7u);
+  // The widest ranges.
+  for (auto i = 0_usize; i < 100u; i += 1u) {
+    const u64 v = rng.gen_range(sus::ops::Range<u64>(0u, u64::MAX));
+    EXPECT_LT(v, u64::MAX);
+    const i64 s = rng.gen_range(sus::ops::Range<i64>(i64::MIN, i64::MAX));
+    EXPECT_LT(s, i64::MAX);
+  }
+}
+
+TEST(Rng, GenRangeTypes) {
+  auto rng = Pcg64::with_seed(3u);
+  bool saw_min = false;
+  bool saw_max = false;
+  for (auto i = 0_usize; i < 1000u; i += 1u) {
+    const i8 v = rng.gen_range(sus::ops::Range<i8>(-3_i8, 3_i8));
+    EXPECT_GE(v, -3_i8);
+    EXPECT_LT(v, 3_i8);
+    saw_min |= v == -3_i8;
+    saw_max |= v == 2_i8;
+  }
+  EXPECT_TRUE(saw_min);
+  EXPECT_TRUE(saw_max);
+
+  const usize u = rng.gen_range("5..9"_r);
+  EXPECT_GE(u, 5u);
+  EXPECT_LT(u, 9u);
+  const u8 b = rng.gen_range(sus::ops::Range<u8>(250_u8, u8::MAX));
+  EXPECT_GE(b, 250u);
+}
+
+TEST(RngDeathTest, GenRangeEmpty) {
+#if GTEST_HAS_DEATH_TEST
+  auto rng = SplitMix64::with_seed(0u);
+  EXPECT_DEATH(
+      {
+        auto x = rng.gen_range(sus::ops::Range<u64>(3u, 3u));
+        ensure_use(&x);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto x = rng.gen_range(sus::ops::Range<i32>(3, -3));
+        ensure_use(&x);
+      },
+      "");
+#endif
+}
+
+TEST(Rng, GenRatio) {
+  auto rng = Xoshiro256StarStar::with_seed(2u);
+  EXPECT_TRUE(rng.gen_ratio(1u, 1u));
+  EXPECT_FALSE(rng.gen_ratio(0u, 1u));
+  u32 hits = 0u;
+  for (auto i = 0_usize; i < 10000u; i += 1u) {
+    if (rng.gen_ratio(1u, 4u)) hits += 1u;
+  }
+  EXPECT_GT(hits, 2300u);
+  EXPECT_LT(hits, 2700u);
+}
+
+TEST(Rng, FillBytes) {
+  // The bytes are each next_u64() in little endian order, with a partial last
+  // word.
+  auto rng = SplitMix64::with_seed(0u);
+  auto bytes = sus::Array<u8, 11>();
+  rng.fill_bytes(bytes.as_mut_slice());
+  EXPECT_EQ(bytes[0u], 0xaf_u8);
+  EXPECT_EQ(bytes[7u], 0xe2_u8);
+  EXPECT_EQ(bytes[8u], 0xf4_u8);
+  EXPECT_EQ(bytes[9u], 0x65_u8);
+  EXPECT_EQ(bytes[10u], 0xb9_u8);
+  // A partial word still consumes a whole output.
+  EXPECT_EQ(rng.next_u64(), 0x06c45d188009454f_u64);
+
+  // Filling nothing doesn't advance the generator.
+  auto empty = sus::Vec<u8>();
+  rng.fill_bytes(empty.as_mut_slice());
+  EXPECT_EQ(rng.next_u64(), 0xf88bb8a8724c81ec_u64);
+
+  // Every byte value shows up in a large fill.
+  auto big = sus::Vec<u8>::with_capacity(4096u);
+  for (auto i = 0_usize; i < 4096u; i += 1u) big.push(0_u8);
+  auto pcg = Pcg64::with_seed(0u);
+  pcg.fill_bytes(big.as_mut_slice());
+  bool seen[256u] = {};
+  for (u8 b : big) seen[size_t{b}] = true;
+  for (bool s : seen) EXPECT_TRUE(s);
+}
+
+}  // namespace
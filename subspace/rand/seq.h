@@ -0,0 +1,86 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "subspace/containers/vec.h"
+#include "subspace/iter/iterator_concept.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/mem/forward.h"
+#include "subspace/mem/move.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/rand/__private/uniform.h"
+#include "subspace/rand/rng_concept.h"
+
+namespace sus::rand {
+
+/// Chooses one element uniformly at random from the iterator, or returns
+/// `None` if it is empty.
+///
+/// This is reservoir sampling: the iterator is consumed in a single pass and
+/// only the chosen element is kept, so the length need not be known ahead of
+/// time.
+template <class Iter, Rng R>
+  requires(::sus::iter::Iterator<Iter, typename Iter::Item>)
+constexpr ::sus::option::Option<typename Iter::Item> choose(Iter iter,
+                                                             R& rng) noexcept {
+  using Item = typename Iter::Item;
+  auto chosen = ::sus::option::Option<Item>::none();
+  uint64_t seen = 0u;
+  for (Item item : iter) {
+    seen += 1u;
+    // The `seen`th element replaces the choice with probability 1/seen.
+    if (__private::uniform_below(rng, seen) == 0u)
+      chosen = ::sus::option::Option<Item>::some(::sus::forward<Item>(item));
+  }
+  return chosen;
+}
+
+/// Chooses `amount` distinct elements uniformly at random from the iterator,
+/// or all of them if it has fewer than `amount`.
+///
+/// This is reservoir sampling: the iterator is consumed in a single pass and
+/// only the chosen elements are kept, so the length need not be known ahead of
+/// time. The order of the chosen elements is not itself random; use
+/// `shuffle()` on the result if that matters.
+template <class Iter, Rng R>
+  requires(::sus::iter::Iterator<Iter, typename Iter::Item> &&
+           !std::is_reference_v<typename Iter::Item>)
+constexpr ::sus::containers::Vec<typename Iter::Item> choose_multiple(
+    Iter iter, R& rng, ::sus::num::usize amount) noexcept {
+  using Item = typename Iter::Item;
+  auto reservoir = ::sus::containers::Vec<Item>::with_capacity(amount);
+  const auto k = uint64_t{amount.primitive_value};
+  uint64_t seen = 0u;
+  for (Item item : iter) {
+    if (seen < k) {
+      reservoir.push(::sus::move(item));
+    } else {
+      // The `seen + 1`th element is kept with probability k/(seen + 1), in
+      // place of a random earlier choice.
+      const uint64_t slot = __private::uniform_below(rng, seen + 1u);
+      if (slot < k)
+        reservoir[::sus::num::usize::from(slot)] = ::sus::move(item);
+    }
+    seen += 1u;
+  }
+  return reservoir;
+}
+
+}  // namespace sus::rand
@@ -0,0 +1,82 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/rand/seq.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/ops/range_literals.h"
+#include "subspace/prelude.h"
+#include "subspace/rand/pcg64.h"
+#include "subspace/rand/xoshiro256.h"
+
+namespace {
+
+using sus::rand::Pcg64;
+using sus::rand::Xoshiro256StarStar;
+
+TEST(RandSeq, Choose) {
+  auto rng = Xoshiro256StarStar::with_seed(4u);
+  EXPECT_EQ(sus::rand::choose("0..0"_r, rng), sus::None);
+  EXPECT_EQ(sus::rand::choose("5..6"_r, rng), sus::some(5_usize));
+
+  // Every element is equally likely to be chosen.
+  u32 counts[4u] = {};
+  for (auto i = 0_usize; i < 40000u; i += 1u)
+    counts[size_t{sus::rand::choose("0..4"_r, rng).unwrap()}] += 1u;
+  for (u32 c : counts) {
+    EXPECT_GT(c, 9600u);
+    EXPECT_LT(c, 10400u);
+  }
+
+  // References are chosen without copying.
+  const auto v = sus::Vec<i32>::with_values(1, 2, 3);
+  const i32& r = sus::rand::choose(v.iter(), rng).unwrap();
+  EXPECT_TRUE(&r >= v.as_ptr() && &r < v.as_ptr() + 3u);
+}
+
+TEST(RandSeq, ChooseMultiple) {
+  auto rng = Pcg64::with_seed(5u);
+  // Fewer elements than requested returns all of them.
+  auto all = sus::rand::choose_multiple("0..3"_r, rng, 5u);
+  EXPECT_EQ(all, sus::Vec<usize>::with_values(0_usize, 1_usize, 2_usize));
+  EXPECT_EQ(sus::rand::choose_multiple("0..3"_r, rng, 0u).len(), 0u);
+
+  // Chosen elements are distinct and every element is equally likely to be
+  // chosen.
+  u32 counts[10u] = {};
+  for (auto i = 0_usize; i < 10000u; i += 1u) {
+    auto chosen = sus::rand::choose_multiple("0..10"_r, rng, 3u);
+    ASSERT_EQ(chosen.len(), 3u);
+    EXPECT_NE(chosen[0u], chosen[1u]);
+    EXPECT_NE(chosen[0u], chosen[2u]);
+    EXPECT_NE(chosen[1u], chosen[2u]);
+    for (usize c : chosen) counts[size_t{c}] += 1u;
+  }
+  // Each element is expected 3000 times, with a standard deviation of ~46.
+  for (u32 c : counts) {
+    EXPECT_GT(c, 2800u);
+    EXPECT_LT(c, 3200u);
+  }
+
+  // Move-only elements are moved into the result.
+  auto owned = sus::Vec<sus::Vec<i32>>();
+  for (i32 i = 0; i < 5; i += 1) owned.push(sus::Vec<i32>::with_values(i));
+  auto picked =
+      sus::rand::choose_multiple(sus::move(owned).into_iter(), rng, 2u);
+  EXPECT_EQ(picked.len(), 2u);
+  EXPECT_EQ(picked[0u].len(), 1u);
+}
+
+}  // namespace
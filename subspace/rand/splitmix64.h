@@ -0,0 +1,56 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "subspace/macros/pure.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/rand/rng.h"
+
+namespace sus::rand {
+
+/// The SplitMix64 generator, with 64 bits of state.
+///
+/// Every seed is valid, including zero, and each step is one add and a few
+/// multiplies. The output is too weak for large simulations, but is well
+/// suited to expanding a single `u64` seed into the larger state of another
+/// generator, which is how `Xoshiro256StarStar` and `Pcg64` use it.
+class SplitMix64 final : public RngBase<SplitMix64> {
+ public:
+  /// Constructs the generator from a `seed`.
+  [[nodiscard]] sus_pure static constexpr SplitMix64 with_seed(
+      u64 seed) noexcept {
+    return SplitMix64(seed.primitive_value);
+  }
+
+  /// Returns the next 64 random bits and advances the generator.
+  ///
+  /// sus::rand::Rng trait.
+  constexpr u64 next_u64() noexcept {
+    state_ += 0x9e3779b97f4a7c15u;
+    uint64_t z = state_;
+    z = (z ^ (z >> 30u)) * 0xbf58476d1ce4e5b9u;
+    z = (z ^ (z >> 27u)) * 0x94d049bb133111ebu;
+    return z ^ (z >> 31u);
+  }
+
+ private:
+  constexpr SplitMix64(uint64_t state) noexcept : state_(state) {}
+
+  uint64_t state_;
+};
+
+}  // namespace sus::rand
@@ -0,0 +1,84 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "subspace/assertions/check.h"
+#include "subspace/macros/pure.h"
+#include "subspace/num/__private/intrinsics.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/rand/rng.h"
+#include "subspace/rand/splitmix64.h"
+
+namespace sus::rand {
+
+/// The xoshiro256** generator, with 256 bits of state.
+///
+/// This is a fast all-purpose generator: each step is a handful of shifts,
+/// xors and rotates with no multiplies on the state, and it passes all known
+/// statistical tests. Its period is 2^256 - 1.
+class Xoshiro256StarStar final : public RngBase<Xoshiro256StarStar> {
+ public:
+  /// Constructs the generator from a `seed`, which is expanded into the full
+  /// state with `SplitMix64`. Every seed is valid.
+  [[nodiscard]] sus_pure static constexpr Xoshiro256StarStar with_seed(
+      u64 seed) noexcept {
+    auto sm = SplitMix64::with_seed(seed);
+    const u64 s0 = sm.next_u64();
+    const u64 s1 = sm.next_u64();
+    const u64 s2 = sm.next_u64();
+    const u64 s3 = sm.next_u64();
+    return Xoshiro256StarStar(s0.primitive_value, s1.primitive_value,
+                              s2.primitive_value, s3.primitive_value);
+  }
+
+  /// Constructs the generator with the exact state words `s0` to `s3`, such as
+  /// to reproduce a reference sequence.
+  ///
+  /// # Panics
+  /// Panics if every word is zero, as the generator would only produce zeros.
+  [[nodiscard]] sus_pure static constexpr Xoshiro256StarStar from_state(
+      u64 s0, u64 s1, u64 s2, u64 s3) noexcept {
+    ::sus::check((s0 | s1 | s2 | s3) != 0u);
+    return Xoshiro256StarStar(s0.primitive_value, s1.primitive_value,
+                              s2.primitive_value, s3.primitive_value);
+  }
+
+  /// Returns the next 64 random bits and advances the generator.
+  ///
+  /// sus::rand::Rng trait.
+  constexpr u64 next_u64() noexcept {
+    namespace intrinsics = ::sus::num::__private;
+    const uint64_t result = intrinsics::rotate_left(s_[1u] * 5u, 7u) * 9u;
+    const uint64_t t = s_[1u] << 17u;
+    s_[2u] ^= s_[0u];
+    s_[3u] ^= s_[1u];
+    s_[1u] ^= s_[2u];
+    s_[0u] ^= s_[3u];
+    s_[2u] ^= t;
+    s_[3u] = intrinsics::rotate_left(s_[3u], 45u);
+    return result;
+  }
+
+ private:
+  constexpr Xoshiro256StarStar(uint64_t s0, uint64_t s1, uint64_t s2,
+                               uint64_t s3) noexcept
+      : s_{s0, s1, s2, s3} {}
+
+  uint64_t s_[4u];
+};
+
+}  // namespace sus::rand
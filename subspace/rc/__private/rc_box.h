@@ -0,0 +1,298 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/vec.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/forward.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/option/option.h"
+
+namespace sus::rc::__private {
+
+/// The number of references at which the program panics instead of risking an
+/// overflow of the count.
+static constexpr size_t kMaxRefs = ~size_t{0} >> 1u;
+
+/// Reference counts for the single-threaded `Rc`.
+///
+/// The weak count holds one extra reference which is owned collectively by all
+/// the strong references, so that the allocation is freed when the weak count
+/// reaches zero, whether the last reference was strong or weak.
+struct LocalCounts {
+  size_t strong_count() const noexcept { return strong; }
+  size_t weak_count() const noexcept { return weak; }
+
+  void inc_strong() noexcept {
+    ::sus::check(strong < kMaxRefs);
+    strong += 1u;
+  }
+  /// Returns true if the last strong reference was dropped.
+  bool dec_strong() noexcept {
+    strong -= 1u;
+    return strong == 0u;
+  }
+  void inc_weak() noexcept {
+    ::sus::check(weak < kMaxRefs);
+    weak += 1u;
+  }
+  /// Returns true if the allocation has no references left.
+  bool dec_weak() noexcept {
+    weak -= 1u;
+    return weak == 0u;
+  }
+  /// Adds a strong reference unless the value has already been destroyed.
+  bool try_inc_strong() noexcept {
+    if (strong == 0u) return false;
+    inc_strong();
+    return true;
+  }
+  /// Returns true if the caller holds the only reference of any kind.
+  bool is_unique() noexcept { return strong == 1u && weak == 1u; }
+  /// Takes the only strong reference, leaving the strong count at 0 so that
+  /// weak references can no longer be upgraded. Fails if there are other
+  /// strong references.
+  bool try_take_strong() noexcept {
+    if (strong != 1u) return false;
+    strong = 0u;
+    return true;
+  }
+  void restore_strong() noexcept { strong = 1u; }
+  bool has_weak() const noexcept { return weak != 1u; }
+
+  size_t strong = 1u;
+  size_t weak = 1u;
+};
+
+/// Reference counts for the thread-safe `Arc`.
+///
+/// These follow the same protocol as `LocalCounts`. Incrementing is relaxed, as
+/// a new reference can only be made from an existing one. Decrementing
+/// releases, and the thread that drops the last reference acquires, so that
+/// every use of the value happens before it is destroyed.
+struct AtomicCounts {
+  size_t strong_count() const noexcept {
+    return strong.load(std::memory_order_acquire);
+  }
+  size_t weak_count() const noexcept {
+    size_t w = weak.load(std::memory_order_acquire);
+    // While `is_unique()` holds the weak count locked, there was exactly one.
+    return w == kLocked ? 1u : w;
+  }
+
+  void inc_strong() noexcept {
+    ::sus::check(strong.fetch_add(1u, std::memory_order_relaxed) < kMaxRefs);
+  }
+  bool dec_strong() noexcept {
+    if (strong.fetch_sub(1u, std::memory_order_release) != 1u) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+  void inc_weak() noexcept {
+    size_t cur = weak.load(std::memory_order_relaxed);
+    while (true) {
+      // Wait out `is_unique()` which briefly locks the weak count.
+      if (cur == kLocked) {
+        cur = weak.load(std::memory_order_relaxed);
+        continue;
+      }
+      ::sus::check(cur < kMaxRefs);
+      if (weak.compare_exchange_weak(cur, cur + 1u, std::memory_order_acquire,
+                                     std::memory_order_relaxed))
+        return;
+    }
+  }
+  bool dec_weak() noexcept {
+    if (weak.fetch_sub(1u, std::memory_order_release) != 1u) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+  bool try_inc_strong() noexcept {
+    size_t cur = strong.load(std::memory_order_relaxed);
+    while (cur != 0u) {
+      ::sus::check(cur < kMaxRefs);
+      if (strong.compare_exchange_weak(cur, cur + 1u,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed))
+        return true;
+    }
+    return false;
+  }
+  bool is_unique() noexcept {
+    // Lock the weak count so that no Weak can be made from a strong reference
+    // on another thread while we look at the strong count. With the weak count
+    // at 1, the only way to make a new Weak is from a strong reference.
+    size_t expected = 1u;
+    if (!weak.compare_exchange_strong(expected, kLocked,
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed))
+      return false;
+    const bool unique = strong.load(std::memory_order_acquire) == 1u;
+    weak.store(1u, std::memory_order_release);
+    return unique;
+  }
+  bool try_take_strong() noexcept {
+    size_t expected = 1u;
+    return strong.compare_exchange_strong(expected, 0u,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed);
+  }
+  void restore_strong() noexcept {
+    strong.store(1u, std::memory_order_release);
+  }
+  bool has_weak() const noexcept {
+    return weak.load(std::memory_order_relaxed) != 1u;
+  }
+
+  static constexpr size_t kLocked = ~size_t{0};
+
+  std::atomic<size_t> strong = 1u;
+  std::atomic<size_t> weak = 1u;
+};
+
+/// Marks construction of the value from the result of a function.
+struct WithFn {};
+inline constexpr WithFn kWithFn;
+
+/// The heap allocation shared by an `Rc<T>` or `Arc<T>` and its weak
+/// references.
+///
+/// The value is destroyed when the last strong reference is dropped, but the
+/// allocation lives on until the last weak reference is dropped, so the value
+/// is held in a union to control its lifetime.
+template <class T, class Counts>
+struct RcBox {
+  explicit RcBox(T&& v) noexcept : value(::sus::move(v)) {}
+  template <class F>
+  RcBox(WithFn, F&& f) noexcept : value(::sus::forward<F>(f)()) {}
+  ~RcBox() {}
+
+  Counts counts;
+  union {
+    T value;
+  };
+};
+
+/// Drops a weak reference, freeing the allocation if it was the last reference.
+template <class T, class Counts>
+inline void drop_weak(RcBox<T, Counts>* box) noexcept {
+  if (box->counts.dec_weak()) delete box;
+}
+
+/// Drops a strong reference, destroying the value if it was the last strong
+/// reference.
+template <class T, class Counts>
+inline void drop_strong(RcBox<T, Counts>* box) noexcept {
+  if (box->counts.dec_strong()) {
+    box->value.~T();
+    drop_weak(box);
+  }
+}
+
+/// Gives up the strong reference in `box`, returning the value if it was the
+/// last one.
+template <class T, class Counts>
+inline ::sus::Option<T> into_inner(RcBox<T, Counts>* box) noexcept {
+  if (!box->counts.dec_strong()) return ::sus::Option<T>::none();
+  auto out = ::sus::Option<T>::some(::sus::move(box->value));
+  box->value.~T();
+  drop_weak(box);
+  return out;
+}
+
+/// Makes `box` the only reference to its value, cloning the value into a new
+/// allocation if there are other strong references, and returns the value.
+template <class T, class Counts>
+inline T& make_mut(RcBox<T, Counts>*& box) noexcept {
+  if (!box->counts.try_take_strong()) {
+    // Other strong references exist, so they keep the current value.
+    auto* fresh = new RcBox<T, Counts>(::sus::clone(box->value));
+    drop_strong(box);
+    box = fresh;
+  } else if (box->counts.has_weak()) {
+    // Only weak references remain. The strong count is now 0 so they can't be
+    // upgraded, and the value can move to a new allocation without them.
+    auto* fresh = new RcBox<T, Counts>(::sus::move(box->value));
+    box->value.~T();
+    drop_weak(box);
+    box = fresh;
+  } else {
+    box->counts.restore_strong();
+  }
+  return box->value;
+}
+
+/// The heap allocation shared by an `Rc<Slice<T>>` or `Arc<Slice<T>>`.
+///
+/// The counts, the length, and the elements are all in a single allocation,
+/// with the elements following the header.
+template <class T, class Counts>
+struct RcSliceBox {
+  static constexpr size_t kDataOffset =
+      (sizeof(Counts) + sizeof(size_t) + alignof(T) - 1u) / alignof(T) *
+      alignof(T);
+  static constexpr size_t kAlign =
+      alignof(T) > alignof(Counts) ? alignof(T) : alignof(Counts);
+
+  /// Allocates a box and moves the elements of `vec` into it.
+  static RcSliceBox* from_vec(::sus::containers::Vec<T>&& vec) noexcept {
+    const size_t len = size_t{vec.len()};
+    void* mem = ::operator new(kDataOffset + len * sizeof(T),
+                               std::align_val_t{kAlign});
+    auto* box = new (mem) RcSliceBox(len);
+    T* src = vec.as_mut_ptr();
+    if constexpr (::sus::mem::relocate_by_memcpy<T>) {
+      if (len > 0u) memcpy(box->data(), src, len * sizeof(T));
+      vec.set_len(::sus::marker::unsafe_fn, 0_usize);
+    } else {
+      for (size_t i = 0u; i < len; ++i)
+        new (box->data() + i) T(::sus::move(src[i]));
+    }
+    return box;
+  }
+
+  /// Drops a strong reference, destroying the elements and freeing the
+  /// allocation if it was the last one.
+  static void drop_strong(RcSliceBox* box) noexcept {
+    if (!box->counts.dec_strong()) return;
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_t i = 0u; i < box->len; ++i) box->data()[i].~T();
+    }
+    box->~RcSliceBox();
+    ::operator delete(box, std::align_val_t{kAlign});
+  }
+
+  T* data() noexcept {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(this) + kDataOffset);
+  }
+
+  Counts counts;
+  size_t len;
+
+ private:
+  explicit RcSliceBox(size_t l) noexcept : len(l) {}
+};
+
+}  // namespace sus::rc::__private
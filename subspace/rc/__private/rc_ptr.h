@@ -0,0 +1,336 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/forward.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/never_value.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/mem/replace.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/eq.h"
+#include "subspace/option/option.h"
+#include "subspace/rc/__private/rc_box.h"
+
+namespace sus::rc::__private {
+
+// The implementation of `sus::rc::Rc` and `sus::sync::Arc`, which differ only
+// in the `Counts` they keep in the allocation. See those types for the docs.
+
+template <class T, class Counts>
+class RcPtr;
+
+/// The implementation of `sus::rc::Weak` and `sus::sync::Weak`.
+template <class T, class Counts>
+class WeakPtr final {
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs a Weak that doesn't refer to any value. Calling `upgrade()` on
+  /// it always returns None.
+  constexpr WeakPtr() noexcept : box_(nullptr) {}
+
+  ~WeakPtr() noexcept {
+    if (box_) drop_weak(box_);
+  }
+
+  WeakPtr(WeakPtr&& o) noexcept
+      : box_(::sus::mem::replace(mref(o.box_), nullptr)) {}
+  WeakPtr& operator=(WeakPtr&& o) noexcept {
+    // Take the other pointer first, as dropping the old one may free it when
+    // they are the same.
+    Box* box = ::sus::mem::replace(mref(o.box_), nullptr);
+    if (box_) drop_weak(box_);
+    box_ = box;
+    return *this;
+  }
+
+  /// sus::mem::Clone trait.
+  ///
+  /// Makes another weak reference to the same value.
+  WeakPtr clone() const& noexcept {
+    if (box_) box_->counts.inc_weak();
+    return WeakPtr(box_);
+  }
+
+  /// Returns a strong reference to the value, or None if the value has
+  /// already been destroyed.
+  Option<RcPtr<T, Counts>> upgrade() const& noexcept {
+    if (box_ && box_->counts.try_inc_strong())
+      return Option<RcPtr<T, Counts>>::some(RcPtr<T, Counts>(box_));
+    else
+      return Option<RcPtr<T, Counts>>::none();
+  }
+
+  /// Returns the number of strong references to the value, which is 0 if the
+  /// value has been destroyed.
+  usize strong_count() const& noexcept {
+    return box_ ? usize(box_->counts.strong_count()) : 0_usize;
+  }
+  /// Returns the number of weak references to the value, which is 0 if the
+  /// value has been destroyed.
+  usize weak_count() const& noexcept {
+    if (!box_ || box_->counts.strong_count() == 0u) return 0_usize;
+    // Remove the weak reference held by the strong references.
+    return usize(box_->counts.weak_count() - 1u);
+  }
+
+ private:
+  friend class RcPtr<T, Counts>;
+
+  using Box = RcBox<T, Counts>;
+
+  explicit WeakPtr(Box* box) noexcept : box_(box) {}
+
+  Box* box_;
+
+  sus_class_trivially_relocatable_unchecked(::sus::marker::unsafe_fn);
+};
+
+/// The implementation of `sus::rc::Rc` and `sus::sync::Arc`.
+template <class T, class Counts>
+class RcPtr final {
+  static_assert(!std::is_reference_v<T>,
+                "References in Rc or Arc are not supported.");
+
+ public:
+  /// Constructs a pointer holding `value` in a new heap allocation.
+  static RcPtr with(T value) noexcept {
+    return RcPtr(new Box(::sus::move(value)));
+  }
+
+  /// Constructs a pointer holding the value returned by `f`.
+  ///
+  /// The value is constructed in place in the heap allocation, so this can
+  /// hold types which can not be moved, such as `sus::sync::Mutex`.
+  //
+  // This doesn't use `FnOnce<T()>`, as it requires the return type to be
+  // movable.
+  template <class F>
+    requires(std::same_as<std::invoke_result_t<F&&>, T>)
+  static RcPtr with_fn(F&& f) noexcept {
+    return RcPtr(new Box(kWithFn, ::sus::forward<F>(f)));
+  }
+
+  ~RcPtr() noexcept {
+    if (box_) drop_strong(box_);
+  }
+
+  RcPtr(RcPtr&& o) noexcept
+      : box_(::sus::mem::replace(mref(o.box_), nullptr)) {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+  }
+  RcPtr& operator=(RcPtr&& o) noexcept {
+    ::sus::check(o.box_ != nullptr);  // Catch use-after-move.
+    // Take the other pointer first, as dropping the old one may free it when
+    // they are the same.
+    Box* box = ::sus::mem::replace(mref(o.box_), nullptr);
+    if (box_) drop_strong(box_);
+    box_ = box;
+    return *this;
+  }
+
+  /// sus::mem::Clone trait.
+  ///
+  /// Makes another pointer to the same value, without copying the value.
+  RcPtr clone() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    box_->counts.inc_strong();
+    return RcPtr(box_);
+  }
+
+  const T& operator*() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return box_->value;
+  }
+  const T& operator*() && = delete;
+  const T* operator->() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return &box_->value;
+  }
+  const T* operator->() && = delete;
+
+  /// Returns a mutable reference to the value if there are no other strong or
+  /// `Weak` pointers to it, and None otherwise.
+  Option<T&> get_mut() & noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    if (box_->counts.is_unique())
+      return Option<T&>::some(box_->value);
+    else
+      return Option<T&>::none();
+  }
+
+  /// Returns a mutable reference to the value, first cloning it into a new
+  /// allocation if other strong pointers share it.
+  ///
+  /// This gives copy-on-write semantics: the other strong pointers keep the
+  /// old value. If only `Weak` pointers share the value, it is moved to a new
+  /// allocation instead, and the `Weak` pointers can no longer be upgraded.
+  T& make_mut() & noexcept sus_lifetimebound
+    requires(::sus::mem::Clone<T>)
+  {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return ::sus::rc::__private::make_mut(box_);
+  }
+
+  /// Returns the value if this is the only strong pointer to it, and None
+  /// otherwise. Either way, the pointer is consumed.
+  Option<T> into_inner() && noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return ::sus::rc::__private::into_inner(
+        ::sus::mem::replace(mref(box_), nullptr));
+  }
+
+  /// Makes a `Weak` pointer to the value.
+  WeakPtr<T, Counts> downgrade() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    box_->counts.inc_weak();
+    return WeakPtr<T, Counts>(box_);
+  }
+
+  /// Returns the number of strong pointers to the value.
+  usize strong_count() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return usize(box_->counts.strong_count());
+  }
+  /// Returns the number of `Weak` pointers to the value.
+  usize weak_count() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    // Remove the weak reference held by the strong references.
+    return usize(box_->counts.weak_count() - 1u);
+  }
+
+  /// Returns true if both pointers point to the same allocation.
+  bool ptr_eq(const RcPtr& other) const& noexcept {
+    return box_ == other.box_;
+  }
+
+  /// sus::ops::Eq<RcPtr<T, Counts>> trait.
+  ///
+  /// Compares the values pointed to, not the pointers. Use `ptr_eq()` to
+  /// compare the pointers.
+  friend bool operator==(const RcPtr& l, const RcPtr& r) noexcept
+    requires(::sus::ops::Eq<T>)
+  {
+    return *l == *r;
+  }
+
+ private:
+  friend class WeakPtr<T, Counts>;
+
+  using Box = RcBox<T, Counts>;
+
+  explicit RcPtr(Box* box) noexcept : box_(box) {}
+
+  Box* box_;
+
+  sus_class_trivially_relocatable_unchecked(::sus::marker::unsafe_fn);
+  // The `box_` is only null when moved-from.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, RcPtr, box_, nullptr,
+                              nullptr);
+  constexpr RcPtr() = default;  // For the NeverValueField.
+};
+
+/// The implementation of `Rc<Slice<T>>` and `Arc<Slice<T>>`, which hold the
+/// reference counts and the elements in a single allocation.
+template <class T, class Counts>
+class RcPtr<::sus::containers::Slice<T>, Counts> final {
+ public:
+  /// sus::construct::From<Vec<T>> trait.
+  ///
+  /// Moves the elements of `vec` into a new allocation shared by the pointer.
+  static RcPtr from(::sus::containers::Vec<T> vec) noexcept {
+    return RcPtr(Box::from_vec(::sus::move(vec)));
+  }
+
+  ~RcPtr() noexcept {
+    if (box_) Box::drop_strong(box_);
+  }
+
+  RcPtr(RcPtr&& o) noexcept
+      : box_(::sus::mem::replace(mref(o.box_), nullptr)) {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+  }
+  RcPtr& operator=(RcPtr&& o) noexcept {
+    ::sus::check(o.box_ != nullptr);  // Catch use-after-move.
+    // Take the other pointer first, as dropping the old one may free it when
+    // they are the same.
+    Box* box = ::sus::mem::replace(mref(o.box_), nullptr);
+    if (box_) Box::drop_strong(box_);
+    box_ = box;
+    return *this;
+  }
+
+  /// sus::mem::Clone trait.
+  ///
+  /// Makes another pointer to the same elements, without copying them.
+  RcPtr clone() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    box_->counts.inc_strong();
+    return RcPtr(box_);
+  }
+
+  /// Returns a slice of the elements.
+  ::sus::containers::Slice<T> as_slice() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return ::sus::containers::Slice<T>::from_raw_parts(
+        ::sus::marker::unsafe_fn, box_->data(), usize(box_->len));
+  }
+  ::sus::containers::Slice<T> as_slice() && = delete;
+
+  /// Returns the number of elements.
+  usize len() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return usize(box_->len);
+  }
+  /// Returns true if there are no elements.
+  bool is_empty() const& noexcept { return len() == 0u; }
+
+  /// Returns the number of strong pointers to the elements.
+  usize strong_count() const& noexcept {
+    ::sus::check(box_ != nullptr);  // Catch use-after-move.
+    return usize(box_->counts.strong_count());
+  }
+
+  /// Returns true if both pointers point to the same allocation.
+  bool ptr_eq(const RcPtr& other) const& noexcept {
+    return box_ == other.box_;
+  }
+
+ private:
+  using Box = RcSliceBox<T, Counts>;
+
+  explicit RcPtr(Box* box) noexcept : box_(box) {}
+
+  Box* box_;
+
+  sus_class_trivially_relocatable_unchecked(::sus::marker::unsafe_fn);
+  // The `box_` is only null when moved-from.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, RcPtr, box_, nullptr,
+                              nullptr);
+  constexpr RcPtr() = default;  // For the NeverValueField.
+};
+
+}  // namespace sus::rc::__private
@@ -0,0 +1,63 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/rc/__private/rc_box.h"
+#include "subspace/rc/__private/rc_ptr.h"
+
+namespace sus::rc {
+
+/// A non-owning reference to the value in an `Rc`.
+///
+/// A Weak does not keep the value alive, but it keeps the allocation alive, so
+/// that `upgrade()` can tell if the value is still there. This allows cycles of
+/// `Rc` to be broken by making one of the links a Weak.
+///
+/// This type is created by `Rc::downgrade()`.
+template <class T>
+using Weak = __private::WeakPtr<T, __private::LocalCounts>;
+
+/// A single-threaded reference-counted pointer, which shares ownership of a
+/// value on the heap.
+///
+/// Cloning an Rc makes another pointer to the same value, and the value is
+/// destroyed when the last Rc pointing to it is destroyed. Access to the value
+/// is const, since it is shared. Use `make_mut()` to get mutable access with
+/// copy-on-write, or put a type with interior mutability inside the Rc.
+///
+/// The reference counts are not atomic, so an Rc and its clones must all be
+/// used from a single thread. Use `sus::sync::Arc` to share values between
+/// threads.
+///
+/// An Rc is never null, except when moved-from, so `Option<Rc<T>>` is the same
+/// size as a pointer.
+///
+/// `Rc<Slice<T>>` is a specialization which holds an immutable array of
+/// elements in the same allocation as the reference counts, and can be
+/// accessed through `as_slice()`.
+///
+/// # Example
+/// ```
+/// auto a = sus::rc::Rc<Config>::with(Config::load());
+/// auto b = a.clone();  // Shares the same Config.
+/// b.make_mut().verbose = true;  // Copies the Config, `a` is unchanged.
+///
+/// auto v = sus::Vec<i32>::with_values(1, 2, 3);
+/// auto s = sus::rc::Rc<sus::Slice<i32>>::from(sus::move(v));
+/// ```
+template <class T>
+using Rc = __private::RcPtr<T, __private::LocalCounts>;
+
+}  // namespace sus::rc
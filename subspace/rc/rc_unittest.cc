@@ -0,0 +1,226 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/rc/rc.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::rc::Rc;
+using sus::rc::Weak;
+
+static_assert(sizeof(Rc<i32>) == sizeof(void*));
+static_assert(sizeof(sus::Option<Rc<i32>>) == sizeof(void*));
+static_assert(sizeof(Rc<sus::Slice<i32>>) == sizeof(void*));
+static_assert(sizeof(sus::Option<Rc<sus::Slice<i32>>>) == sizeof(void*));
+static_assert(sus::mem::Clone<Rc<i32>>);
+static_assert(!sus::mem::Copy<Rc<i32>>);
+static_assert(sus::mem::relocate_by_memcpy<Rc<i32>>);
+
+struct Counter {
+  Counter(i32& drops) : drops(&drops) {}
+  Counter(Counter&& o)
+      : drops(sus::mem::replace(sus::mref(o.drops), nullptr)) {}
+  Counter& operator=(Counter&& o) {
+    if (drops) *drops += 1;
+    drops = sus::mem::replace(sus::mref(o.drops), nullptr);
+    return *this;
+  }
+  ~Counter() {
+    if (drops) *drops += 1;
+  }
+  Counter clone() const { return Counter(*drops); }
+  i32* drops;
+};
+
+TEST(Rc, With) {
+  auto a = Rc<i32>::with(3);
+  EXPECT_EQ(*a, 3);
+  EXPECT_EQ(a.strong_count(), 1u);
+  EXPECT_EQ(a.weak_count(), 0u);
+
+  auto v = Rc<Vec<i32>>::with(sus::Vec<i32>::with_values(1, 2));
+  EXPECT_EQ(v->len(), 2u);
+}
+
+TEST(Rc, Clone) {
+  i32 drops = 0;
+  {
+    auto a = Rc<Counter>::with(Counter(drops));
+    auto b = a.clone();
+    EXPECT_TRUE(a.ptr_eq(b));
+    EXPECT_EQ(a.strong_count(), 2u);
+    EXPECT_EQ(b.strong_count(), 2u);
+    {
+      auto c = sus::move(b);
+      EXPECT_EQ(a.strong_count(), 2u);
+    }
+    EXPECT_EQ(drops, 0);
+    EXPECT_EQ(a.strong_count(), 1u);
+  }
+  EXPECT_EQ(drops, 1);
+}
+
+TEST(Rc, MoveAssign) {
+  i32 drops = 0;
+  auto a = Rc<Counter>::with(Counter(drops));
+  auto b = Rc<Counter>::with(Counter(drops));
+  a = sus::move(b);
+  EXPECT_EQ(drops, 1);
+
+  // Self-move keeps the value alive.
+  auto& self = a;
+  a = sus::move(self);
+  EXPECT_EQ(drops, 1);
+  EXPECT_EQ(a.strong_count(), 1u);
+
+  auto w = a.downgrade();
+  auto& wself = w;
+  w = sus::move(wself);
+  EXPECT_EQ(w.weak_count(), 1u);
+
+  auto s = Rc<sus::Slice<i32>>::from(sus::Vec<i32>::with_values(1, 2));
+  auto& sself = s;
+  s = sus::move(sself);
+  EXPECT_EQ(s.len(), 2u);
+}
+
+TEST(Rc, Eq) {
+  auto a = Rc<i32>::with(3);
+  auto b = Rc<i32>::with(3);
+  EXPECT_EQ(a, b);
+  EXPECT_FALSE(a.ptr_eq(b));
+  EXPECT_NE(a, Rc<i32>::with(4));
+}
+
+TEST(Rc, GetMut) {
+  auto a = Rc<i32>::with(3);
+  a.get_mut().unwrap() = 4;
+  EXPECT_EQ(*a, 4);
+
+  {
+    auto b = a.clone();
+    EXPECT_TRUE(a.get_mut().is_none());
+  }
+  {
+    auto w = a.downgrade();
+    EXPECT_TRUE(a.get_mut().is_none());
+  }
+  EXPECT_EQ(a.get_mut().unwrap(), 4);
+}
+
+TEST(Rc, MakeMut) {
+  auto a = Rc<Vec<i32>>::with(sus::Vec<i32>::with_values(1, 2));
+  const Vec<i32>* before = &*a;
+  // Unique, so no copy is made.
+  a.make_mut().push(3);
+  EXPECT_EQ(&*a, before);
+
+  // Shared, so the value is copied and `b` is unchanged.
+  auto b = a.clone();
+  a.make_mut().push(4);
+  EXPECT_FALSE(a.ptr_eq(b));
+  EXPECT_EQ(*a, sus::Vec<i32>::with_values(1, 2, 3, 4));
+  EXPECT_EQ(*b, sus::Vec<i32>::with_values(1, 2, 3));
+  EXPECT_EQ(a.strong_count(), 1u);
+  EXPECT_EQ(b.strong_count(), 1u);
+
+  // Only weakly shared, so the value is moved away from the weak pointer.
+  auto w = b.downgrade();
+  b.make_mut().push(5);
+  EXPECT_EQ(*b, sus::Vec<i32>::with_values(1, 2, 3, 5));
+  EXPECT_TRUE(w.upgrade().is_none());
+  EXPECT_EQ(b.weak_count(), 0u);
+}
+
+TEST(Rc, IntoInner) {
+  auto a = Rc<i32>::with(3);
+  auto b = a.clone();
+  EXPECT_TRUE(sus::move(a).into_inner().is_none());
+  EXPECT_EQ(sus::move(b).into_inner().unwrap(), 3);
+
+  i32 drops = 0;
+  {
+    auto c = Rc<Counter>::with(Counter(drops));
+    auto w = c.downgrade();
+    auto o = sus::move(c).into_inner();
+    EXPECT_EQ(drops, 0);
+    EXPECT_TRUE(o.is_some());
+    EXPECT_TRUE(w.upgrade().is_none());
+  }
+  EXPECT_EQ(drops, 1);
+}
+
+TEST(Rc, Weak) {
+  i32 drops = 0;
+  auto w = Weak<Counter>();
+  EXPECT_TRUE(w.upgrade().is_none());
+  EXPECT_EQ(w.strong_count(), 0u);
+  {
+    auto a = Rc<Counter>::with(Counter(drops));
+    w = a.downgrade();
+    auto w2 = w.clone();
+    EXPECT_EQ(a.weak_count(), 2u);
+    EXPECT_EQ(w.weak_count(), 2u);
+    EXPECT_EQ(w.strong_count(), 1u);
+    auto b = w.upgrade().unwrap();
+    EXPECT_TRUE(a.ptr_eq(b));
+    EXPECT_EQ(a.strong_count(), 2u);
+  }
+  // The value is destroyed while the Weak keeps the allocation alive.
+  EXPECT_EQ(drops, 1);
+  EXPECT_EQ(w.strong_count(), 0u);
+  EXPECT_EQ(w.weak_count(), 0u);
+  EXPECT_TRUE(w.upgrade().is_none());
+}
+
+TEST(Rc, Slice) {
+  i32 drops = 0;
+  {
+    auto v = sus::Vec<Counter>();
+    v.push(Counter(drops));
+    v.push(Counter(drops));
+    auto a = Rc<sus::Slice<Counter>>::from(sus::move(v));
+    EXPECT_EQ(a.len(), 2u);
+    EXPECT_FALSE(a.is_empty());
+    auto b = a.clone();
+    EXPECT_EQ(b.strong_count(), 2u);
+    EXPECT_TRUE(a.ptr_eq(b));
+    EXPECT_EQ(a.as_slice().as_ptr(), b.as_slice().as_ptr());
+    EXPECT_EQ(drops, 0);
+  }
+  EXPECT_EQ(drops, 2);
+
+  auto t = Rc<sus::Slice<i32>>::from(sus::Vec<i32>::with_values(1, 2, 3));
+  EXPECT_EQ(t.as_slice()[2u], 3);
+  i32 sum = 0;
+  for (i32 i : t.as_slice()) sum += i;
+  EXPECT_EQ(sum, 6);
+
+  auto e = Rc<sus::Slice<u64>>::from(sus::Vec<u64>());
+  EXPECT_TRUE(e.is_empty());
+}
+
+#if GTEST_HAS_DEATH_TEST
+TEST(RcDeathTest, UseAfterMove) {
+  auto a = Rc<i32>::with(3);
+  auto b = sus::move(a);
+  EXPECT_DEATH(*a, "");
+}
+#endif
+
+}  // namespace
@@ -14,8 +14,25 @@
 
 #pragma once
 
+#include <stdint.h>
+
 namespace sus::result::__private {
 
-enum class ResultState { IsErr = 0, IsOk = 1, IsMoved = 2 };
+// The state is a single byte so that it fits in any tail padding of the Ok or
+// Err types, which Result places it in through `[[sus_no_unique_address]]`.
+//
+// Unlike Option, Result never stores its state in a never-value field of `T`
+// or `E`, even when exactly one of them has one:
+// * The Ok and Err values share their bytes in a union, so while holding an
+//   Err, the bytes of the never-value field in `T` belong to `E`. Reading or
+//   writing them would only be sound if `E` was known to not overlap the
+//   field, and `sus::mem::NeverValueField` does not expose the field's offset
+//   to check that.
+// * A never-value field has a single never-value. With the field in `T`, that
+//   value could mark IsErr, but IsMoved would need a second value. The same
+//   holds for IsOk with the field in `E`.
+// So a Result is always at least one byte larger than its union, unless that
+// byte fits in tail padding.
+enum class ResultState : uint8_t { IsErr = 0, IsOk = 1, IsMoved = 2 };
 
 }
@@ -487,6 +487,30 @@ class [[nodiscard]] Result final {
     ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
   }
 
+  /// Returns a const reference to the contained `Ok` value, without consuming
+  /// the self value.
+  ///
+  /// # Panics
+  /// Panics if the value is an `Err`.
+  [[nodiscard]] constexpr inline const T& as_ok() const& noexcept {
+    check_with_message(state_ == __private::ResultState::IsOk,
+                       *"called `Result::as_ok()` on an `Err` value");
+    return storage_.ok_;
+  }
+  constexpr inline const T& as_ok() && noexcept = delete;
+
+  /// Returns a const reference to the contained `Err` value, without
+  /// consuming the self value.
+  ///
+  /// # Panics
+  /// Panics if the value is an `Ok`.
+  [[nodiscard]] constexpr inline const E& as_err() const& noexcept {
+    check_with_message(state_ == __private::ResultState::IsErr,
+                       *"called `Result::as_err()` on an `Ok` value");
+    return storage_.err_;
+  }
+  constexpr inline const E& as_err() && noexcept = delete;
+
   /// Returns the contained `Ok` value, consuming the self value.
   ///
   /// Because this function may panic, its use is generally discouraged.
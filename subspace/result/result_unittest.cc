@@ -40,6 +40,22 @@ struct TailPadding {
 static_assert(sizeof(Result<i32, TailPadding>) ==
               sizeof(TailPadding) + sus_if_msvc_else(8, 0));
 
+struct OneByteTailPadding {
+  i32 i;
+  i16 j;
+  i8 k;
+  // 1 byte of tail padding, which the Result can use for its own state.
+};
+static_assert(sizeof(Result<i32, OneByteTailPadding>) ==
+              sizeof(OneByteTailPadding) + sus_if_msvc_else(4, 0));
+static_assert(sizeof(Result<OneByteTailPadding, u8>) ==
+              sizeof(OneByteTailPadding) + sus_if_msvc_else(4, 0));
+
+// The state takes a single byte after the union.
+static_assert(sizeof(Result<u8, u8>) == 2u);
+static_assert(sizeof(Result<u16, u8>) == 4u);
+static_assert(sizeof(Result<u64, u32>) == 16u);
+
 struct Error {};
 
 static_assert(::sus::mem::Copy<Result<int, int>>);
@@ -276,6 +292,32 @@ TEST(ResultDeathTest, UnwrapErrWithOk) {
 #endif
 }
 
+TEST(Result, AsOk) {
+  const auto r = Result<i32, i32>::with(3_i32);
+  EXPECT_EQ(r.as_ok(), 3_i32);
+  EXPECT_TRUE(r.is_ok());
+}
+
+TEST(ResultDeathTest, AsOkWithErr) {
+#if GTEST_HAS_DEATH_TEST
+  const auto r = Result<i32, i32>::with_err(3_i32);
+  EXPECT_DEATH((void)r.as_ok(), "");
+#endif
+}
+
+TEST(Result, AsErr) {
+  const auto r = Result<i32, i32>::with_err(4_i32);
+  EXPECT_EQ(r.as_err(), 4_i32);
+  EXPECT_TRUE(r.is_err());
+}
+
+TEST(ResultDeathTest, AsErrWithOk) {
+#if GTEST_HAS_DEATH_TEST
+  const auto r = Result<i32, i32>::with(3_i32);
+  EXPECT_DEATH((void)r.as_err(), "");
+#endif
+}
+
 TEST(Result, Move) {
   auto r = Result<i32, i32>::with(1_i32);
   auto r2 = sus::move(r);
@@ -0,0 +1,168 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace sus::string::__private {
+
+/// The bytes of an empty string, so that an empty `Str` never holds a null
+/// pointer, which can't be passed to `memcmp()` and friends even with a length
+/// of zero.
+inline constexpr uint8_t kEmptyBytes[1u] = {0u};
+
+/// The result of validating a run of bytes as UTF-8.
+struct Utf8Validation {
+  /// The length of the valid UTF-8 prefix of the input.
+  size_t valid_up_to;
+  /// The length of the invalid sequence found at `valid_up_to`, or 0 if the
+  /// input ended in the middle of an otherwise valid sequence. Meaningless if
+  /// `valid_up_to` is the length of the input.
+  size_t error_len;
+};
+
+constexpr inline bool is_continuation(uint8_t b) noexcept {
+  return (b & 0xC0u) == 0x80u;
+}
+
+/// Returns the number of bytes in the UTF-8 sequence starting with `first`, or
+/// 0 if `first` can not start a sequence.
+constexpr inline size_t utf8_width(uint8_t first) noexcept {
+  if (first < 0x80u) return 1u;
+  if (first < 0xC2u) return 0u;  // Continuation bytes, and overlong 2-byte.
+  if (first < 0xE0u) return 2u;
+  if (first < 0xF0u) return 3u;
+  if (first < 0xF5u) return 4u;
+  return 0u;  // Beyond U+10FFFF.
+}
+
+/// Validates that `p[0..n)` is UTF-8.
+///
+/// Runs of ASCII, which are the common case in most text, are checked a
+/// machine word at a time by testing the high bit of each byte together, and
+/// other bytes are checked one sequence at a time.
+inline Utf8Validation validate_utf8(const uint8_t* p, size_t n) noexcept {
+  constexpr uint64_t kHighBits = 0x8080808080808080u;
+  size_t i = 0u;
+  while (i < n) {
+    const uint8_t first = p[i];
+    if (first < 0x80u) {
+      while (i + 8u <= n) {
+        uint64_t word;
+        memcpy(&word, p + i, 8u);
+        if ((word & kHighBits) != 0u) break;
+        i += 8u;
+      }
+      while (i < n && p[i] < 0x80u) ++i;
+      continue;
+    }
+
+    const size_t width = utf8_width(first);
+    if (width == 0u) return Utf8Validation(i, 1u);
+    // The second byte has a narrower range for some leading bytes, to reject
+    // overlong encodings, surrogates, and values beyond U+10FFFF.
+    uint8_t lo = 0x80u;
+    uint8_t hi = 0xBFu;
+    if (first == 0xE0u) lo = 0xA0u;
+    if (first == 0xEDu) hi = 0x9Fu;
+    if (first == 0xF0u) lo = 0x90u;
+    if (first == 0xF4u) hi = 0x8Fu;
+    for (size_t k = 1u; k < width; ++k) {
+      if (i + k >= n) return Utf8Validation(i, 0u);
+      const uint8_t b = p[i + k];
+      const bool ok = k == 1u ? (b >= lo && b <= hi) : is_continuation(b);
+      if (!ok) return Utf8Validation(i, k);
+    }
+    i += width;
+  }
+  return Utf8Validation(n, 0u);
+}
+
+/// Decodes the character at `p[i]` from valid UTF-8, and moves `i` past it.
+inline char32_t decode_utf8(const uint8_t* p, size_t& i) noexcept {
+  const uint8_t first = p[i];
+  if (first < 0x80u) {
+    i += 1u;
+    return first;
+  }
+  const size_t width = utf8_width(first);
+  char32_t c = first & (0x7Fu >> width);
+  for (size_t k = 1u; k < width; ++k) c = (c << 6u) | (p[i + k] & 0x3Fu);
+  i += width;
+  return c;
+}
+
+/// Decodes the character that ends just before `p[i]` from valid UTF-8, and
+/// moves `i` back to its start.
+inline char32_t decode_utf8_back(const uint8_t* p, size_t& i) noexcept {
+  size_t start = i - 1u;
+  while (is_continuation(p[start])) start -= 1u;
+  size_t pos = start;
+  const char32_t c = decode_utf8(p, pos);
+  i = start;
+  return c;
+}
+
+/// Returns true if `c` is a Unicode scalar value, which can be encoded as
+/// UTF-8.
+constexpr inline bool is_scalar_value(char32_t c) noexcept {
+  return c < 0xD800u || (c > 0xDFFFu && c < 0x110000u);
+}
+
+/// Encodes the scalar value `c` as UTF-8 into `out`, returning the number of
+/// bytes written.
+constexpr inline size_t encode_utf8(char32_t c, uint8_t (&out)[4u]) noexcept {
+  if (c < 0x80u) {
+    out[0u] = static_cast<uint8_t>(c);
+    return 1u;
+  }
+  if (c < 0x800u) {
+    out[0u] = static_cast<uint8_t>(0xC0u | (c >> 6u));
+    out[1u] = static_cast<uint8_t>(0x80u | (c & 0x3Fu));
+    return 2u;
+  }
+  if (c < 0x10000u) {
+    out[0u] = static_cast<uint8_t>(0xE0u | (c >> 12u));
+    out[1u] = static_cast<uint8_t>(0x80u | ((c >> 6u) & 0x3Fu));
+    out[2u] = static_cast<uint8_t>(0x80u | (c & 0x3Fu));
+    return 3u;
+  }
+  out[0u] = static_cast<uint8_t>(0xF0u | (c >> 18u));
+  out[1u] = static_cast<uint8_t>(0x80u | ((c >> 12u) & 0x3Fu));
+  out[2u] = static_cast<uint8_t>(0x80u | ((c >> 6u) & 0x3Fu));
+  out[3u] = static_cast<uint8_t>(0x80u | (c & 0x3Fu));
+  return 4u;
+}
+
+/// Returns the position of the first occurrence of `needle` in `hay`, or
+/// `hay_len` if there is none. The `needle` must not be empty.
+inline size_t find_bytes(const uint8_t* hay, size_t hay_len,
+                         const uint8_t* needle, size_t needle_len) noexcept {
+  if (needle_len > hay_len) return hay_len;
+  const size_t last = hay_len - needle_len;
+  size_t i = 0u;
+  while (i <= last) {
+    const void* found = memchr(hay + i, needle[0u], last - i + 1u);
+    if (found == nullptr) break;
+    i = static_cast<size_t>(static_cast<const uint8_t*>(found) - hay);
+    if (memcmp(hay + i, needle, needle_len) == 0) return i;
+    i += 1u;
+  }
+  return hay_len;
+}
+
+}  // namespace sus::string::__private
@@ -0,0 +1,479 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <compare>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/slice.h"
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/mem/replace.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/ops/range.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+#include "subspace/string/__private/utf8.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::string {
+
+class String;
+class Chars;
+class CharIndices;
+class Split;
+class Lines;
+
+/// The error returned when bytes are not valid UTF-8.
+class Utf8Error final {
+ public:
+  /// Returns the number of bytes at the start of the input that are valid
+  /// UTF-8. This is where the invalid sequence begins.
+  usize valid_up_to() const noexcept { return valid_up_to_; }
+
+  /// Returns the length of the invalid byte sequence, or None if the input
+  /// ended in the middle of a sequence which may have been valid if it had
+  /// continued.
+  Option<usize> error_len() const noexcept {
+    if (error_len_ == 0u) return Option<usize>::none();
+    return Option<usize>::some(error_len_);
+  }
+
+  /// sus::ops::Eq<Utf8Error> trait.
+  constexpr bool operator==(const Utf8Error&) const noexcept = default;
+
+ private:
+  friend class Str;
+  friend class String;
+
+  constexpr Utf8Error(usize valid_up_to, usize error_len) noexcept
+      : valid_up_to_(valid_up_to), error_len_(error_len) {}
+
+  usize valid_up_to_;
+  usize error_len_;
+};
+
+/// A borrowed view of a UTF-8 string.
+///
+/// A Str is a pointer and a length, like a `Slice<u8>`, but the bytes are
+/// always valid UTF-8. It does not own the bytes, which must outlive it. An
+/// owned string is a `String`.
+///
+/// Lengths and positions in a Str are in bytes. A position which falls between
+/// the bytes of a single character is not a character boundary, and methods
+/// which take positions will not split a character.
+///
+/// # Example
+/// ```
+/// auto s = sus::Str::from("hello\nworld");
+/// for (sus::Str line : s.lines()) {
+///   sus::check(line.len() == 5u);
+/// }
+/// ```
+class [[sus_trivial_abi]] Str final {
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty Str.
+  constexpr Str() noexcept = default;
+
+  /// sus::construct::From<const char[N]> trait.
+  ///
+  /// Constructs a Str referring to a string literal, without its terminating
+  /// nul.
+  ///
+  /// # Panics
+  /// This function will panic if the literal is not valid UTF-8.
+  template <size_t N>
+  static Str from(const char (&s)[N] sus_lifetimebound) noexcept {
+    ::sus::check(s[N - 1u] == '\0');
+    return from_utf8(::sus::Slice<u8>::from_raw_parts(
+                         ::sus::marker::unsafe_fn,
+                         reinterpret_cast<const u8*>(s), N - 1u))
+        .unwrap();
+  }
+
+  /// Converts bytes to a Str, after checking that they are valid UTF-8.
+  static ::sus::Result<Str, Utf8Error> from_utf8(
+      ::sus::Slice<u8> bytes) noexcept {
+    const auto v = __private::validate_utf8(
+        reinterpret_cast<const uint8_t*>(bytes.as_ptr()), size_t{bytes.len()});
+    if (v.valid_up_to != bytes.len()) {
+      return ::sus::Result<Str, Utf8Error>::with_err(
+          Utf8Error(v.valid_up_to, v.error_len));
+    }
+    return ::sus::Result<Str, Utf8Error>::with(
+        Str(reinterpret_cast<const uint8_t*>(bytes.as_ptr()), bytes.len()));
+  }
+
+  /// Converts bytes to a Str without checking that they are valid UTF-8.
+  ///
+  /// # Safety
+  /// The bytes must be valid UTF-8, or the methods of Str will read past the
+  /// end of the bytes.
+  static Str from_utf8_unchecked(::sus::marker::UnsafeFnMarker,
+                                 ::sus::Slice<u8> bytes) noexcept {
+    return Str(reinterpret_cast<const uint8_t*>(bytes.as_ptr()), bytes.len());
+  }
+
+  /// Returns the length of the string in bytes.
+  constexpr usize len() const noexcept { return len_; }
+  /// Returns true if the string has a length of zero bytes.
+  constexpr bool is_empty() const noexcept { return len_ == 0u; }
+
+  /// Returns the bytes of the string, without copying.
+  ::sus::Slice<u8> as_bytes() const noexcept {
+    return ::sus::Slice<u8>::from_raw_parts(::sus::marker::unsafe_fn,
+                                            reinterpret_cast<const u8*>(ptr_),
+                                            len_);
+  }
+  /// Returns a pointer to the first byte of the string.
+  const u8* as_ptr() const noexcept {
+    return reinterpret_cast<const u8*>(ptr_);
+  }
+
+  /// Returns true if `index` is at the start of a character, or at the end of
+  /// the string.
+  bool is_char_boundary(usize index) const noexcept {
+    if (index == 0u || index == len_) return true;
+    if (index > len_) return false;
+    return !__private::is_continuation(ptr_[size_t{index}]);
+  }
+
+  /// Returns the substring in `range`, or None if the range is out of bounds or
+  /// either end is not on a character boundary.
+  Option<Str> get(const ::sus::ops::RangeBounds<usize> auto& range)
+      const noexcept {
+    const usize start = range.start_bound().unwrap_or(0u);
+    const usize end = range.end_bound().unwrap_or(len_);
+    if (start > end || end > len_ || !is_char_boundary(start) ||
+        !is_char_boundary(end))
+      return Option<Str>::none();
+    return Option<Str>::some(Str(ptr_ + size_t{start}, end - start));
+  }
+
+  /// Returns the substring in `range`.
+  ///
+  /// # Panics
+  /// This function will panic if the range is out of bounds or either end is
+  /// not on a character boundary.
+  Str operator[](const ::sus::ops::RangeBounds<usize> auto& range)
+      const noexcept {
+    return get(range).unwrap();
+  }
+
+  /// Returns true if the string begins with `prefix`.
+  bool starts_with(Str prefix) const noexcept {
+    return prefix.len_ <= len_ &&
+           memcmp(ptr_, prefix.ptr_, size_t{prefix.len_}) == 0;
+  }
+  /// Returns true if the string ends with `suffix`.
+  bool ends_with(Str suffix) const noexcept {
+    return suffix.len_ <= len_ &&
+           memcmp(ptr_ + size_t{len_ - suffix.len_}, suffix.ptr_,
+                  size_t{suffix.len_}) == 0;
+  }
+
+  /// Returns the byte position of the first occurrence of `pattern`, or None
+  /// if it does not occur. An empty `pattern` is found at position 0.
+  Option<usize> find(Str pattern) const noexcept {
+    if (pattern.is_empty()) return Option<usize>::some(0u);
+    const size_t i = __private::find_bytes(ptr_, size_t{len_}, pattern.ptr_,
+                                           size_t{pattern.len_});
+    if (i == len_) return Option<usize>::none();
+    return Option<usize>::some(i);
+  }
+  /// Returns true if `pattern` occurs in the string.
+  bool contains(Str pattern) const noexcept { return find(pattern).is_some(); }
+
+  /// Returns an iterator over the characters of the string, as `char32_t`.
+  Chars chars() const noexcept;
+
+  /// Returns an iterator over the characters of the string, as
+  /// `Tuple<usize, char32_t>` with the byte position of each character.
+  CharIndices char_indices() const noexcept;
+
+  /// Returns an iterator over the substrings separated by `pattern`.
+  ///
+  /// Adjacent separators produce an empty substring between them, as do
+  /// separators at the start or end of the string.
+  ///
+  /// # Panics
+  /// This function will panic if `pattern` is empty.
+  Split split(Str pattern) const noexcept;
+
+  /// Returns an iterator over the lines of the string.
+  ///
+  /// Lines end with `\n` or `\r\n`, which is not included in the line. The
+  /// final line may end without a line ending, and a line ending at the end of
+  /// the string does not begin another line.
+  Lines lines() const noexcept;
+
+  /// sus::ops::Eq<Str> trait.
+  friend bool operator==(const Str& l, const Str& r) noexcept {
+    return l.len_ == r.len_ && memcmp(l.ptr_, r.ptr_, size_t{l.len_}) == 0;
+  }
+  /// sus::ops::Ord<Str> trait.
+  ///
+  /// Strings are ordered by their bytes, which for UTF-8 is the same as
+  /// ordering by their characters.
+  friend std::strong_ordering operator<=>(const Str& l, const Str& r) noexcept {
+    const size_t common = size_t{l.len_ < r.len_ ? l.len_ : r.len_};
+    const int c = common == 0u ? 0 : memcmp(l.ptr_, r.ptr_, common);
+    if (c != 0) return c < 0 ? std::strong_ordering::less
+                             : std::strong_ordering::greater;
+    return l.len_ <=> r.len_;
+  }
+
+  /// Str satisfies `sus::containers::Concat`, producing a `String`.
+  using ConcatOutputType = String;
+  /// Appends the string onto `s`, for `Slice<Str>::concat()`.
+  void concat_into(String& s) const& noexcept;
+
+  /// Str satisfies `sus::containers::Join<Str, Str>`, producing a `String`.
+  using JoinOutputType = String;
+  /// Appends the string onto `s`, for `Slice<Str>::join()`.
+  void join_into(String& s) const& noexcept;
+  /// Appends the separator onto `s`, for `Slice<Str>::join()`.
+  static void join_sep_into(String& s, const Str& separator) noexcept;
+
+ private:
+  friend class String;
+  friend class Split;
+  friend class Lines;
+
+  constexpr Str(const uint8_t* ptr, usize len) noexcept
+      : ptr_(ptr != nullptr ? ptr : __private::kEmptyBytes), len_(len) {}
+
+  const uint8_t* ptr_ = __private::kEmptyBytes;
+  usize len_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(ptr_),
+                                  decltype(len_));
+};
+
+/// An iterator over the characters of a `Str`.
+class [[nodiscard]] [[sus_trivial_abi]] Chars final
+    : public ::sus::iter::IteratorBase<Chars, char32_t> {
+ public:
+  using Item = char32_t;
+
+  // sus::iter::Iterator trait.
+  Option<char32_t> next() noexcept {
+    if (front_ == back_) return Option<char32_t>::none();
+    size_t i = front_;
+    const char32_t c = __private::decode_utf8(ptr_, i);
+    front_ = i;
+    return Option<char32_t>::some(c);
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<char32_t> next_back() noexcept {
+    if (front_ == back_) return Option<char32_t>::none();
+    size_t i = back_;
+    const char32_t c = __private::decode_utf8_back(ptr_, i);
+    back_ = i;
+    return Option<char32_t>::some(c);
+  }
+
+  /// sus::iter::Iterator trait.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    // Each character is 1 to 4 bytes.
+    const usize bytes = back_ - front_;
+    return ::sus::iter::SizeHint((bytes + 3u) / 4u,
+                                 Option<usize>::some(bytes));
+  }
+
+ private:
+  friend class Str;
+  friend class CharIndices;
+
+  constexpr Chars(const uint8_t* ptr, size_t len) noexcept
+      : ptr_(ptr), front_(0u), back_(len) {}
+
+  const uint8_t* ptr_;
+  size_t front_;
+  size_t back_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(ptr_),
+                                  decltype(front_), decltype(back_));
+};
+
+/// An iterator over the characters of a `Str` and their byte positions.
+class [[nodiscard]] [[sus_trivial_abi]] CharIndices final
+    : public ::sus::iter::IteratorBase<CharIndices,
+                                       ::sus::Tuple<usize, char32_t>> {
+ public:
+  using Item = ::sus::Tuple<usize, char32_t>;
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    const usize pos = chars_.front_;
+    return chars_.next().map(
+        [pos](char32_t c) { return Item::with(pos, c); });
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Item> next_back() noexcept {
+    return chars_.next_back().map([this](char32_t c) {
+      return Item::with(usize(chars_.back_), c);
+    });
+  }
+
+  /// sus::iter::Iterator trait.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    return chars_.size_hint();
+  }
+
+ private:
+  friend class Str;
+
+  constexpr CharIndices(Chars chars) noexcept : chars_(chars) {}
+
+  Chars chars_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(chars_));
+};
+
+/// An iterator over the substrings of a `Str` separated by a pattern.
+///
+/// This is not a `DoubleEndedIterator`, since matches of a pattern that
+/// overlaps itself, such as `"aa"` in `"aaa"`, are different when searching
+/// from the back.
+class [[nodiscard]] [[sus_trivial_abi]] Split final
+    : public ::sus::iter::IteratorBase<Split, Str> {
+ public:
+  using Item = Str;
+
+  // sus::iter::Iterator trait.
+  Option<Str> next() noexcept {
+    if (finished_) return Option<Str>::none();
+    const size_t i =
+        __private::find_bytes(rest_.ptr_, size_t{rest_.len_}, pattern_.ptr_,
+                              size_t{pattern_.len_});
+    if (i == rest_.len_) {
+      finished_ = true;
+      return Option<Str>::some(rest_);
+    }
+    const auto piece = Str(rest_.ptr_, i);
+    const usize skip = i + pattern_.len_;
+    rest_ = Str(rest_.ptr_ + size_t{skip}, rest_.len_ - skip);
+    return Option<Str>::some(piece);
+  }
+
+  /// sus::iter::Iterator trait.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    if (finished_) return ::sus::iter::SizeHint(0u, Option<usize>::some(0u));
+    return ::sus::iter::SizeHint(
+        1u, Option<usize>::some(rest_.len_ / pattern_.len_ + 1u));
+  }
+
+ private:
+  friend class Str;
+
+  constexpr Split(Str s, Str pattern) noexcept : rest_(s), pattern_(pattern) {}
+
+  Str rest_;
+  Str pattern_;
+  bool finished_ = false;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(rest_),
+                                  decltype(pattern_), decltype(finished_));
+};
+
+/// An iterator over the lines of a `Str`.
+class [[nodiscard]] [[sus_trivial_abi]] Lines final
+    : public ::sus::iter::IteratorBase<Lines, Str> {
+ public:
+  using Item = Str;
+
+  // sus::iter::Iterator trait.
+  Option<Str> next() noexcept {
+    if (rest_.is_empty()) return Option<Str>::none();
+    const void* nl = memchr(rest_.ptr_, '\n', size_t{rest_.len_});
+    if (nl == nullptr) {
+      return Option<Str>::some(
+          strip_cr(::sus::mem::replace(mref(rest_), Str())));
+    }
+    const size_t i =
+        static_cast<size_t>(static_cast<const uint8_t*>(nl) - rest_.ptr_);
+    auto line = Str(rest_.ptr_, i);
+    rest_ = Str(rest_.ptr_ + i + 1u, rest_.len_ - i - 1u);
+    return Option<Str>::some(strip_cr(line));
+  }
+
+  // sus::iter::DoubleEndedIterator trait.
+  Option<Str> next_back() noexcept {
+    if (rest_.is_empty()) return Option<Str>::none();
+    // The line ending of the last line, if any, is not part of the search.
+    size_t end = size_t{rest_.len_};
+    if (rest_.ptr_[end - 1u] == '\n') end -= 1u;
+    size_t start = end;
+    while (start > 0u && rest_.ptr_[start - 1u] != '\n') start -= 1u;
+    auto line = Str(rest_.ptr_ + start, end - start);
+    rest_ = Str(rest_.ptr_, start);
+    return Option<Str>::some(strip_cr(line));
+  }
+
+  /// sus::iter::Iterator trait.
+  ::sus::iter::SizeHint size_hint() const noexcept final {
+    const usize lower = rest_.is_empty() ? 0u : 1u;
+    return ::sus::iter::SizeHint(lower, Option<usize>::some(rest_.len_));
+  }
+
+ private:
+  friend class Str;
+
+  constexpr Lines(Str s) noexcept : rest_(s) {}
+
+  static Str strip_cr(Str line) noexcept {
+    if (!line.is_empty() && line.ptr_[size_t{line.len_} - 1u] == '\r')
+      return Str(line.ptr_, line.len_ - 1u);
+    return line;
+  }
+
+  Str rest_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(rest_));
+};
+
+inline Chars Str::chars() const noexcept {
+  return Chars(ptr_, size_t{len_});
+}
+
+inline CharIndices Str::char_indices() const noexcept {
+  return CharIndices(chars());
+}
+
+inline Split Str::split(Str pattern) const noexcept {
+  ::sus::check(!pattern.is_empty());
+  return Split(*this, pattern);
+}
+
+inline Lines Str::lines() const noexcept { return Lines(*this); }
+
+}  // namespace sus::string
+
+// Promote Str into the `sus` namespace.
+namespace sus {
+using ::sus::string::Str;
+}  // namespace sus
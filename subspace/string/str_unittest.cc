@@ -0,0 +1,206 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/string/str.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/prelude.h"
+#include "subspace/string/string.h"
+#include "subspace/test/ensure_use.h"
+
+namespace {
+
+using sus::string::Str;
+
+TEST(Str, FromLiteral) {
+  auto s = Str::from("hello");
+  EXPECT_EQ(s.len(), 5u);
+  EXPECT_FALSE(s.is_empty());
+  EXPECT_TRUE(Str().is_empty());
+  EXPECT_TRUE(Str::from("").is_empty());
+  EXPECT_TRUE(Str::from_utf8(sus::Slice<u8>()).unwrap().is_empty());
+  EXPECT_EQ(s.as_bytes()[0u], u8('h'));
+  EXPECT_EQ(s.as_bytes().as_ptr(), s.as_ptr());
+}
+
+TEST(Str, FromUtf8) {
+  u8 ok[] = {0x61, 0xC3, 0xA9, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x80};
+  auto s = Str::from_utf8(sus::Slice<u8>::from(ok)).unwrap();
+  EXPECT_EQ(s.len(), 10u);
+  EXPECT_EQ(s.chars().count(), 4u);
+
+  // A stray continuation byte.
+  u8 bad[] = {0x61, 0x62, 0x80, 0x63};
+  auto e = Str::from_utf8(sus::Slice<u8>::from(bad)).unwrap_err();
+  EXPECT_EQ(e.valid_up_to(), 2u);
+  EXPECT_EQ(e.error_len(), sus::some(1_usize));
+
+  // Truncated in the middle of a character.
+  u8 trunc[] = {0x61, 0xE2, 0x82};
+  e = Str::from_utf8(sus::Slice<u8>::from(trunc)).unwrap_err();
+  EXPECT_EQ(e.valid_up_to(), 1u);
+  EXPECT_TRUE(e.error_len().is_none());
+
+  // Surrogates, overlong encodings, and values past U+10FFFF are rejected.
+  u8 surrogate[] = {0xED, 0xA0, 0x80};
+  EXPECT_TRUE(Str::from_utf8(sus::Slice<u8>::from(surrogate)).is_err());
+  u8 overlong[] = {0xC0, 0xAF};
+  EXPECT_TRUE(Str::from_utf8(sus::Slice<u8>::from(overlong)).is_err());
+  u8 overlong3[] = {0xE0, 0x80, 0xAF};
+  e = Str::from_utf8(sus::Slice<u8>::from(overlong3)).unwrap_err();
+  EXPECT_EQ(e.error_len(), sus::some(1_usize));
+  u8 too_big[] = {0xF4, 0x90, 0x80, 0x80};
+  EXPECT_TRUE(Str::from_utf8(sus::Slice<u8>::from(too_big)).is_err());
+
+  // An error after a long run of ASCII is found past the word-at-a-time scan.
+  u8 long_ascii[40];
+  for (u8& b : long_ascii) b = u8(0x61);
+  long_ascii[37] = u8(0xFF);
+  e = Str::from_utf8(sus::Slice<u8>::from(long_ascii)).unwrap_err();
+  EXPECT_EQ(e.valid_up_to(), 37u);
+}
+
+TEST(Str, Chars) {
+  auto s = Str::from("aé€\U0001F600");
+  auto it = s.chars();
+  EXPECT_EQ(it.next(), sus::some(U'a'));
+  EXPECT_EQ(it.next_back(), sus::some(U'\U0001F600'));
+  EXPECT_EQ(it.next(), sus::some(U'é'));
+  EXPECT_EQ(it.next_back(), sus::some(U'€'));
+  EXPECT_TRUE(it.next().is_none());
+  EXPECT_TRUE(it.next_back().is_none());
+
+  auto idx = s.char_indices();
+  auto [i0, c0] = idx.next().unwrap();
+  EXPECT_EQ(i0, 0u);
+  EXPECT_EQ(c0, U'a');
+  auto [i1, c1] = idx.next().unwrap();
+  EXPECT_EQ(i1, 1u);
+  EXPECT_EQ(c1, U'é');
+  auto [i3, c3] = idx.next_back().unwrap();
+  EXPECT_EQ(i3, 6u);
+  EXPECT_EQ(c3, U'\U0001F600');
+  auto [i2, c2] = idx.next().unwrap();
+  EXPECT_EQ(i2, 3u);
+  EXPECT_EQ(c2, U'€');
+  EXPECT_TRUE(idx.next().is_none());
+}
+
+TEST(Str, Get) {
+  auto s = Str::from("aéb");
+  EXPECT_TRUE(s.is_char_boundary(1u));
+  EXPECT_FALSE(s.is_char_boundary(2u));
+  EXPECT_TRUE(s.is_char_boundary(4u));
+  EXPECT_FALSE(s.is_char_boundary(5u));
+  EXPECT_EQ(s.get("1..3"_r), sus::some(Str::from("é")));
+  EXPECT_TRUE(s.get("1..2"_r).is_none());
+  EXPECT_TRUE(s.get("0..5"_r).is_none());
+  EXPECT_EQ(s["3.."_r], Str::from("b"));
+  EXPECT_EQ(s[".."_r], s);
+}
+
+TEST(Str, Search) {
+  auto s = Str::from("hello world");
+  EXPECT_TRUE(s.starts_with(Str::from("hello")));
+  EXPECT_FALSE(s.starts_with(Str::from("world")));
+  EXPECT_TRUE(s.ends_with(Str::from("world")));
+  EXPECT_TRUE(s.ends_with(Str()));
+  EXPECT_EQ(s.find(Str::from("o")), sus::some(4_usize));
+  EXPECT_EQ(s.find(Str::from("orl")), sus::some(7_usize));
+  EXPECT_TRUE(s.find(Str::from("xyz")).is_none());
+  EXPECT_TRUE(s.find(Str::from("hello world!")).is_none());
+  EXPECT_TRUE(s.contains(Str::from("lo w")));
+}
+
+TEST(Str, Split) {
+  auto s = Str::from("a,b,,c,");
+  auto v = sus::Vec<Str>();
+  for (Str piece : s.split(Str::from(","))) v.push(piece);
+  EXPECT_EQ(v.len(), 5u);
+  EXPECT_EQ(v[0u], Str::from("a"));
+  EXPECT_EQ(v[1u], Str::from("b"));
+  EXPECT_EQ(v[2u], Str());
+  EXPECT_EQ(v[3u], Str::from("c"));
+  EXPECT_EQ(v[4u], Str());
+
+  auto it = Str::from("one::two::three").split(Str::from("::"));
+  EXPECT_EQ(it.next(), sus::some(Str::from("one")));
+  EXPECT_EQ(it.next(), sus::some(Str::from("two")));
+  EXPECT_EQ(it.next(), sus::some(Str::from("three")));
+  EXPECT_TRUE(it.next().is_none());
+
+  // Matches of a self-overlapping pattern are found from the front.
+  auto overlap = Str::from("aaa").split(Str::from("aa"));
+  EXPECT_EQ(overlap.next(), sus::some(Str()));
+  EXPECT_EQ(overlap.next(), sus::some(Str::from("a")));
+  EXPECT_TRUE(overlap.next().is_none());
+
+  EXPECT_EQ(Str::from("abc").split(Str::from(",")).count(), 1u);
+  EXPECT_EQ(Str().split(Str::from(",")).count(), 1u);
+}
+
+TEST(Str, Lines) {
+  auto s = Str::from("one\r\ntwo\n\nthree\n");
+  auto v = sus::Vec<Str>();
+  for (Str line : s.lines()) v.push(line);
+  EXPECT_EQ(v.len(), 4u);
+  EXPECT_EQ(v[0u], Str::from("one"));
+  EXPECT_EQ(v[1u], Str::from("two"));
+  EXPECT_EQ(v[2u], Str());
+  EXPECT_EQ(v[3u], Str::from("three"));
+
+  auto it = s.lines();
+  EXPECT_EQ(it.next_back(), sus::some(Str::from("three")));
+  EXPECT_EQ(it.next_back(), sus::some(Str()));
+  EXPECT_EQ(it.next(), sus::some(Str::from("one")));
+  EXPECT_EQ(it.next_back(), sus::some(Str::from("two")));
+  EXPECT_TRUE(it.next().is_none());
+
+  EXPECT_EQ(Str().lines().count(), 0u);
+  EXPECT_EQ(Str::from("x").lines().count(), 1u);
+  EXPECT_EQ(Str::from("x\r").lines().next(), sus::some(Str::from("x")));
+}
+
+TEST(Str, Ord) {
+  EXPECT_LT(Str::from("abc"), Str::from("abd"));
+  EXPECT_LT(Str::from("ab"), Str::from("abc"));
+  EXPECT_LT(Str(), Str::from("a"));
+  EXPECT_LT(Str::from("z"), Str::from("é"));
+  EXPECT_EQ(Str::from("abc"), Str::from("abc"));
+  static_assert(sus::ops::Ord<Str>);
+}
+
+TEST(Str, ConcatJoin) {
+  Str parts[] = {Str::from("a"), Str::from("bc"), Str::from("d")};
+  auto s = sus::Slice<Str>::from(parts);
+  EXPECT_EQ(s.concat(), Str::from("abcd"));
+  EXPECT_EQ(s.join(Str::from(", ")), Str::from("a, bc, d"));
+}
+
+#if GTEST_HAS_DEATH_TEST
+TEST(StrDeathTest, InvalidRange) {
+  auto s = Str::from("aé");
+  EXPECT_DEATH(s["0..2"_r], "");
+  EXPECT_DEATH(Str::from("\xff"), "");
+  EXPECT_DEATH(
+      {
+        auto it = s.split(Str());
+        ensure_use(&it);
+      },
+      "");
+}
+#endif
+
+}  // namespace
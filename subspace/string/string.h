@@ -0,0 +1,338 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <compare>
+#include <new>
+
+#include "subspace/assertions/check.h"
+#include "subspace/containers/slice.h"
+#include "subspace/containers/vec.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/marker/unsafe.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+#include "subspace/string/__private/utf8.h"
+#include "subspace/string/str.h"
+
+namespace sus::string {
+
+/// An owned, growable UTF-8 string.
+///
+/// Short strings are stored inline in the String object itself, without
+/// allocating, which makes building and copying small strings such as keys,
+/// names and numbers cheap. Longer strings are stored in a `Vec<u8>`, which
+/// can be moved into and out of the String without copying through
+/// `from_utf8()` and `into_bytes()`.
+///
+/// Borrowing the contents of a String as a `Str` with `as_str()` gives access
+/// to searching, splitting, and iterating over characters.
+///
+/// # Example
+/// ```
+/// auto s = sus::String::from("hello");
+/// s.push(U' ');
+/// s.push_str(sus::Str::from("world"));
+/// sus::check(s.as_str() == sus::Str::from("hello world"));
+/// ```
+class String final {
+ public:
+  /// The number of bytes a String can hold without allocating.
+  static constexpr size_t kInlineCapacity = 31u;
+
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty String, without allocating.
+  String() noexcept { set_inline_len(0u); }
+
+  /// Constructs an empty String with space for at least `cap` bytes.
+  static String with_capacity(usize cap) noexcept {
+    auto s = String();
+    s.reserve(cap);
+    return s;
+  }
+
+  /// sus::construct::From<Str> trait.
+  ///
+  /// Constructs a String holding a copy of `s`.
+  static String from(Str s) noexcept {
+    auto out = String::with_capacity(s.len());
+    out.push_str(s);
+    return out;
+  }
+  /// sus::construct::From<const char[N]> trait.
+  ///
+  /// Constructs a String holding a copy of a string literal.
+  ///
+  /// # Panics
+  /// This function will panic if the literal is not valid UTF-8.
+  template <size_t N>
+  static String from(const char (&s)[N]) noexcept {
+    return from(Str::from(s));
+  }
+
+  /// Converts bytes to a String, after checking that they are valid UTF-8.
+  ///
+  /// The Vec is moved into the String, without copying the bytes.
+  static ::sus::Result<String, Utf8Error> from_utf8(Vec<u8> bytes) noexcept {
+    const auto v = __private::validate_utf8(
+        reinterpret_cast<const uint8_t*>(bytes.as_ptr()), size_t{bytes.len()});
+    if (v.valid_up_to != bytes.len()) {
+      return ::sus::Result<String, Utf8Error>::with_err(
+          Utf8Error(v.valid_up_to, v.error_len));
+    }
+    return ::sus::Result<String, Utf8Error>::with(
+        String(::sus::move(bytes)));
+  }
+
+  /// Converts bytes to a String without checking that they are valid UTF-8.
+  ///
+  /// # Safety
+  /// The bytes must be valid UTF-8.
+  static String from_utf8_unchecked(::sus::marker::UnsafeFnMarker,
+                                    Vec<u8> bytes) noexcept {
+    return String(::sus::move(bytes));
+  }
+
+  ~String() noexcept {
+    if (is_heap()) heap().~Vec<u8>();
+  }
+
+  String(String&& o) noexcept {
+    memcpy(storage_, o.storage_, kStorageSize);
+    o.set_inline_len(0u);
+  }
+  String& operator=(String&& o) noexcept {
+    if (this != &o) {
+      if (is_heap()) heap().~Vec<u8>();
+      memcpy(storage_, o.storage_, kStorageSize);
+      o.set_inline_len(0u);
+    }
+    return *this;
+  }
+
+  /// sus::mem::Clone trait.
+  String clone() const& noexcept { return String::from(as_str()); }
+
+  /// Returns the length of the string in bytes.
+  usize len() const& noexcept {
+    return is_heap() ? heap().len() : usize(inline_len());
+  }
+  /// Returns true if the string has a length of zero bytes.
+  bool is_empty() const& noexcept { return len() == 0u; }
+  /// Returns the number of bytes the string can hold without reallocating.
+  usize capacity() const& noexcept {
+    return is_heap() ? heap().capacity() : usize(kInlineCapacity);
+  }
+
+  /// Returns a Str that borrows the contents of the string.
+  Str as_str() const& noexcept sus_lifetimebound {
+    return Str(reinterpret_cast<const uint8_t*>(data()), len());
+  }
+  Str as_str() && = delete;
+
+  /// Returns the bytes of the string, without copying.
+  ::sus::Slice<u8> as_bytes() const& noexcept sus_lifetimebound {
+    return ::sus::Slice<u8>::from_raw_parts(::sus::marker::unsafe_fn, data(),
+                                            len());
+  }
+  ::sus::Slice<u8> as_bytes() && = delete;
+
+  /// Converts the String into its bytes.
+  ///
+  /// If the string has been stored in a `Vec<u8>`, it is returned without
+  /// copying.
+  Vec<u8> into_bytes() && noexcept {
+    if (is_heap()) {
+      auto v = ::sus::move(heap());
+      heap().~Vec<u8>();
+      set_inline_len(0u);
+      return v;
+    }
+    auto v = Vec<u8>::with_capacity(inline_len());
+    v.extend_from_slice(as_bytes());
+    set_inline_len(0u);
+    return v;
+  }
+
+  /// Reserves space for at least `additional` more bytes.
+  void reserve(usize additional) noexcept {
+    if (is_heap()) {
+      heap().reserve(additional);
+      return;
+    }
+    const usize needed = usize(inline_len()) + additional;
+    if (needed > kInlineCapacity) spill(needed);
+  }
+
+  /// Appends the character `c` to the end of the string.
+  ///
+  /// # Panics
+  /// This function will panic if `c` is not a Unicode scalar value, such as a
+  /// surrogate code point.
+  void push(char32_t c) noexcept {
+    ::sus::check(__private::is_scalar_value(c));
+    uint8_t bytes[4u];
+    const size_t n = __private::encode_utf8(c, bytes);
+    append(bytes, n);
+  }
+
+  /// Appends a copy of `s` to the end of the string.
+  void push_str(Str s) noexcept { append(s.ptr_, s.len_); }
+
+  /// Shortens the string to `new_len` bytes. Does nothing if `new_len` is not
+  /// less than the current length.
+  ///
+  /// # Panics
+  /// This function will panic if `new_len` is not on a character boundary.
+  void truncate(usize new_len) noexcept {
+    if (new_len >= len()) return;
+    ::sus::check(as_str().is_char_boundary(new_len));
+    if (is_heap())
+      heap().set_len(::sus::marker::unsafe_fn, new_len);
+    else
+      set_inline_len(size_t{new_len});
+  }
+
+  /// Removes all bytes from the string, without releasing any memory.
+  void clear() noexcept { truncate(0u); }
+
+  /// sus::ops::Eq<String> trait.
+  friend bool operator==(const String& l, const String& r) noexcept {
+    return l.as_str() == r.as_str();
+  }
+  /// sus::ops::Eq<String, Str> trait.
+  friend bool operator==(const String& l, const Str& r) noexcept {
+    return l.as_str() == r;
+  }
+  /// sus::ops::Ord<String> trait.
+  friend std::strong_ordering operator<=>(const String& l,
+                                          const String& r) noexcept {
+    return l.as_str() <=> r.as_str();
+  }
+
+  /// String satisfies `sus::containers::Concat`, producing a `String`.
+  using ConcatOutputType = String;
+  /// Appends the string onto `s`, for `Slice<String>::concat()`.
+  void concat_into(String& s) const& noexcept { s.push_str(as_str()); }
+
+  /// String satisfies `sus::containers::Join<String, Str>`, producing a
+  /// `String`.
+  using JoinOutputType = String;
+  /// Appends the string onto `s`, for `Slice<String>::join()`.
+  void join_into(String& s) const& noexcept { s.push_str(as_str()); }
+  /// Appends the separator onto `s`, for `Slice<String>::join()`.
+  static void join_sep_into(String& s, const Str& separator) noexcept {
+    s.push_str(separator);
+  }
+
+ private:
+  // The String holds either the bytes of the string inline, with the length in
+  // the last byte of `storage_`, or a `Vec<u8>` at the start of `storage_`
+  // with `kHeapTag` in the last byte.
+  static constexpr size_t kStorageSize = kInlineCapacity + 1u;
+  static constexpr uint8_t kHeapTag = 0xFFu;
+  static_assert(sizeof(Vec<u8>) < kStorageSize);
+  static_assert(alignof(Vec<u8>) <= alignof(max_align_t));
+  // Moving the String moves the Vec with memcpy.
+  static_assert(::sus::mem::relocate_by_memcpy<Vec<u8>>);
+
+  explicit String(Vec<u8>&& v) noexcept {
+    new (storage_) Vec<u8>(::sus::move(v));
+    storage_[kStorageSize - 1u] = kHeapTag;
+  }
+
+  bool is_heap() const noexcept {
+    return storage_[kStorageSize - 1u] == kHeapTag;
+  }
+  size_t inline_len() const noexcept { return storage_[kStorageSize - 1u]; }
+  void set_inline_len(size_t n) noexcept {
+    storage_[kStorageSize - 1u] = static_cast<unsigned char>(n);
+  }
+  Vec<u8>& heap() noexcept {
+    return *std::launder(reinterpret_cast<Vec<u8>*>(storage_));
+  }
+  const Vec<u8>& heap() const noexcept {
+    return *std::launder(reinterpret_cast<const Vec<u8>*>(storage_));
+  }
+  const u8* data() const noexcept {
+    return is_heap() ? heap().as_ptr()
+                     : reinterpret_cast<const u8*>(storage_);
+  }
+
+  /// Moves the inline bytes into a Vec with room for `cap` bytes.
+  void spill(usize cap) noexcept {
+    const size_t n = inline_len();
+    auto v = Vec<u8>::with_capacity(cap);
+    v.extend_from_slice(::sus::Slice<u8>::from_raw_parts(
+        ::sus::marker::unsafe_fn, reinterpret_cast<const u8*>(storage_), n));
+    new (storage_) Vec<u8>(::sus::move(v));
+    storage_[kStorageSize - 1u] = kHeapTag;
+  }
+
+  void append(const uint8_t* bytes, usize n) noexcept {
+    const size_t old_len = size_t{len()};
+    const size_t count = size_t{n};
+    if (!is_heap() && old_len + count <= kInlineCapacity) {
+      memcpy(storage_ + old_len, bytes, count);
+      set_inline_len(old_len + count);
+      return;
+    }
+    // The bytes may come from this String, as in `s.push_str(s.as_str())`, in
+    // which case they move when the String grows.
+    const auto base = reinterpret_cast<uintptr_t>(data());
+    const auto addr = reinterpret_cast<uintptr_t>(bytes);
+    const bool aliased = addr >= base && addr < base + old_len;
+    if (is_heap()) {
+      heap().reserve(n);
+    } else {
+      // Grow by at least doubling, so that repeated appends are amortized.
+      const size_t needed = old_len + count;
+      spill(needed > 2u * kInlineCapacity ? needed : 2u * kInlineCapacity);
+    }
+    Vec<u8>& v = heap();
+    if (aliased)
+      bytes = reinterpret_cast<const uint8_t*>(v.as_ptr()) + (addr - base);
+    memcpy(v.as_mut_ptr() + old_len, bytes, count);
+    v.set_len(::sus::marker::unsafe_fn, old_len + count);
+  }
+
+  alignas(alignof(Vec<u8>)) unsigned char storage_[kStorageSize];
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(storage_));
+};
+
+inline void Str::concat_into(String& s) const& noexcept { s.push_str(*this); }
+
+inline void Str::join_into(String& s) const& noexcept { s.push_str(*this); }
+
+inline void Str::join_sep_into(String& s, const Str& separator) noexcept {
+  s.push_str(separator);
+}
+
+}  // namespace sus::string
+
+// Promote String into the `sus` namespace.
+namespace sus {
+using ::sus::string::String;
+}  // namespace sus
@@ -0,0 +1,159 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/string/string.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::string::Str;
+using sus::string::String;
+
+TEST(String, Default) {
+  auto s = String();
+  EXPECT_TRUE(s.is_empty());
+  EXPECT_EQ(s.len(), 0u);
+  EXPECT_EQ(s.capacity(), String::kInlineCapacity);
+  EXPECT_EQ(s.as_str(), Str());
+  static_assert(sizeof(String) == 32u);
+}
+
+TEST(String, PushInline) {
+  auto s = String::from("hi");
+  const u8* inline_ptr = s.as_bytes().as_ptr();
+  s.push(U' ');
+  s.push(U'é');
+  s.push(U'\U0001F600');
+  EXPECT_EQ(s.as_str(), Str::from("hi é\U0001F600"));
+  EXPECT_EQ(s.len(), 9u);
+  // Short strings stay inline, without allocating.
+  EXPECT_EQ(s.capacity(), String::kInlineCapacity);
+  EXPECT_EQ(s.as_bytes().as_ptr(), inline_ptr);
+}
+
+TEST(String, Spill) {
+  auto s = String();
+  for (char32_t i = 0u; i < 100u; ++i) s.push(U'a' + i % 26u);
+  EXPECT_EQ(s.len(), 100u);
+  EXPECT_GE(s.capacity(), 100u);
+  EXPECT_TRUE(
+      s.as_str().starts_with(Str::from("abcdefghijklmnopqrstuvwxyzab")));
+
+  auto t = String::from("0123456789012345678901234567890");
+  EXPECT_EQ(t.len(), String::kInlineCapacity);
+  EXPECT_EQ(t.capacity(), String::kInlineCapacity);
+  t.push(U'!');
+  EXPECT_EQ(t.as_str(), Str::from("0123456789012345678901234567890!"));
+  EXPECT_GT(t.capacity(), String::kInlineCapacity);
+}
+
+TEST(String, PushSelf) {
+  auto s = String::from("abc");
+  s.push_str(s.as_str());
+  EXPECT_EQ(s, Str::from("abcabc"));
+  // Appending to itself while moving out of the inline storage.
+  for (i32 i = 0; i < 4; i += 1) s.push_str(s.as_str());
+  EXPECT_EQ(s.len(), 96u);
+  EXPECT_TRUE(s.as_str().ends_with(Str::from("abcabc")));
+  s.push_str(s.as_str());
+  EXPECT_EQ(s.len(), 192u);
+}
+
+TEST(String, WithCapacity) {
+  auto s = String::with_capacity(100u);
+  EXPECT_GE(s.capacity(), 100u);
+  EXPECT_TRUE(s.is_empty());
+  s.push_str(Str::from("x"));
+  EXPECT_EQ(s, Str::from("x"));
+}
+
+TEST(String, Bytes) {
+  auto v = sus::Vec<u8>::with_values(u8('a'), u8('b'));
+  const u8* p = v.as_ptr();
+  auto s = String::from_utf8(sus::move(v)).unwrap();
+  EXPECT_EQ(s, Str::from("ab"));
+  // The Vec moves in and out without copying.
+  EXPECT_EQ(s.as_bytes().as_ptr(), p);
+  auto back = sus::move(s).into_bytes();
+  EXPECT_EQ(back.as_ptr(), p);
+  EXPECT_EQ(back.len(), 2u);
+
+  auto inl = String::from("xyz");
+  auto bytes = sus::move(inl).into_bytes();
+  EXPECT_EQ(bytes, sus::Vec<u8>::with_values(u8('x'), u8('y'), u8('z')));
+
+  auto bad = sus::Vec<u8>::with_values(u8('a'), u8(0xFF));
+  EXPECT_EQ(String::from_utf8(sus::move(bad)).unwrap_err().valid_up_to(), 1u);
+}
+
+TEST(String, MoveClone) {
+  auto a = String::from("short");
+  auto b = sus::move(a);
+  EXPECT_EQ(b, Str::from("short"));
+  EXPECT_TRUE(a.is_empty());
+
+  auto l = String::from("a string which is too long to be stored inline");
+  auto c = l.clone();
+  EXPECT_EQ(c, l);
+  EXPECT_NE(c.as_bytes().as_ptr(), l.as_bytes().as_ptr());
+  auto m = sus::move(l);
+  EXPECT_EQ(m, c);
+  m = sus::move(b);
+  EXPECT_EQ(m, Str::from("short"));
+  EXPECT_TRUE(b.is_empty());
+}
+
+TEST(String, TruncateClear) {
+  auto s = String::from("aéb");
+  s.truncate(3u);
+  EXPECT_EQ(s, Str::from("aé"));
+  s.truncate(10u);
+  EXPECT_EQ(s.len(), 3u);
+  s.clear();
+  EXPECT_TRUE(s.is_empty());
+
+  auto l = String::from("a string which is too long to be stored inline");
+  const usize cap = l.capacity();
+  l.clear();
+  EXPECT_TRUE(l.is_empty());
+  EXPECT_EQ(l.capacity(), cap);
+}
+
+TEST(String, Ord) {
+  EXPECT_LT(String::from("abc"), String::from("abd"));
+  EXPECT_EQ(String::from("abc"), String::from("abc"));
+  static_assert(sus::ops::Ord<String>);
+  static_assert(sus::mem::Clone<String>);
+}
+
+TEST(String, ConcatJoin) {
+  String parts[] = {String::from("a"), String::from("bc"), String::from("d")};
+  auto s = sus::Slice<String>::from(parts);
+  EXPECT_EQ(s.concat(), Str::from("abcd"));
+  EXPECT_EQ(s.join(Str::from("--")), Str::from("a--bc--d"));
+}
+
+#if GTEST_HAS_DEATH_TEST
+TEST(StringDeathTest, InvalidChar) {
+  auto s = String();
+  EXPECT_DEATH(s.push(char32_t{0xD800}), "");
+  EXPECT_DEATH(s.push(char32_t{0x110000}), "");
+  auto t = String::from("é");
+  EXPECT_DEATH(t.truncate(1u), "");
+}
+#endif
+
+}  // namespace
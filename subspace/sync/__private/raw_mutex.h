@@ -0,0 +1,90 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+namespace sus::sync::__private {
+
+/// A mutual exclusion lock on a single 32-bit word, in the style of a futex
+/// lock.
+///
+/// The word is 0 when unlocked, 1 when locked, and 2 when locked with threads
+/// (possibly) blocked waiting for it. Locking and unlocking without contention
+/// are a single atomic operation each, and unlocking only makes a syscall to
+/// wake a thread when the word says there may be one waiting.
+class RawMutex {
+ public:
+  constexpr RawMutex() noexcept = default;
+
+  RawMutex(const RawMutex&) = delete;
+  RawMutex& operator=(const RawMutex&) = delete;
+
+  bool try_lock() noexcept {
+    uint32_t unlocked = kUnlocked;
+    return state_.compare_exchange_strong(unlocked, kLocked,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed);
+  }
+
+  void lock() noexcept {
+    if (!try_lock()) lock_contended();
+  }
+
+  void unlock() noexcept {
+    if (state_.exchange(kUnlocked, std::memory_order_release) == kContended)
+      state_.notify_one();
+  }
+
+ private:
+  void lock_contended() noexcept {
+    // Spin for a short while first, as critical sections tend to be short and
+    // the lock may be released before it's worth going to sleep.
+    uint32_t state = spin();
+    if (state == kUnlocked) {
+      if (state_.compare_exchange_strong(state, kLocked,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed))
+        return;
+    }
+    while (true) {
+      // Mark the lock as contended, which also acquires it if it was
+      // unlocked. Once it's been marked, the unlocking thread will wake us.
+      if (state != kContended &&
+          state_.exchange(kContended, std::memory_order_acquire) == kUnlocked)
+        return;
+      state_.wait(kContended, std::memory_order_relaxed);
+      state = spin();
+    }
+  }
+
+  uint32_t spin() noexcept {
+    uint32_t state = state_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0u; state == kLocked && i < kSpinLimit; ++i)
+      state = state_.load(std::memory_order_relaxed);
+    return state;
+  }
+
+  static constexpr uint32_t kUnlocked = 0u;
+  static constexpr uint32_t kLocked = 1u;
+  static constexpr uint32_t kContended = 2u;
+  static constexpr uint32_t kSpinLimit = 100u;
+
+  std::atomic<uint32_t> state_ = kUnlocked;
+};
+
+}  // namespace sus::sync::__private
@@ -0,0 +1,139 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+namespace sus::sync::__private {
+
+/// A reader-writer lock on a single 32-bit word, in the style of a futex lock.
+///
+/// The low 31 bits hold the number of readers, or `kWriteLocked` when a writer
+/// holds the lock. The high bit is set when threads (possibly) are blocked
+/// waiting for the lock. While it is set, new readers will not acquire the
+/// lock, so that a waiting writer is not starved by a stream of readers.
+///
+/// The waiting bit is only cleared when the lock becomes free, by the thread
+/// that frees it, which then wakes all blocked threads to compete for the lock
+/// again. Unlocking without any threads blocked does not make a syscall.
+class RawRwLock {
+ public:
+  constexpr RawRwLock() noexcept = default;
+
+  RawRwLock(const RawRwLock&) = delete;
+  RawRwLock& operator=(const RawRwLock&) = delete;
+
+  bool try_read() noexcept {
+    uint32_t state = state_.load(std::memory_order_relaxed);
+    while (can_read(state)) {
+      if (state_.compare_exchange_weak(state, state + 1u,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed))
+        return true;
+    }
+    return false;
+  }
+
+  void read() noexcept {
+    uint32_t state = state_.load(std::memory_order_relaxed);
+    while (true) {
+      if (can_read(state)) {
+        if (state_.compare_exchange_weak(state, state + 1u,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed))
+          return;
+        continue;
+      }
+      if (!mark_waiting(state)) continue;
+      state_.wait(state, std::memory_order_relaxed);
+      state = state_.load(std::memory_order_relaxed);
+    }
+  }
+
+  void read_unlock() noexcept {
+    const uint32_t state = state_.fetch_sub(1u, std::memory_order_release);
+    if (state == (kWaiting | 1u)) wake_from(kWaiting);
+  }
+
+  bool try_write() noexcept {
+    uint32_t state = state_.load(std::memory_order_relaxed);
+    while ((state & kCountMask) == 0u) {
+      if (state_.compare_exchange_weak(state, state | kWriteLocked,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed))
+        return true;
+    }
+    return false;
+  }
+
+  void write() noexcept {
+    uint32_t state = state_.load(std::memory_order_relaxed);
+    while (true) {
+      if ((state & kCountMask) == 0u) {
+        if (state_.compare_exchange_weak(state, state | kWriteLocked,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed))
+          return;
+        continue;
+      }
+      if (!mark_waiting(state)) continue;
+      state_.wait(state, std::memory_order_relaxed);
+      state = state_.load(std::memory_order_relaxed);
+    }
+  }
+
+  void write_unlock() noexcept {
+    if (state_.exchange(0u, std::memory_order_release) & kWaiting)
+      state_.notify_all();
+  }
+
+ private:
+  static bool can_read(uint32_t state) noexcept {
+    return (state & kWaiting) == 0u && (state & kCountMask) < kMaxReaders;
+  }
+
+  /// Sets the waiting bit in `state` if it is not already set. Returns false,
+  /// with `state` updated to the current state, if the state had changed.
+  bool mark_waiting(uint32_t& state) noexcept {
+    if (state & kWaiting) return true;
+    if (state_.compare_exchange_weak(state, state | kWaiting,
+                                     std::memory_order_relaxed,
+                                     std::memory_order_relaxed)) {
+      state |= kWaiting;
+      return true;
+    }
+    return false;
+  }
+
+  /// Clears the waiting bit and wakes all waiters, if the lock is still free.
+  /// If another thread acquired the lock in the meantime, the waiting bit is
+  /// left set and that thread will wake the waiters when it unlocks.
+  void wake_from(uint32_t state) noexcept {
+    if (state_.compare_exchange_strong(state, 0u, std::memory_order_relaxed,
+                                       std::memory_order_relaxed))
+      state_.notify_all();
+  }
+
+  static constexpr uint32_t kWaiting = 1u << 31u;
+  static constexpr uint32_t kCountMask = kWaiting - 1u;
+  static constexpr uint32_t kWriteLocked = kCountMask;
+  static constexpr uint32_t kMaxReaders = kWriteLocked - 1u;
+
+  std::atomic<uint32_t> state_ = 0u;
+};
+
+}  // namespace sus::sync::__private
@@ -0,0 +1,96 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+namespace sus::sync::__private {
+
+/// The size of a cache line, used to keep independently written atomics from
+/// sharing a line and bouncing it between cores.
+///
+/// This is a constant rather than `std::hardware_destructive_interference_size`
+/// as the latter changes with compiler flags, and it is used in layout.
+inline constexpr size_t kCacheLineSize = 64u;
+
+/// Blocks threads until an event occurs, in the style of a futex.
+///
+/// A thread that wants to wait for a condition calls `prepare_wait()`, then
+/// re-checks the condition, and then calls `wait()` with the epoch returned
+/// from `prepare_wait()` if the condition still does not hold. A thread that
+/// makes the condition true calls `notify_one()` or `notify_all()` afterward.
+///
+/// When no thread is waiting, notifying costs a fence and a load, and does not
+/// write to shared memory or make a syscall.
+class Waiter {
+ public:
+  constexpr Waiter() noexcept = default;
+
+  Waiter(const Waiter&) = delete;
+  Waiter& operator=(const Waiter&) = delete;
+
+  /// Registers the current thread as a waiter, and returns the epoch to pass to
+  /// `wait()`.
+  ///
+  /// The caller must re-check the condition it is waiting for after calling
+  /// `prepare_wait()`, and must always call `finish_wait()` afterward, whether
+  /// it called `wait()` or not.
+  uint32_t prepare_wait() noexcept {
+    waiters_.fetch_add(1u, std::memory_order_seq_cst);
+    return epoch_.load(std::memory_order_seq_cst);
+  }
+
+  /// Blocks the current thread until the epoch changes from `epoch`. May also
+  /// return spuriously.
+  void wait(uint32_t epoch) noexcept {
+    epoch_.wait(epoch, std::memory_order_seq_cst);
+  }
+
+  /// Unregisters the current thread as a waiter.
+  void finish_wait() noexcept {
+    waiters_.fetch_sub(1u, std::memory_order_relaxed);
+  }
+
+  /// Wakes up one thread blocked in `wait()`, if there are any.
+  void notify_one() noexcept {
+    if (has_waiters()) {
+      epoch_.fetch_add(1u, std::memory_order_seq_cst);
+      epoch_.notify_one();
+    }
+  }
+
+  /// Wakes up all threads blocked in `wait()`.
+  void notify_all() noexcept {
+    if (has_waiters()) {
+      epoch_.fetch_add(1u, std::memory_order_seq_cst);
+      epoch_.notify_all();
+    }
+  }
+
+ private:
+  bool has_waiters() noexcept {
+    // Pairs with the `fetch_add()` in `prepare_wait()`: either the waiter sees
+    // the state change made before calling notify, or we see the waiter.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return waiters_.load(std::memory_order_seq_cst) != 0u;
+  }
+
+  std::atomic<uint32_t> epoch_ = 0u;
+  std::atomic<uint32_t> waiters_ = 0u;
+};
+
+}  // namespace sus::sync::__private
@@ -0,0 +1,62 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/rc/__private/rc_box.h"
+#include "subspace/rc/__private/rc_ptr.h"
+
+namespace sus::sync {
+
+/// A non-owning reference to the value in an `Arc`.
+///
+/// A Weak does not keep the value alive, but it keeps the allocation alive, so
+/// that `upgrade()` can tell if the value is still there. This allows cycles of
+/// `Arc` to be broken by making one of the links a Weak.
+///
+/// This type is created by `Arc::downgrade()`.
+template <class T>
+using Weak =
+    ::sus::rc::__private::WeakPtr<T, ::sus::rc::__private::AtomicCounts>;
+
+/// A thread-safe reference-counted pointer, which shares ownership of a value
+/// on the heap.
+///
+/// Cloning an Arc makes another pointer to the same value, and the value is
+/// destroyed when the last Arc pointing to it is destroyed. Access to the value
+/// is const, since it is shared. Use `make_mut()` to get mutable access with
+/// copy-on-write, or put a type that synchronizes its own mutation, such as a
+/// `Mutex`, inside the Arc.
+///
+/// The reference counts are atomic, so an Arc and its clones can be used from
+/// different threads at once. This makes cloning and dropping an Arc more
+/// expensive than a `sus::rc::Rc`, which should be preferred for values that
+/// are not shared between threads.
+///
+/// An Arc is never null, except when moved-from, so `Option<Arc<T>>` is the
+/// same size as a pointer.
+///
+/// `Arc<Slice<T>>` is a specialization which holds an immutable array of
+/// elements in the same allocation as the reference counts, and can be
+/// accessed through `as_slice()`.
+///
+/// # Example
+/// ```
+/// auto config = sus::sync::Arc<Config>::with(Config::load());
+/// auto t = std::thread([c = config.clone()]() { use_config(*c); });
+/// ```
+template <class T>
+using Arc = ::sus::rc::__private::RcPtr<T, ::sus::rc::__private::AtomicCounts>;
+
+}  // namespace sus::sync
@@ -0,0 +1,139 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/arc.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+#include "subspace/sync/mutex.h"
+
+namespace {
+
+using sus::sync::Arc;
+using sus::sync::Weak;
+
+static_assert(sizeof(Arc<i32>) == sizeof(void*));
+static_assert(sizeof(sus::Option<Arc<i32>>) == sizeof(void*));
+static_assert(sizeof(sus::Option<Arc<sus::Slice<i32>>>) == sizeof(void*));
+static_assert(sus::mem::Clone<Arc<i32>>);
+static_assert(!sus::mem::Copy<Arc<i32>>);
+
+TEST(Arc, Clone) {
+  auto a = Arc<Vec<i32>>::with(sus::Vec<i32>::with_values(1, 2));
+  auto b = a.clone();
+  EXPECT_TRUE(a.ptr_eq(b));
+  EXPECT_EQ(a.strong_count(), 2u);
+  EXPECT_EQ(*a, *b);
+  EXPECT_EQ(b->len(), 2u);
+}
+
+TEST(Arc, MoveAssign) {
+  auto a = Arc<i32>::with(1);
+  auto b = Arc<i32>::with(2);
+  a = sus::move(b);
+  EXPECT_EQ(*a, 2);
+
+  // Self-move keeps the value alive.
+  auto& self = a;
+  a = sus::move(self);
+  EXPECT_EQ(*a, 2);
+  EXPECT_EQ(a.strong_count(), 1u);
+}
+
+TEST(Arc, MakeMut) {
+  auto a = Arc<Vec<i32>>::with(sus::Vec<i32>::with_values(1, 2));
+  const Vec<i32>* before = &*a;
+  a.make_mut().push(3);
+  EXPECT_EQ(&*a, before);
+
+  auto b = a.clone();
+  a.make_mut().push(4);
+  EXPECT_EQ(*a, sus::Vec<i32>::with_values(1, 2, 3, 4));
+  EXPECT_EQ(*b, sus::Vec<i32>::with_values(1, 2, 3));
+
+  auto w = b.downgrade();
+  b.make_mut().push(5);
+  EXPECT_EQ(*b, sus::Vec<i32>::with_values(1, 2, 3, 5));
+  EXPECT_TRUE(w.upgrade().is_none());
+}
+
+TEST(Arc, GetMut) {
+  auto a = Arc<i32>::with(3);
+  a.get_mut().unwrap() = 4;
+  {
+    auto w = a.downgrade();
+    EXPECT_EQ(a.weak_count(), 1u);
+    EXPECT_TRUE(a.get_mut().is_none());
+  }
+  EXPECT_EQ(a.get_mut().unwrap(), 4);
+}
+
+TEST(Arc, Weak) {
+  auto w = Weak<i32>();
+  EXPECT_TRUE(w.upgrade().is_none());
+  {
+    auto a = Arc<i32>::with(3);
+    w = a.downgrade();
+    auto b = w.upgrade().unwrap();
+    EXPECT_EQ(*b, 3);
+  }
+  EXPECT_EQ(w.strong_count(), 0u);
+  EXPECT_TRUE(w.upgrade().is_none());
+}
+
+TEST(Arc, IntoInner) {
+  auto a = Arc<i32>::with(3);
+  auto b = a.clone();
+  EXPECT_TRUE(sus::move(a).into_inner().is_none());
+  EXPECT_EQ(sus::move(b).into_inner().unwrap(), 3);
+}
+
+TEST(Arc, Threads) {
+  auto config = Arc<Vec<i32>>::with(sus::Vec<i32>::with_values(1, 2, 3));
+  // A Mutex can't be moved, so it's constructed in place.
+  auto sums = Arc<sus::sync::Mutex<i32>>::with_fn(
+      []() { return sus::sync::Mutex<i32>::with(0); });
+  auto threads = sus::Vec<std::thread>();
+  for (i32 i = 0; i < 4; i += 1) {
+    threads.push(std::thread([c = config.clone(), s = sums.clone()]() {
+      for (i32 j = 0; j < 1000; j += 1) {
+        auto local = c.clone();
+        auto w = local.downgrade();
+        i32 sum = 0;
+        auto upgraded = w.upgrade().unwrap();
+        for (i32 v : *upgraded) sum += v;
+        *s->lock() += sum;
+      }
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+  EXPECT_EQ(*sums->lock(), 4 * 1000 * 6);
+  EXPECT_EQ(config.strong_count(), 1u);
+  EXPECT_EQ(config.weak_count(), 0u);
+}
+
+TEST(Arc, Slice) {
+  auto a = Arc<sus::Slice<i32>>::from(sus::Vec<i32>::with_values(1, 2, 3));
+  auto b = a.clone();
+  EXPECT_EQ(b.len(), 3u);
+  EXPECT_EQ(a.as_slice().as_ptr(), b.as_slice().as_ptr());
+  auto t = std::thread([c = a.clone()]() { EXPECT_EQ(c.as_slice()[1u], 2); });
+  t.join();
+  EXPECT_EQ(a.strong_count(), 2u);
+}
+
+}  // namespace
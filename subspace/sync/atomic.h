@@ -0,0 +1,278 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/fn/fn_concepts.h"
+#include "subspace/mem/move.h"
+#include "subspace/num/integer_concepts.h"
+#include "subspace/num/signed_integer.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+#include "subspace/sync/ordering.h"
+
+namespace sus::sync {
+
+/// An integer type which can be safely shared between threads.
+///
+/// `Atomic<T>` has the same in-memory representation as the underlying
+/// integer type `T` (one of the Subspace integer types, such as `u32` or
+/// `isize`). Every operation receives an explicit `Ordering`, which describes
+/// how it synchronizes with other threads.
+///
+/// Arithmetic operations (`fetch_add()`, `fetch_sub()`) wrap around on
+/// overflow, as they do in hardware. The `checked_fetch_add()` and
+/// `checked_fetch_sub()` methods instead leave the value unchanged and return
+/// None if the operation would overflow, matching the `checked_add()` and
+/// `checked_sub()` methods on the integer types.
+///
+/// Atomic types can not be copied or moved, as the value may be in use by other
+/// threads. They are typically shared between threads by reference.
+///
+/// # Example
+/// ```
+/// static auto counter = sus::sync::Atomic<u64>::with(0u);
+/// u64 id = counter.fetch_add(1u, sus::sync::Ordering::Relaxed);
+/// ```
+template <::sus::num::Integer T>
+class Atomic final {
+  using Primitive = decltype(std::declval<T>().primitive_value);
+
+ public:
+  /// Constructs an Atomic holding `value`.
+  static constexpr Atomic with(T value) noexcept { return Atomic(value); }
+
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an Atomic holding zero.
+  constexpr Atomic() noexcept : Atomic(T()) {}
+
+  Atomic(const Atomic&) = delete;
+  Atomic& operator=(const Atomic&) = delete;
+
+  /// Consumes the Atomic and returns the contained value.
+  ///
+  /// This is safe because consuming the Atomic guarantees that no other
+  /// threads are concurrently accessing it.
+  T into_inner() && noexcept {
+    return v_.load(std::memory_order_relaxed);
+  }
+
+  /// Loads the value.
+  ///
+  /// # Panics
+  /// Panics if `order` is `Release` or `AcqRel`.
+  T load(Ordering order) const noexcept {
+    ::sus::check(order != Ordering::Release && order != Ordering::AcqRel);
+    return v_.load(__private::to_memory_order(order));
+  }
+
+  /// Stores `value`.
+  ///
+  /// # Panics
+  /// Panics if `order` is `Acquire` or `AcqRel`.
+  void store(T value, Ordering order) noexcept {
+    ::sus::check(order != Ordering::Acquire && order != Ordering::AcqRel);
+    v_.store(value.primitive_value, __private::to_memory_order(order));
+  }
+
+  /// Stores `value`, returning the previous value.
+  T swap(T value, Ordering order) noexcept {
+    return v_.exchange(value.primitive_value,
+                       __private::to_memory_order(order));
+  }
+
+  /// Stores `new_value` if the current value is the same as `current`.
+  ///
+  /// Returns Ok with the previous value (which is equal to `current`) if the
+  /// value was replaced, and Err with the current value otherwise.
+  ///
+  /// The `success` ordering is used for the read-modify-write operation when
+  /// the comparison succeeds, and the `failure` ordering is used for the load
+  /// when it fails.
+  ///
+  /// # Panics
+  /// Panics if `failure` is `Release` or `AcqRel`.
+  ::sus::Result<T, T> compare_exchange(T current, T new_value, Ordering success,
+                                       Ordering failure) noexcept {
+    ::sus::check(failure != Ordering::Release && failure != Ordering::AcqRel);
+    Primitive p = current.primitive_value;
+    if (v_.compare_exchange_strong(p, new_value.primitive_value,
+                                   __private::to_memory_order(success),
+                                   __private::to_memory_order(failure))) {
+      return ::sus::Result<T, T>::with(T(p));
+    } else {
+      return ::sus::Result<T, T>::with_err(T(p));
+    }
+  }
+
+  /// Stores `new_value` if the current value is the same as `current`.
+  ///
+  /// Unlike `compare_exchange()`, this function is allowed to spuriously fail
+  /// even when the comparison succeeds, which can result in more efficient
+  /// code on some platforms. It is meant to be called in a loop.
+  ///
+  /// # Panics
+  /// Panics if `failure` is `Release` or `AcqRel`.
+  ::sus::Result<T, T> compare_exchange_weak(T current, T new_value,
+                                            Ordering success,
+                                            Ordering failure) noexcept {
+    ::sus::check(failure != Ordering::Release && failure != Ordering::AcqRel);
+    Primitive p = current.primitive_value;
+    if (v_.compare_exchange_weak(p, new_value.primitive_value,
+                                 __private::to_memory_order(success),
+                                 __private::to_memory_order(failure))) {
+      return ::sus::Result<T, T>::with(T(p));
+    } else {
+      return ::sus::Result<T, T>::with_err(T(p));
+    }
+  }
+
+  /// Adds to the current value, wrapping around on overflow, and returns the
+  /// previous value.
+  T fetch_add(T value, Ordering order) noexcept {
+    return v_.fetch_add(value.primitive_value,
+                        __private::to_memory_order(order));
+  }
+
+  /// Subtracts from the current value, wrapping around on overflow, and
+  /// returns the previous value.
+  T fetch_sub(T value, Ordering order) noexcept {
+    return v_.fetch_sub(value.primitive_value,
+                        __private::to_memory_order(order));
+  }
+
+  /// Bitwise "and" with the current value, returning the previous value.
+  T fetch_and(T value, Ordering order) noexcept {
+    return v_.fetch_and(value.primitive_value,
+                        __private::to_memory_order(order));
+  }
+
+  /// Bitwise "nand" with the current value, returning the previous value.
+  T fetch_nand(T value, Ordering order) noexcept {
+    return fetch_update_impl(order, [value](T current) {
+      return Option<T>::some(~(current & value));
+    }).unwrap_unchecked(::sus::marker::unsafe_fn);
+  }
+
+  /// Bitwise "or" with the current value, returning the previous value.
+  T fetch_or(T value, Ordering order) noexcept {
+    return v_.fetch_or(value.primitive_value,
+                       __private::to_memory_order(order));
+  }
+
+  /// Bitwise "xor" with the current value, returning the previous value.
+  T fetch_xor(T value, Ordering order) noexcept {
+    return v_.fetch_xor(value.primitive_value,
+                        __private::to_memory_order(order));
+  }
+
+  /// Stores the maximum of the current value and `value`, returning the
+  /// previous value.
+  T fetch_max(T value, Ordering order) noexcept {
+    return fetch_update_impl(order, [value](T current) {
+      return current < value ? Option<T>::some(value) : Option<T>::none();
+    }).unwrap_or_else([](T current) { return current; });
+  }
+
+  /// Stores the minimum of the current value and `value`, returning the
+  /// previous value.
+  T fetch_min(T value, Ordering order) noexcept {
+    return fetch_update_impl(order, [value](T current) {
+      return value < current ? Option<T>::some(value) : Option<T>::none();
+    }).unwrap_or_else([](T current) { return current; });
+  }
+
+  /// Adds to the current value if it would not overflow, returning the
+  /// previous value. If it would overflow, the value is not changed and None
+  /// is returned.
+  Option<T> checked_fetch_add(T value, Ordering order) noexcept {
+    return fetch_update_impl(order, [value](T current) {
+             return current.checked_add(value);
+           })
+        .ok();
+  }
+
+  /// Subtracts from the current value if it would not overflow, returning the
+  /// previous value. If it would overflow, the value is not changed and None
+  /// is returned.
+  Option<T> checked_fetch_sub(T value, Ordering order) noexcept {
+    return fetch_update_impl(order, [value](T current) {
+             return current.checked_sub(value);
+           })
+        .ok();
+  }
+
+  /// Fetches the value, and applies a function to it that returns an optional
+  /// new value. The new value is stored if the value was not changed by
+  /// another thread in the meantime, otherwise the function is called again
+  /// with the newer value.
+  ///
+  /// Returns Ok with the previous value if the function returned Some, and Err
+  /// with the current value if it returned None.
+  ///
+  /// The `set_order` ordering is used when the new value is stored, and the
+  /// `fetch_order` ordering is used when loading the value.
+  ///
+  /// # Panics
+  /// Panics if `fetch_order` is `Release` or `AcqRel`.
+  ::sus::Result<T, T> fetch_update(
+      Ordering set_order, Ordering fetch_order,
+      ::sus::fn::FnMut<Option<T>(T)> auto&& f) noexcept {
+    ::sus::check(fetch_order != Ordering::Release &&
+                 fetch_order != Ordering::AcqRel);
+    Primitive p = v_.load(__private::to_memory_order(fetch_order));
+    while (true) {
+      Option<T> next = f(T(p));
+      if (next.is_none()) return ::sus::Result<T, T>::with_err(T(p));
+      if (v_.compare_exchange_weak(
+              p, ::sus::move(next).unwrap_unchecked(::sus::marker::unsafe_fn)
+                     .primitive_value,
+              __private::to_memory_order(set_order),
+              __private::to_memory_order(fetch_order))) {
+        return ::sus::Result<T, T>::with(T(p));
+      }
+    }
+  }
+
+ private:
+  constexpr explicit Atomic(T value) noexcept : v_(value.primitive_value) {}
+
+  // Implements the read-modify-write operations which have no direct
+  // std::atomic equivalent, with a load ordering derived from `order` the way
+  // Rust does.
+  ::sus::Result<T, T> fetch_update_impl(
+      Ordering order, ::sus::fn::FnMut<Option<T>(T)> auto&& f) noexcept {
+    return fetch_update(order, load_order(order), f);
+  }
+
+  static constexpr Ordering load_order(Ordering order) noexcept {
+    switch (order) {
+      case Ordering::Release: return Ordering::Relaxed;
+      case Ordering::AcqRel: return Ordering::Acquire;
+      default: return order;
+    }
+  }
+
+  std::atomic<Primitive> v_;
+
+  static_assert(sizeof(v_) == sizeof(T));
+};
+
+}  // namespace sus::sync
@@ -0,0 +1,152 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/atomic.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::sync::Atomic;
+using sus::sync::Ordering;
+
+static_assert(sizeof(Atomic<u8>) == sizeof(u8));
+static_assert(sizeof(Atomic<u64>) == sizeof(u64));
+static_assert(sizeof(Atomic<isize>) == sizeof(isize));
+
+TEST(Atomic, WithDefault) {
+  auto a = Atomic<u32>::with(3u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 3u);
+  auto b = Atomic<i64>();
+  EXPECT_EQ(b.load(Ordering::SeqCst), 0);
+}
+
+TEST(Atomic, LoadStoreSwap) {
+  auto a = Atomic<usize>::with(1u);
+  a.store(2u, Ordering::Release);
+  EXPECT_EQ(a.load(Ordering::Acquire), 2u);
+  EXPECT_EQ(a.swap(5u, Ordering::AcqRel), 2u);
+  EXPECT_EQ(sus::move(a).into_inner(), 5u);
+}
+
+TEST(Atomic, CompareExchange) {
+  auto a = Atomic<u32>::with(1u);
+  auto r = a.compare_exchange(1u, 2u, Ordering::AcqRel, Ordering::Acquire);
+  EXPECT_EQ(r.is_ok(), true);
+  EXPECT_EQ(sus::move(r).unwrap(), 1u);
+  auto e = a.compare_exchange(1u, 3u, Ordering::AcqRel, Ordering::Relaxed);
+  EXPECT_EQ(e.is_err(), true);
+  EXPECT_EQ(sus::move(e).unwrap_err(), 2u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 2u);
+
+  // The weak version may fail spuriously, so loop.
+  u32 current = a.load(Ordering::Relaxed);
+  while (true) {
+    auto w = a.compare_exchange_weak(current, current + 1u, Ordering::SeqCst,
+                                     Ordering::Relaxed);
+    if (w.is_ok()) break;
+    current = sus::move(w).unwrap_err();
+  }
+  EXPECT_EQ(a.load(Ordering::Relaxed), 3u);
+}
+
+TEST(Atomic, FetchArithmeticWraps) {
+  auto a = Atomic<u8>::with(u8::MAX);
+  EXPECT_EQ(a.fetch_add(2u, Ordering::Relaxed), u8::MAX);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 1u);
+  EXPECT_EQ(a.fetch_sub(2u, Ordering::Relaxed), 1u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), u8::MAX);
+
+  auto s = Atomic<i32>::with(i32::MAX);
+  EXPECT_EQ(s.fetch_add(1, Ordering::Relaxed), i32::MAX);
+  EXPECT_EQ(s.load(Ordering::Relaxed), i32::MIN);
+}
+
+TEST(Atomic, FetchBitwise) {
+  auto a = Atomic<u32>::with(0b1100u);
+  EXPECT_EQ(a.fetch_and(0b1010u, Ordering::Relaxed), 0b1100u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 0b1000u);
+  EXPECT_EQ(a.fetch_or(0b0011u, Ordering::Relaxed), 0b1000u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 0b1011u);
+  EXPECT_EQ(a.fetch_xor(0b1111u, Ordering::Relaxed), 0b1011u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 0b0100u);
+  EXPECT_EQ(a.fetch_nand(0b0110u, Ordering::Relaxed), 0b0100u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), ~u32(0b0100u));
+}
+
+TEST(Atomic, FetchMaxMin) {
+  auto a = Atomic<i16>::with(5);
+  EXPECT_EQ(a.fetch_max(3, Ordering::Relaxed), 5);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 5);
+  EXPECT_EQ(a.fetch_max(9, Ordering::Relaxed), 5);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 9);
+  EXPECT_EQ(a.fetch_min(-2, Ordering::Release), 9);
+  EXPECT_EQ(a.load(Ordering::Relaxed), -2);
+  EXPECT_EQ(a.fetch_min(7, Ordering::AcqRel), -2);
+  EXPECT_EQ(a.load(Ordering::Relaxed), -2);
+}
+
+TEST(Atomic, CheckedFetch) {
+  auto a = Atomic<u8>::with(250u);
+  EXPECT_EQ(a.checked_fetch_add(5u, Ordering::Relaxed).unwrap(), 250u);
+  EXPECT_EQ(a.checked_fetch_add(1u, Ordering::Relaxed).is_none(), true);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 255u);
+
+  auto b = Atomic<u64>::with(1u);
+  EXPECT_EQ(b.checked_fetch_sub(1u, Ordering::Relaxed).unwrap(), 1u);
+  EXPECT_EQ(b.checked_fetch_sub(1u, Ordering::Relaxed).is_none(), true);
+  EXPECT_EQ(b.load(Ordering::Relaxed), 0u);
+}
+
+TEST(Atomic, FetchUpdate) {
+  auto a = Atomic<u32>::with(7u);
+  auto r = a.fetch_update(Ordering::SeqCst, Ordering::SeqCst,
+                          [](u32 x) { return sus::Option<u32>::some(x * 2u); });
+  EXPECT_EQ(sus::move(r).unwrap(), 7u);
+  EXPECT_EQ(a.load(Ordering::Relaxed), 14u);
+  auto e = a.fetch_update(Ordering::SeqCst, Ordering::SeqCst,
+                          [](u32) { return sus::Option<u32>::none(); });
+  EXPECT_EQ(sus::move(e).unwrap_err(), 14u);
+}
+
+TEST(Atomic, Threads) {
+  auto a = Atomic<u64>();
+  auto threads = Vec<std::thread>();
+  for (i32 t = 0; t < 4; t += 1) {
+    threads.push(std::thread([&a]() {
+      for (i32 i = 0; i < 10000; i += 1) a.fetch_add(1u, Ordering::Relaxed);
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+  EXPECT_EQ(a.load(Ordering::Relaxed), 40000u);
+}
+
+TEST(AtomicDeathTest, BadOrderings) {
+  auto a = Atomic<u32>();
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(a.load(Ordering::Release), "");
+  EXPECT_DEATH(a.load(Ordering::AcqRel), "");
+  EXPECT_DEATH(a.store(1u, Ordering::Acquire), "");
+  EXPECT_DEATH(
+      [[maybe_unused]] auto r =
+          a.compare_exchange(0u, 1u, Ordering::SeqCst, Ordering::Release),
+      "");
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,176 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "subspace/mem/move.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+#include "subspace/sync/__private/waiter.h"
+#include "subspace/sync/channel/errors.h"
+
+namespace sus::sync::channel::__private {
+
+/// The state shared between all the senders and receivers of a channel.
+///
+/// The `Queue` provides the lock-free storage, and the Channel adds
+/// disconnection and blocking on top of it. The Channel is heap allocated, and
+/// deletes itself when the last sender or receiver is dropped.
+template <class Queue>
+class Channel final {
+  using T = typename Queue::Item;
+
+ public:
+  /// Creates a Channel with one sender and one receiver.
+  static Channel* create(size_t capacity) noexcept {
+    return new Channel(capacity);
+  }
+
+  Channel(const Channel&) = delete;
+  Channel& operator=(const Channel&) = delete;
+
+  size_t capacity() const noexcept { return queue_.capacity(); }
+
+  Option<TrySendError<T>> try_send(T&& value) noexcept {
+    if (receivers_.load(std::memory_order_acquire) == 0u) {
+      return Option<TrySendError<T>>::some(TrySendError<T>(
+          TrySendError<T>::Kind::Disconnected, ::sus::move(value)));
+    }
+    if (!queue_.try_push(value)) {
+      return Option<TrySendError<T>>::some(
+          TrySendError<T>(TrySendError<T>::Kind::Full, ::sus::move(value)));
+    }
+    recv_waiter_.notify_one();
+    return Option<TrySendError<T>>::none();
+  }
+
+  Option<SendError<T>> send(T&& value) noexcept {
+    while (true) {
+      if (receivers_.load(std::memory_order_acquire) == 0u)
+        return Option<SendError<T>>::some(SendError<T>(::sus::move(value)));
+      if (queue_.try_push(value)) break;
+
+      // The queue was full, so wait for a receiver to make space, or to
+      // disconnect. The condition is checked again after registering as a
+      // waiter, in case a receiver made space before we were registered.
+      const uint32_t epoch = send_waiter_.prepare_wait();
+      const bool connected = receivers_.load(std::memory_order_acquire) != 0u;
+      const bool pushed = connected && queue_.try_push(value);
+      if (connected && !pushed) send_waiter_.wait(epoch);
+      send_waiter_.finish_wait();
+      if (pushed) break;
+    }
+    recv_waiter_.notify_one();
+    return Option<SendError<T>>::none();
+  }
+
+  ::sus::Result<T, TryRecvError> try_recv() noexcept {
+    if (Option<T> o = queue_.try_pop(); o.is_some()) {
+      send_waiter_.notify_one();
+      return ::sus::Result<T, TryRecvError>::with(
+          ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn));
+    }
+    if (senders_.load(std::memory_order_acquire) != 0u) {
+      return ::sus::Result<T, TryRecvError>::with_err(
+          TryRecvError(TryRecvError::Kind::Empty));
+    }
+    // The last sender may have sent a value before disconnecting. Its send
+    // happens-before we observed the disconnect, so it's visible now.
+    if (Option<T> o = queue_.try_pop(); o.is_some()) {
+      return ::sus::Result<T, TryRecvError>::with(
+          ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn));
+    }
+    return ::sus::Result<T, TryRecvError>::with_err(
+        TryRecvError(TryRecvError::Kind::Disconnected));
+  }
+
+  ::sus::Result<T, RecvError> recv() noexcept {
+    while (true) {
+      ::sus::Result<T, TryRecvError> r = try_recv();
+      if (r.is_ok()) {
+        return ::sus::Result<T, RecvError>::with(
+            ::sus::move(r).unwrap_unchecked(::sus::marker::unsafe_fn));
+      }
+      if (::sus::move(r)
+              .unwrap_err_unchecked(::sus::marker::unsafe_fn)
+              .is_disconnected()) {
+        return ::sus::Result<T, RecvError>::with_err(RecvError());
+      }
+
+      // The queue was empty, so wait for a sender to send, or to disconnect.
+      // The condition is checked again after registering as a waiter, in case
+      // a sender sent before we were registered.
+      const uint32_t epoch = recv_waiter_.prepare_wait();
+      Option<T> o = queue_.try_pop();
+      if (o.is_none() && senders_.load(std::memory_order_acquire) != 0u)
+        recv_waiter_.wait(epoch);
+      recv_waiter_.finish_wait();
+      if (o.is_some()) {
+        send_waiter_.notify_one();
+        return ::sus::Result<T, RecvError>::with(
+            ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn));
+      }
+    }
+  }
+
+  void add_sender() noexcept {
+    senders_.fetch_add(1u, std::memory_order_relaxed);
+    refs_.fetch_add(1u, std::memory_order_relaxed);
+  }
+  void add_receiver() noexcept {
+    receivers_.fetch_add(1u, std::memory_order_relaxed);
+    refs_.fetch_add(1u, std::memory_order_relaxed);
+  }
+
+  /// Drops a sender, which may delete the Channel.
+  void drop_sender() noexcept {
+    // Wake any receivers blocked on an empty queue when the last sender goes
+    // away, as they will now get an error.
+    if (senders_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+      recv_waiter_.notify_all();
+    drop_ref();
+  }
+  /// Drops a receiver, which may delete the Channel.
+  void drop_receiver() noexcept {
+    // Wake any senders blocked on a full queue when the last receiver goes
+    // away, as they will now get an error.
+    if (receivers_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+      send_waiter_.notify_all();
+    drop_ref();
+  }
+
+ private:
+  explicit Channel(size_t capacity) noexcept : queue_(capacity) {}
+
+  void drop_ref() noexcept {
+    if (refs_.fetch_sub(1u, std::memory_order_acq_rel) == 1u) delete this;
+  }
+
+  Queue queue_;
+  // Senders wait on `send_waiter_` for space, and receivers wait on
+  // `recv_waiter_` for values.
+  alignas(::sus::sync::__private::kCacheLineSize)
+      ::sus::sync::__private::Waiter send_waiter_;
+  ::sus::sync::__private::Waiter recv_waiter_;
+  std::atomic<size_t> senders_ = 1u;
+  std::atomic<size_t> receivers_ = 1u;
+  std::atomic<size_t> refs_ = 2u;
+};
+
+}  // namespace sus::sync::channel::__private
@@ -0,0 +1,158 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <new>
+
+#include "subspace/mem/move.h"
+#include "subspace/option/option.h"
+#include "subspace/sync/__private/waiter.h"
+
+namespace sus::sync::channel::__private {
+
+/// A bounded lock-free multi-producer multi-consumer queue, from Dmitry
+/// Vyukov's bounded MPMC queue design.
+///
+/// Each slot holds a stamp that encodes which lap of the ring buffer the slot
+/// is ready for, and whether it is holding a value. Producers and consumers
+/// claim a position with a CAS on the head or tail, and then the slot's stamp
+/// hands the slot back and forth between them without any other
+/// synchronization.
+///
+/// For position `pos`, the slot at `pos % capacity` has stamp:
+/// * `2 * pos` when it is empty and ready to be written at `pos`.
+/// * `2 * pos + 1` when it has been written at `pos` and is ready to be read.
+///
+/// Doubling the positions keeps the two states distinct even when the capacity
+/// is 1, where the full state of one lap would otherwise equal the empty state
+/// of the next.
+template <class T>
+class MpmcQueue final {
+ public:
+  using Item = T;
+
+  explicit MpmcQueue(size_t capacity) noexcept
+      : slots_(new Slot[capacity]),
+        capacity_(capacity),
+        mask_((capacity & (capacity - 1u)) == 0u ? capacity - 1u : 0u) {
+    for (size_t i = 0u; i < capacity; ++i)
+      slots_[i].stamp.store(i * 2u, std::memory_order_relaxed);
+  }
+
+  ~MpmcQueue() noexcept {
+    // No other threads can be accessing the queue by now, so the values that
+    // remain are exactly those between the tail and the head.
+    const size_t head = head_.load(std::memory_order_relaxed);
+    for (size_t pos = tail_.load(std::memory_order_relaxed); pos != head; ++pos)
+      slots_[index(pos)].value.~T();
+    delete[] slots_;
+  }
+
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  /// Pushes `value` into the queue, moving from it, if the queue is not full.
+  /// Returns false and leaves `value` untouched if the queue is full.
+  bool try_push(T& value) noexcept {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[index(pos)];
+      const size_t stamp = slot.stamp.load(std::memory_order_acquire);
+      const auto diff = static_cast<intptr_t>(stamp - pos * 2u);
+      if (diff == 0) {
+        // The slot is empty for this lap, try to claim it.
+        if (head_.compare_exchange_weak(pos, pos + 1u,
+                                        std::memory_order_relaxed)) {
+          new (&slot.value) T(::sus::move(value));
+          slot.stamp.store(pos * 2u + 1u, std::memory_order_release);
+          return true;
+        }
+        // The CAS failure reloaded `pos`.
+      } else if (diff < 0) {
+        // The slot still holds a value from the previous lap, so the queue is
+        // full, unless `pos` is stale.
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == pos) return false;
+        pos = head;
+      } else {
+        // Another producer claimed `pos` already.
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Pops the oldest value from the queue, or returns None if it is empty.
+  ::sus::Option<T> try_pop() noexcept {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[index(pos)];
+      const size_t stamp = slot.stamp.load(std::memory_order_acquire);
+      const auto diff = static_cast<intptr_t>(stamp - (pos * 2u + 1u));
+      if (diff == 0) {
+        // The slot holds a value for this lap, try to claim it.
+        if (tail_.compare_exchange_weak(pos, pos + 1u,
+                                        std::memory_order_relaxed)) {
+          auto out = ::sus::Option<T>::some(::sus::move(slot.value));
+          slot.value.~T();
+          slot.stamp.store((pos + capacity_) * 2u, std::memory_order_release);
+          return out;
+        }
+        // The CAS failure reloaded `pos`.
+      } else if (diff < 0) {
+        // The slot has not been written for this lap yet, so the queue is
+        // empty, unless `pos` is stale.
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == pos) return ::sus::Option<T>::none();
+        pos = tail;
+      } else {
+        // Another consumer claimed `pos` already.
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  size_t capacity() const noexcept { return capacity_; }
+
+ private:
+  struct Slot {
+    Slot() noexcept {}
+    ~Slot() noexcept {}
+
+    std::atomic<size_t> stamp;
+    union {
+      T value;
+    };
+  };
+
+  size_t index(size_t pos) const noexcept {
+    // Avoid the division when the capacity is a power of two.
+    return mask_ != 0u ? pos & mask_ : pos % capacity_;
+  }
+
+  // Producers and consumers each write to their own cache line.
+  alignas(::sus::sync::__private::kCacheLineSize)
+      std::atomic<size_t> head_ = 0u;
+  alignas(::sus::sync::__private::kCacheLineSize)
+      std::atomic<size_t> tail_ = 0u;
+  alignas(::sus::sync::__private::kCacheLineSize) Slot* const slots_;
+  const size_t capacity_;
+  const size_t mask_;
+};
+
+}  // namespace sus::sync::channel::__private
@@ -0,0 +1,124 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <atomic>
+#include <new>
+
+#include "subspace/mem/move.h"
+#include "subspace/option/option.h"
+#include "subspace/sync/__private/waiter.h"
+
+namespace sus::sync::channel::__private {
+
+/// A bounded lock-free single-producer single-consumer ring buffer.
+///
+/// The head is only written by the producer and the tail is only written by
+/// the consumer, and each lives on its own cache line. Each side also keeps a
+/// cached copy of the other side's position on its own cache line, so that it
+/// only needs to read the other side's cache line when the cached value says
+/// the queue is full (for the producer) or empty (for the consumer).
+///
+/// Positions increase monotonically, and the queue holds `head - tail` values.
+template <class T>
+class SpscQueue final {
+ public:
+  using Item = T;
+
+  explicit SpscQueue(size_t capacity) noexcept
+      : cells_(new Cell[capacity]),
+        capacity_(capacity),
+        mask_((capacity & (capacity - 1u)) == 0u ? capacity - 1u : 0u) {}
+
+  ~SpscQueue() noexcept {
+    // No other threads can be accessing the queue by now, so the values that
+    // remain are exactly those between the tail and the head.
+    const size_t head = producer_.head.load(std::memory_order_relaxed);
+    for (size_t pos = consumer_.tail.load(std::memory_order_relaxed);
+         pos != head; ++pos)
+      cells_[index(pos)].value.~T();
+    delete[] cells_;
+  }
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  /// Pushes `value` into the queue, moving from it, if the queue is not full.
+  /// Returns false and leaves `value` untouched if the queue is full.
+  ///
+  /// Must only be called from one thread at a time.
+  bool try_push(T& value) noexcept {
+    const size_t head = producer_.head.load(std::memory_order_relaxed);
+    if (head - producer_.cached_tail == capacity_) {
+      producer_.cached_tail = consumer_.tail.load(std::memory_order_acquire);
+      if (head - producer_.cached_tail == capacity_) return false;
+    }
+    new (&cells_[index(head)].value) T(::sus::move(value));
+    producer_.head.store(head + 1u, std::memory_order_release);
+    return true;
+  }
+
+  /// Pops the oldest value from the queue, or returns None if it is empty.
+  ///
+  /// Must only be called from one thread at a time.
+  ::sus::Option<T> try_pop() noexcept {
+    const size_t tail = consumer_.tail.load(std::memory_order_relaxed);
+    if (tail == consumer_.cached_head) {
+      consumer_.cached_head = producer_.head.load(std::memory_order_acquire);
+      if (tail == consumer_.cached_head) return ::sus::Option<T>::none();
+    }
+    Cell& cell = cells_[index(tail)];
+    auto out = ::sus::Option<T>::some(::sus::move(cell.value));
+    cell.value.~T();
+    consumer_.tail.store(tail + 1u, std::memory_order_release);
+    return out;
+  }
+
+  size_t capacity() const noexcept { return capacity_; }
+
+ private:
+  struct Cell {
+    Cell() noexcept {}
+    ~Cell() noexcept {}
+
+    union {
+      T value;
+    };
+  };
+
+  size_t index(size_t pos) const noexcept {
+    // Avoid the division when the capacity is a power of two.
+    return mask_ != 0u ? pos & mask_ : pos % capacity_;
+  }
+
+  struct alignas(::sus::sync::__private::kCacheLineSize) Producer {
+    std::atomic<size_t> head = 0u;
+    size_t cached_tail = 0u;
+  };
+  struct alignas(::sus::sync::__private::kCacheLineSize) Consumer {
+    std::atomic<size_t> tail = 0u;
+    size_t cached_head = 0u;
+  };
+
+  Producer producer_;
+  Consumer consumer_;
+  alignas(::sus::sync::__private::kCacheLineSize) Cell* const cells_;
+  const size_t capacity_;
+  const size_t mask_;
+};
+
+}  // namespace sus::sync::channel::__private
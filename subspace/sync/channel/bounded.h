@@ -0,0 +1,278 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/assertions/check.h"
+#include "subspace/iter/__private/iterator_end.h"
+#include "subspace/iter/__private/iterator_loop.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/mem/replace.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+#include "subspace/sync/channel/__private/channel.h"
+#include "subspace/sync/channel/__private/mpmc_queue.h"
+#include "subspace/sync/channel/errors.h"
+#include "subspace/sync/channel/receiver_iter.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::sync::channel {
+
+template <class T>
+class Receiver;
+
+/// The sending half of a bounded multi-producer multi-consumer channel.
+///
+/// Values sent through the Sender are received by one of the channel's
+/// `Receiver`s, in the order they were sent. The Sender can be cloned to send
+/// from multiple threads, and the channel stays connected to receivers as long
+/// as any Sender exists.
+///
+/// The methods on a Sender are thread-safe, though a single Sender object
+/// should be used from one thread at a time, with a `clone()` given to each
+/// other thread.
+///
+/// This type is created by `bounded()`.
+template <class T>
+class [[sus_trivial_abi]] Sender final {
+  using Channel = __private::Channel<__private::MpmcQueue<T>>;
+
+ public:
+  /// sus::mem::Clone trait.
+  Sender clone() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    channel_->add_sender();
+    return Sender(*channel_);
+  }
+
+  ~Sender() noexcept {
+    if (channel_) channel_->drop_sender();
+  }
+
+  Sender(Sender&& o) noexcept
+      : channel_(::sus::mem::replace(mref(o.channel_), nullptr)) {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+  }
+  Sender& operator=(Sender&& o) noexcept {
+    ::sus::check(o.channel_ != nullptr);  // Catch use-after-move.
+    // Take the other channel first, as dropping the old one may free it when
+    // they are the same.
+    Channel* channel = ::sus::mem::replace(mref(o.channel_), nullptr);
+    if (channel_) channel_->drop_sender();
+    channel_ = channel;
+    return *this;
+  }
+
+  /// Attempts to send `value` on the channel without blocking.
+  ///
+  /// Returns None if the value was sent. Otherwise returns a `TrySendError`
+  /// holding the unsent value, which says if the channel was full or if all
+  /// receivers have been dropped.
+  ///
+  /// The error is returned in an Option, since `Result` can not hold `void`
+  /// for the success case.
+  [[nodiscard]] Option<TrySendError<T>> try_send(T value) const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->try_send(::sus::move(value));
+  }
+
+  /// Sends `value` on the channel, blocking while the channel is full.
+  ///
+  /// Returns None if the value was sent. If all receivers have been dropped,
+  /// the value can not be sent, and it is returned in a `SendError`.
+  ///
+  /// The error is returned in an Option, since `Result` can not hold `void`
+  /// for the success case.
+  [[nodiscard]] Option<SendError<T>> send(T value) const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->send(::sus::move(value));
+  }
+
+  /// Returns the maximum number of values the channel can hold.
+  ::sus::num::usize capacity() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->capacity();
+  }
+
+ private:
+  template <class U>
+  friend ::sus::Tuple<Sender<U>, Receiver<U>> bounded(
+      ::sus::num::usize capacity) noexcept;
+
+  explicit Sender(Channel& channel) noexcept : channel_(&channel) {}
+
+  Channel* channel_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(channel_));
+};
+
+/// The receiving half of a bounded multi-producer multi-consumer channel.
+///
+/// Each value sent on the channel is received by exactly one Receiver, in the
+/// order they were sent. The Receiver can be cloned to receive from multiple
+/// threads, and the channel stays connected to senders as long as any
+/// Receiver exists.
+///
+/// The methods on a Receiver are thread-safe, though a single Receiver object
+/// should be used from one thread at a time, with a `clone()` given to each
+/// other thread.
+///
+/// Values can be received one at a time with `recv()` or `try_recv()`, or
+/// through an iterator from `iter()`, `try_iter()` or `into_iter()`, which
+/// provides all the adaptors in `sus::iter::IteratorBase`. A Receiver can also
+/// be used directly in a ranged for loop, which receives until all senders
+/// are dropped.
+///
+/// This type is created by `bounded()`.
+template <class T>
+class [[sus_trivial_abi]] Receiver final {
+  using Channel = __private::Channel<__private::MpmcQueue<T>>;
+
+ public:
+  /// sus::mem::Clone trait.
+  Receiver clone() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    channel_->add_receiver();
+    return Receiver(*channel_);
+  }
+
+  ~Receiver() noexcept {
+    if (channel_) channel_->drop_receiver();
+  }
+
+  Receiver(Receiver&& o) noexcept
+      : channel_(::sus::mem::replace(mref(o.channel_), nullptr)) {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+  }
+  Receiver& operator=(Receiver&& o) noexcept {
+    ::sus::check(o.channel_ != nullptr);  // Catch use-after-move.
+    // Take the other channel first, as dropping the old one may free it when
+    // they are the same.
+    Channel* channel = ::sus::mem::replace(mref(o.channel_), nullptr);
+    if (channel_) channel_->drop_receiver();
+    channel_ = channel;
+    return *this;
+  }
+
+  /// Attempts to receive a value from the channel without blocking.
+  ///
+  /// Returns a `TryRecvError` if the channel is empty, which says if senders
+  /// still exist or if they have all been dropped.
+  ::sus::Result<T, TryRecvError> try_recv() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->try_recv();
+  }
+
+  /// Receives a value from the channel, blocking while the channel is empty.
+  ///
+  /// Returns a `RecvError` if the channel is empty and all senders have been
+  /// dropped. Values sent before the senders were dropped are still received
+  /// first.
+  ::sus::Result<T, RecvError> recv() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->recv();
+  }
+
+  /// Returns an iterator that receives values, blocking while the channel is
+  /// empty, until all senders are dropped.
+  RecvIter<T, Receiver> iter() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return RecvIter<T, Receiver>::with(*this);
+  }
+  RecvIter<T, Receiver> iter() && = delete;
+
+  /// Returns an iterator that receives the values currently in the channel,
+  /// without blocking.
+  TryRecvIter<T, Receiver> try_iter() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return TryRecvIter<T, Receiver>::with(*this);
+  }
+  TryRecvIter<T, Receiver> try_iter() && = delete;
+
+  /// Converts the Receiver into an iterator that receives values, blocking
+  /// while the channel is empty, until all senders are dropped.
+  ///
+  /// sus::iter::IntoIterator trait.
+  RecvIntoIter<T, Receiver> into_iter() && noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return RecvIntoIter<T, Receiver>::with(::sus::move(*this));
+  }
+
+  /// Returns the maximum number of values the channel can hold.
+  ::sus::num::usize capacity() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->capacity();
+  }
+
+ private:
+  template <class U>
+  friend ::sus::Tuple<Sender<U>, Receiver<U>> bounded(
+      ::sus::num::usize capacity) noexcept;
+
+  explicit Receiver(Channel& channel) noexcept : channel_(&channel) {}
+
+  Channel* channel_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(channel_));
+};
+
+/// Creates a bounded multi-producer multi-consumer channel, which can hold up
+/// to `capacity` values at a time.
+///
+/// Sending and receiving are lock-free, built on a ring buffer of `capacity`
+/// slots. When the channel is full, `Sender::send()` blocks until a value is
+/// received, and when it's empty, `Receiver::recv()` blocks until a value is
+/// sent. Blocked threads sleep in the kernel (through a futex on Linux) rather
+/// than spinning, and waking them only costs a syscall when a thread is
+/// actually blocked.
+///
+/// For a channel with exactly one sender and one receiver, `spsc()` avoids
+/// the compare-and-swap operations needed here.
+///
+/// # Example
+/// ```
+/// auto [tx, rx] = sus::sync::channel::bounded<i32>(16u);
+/// auto t = std::thread([tx = sus::move(tx)]() {
+///   for (i32 i : sus::Vec<i32>::with_values(1, 2, 3))
+///     sus::check(tx.send(i).is_none());
+/// });
+/// // Receives until the Sender is dropped at the end of the thread.
+/// i32 sum = 0;
+/// for (i32 i : rx) sum += i;
+/// t.join();
+/// sus::check(sum == 6);
+/// ```
+///
+/// # Panics
+/// Panics if `capacity` is 0.
+template <class T>
+::sus::Tuple<Sender<T>, Receiver<T>> bounded(
+    ::sus::num::usize capacity) noexcept {
+  ::sus::check(capacity > 0u);
+  auto* channel =
+      __private::Channel<__private::MpmcQueue<T>>::create(size_t{capacity});
+  return ::sus::Tuple<Sender<T>, Receiver<T>>::with(Sender<T>(*channel),
+                                                    Receiver<T>(*channel));
+}
+
+// Implicit for-ranged loop iteration via `Receiver::iter()`.
+using ::sus::iter::__private::begin;
+using ::sus::iter::__private::end;
+
+}  // namespace sus::sync::channel
@@ -0,0 +1,249 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/channel/bounded.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::sync::channel::bounded;
+using sus::sync::channel::Receiver;
+using sus::sync::channel::RecvError;
+using sus::sync::channel::Sender;
+using sus::sync::channel::TryRecvError;
+using sus::sync::channel::TrySendError;
+
+static_assert(sus::mem::relocate_by_memcpy<Sender<i32>>);
+static_assert(sus::mem::relocate_by_memcpy<Receiver<i32>>);
+
+// Counts how many times it is destroyed, while not moved-from.
+struct DropCounter {
+  DropCounter(i32& drops) : drops(&drops) {}
+  DropCounter(DropCounter&& o)
+      : drops(sus::mem::replace(mref(o.drops), nullptr)) {}
+  DropCounter& operator=(DropCounter&& o) {
+    drops = sus::mem::replace(mref(o.drops), nullptr);
+    return *this;
+  }
+  ~DropCounter() {
+    if (drops) *drops += 1;
+  }
+
+  i32* drops;
+};
+
+TEST(Bounded, Capacity) {
+  auto [tx, rx] = bounded<i32>(3u);
+  EXPECT_EQ(tx.capacity(), 3u);
+  EXPECT_EQ(rx.capacity(), 3u);
+}
+
+TEST(Bounded, TrySendTryRecv) {
+  auto [tx, rx] = bounded<i32>(2u);
+  EXPECT_EQ(rx.try_recv().unwrap_err().kind(), TryRecvError::Kind::Empty);
+
+  EXPECT_EQ(tx.try_send(1).is_none(), true);
+  EXPECT_EQ(tx.try_send(2).is_none(), true);
+  auto full = tx.try_send(3);
+  EXPECT_EQ(full.is_some(), true);
+  EXPECT_EQ(full->is_full(), true);
+  EXPECT_EQ(sus::move(full).unwrap().into_inner(), 3);
+
+  EXPECT_EQ(rx.try_recv().unwrap(), 1);
+  EXPECT_EQ(tx.try_send(3).is_none(), true);
+  EXPECT_EQ(rx.try_recv().unwrap(), 2);
+  EXPECT_EQ(rx.try_recv().unwrap(), 3);
+  EXPECT_EQ(rx.try_recv().unwrap_err().is_empty(), true);
+}
+
+TEST(Bounded, CapacityOne) {
+  auto [tx, rx] = bounded<i32>(1u);
+  for (i32 i = 0; i < 10; i += 1) {
+    EXPECT_EQ(tx.try_send(i).is_none(), true);
+    EXPECT_EQ(tx.try_send(i).is_some(), true);
+    EXPECT_EQ(rx.try_recv().unwrap(), i);
+    EXPECT_EQ(rx.try_recv().is_err(), true);
+  }
+}
+
+TEST(Bounded, NonPowerOfTwoWraps) {
+  auto [tx, rx] = bounded<i32>(3u);
+  for (i32 i = 0; i < 20; i += 1) {
+    EXPECT_EQ(tx.try_send(i).is_none(), true);
+    EXPECT_EQ(tx.try_send(i + 100).is_none(), true);
+    EXPECT_EQ(rx.try_recv().unwrap(), i);
+    EXPECT_EQ(rx.try_recv().unwrap(), i + 100);
+  }
+}
+
+TEST(Bounded, SenderDisconnected) {
+  auto [tx, rx] = bounded<i32>(4u);
+  EXPECT_EQ(tx.send(1).is_none(), true);
+  EXPECT_EQ(tx.send(2).is_none(), true);
+  { auto drop = sus::move(tx); }
+  // Values sent before the disconnect are still received.
+  EXPECT_EQ(rx.recv().unwrap(), 1);
+  EXPECT_EQ(rx.try_recv().unwrap(), 2);
+  EXPECT_EQ(rx.try_recv().unwrap_err().is_disconnected(), true);
+  EXPECT_EQ(rx.recv().is_err(), true);
+}
+
+TEST(Bounded, ReceiverDisconnected) {
+  auto [tx, rx] = bounded<i32>(4u);
+  { auto drop = sus::move(rx); }
+  auto e = tx.try_send(1);
+  EXPECT_EQ(e.is_some(), true);
+  EXPECT_EQ(e->kind(), TrySendError<i32>::Kind::Disconnected);
+  EXPECT_EQ(tx.send(2).unwrap().into_inner(), 2);
+}
+
+TEST(Bounded, CloneKeepsConnected) {
+  auto [tx, rx] = bounded<i32>(4u);
+  auto tx2 = tx.clone();
+  { auto drop = sus::move(tx); }
+  EXPECT_EQ(rx.try_recv().unwrap_err().is_empty(), true);
+  EXPECT_EQ(tx2.send(5).is_none(), true);
+  { auto drop = sus::move(tx2); }
+  EXPECT_EQ(rx.recv().unwrap(), 5);
+  EXPECT_EQ(rx.recv().is_err(), true);
+}
+
+TEST(Bounded, SelfMoveAssign) {
+  auto [tx, rx] = bounded<i32>(4u);
+  auto& tx_self = tx;
+  tx = sus::move(tx_self);
+  auto& rx_self = rx;
+  rx = sus::move(rx_self);
+  // The channel is still alive and connected on both ends.
+  EXPECT_EQ(tx.send(1).is_none(), true);
+  EXPECT_EQ(rx.recv().unwrap(), 1);
+  EXPECT_EQ(rx.try_recv().unwrap_err().is_empty(), true);
+}
+
+TEST(Bounded, DropsUnreceivedValues) {
+  i32 drops = 0;
+  {
+    auto [tx, rx] = bounded<DropCounter>(4u);
+    EXPECT_EQ(tx.send(DropCounter(drops)).is_none(), true);
+    EXPECT_EQ(tx.send(DropCounter(drops)).is_none(), true);
+    EXPECT_EQ(tx.send(DropCounter(drops)).is_none(), true);
+    { auto received = rx.recv().unwrap(); }
+    EXPECT_EQ(drops, 1);
+  }
+  EXPECT_EQ(drops, 3);
+}
+
+TEST(Bounded, BlockingSendRecv) {
+  auto [tx, rx] = bounded<i32>(1u);
+  auto t = std::thread([tx = sus::move(tx)]() {
+    for (i32 i = 0; i < 1000; i += 1) EXPECT_EQ(tx.send(i).is_none(), true);
+  });
+  for (i32 i = 0; i < 1000; i += 1) EXPECT_EQ(rx.recv().unwrap(), i);
+  EXPECT_EQ(rx.recv().is_err(), true);
+  t.join();
+}
+
+TEST(Bounded, BlockedSenderWokenByDisconnect) {
+  auto [tx, rx] = bounded<i32>(1u);
+  EXPECT_EQ(tx.send(1).is_none(), true);
+  auto t = std::thread([rx = sus::move(rx)]() mutable {
+    // Let the main thread block on a full channel, then disconnect.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto drop = sus::move(rx);
+  });
+  EXPECT_EQ(tx.send(2).unwrap().into_inner(), 2);
+  t.join();
+}
+
+TEST(Bounded, ForLoop) {
+  auto [tx, rx] = bounded<i32>(2u);
+  auto t = std::thread([tx = sus::move(tx)]() {
+    for (i32 i = 1; i <= 100; i += 1) EXPECT_EQ(tx.send(i).is_none(), true);
+  });
+  i32 sum = 0;
+  for (i32 i : rx) sum += i;
+  EXPECT_EQ(sum, 5050);
+  t.join();
+}
+
+TEST(Bounded, IterAdaptors) {
+  auto [tx, rx] = bounded<i32>(8u);
+  for (i32 i = 1; i <= 6; i += 1) EXPECT_EQ(tx.send(i).is_none(), true);
+
+  // try_iter() stops once the channel is empty, without waiting for the
+  // sender.
+  auto v = rx.try_iter()
+               .filter([](const i32& i) { return i % 2 == 0; })
+               .map([](i32&& i) { return i * 10; })
+               .collect<Vec<i32>>();
+  EXPECT_EQ(v, sus::Vec<i32>::with_values(20, 40, 60));
+
+  EXPECT_EQ(tx.send(7).is_none(), true);
+  { auto drop = sus::move(tx); }
+  auto rest = sus::move(rx).into_iter().collect<Vec<i32>>();
+  EXPECT_EQ(rest, sus::Vec<i32>::with_values(7));
+}
+
+TEST(Bounded, MultiProducerMultiConsumer) {
+  static constexpr i32 kPerProducer = 2000;
+  auto [tx, rx] = bounded<i32>(7u);
+
+  auto producers = Vec<std::thread>();
+  for (i32 p = 0; p < 3; p += 1) {
+    producers.push(std::thread([tx = tx.clone()]() {
+      for (i32 i = 1; i <= kPerProducer; i += 1)
+        EXPECT_EQ(tx.send(i).is_none(), true);
+    }));
+  }
+  { auto drop = sus::move(tx); }
+
+  i64 sums[3] = {0, 0, 0};
+  auto consumers = Vec<std::thread>();
+  for (usize c = 0u; c < 3u; c += 1u) {
+    consumers.push(std::thread([rx = rx.clone(), &sum = sums[size_t{c}]]() {
+      for (i32 i : rx) sum += i64::from(i);
+    }));
+  }
+  { auto drop = sus::move(rx); }
+
+  for (std::thread& t : producers.iter_mut()) t.join();
+  for (std::thread& t : consumers.iter_mut()) t.join();
+  const i64 expected = i64::from(kPerProducer * (kPerProducer + 1) / 2 * 3);
+  EXPECT_EQ(sums[0] + sums[1] + sums[2], expected);
+}
+
+TEST(BoundedDeathTest, ZeroCapacity) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(bounded<i32>(0u), "");
+#endif
+}
+
+TEST(BoundedDeathTest, UseAfterMove) {
+  auto [tx, rx] = bounded<i32>(1u);
+  auto tx2 = sus::move(tx);
+  auto rx2 = sus::move(rx);
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(tx.capacity(), "");
+  EXPECT_DEATH(rx.capacity(), "");
+#endif
+}
+
+}  // namespace
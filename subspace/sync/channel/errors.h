@@ -0,0 +1,149 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "subspace/assertions/unreachable.h"
+#include "subspace/macros/pure.h"
+#include "subspace/mem/move.h"
+
+namespace sus::sync::channel {
+
+/// The error returned from a blocking `send()` when all receivers of the
+/// channel have been dropped.
+///
+/// The value that could not be sent is returned inside the error, and can be
+/// recovered with `into_inner()`.
+template <class T>
+class SendError {
+ public:
+  /// Constructs a SendError holding the value that could not be sent.
+  explicit constexpr SendError(T&& value) : value_(::sus::move(value)) {}
+
+  /// Returns the value that could not be sent.
+  constexpr T into_inner() && noexcept { return ::sus::move(value_); }
+
+  [[nodiscard]] sus_pure std::string to_string() const noexcept {
+    return std::string("sending on a disconnected channel");
+  }
+
+ private:
+  T value_;
+};
+
+/// The error returned from `try_send()` when the value could not be sent
+/// without blocking.
+///
+/// The value that could not be sent is returned inside the error, and can be
+/// recovered with `into_inner()`.
+template <class T>
+class TrySendError {
+ public:
+  /// The type of error which occured.
+  enum class Kind {
+    /// The channel is at capacity.
+    Full,
+    /// All receivers of the channel have been dropped.
+    Disconnected,
+  };
+
+  /// Constructs a TrySendError with a `kind`, holding the value that could
+  /// not be sent.
+  constexpr TrySendError(Kind kind, T&& value)
+      : kind_(kind), value_(::sus::move(value)) {}
+
+  /// The type of error which occured.
+  [[nodiscard]] sus_pure constexpr Kind kind() const noexcept { return kind_; }
+  /// Returns true if the value could not be sent because the channel was at
+  /// capacity.
+  [[nodiscard]] sus_pure constexpr bool is_full() const noexcept {
+    return kind_ == Kind::Full;
+  }
+  /// Returns true if the value could not be sent because all receivers were
+  /// dropped.
+  [[nodiscard]] sus_pure constexpr bool is_disconnected() const noexcept {
+    return kind_ == Kind::Disconnected;
+  }
+
+  /// Returns the value that could not be sent.
+  constexpr T into_inner() && noexcept { return ::sus::move(value_); }
+
+  [[nodiscard]] sus_pure std::string to_string() const noexcept {
+    switch (kind_) {
+      case Kind::Full: return std::string("sending on a full channel");
+      case Kind::Disconnected:
+        return std::string("sending on a disconnected channel");
+    }
+    ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);
+  }
+
+ private:
+  Kind kind_;
+  T value_;
+};
+
+/// The error returned from a blocking `recv()` when the channel is empty and
+/// all senders of the channel have been dropped.
+class RecvError {
+ public:
+  constexpr RecvError() = default;
+
+  [[nodiscard]] sus_pure std::string to_string() const noexcept {
+    return std::string("receiving on an empty and disconnected channel");
+  }
+};
+
+/// The error returned from `try_recv()` when no value could be received
+/// without blocking.
+class TryRecvError {
+ public:
+  /// The type of error which occured.
+  enum class Kind {
+    /// The channel is currently empty, but senders still exist.
+    Empty,
+    /// The channel is empty and all senders have been dropped.
+    Disconnected,
+  };
+
+  /// Constructs a TryRecvError with a `kind`.
+  explicit constexpr TryRecvError(Kind kind) : kind_(kind) {}
+
+  /// The type of error which occured.
+  [[nodiscard]] sus_pure constexpr Kind kind() const noexcept { return kind_; }
+  /// Returns true if no value was received because the channel was empty.
+  [[nodiscard]] sus_pure constexpr bool is_empty() const noexcept {
+    return kind_ == Kind::Empty;
+  }
+  /// Returns true if no value was received because the channel was empty and
+  /// all senders were dropped.
+  [[nodiscard]] sus_pure constexpr bool is_disconnected() const noexcept {
+    return kind_ == Kind::Disconnected;
+  }
+
+  [[nodiscard]] sus_pure std::string to_string() const noexcept {
+    switch (kind_) {
+      case Kind::Empty: return std::string("receiving on an empty channel");
+      case Kind::Disconnected:
+        return std::string("receiving on an empty and disconnected channel");
+    }
+    ::sus::assertions::unreachable_unchecked(::sus::marker::unsafe_fn);
+  }
+
+ private:
+  Kind kind_;
+};
+
+}  // namespace sus::sync::channel
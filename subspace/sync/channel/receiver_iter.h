@@ -0,0 +1,107 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/iter/iterator_defn.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/option/option.h"
+
+namespace sus::sync::channel {
+
+/// An iterator over values received on a channel, which blocks waiting for
+/// each value.
+///
+/// The iterator returns None once the channel is empty and all senders have
+/// been dropped.
+///
+/// This struct is created by the `iter()` method on receivers.
+template <class ItemT, class Receiver>
+class [[nodiscard]] [[sus_trivial_abi]] RecvIter final
+    : public ::sus::iter::IteratorBase<RecvIter<ItemT, Receiver>, ItemT> {
+ public:
+  using Item = ItemT;
+
+  static RecvIter with(const Receiver& rx sus_lifetimebound) noexcept {
+    return RecvIter(rx);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept { return rx_->recv().ok(); }
+
+ private:
+  RecvIter(const Receiver& rx) : rx_(&rx) {}
+
+  const Receiver* rx_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(rx_));
+};
+
+/// An iterator over values received on a channel, which does not block.
+///
+/// The iterator returns None once the channel is empty, even if senders still
+/// exist. More values may be received afterward, through a new iterator.
+///
+/// This struct is created by the `try_iter()` method on receivers.
+template <class ItemT, class Receiver>
+class [[nodiscard]] [[sus_trivial_abi]] TryRecvIter final
+    : public ::sus::iter::IteratorBase<TryRecvIter<ItemT, Receiver>, ItemT> {
+ public:
+  using Item = ItemT;
+
+  static TryRecvIter with(const Receiver& rx sus_lifetimebound) noexcept {
+    return TryRecvIter(rx);
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept { return rx_->try_recv().ok(); }
+
+ private:
+  TryRecvIter(const Receiver& rx) : rx_(&rx) {}
+
+  const Receiver* rx_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(rx_));
+};
+
+/// An iterator that owns a receiver, and blocks waiting for each value.
+///
+/// The iterator returns None once the channel is empty and all senders have
+/// been dropped.
+///
+/// This struct is created by the `into_iter()` method on receivers.
+template <class ItemT, class Receiver>
+class [[nodiscard]] [[sus_trivial_abi]] RecvIntoIter final
+    : public ::sus::iter::IteratorBase<RecvIntoIter<ItemT, Receiver>, ItemT> {
+ public:
+  using Item = ItemT;
+
+  static RecvIntoIter with(Receiver&& rx) noexcept {
+    return RecvIntoIter(::sus::move(rx));
+  }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept { return rx_.recv().ok(); }
+
+ private:
+  RecvIntoIter(Receiver&& rx) : rx_(::sus::move(rx)) {}
+
+  Receiver rx_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(rx_));
+};
+
+}  // namespace sus::sync::channel
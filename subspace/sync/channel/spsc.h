@@ -0,0 +1,232 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "subspace/assertions/check.h"
+#include "subspace/iter/__private/iterator_end.h"
+#include "subspace/iter/__private/iterator_loop.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/mem/replace.h"
+#include "subspace/num/unsigned_integer.h"
+#include "subspace/option/option.h"
+#include "subspace/result/result.h"
+#include "subspace/sync/channel/__private/channel.h"
+#include "subspace/sync/channel/__private/spsc_queue.h"
+#include "subspace/sync/channel/errors.h"
+#include "subspace/sync/channel/receiver_iter.h"
+#include "subspace/tuple/tuple.h"
+
+namespace sus::sync::channel {
+
+template <class T>
+class SpscReceiver;
+
+/// The sending half of a bounded single-producer single-consumer channel.
+///
+/// Unlike `Sender`, the SpscSender can not be cloned, and it must only be used
+/// from one thread at a time. It can be moved to another thread.
+///
+/// This type is created by `spsc()`.
+template <class T>
+class [[sus_trivial_abi]] SpscSender final {
+  using Channel = __private::Channel<__private::SpscQueue<T>>;
+
+ public:
+  ~SpscSender() noexcept {
+    if (channel_) channel_->drop_sender();
+  }
+
+  SpscSender(SpscSender&& o) noexcept
+      : channel_(::sus::mem::replace(mref(o.channel_), nullptr)) {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+  }
+  SpscSender& operator=(SpscSender&& o) noexcept {
+    ::sus::check(o.channel_ != nullptr);  // Catch use-after-move.
+    // Take the other channel first, as dropping the old one may free it when
+    // they are the same.
+    Channel* channel = ::sus::mem::replace(mref(o.channel_), nullptr);
+    if (channel_) channel_->drop_sender();
+    channel_ = channel;
+    return *this;
+  }
+
+  /// Attempts to send `value` on the channel without blocking.
+  ///
+  /// Returns None if the value was sent. Otherwise returns a `TrySendError`
+  /// holding the unsent value, which says if the channel was full or if the
+  /// receiver has been dropped.
+  ///
+  /// The error is returned in an Option, since `Result` can not hold `void`
+  /// for the success case.
+  [[nodiscard]] Option<TrySendError<T>> try_send(T value) const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->try_send(::sus::move(value));
+  }
+
+  /// Sends `value` on the channel, blocking while the channel is full.
+  ///
+  /// Returns None if the value was sent. If the receiver has been dropped, the
+  /// value can not be sent, and it is returned in a `SendError`.
+  ///
+  /// The error is returned in an Option, since `Result` can not hold `void`
+  /// for the success case.
+  [[nodiscard]] Option<SendError<T>> send(T value) const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->send(::sus::move(value));
+  }
+
+  /// Returns the maximum number of values the channel can hold.
+  ::sus::num::usize capacity() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->capacity();
+  }
+
+ private:
+  template <class U>
+  friend ::sus::Tuple<SpscSender<U>, SpscReceiver<U>> spsc(
+      ::sus::num::usize capacity) noexcept;
+
+  explicit SpscSender(Channel& channel) noexcept : channel_(&channel) {}
+
+  Channel* channel_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(channel_));
+};
+
+/// The receiving half of a bounded single-producer single-consumer channel.
+///
+/// Unlike `Receiver`, the SpscReceiver can not be cloned, and it must only be
+/// used from one thread at a time. It can be moved to another thread.
+///
+/// Values can be received one at a time with `recv()` or `try_recv()`, or
+/// through an iterator from `iter()`, `try_iter()` or `into_iter()`. A
+/// SpscReceiver can also be used directly in a ranged for loop, which receives
+/// until the sender is dropped.
+///
+/// This type is created by `spsc()`.
+template <class T>
+class [[sus_trivial_abi]] SpscReceiver final {
+  using Channel = __private::Channel<__private::SpscQueue<T>>;
+
+ public:
+  ~SpscReceiver() noexcept {
+    if (channel_) channel_->drop_receiver();
+  }
+
+  SpscReceiver(SpscReceiver&& o) noexcept
+      : channel_(::sus::mem::replace(mref(o.channel_), nullptr)) {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+  }
+  SpscReceiver& operator=(SpscReceiver&& o) noexcept {
+    ::sus::check(o.channel_ != nullptr);  // Catch use-after-move.
+    // Take the other channel first, as dropping the old one may free it when
+    // they are the same.
+    Channel* channel = ::sus::mem::replace(mref(o.channel_), nullptr);
+    if (channel_) channel_->drop_receiver();
+    channel_ = channel;
+    return *this;
+  }
+
+  /// Attempts to receive a value from the channel without blocking.
+  ///
+  /// Returns a `TryRecvError` if the channel is empty, which says if the
+  /// sender still exists or if it has been dropped.
+  ::sus::Result<T, TryRecvError> try_recv() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->try_recv();
+  }
+
+  /// Receives a value from the channel, blocking while the channel is empty.
+  ///
+  /// Returns a `RecvError` if the channel is empty and the sender has been
+  /// dropped.
+  ::sus::Result<T, RecvError> recv() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->recv();
+  }
+
+  /// Returns an iterator that receives values, blocking while the channel is
+  /// empty, until the sender is dropped.
+  RecvIter<T, SpscReceiver> iter() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return RecvIter<T, SpscReceiver>::with(*this);
+  }
+  RecvIter<T, SpscReceiver> iter() && = delete;
+
+  /// Returns an iterator that receives the values currently in the channel,
+  /// without blocking.
+  TryRecvIter<T, SpscReceiver> try_iter() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return TryRecvIter<T, SpscReceiver>::with(*this);
+  }
+  TryRecvIter<T, SpscReceiver> try_iter() && = delete;
+
+  /// Converts the SpscReceiver into an iterator that receives values, blocking
+  /// while the channel is empty, until the sender is dropped.
+  ///
+  /// sus::iter::IntoIterator trait.
+  RecvIntoIter<T, SpscReceiver> into_iter() && noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return RecvIntoIter<T, SpscReceiver>::with(::sus::move(*this));
+  }
+
+  /// Returns the maximum number of values the channel can hold.
+  ::sus::num::usize capacity() const& noexcept {
+    ::sus::check(channel_ != nullptr);  // Catch use-after-move.
+    return channel_->capacity();
+  }
+
+ private:
+  template <class U>
+  friend ::sus::Tuple<SpscSender<U>, SpscReceiver<U>> spsc(
+      ::sus::num::usize capacity) noexcept;
+
+  explicit SpscReceiver(Channel& channel) noexcept : channel_(&channel) {}
+
+  Channel* channel_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
+                                  decltype(channel_));
+};
+
+/// Creates a bounded single-producer single-consumer channel, which can hold
+/// up to `capacity` values at a time.
+///
+/// With only one thread on each side, sending and receiving need no
+/// compare-and-swap operations: each is a load of a cached position and a
+/// release store. The sender and receiver positions are kept on separate cache
+/// lines so the two threads do not contend on them. Blocking works as in
+/// `bounded()`.
+///
+/// # Panics
+/// Panics if `capacity` is 0.
+template <class T>
+::sus::Tuple<SpscSender<T>, SpscReceiver<T>> spsc(
+    ::sus::num::usize capacity) noexcept {
+  ::sus::check(capacity > 0u);
+  auto* channel =
+      __private::Channel<__private::SpscQueue<T>>::create(size_t{capacity});
+  return ::sus::Tuple<SpscSender<T>, SpscReceiver<T>>::with(
+      SpscSender<T>(*channel), SpscReceiver<T>(*channel));
+}
+
+// Implicit for-ranged loop iteration via `SpscReceiver::iter()`.
+using ::sus::iter::__private::begin;
+using ::sus::iter::__private::end;
+
+}  // namespace sus::sync::channel
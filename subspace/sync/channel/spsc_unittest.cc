@@ -0,0 +1,120 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/channel/spsc.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/iter/iterator.h"
+#include "subspace/mem/move.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::sync::channel::spsc;
+using sus::sync::channel::SpscReceiver;
+using sus::sync::channel::SpscSender;
+using sus::sync::channel::TrySendError;
+
+static_assert(sus::mem::relocate_by_memcpy<SpscSender<i32>>);
+static_assert(sus::mem::relocate_by_memcpy<SpscReceiver<i32>>);
+
+TEST(Spsc, TrySendTryRecv) {
+  auto [tx, rx] = spsc<i32>(2u);
+  EXPECT_EQ(tx.capacity(), 2u);
+  EXPECT_EQ(rx.try_recv().unwrap_err().is_empty(), true);
+
+  EXPECT_EQ(tx.try_send(1).is_none(), true);
+  EXPECT_EQ(tx.try_send(2).is_none(), true);
+  auto full = tx.try_send(3);
+  EXPECT_EQ(full->kind(), TrySendError<i32>::Kind::Full);
+  EXPECT_EQ(rx.try_recv().unwrap(), 1);
+  EXPECT_EQ(tx.try_send(3).is_none(), true);
+  EXPECT_EQ(rx.try_recv().unwrap(), 2);
+  EXPECT_EQ(rx.try_recv().unwrap(), 3);
+  EXPECT_EQ(rx.try_recv().is_err(), true);
+}
+
+TEST(Spsc, NonPowerOfTwoWraps) {
+  auto [tx, rx] = spsc<i32>(3u);
+  for (i32 i = 0; i < 20; i += 1) {
+    EXPECT_EQ(tx.try_send(i).is_none(), true);
+    EXPECT_EQ(tx.try_send(i + 100).is_none(), true);
+    EXPECT_EQ(rx.try_recv().unwrap(), i);
+    EXPECT_EQ(rx.try_recv().unwrap(), i + 100);
+  }
+}
+
+TEST(Spsc, Disconnected) {
+  {
+    auto [tx, rx] = spsc<i32>(2u);
+    EXPECT_EQ(tx.send(1).is_none(), true);
+    { auto drop = sus::move(tx); }
+    EXPECT_EQ(rx.recv().unwrap(), 1);
+    EXPECT_EQ(rx.try_recv().unwrap_err().is_disconnected(), true);
+    EXPECT_EQ(rx.recv().is_err(), true);
+  }
+  {
+    auto [tx, rx] = spsc<i32>(2u);
+    { auto drop = sus::move(rx); }
+    auto e = tx.try_send(1);
+    EXPECT_EQ(e->is_disconnected(), true);
+    EXPECT_EQ(tx.send(2).unwrap().into_inner(), 2);
+  }
+}
+
+TEST(Spsc, SelfMoveAssign) {
+  auto [tx, rx] = spsc<i32>(2u);
+  auto& tx_self = tx;
+  tx = sus::move(tx_self);
+  auto& rx_self = rx;
+  rx = sus::move(rx_self);
+  // The channel is still alive and connected on both ends.
+  EXPECT_EQ(tx.send(1).is_none(), true);
+  EXPECT_EQ(rx.recv().unwrap(), 1);
+  EXPECT_EQ(rx.try_recv().unwrap_err().is_empty(), true);
+}
+
+TEST(Spsc, Threaded) {
+  auto [tx, rx] = spsc<usize>(4u);
+  auto t = std::thread([tx = sus::move(tx)]() {
+    for (usize i = 0u; i < 10000u; i += 1u)
+      EXPECT_EQ(tx.send(i).is_none(), true);
+  });
+  // Values arrive in order.
+  usize expected = 0u;
+  for (usize i : rx) {
+    EXPECT_EQ(i, expected);
+    expected += 1u;
+  }
+  EXPECT_EQ(expected, 10000u);
+  t.join();
+}
+
+TEST(Spsc, IntoIter) {
+  auto [tx, rx] = spsc<i32>(4u);
+  auto t = std::thread([tx = sus::move(tx)]() {
+    for (i32 i = 1; i <= 5; i += 1) EXPECT_EQ(tx.send(i).is_none(), true);
+  });
+  auto v = sus::move(rx)
+               .into_iter()
+               .map([](i32&& i) { return i * i; })
+               .collect<Vec<i32>>();
+  EXPECT_EQ(v, sus::Vec<i32>::with_values(1, 4, 9, 16, 25));
+  t.join();
+}
+
+}  // namespace
@@ -0,0 +1,163 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/construct/default.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/replace.h"
+#include "subspace/option/option.h"
+#include "subspace/sync/__private/raw_mutex.h"
+
+namespace sus::sync {
+
+template <class T>
+class Mutex;
+
+/// A held lock on a `Mutex`, which gives access to the data it protects.
+///
+/// The lock is released when the MutexGuard is destroyed.
+///
+/// This type is created by `Mutex::lock()` and `Mutex::try_lock()`.
+template <class T>
+class [[nodiscard]] MutexGuard final {
+ public:
+  ~MutexGuard() noexcept {
+    if (mutex_) mutex_->raw_.unlock();
+  }
+
+  MutexGuard(MutexGuard&& o) noexcept
+      : mutex_(::sus::mem::replace(mref(o.mutex_), nullptr)) {
+    ::sus::check(mutex_ != nullptr);  // Catch use-after-move.
+  }
+  MutexGuard& operator=(MutexGuard&& o) noexcept {
+    ::sus::check(o.mutex_ != nullptr);  // Catch use-after-move.
+    if (mutex_) mutex_->raw_.unlock();
+    mutex_ = ::sus::mem::replace(mref(o.mutex_), nullptr);
+    return *this;
+  }
+
+  const T& operator*() const noexcept {
+    ::sus::check(mutex_ != nullptr);  // Catch use-after-move.
+    return mutex_->data_;
+  }
+  T& operator*() noexcept {
+    ::sus::check(mutex_ != nullptr);  // Catch use-after-move.
+    return mutex_->data_;
+  }
+  const T* operator->() const noexcept {
+    ::sus::check(mutex_ != nullptr);  // Catch use-after-move.
+    return &mutex_->data_;
+  }
+  T* operator->() noexcept {
+    ::sus::check(mutex_ != nullptr);  // Catch use-after-move.
+    return &mutex_->data_;
+  }
+
+ private:
+  friend class Mutex<T>;
+
+  explicit MutexGuard(const Mutex<T>& mutex) noexcept : mutex_(&mutex) {}
+
+  const Mutex<T>* mutex_;
+};
+
+/// A mutual exclusion primitive that protects the data it owns.
+///
+/// The data can only be accessed through the `MutexGuard` returned from
+/// `lock()` or `try_lock()`, which holds the lock until it is destroyed. This
+/// makes it impossible to access the data without holding the lock.
+///
+/// Locking and unlocking a Mutex without contention is a single atomic
+/// operation each. A thread that finds the Mutex locked spins briefly, and
+/// then sleeps in the kernel (through a futex on Linux) until the Mutex is
+/// unlocked. Unlocking only makes a syscall when a thread may be sleeping.
+///
+/// Unlike `std::mutex`, a Mutex is not poisoned if a thread panics while
+/// holding the lock, as a panic terminates the program.
+///
+/// # Example
+/// ```
+/// static auto counts = sus::sync::Mutex<sus::Vec<i32>>();
+/// counts.lock()->push(1);
+/// {
+///   auto guard = counts.lock();
+///   guard->push(2);
+///   guard->push(3);
+/// }  // The lock is released here.
+/// ```
+template <class T>
+class Mutex final {
+  static_assert(!std::is_reference_v<T>,
+                "References in Mutex are not supported.");
+
+ public:
+  /// Constructs a Mutex holding `value`, in an unlocked state.
+  static Mutex with(T value) noexcept { return Mutex(::sus::move(value)); }
+
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs a Mutex holding a default-constructed `T`.
+  Mutex() noexcept
+    requires(::sus::construct::Default<T>)
+      : data_() {}
+
+  Mutex(const Mutex&) = delete;
+  Mutex& operator=(const Mutex&) = delete;
+
+  /// Acquires the lock, blocking the current thread until it is able to do
+  /// so, and returns a guard which gives access to the data.
+  ///
+  /// A Mutex is not reentrant: locking it again from the same thread while
+  /// the lock is held will deadlock.
+  MutexGuard<T> lock() const& noexcept {
+    raw_.lock();
+    return MutexGuard<T>(*this);
+  }
+  MutexGuard<T> lock() && = delete;
+
+  /// Attempts to acquire the lock without blocking, returning a guard which
+  /// gives access to the data if it succeeds.
+  Option<MutexGuard<T>> try_lock() const& noexcept {
+    if (raw_.try_lock())
+      return Option<MutexGuard<T>>::some(MutexGuard<T>(*this));
+    else
+      return Option<MutexGuard<T>>::none();
+  }
+  Option<MutexGuard<T>> try_lock() && = delete;
+
+  /// Returns a mutable reference to the data, without locking.
+  ///
+  /// This is safe because a mutable reference to the Mutex guarantees that no
+  /// other threads are concurrently accessing it.
+  T& get_mut() & noexcept sus_lifetimebound { return data_; }
+
+  /// Consumes the Mutex and returns the data.
+  T into_inner() && noexcept { return ::sus::move(data_); }
+
+ private:
+  friend class MutexGuard<T>;
+
+  explicit Mutex(T&& value) noexcept : data_(::sus::move(value)) {}
+
+  mutable __private::RawMutex raw_;
+  mutable T data_;
+};
+
+}  // namespace sus::sync
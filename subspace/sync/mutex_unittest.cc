@@ -0,0 +1,90 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/mutex.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::sync::Mutex;
+using sus::sync::MutexGuard;
+
+TEST(Mutex, LockGuard) {
+  auto m = Mutex<Vec<i32>>();
+  m.lock()->push(1);
+  {
+    auto guard = m.lock();
+    guard->push(2);
+    (*guard).push(3);
+    EXPECT_EQ(guard->len(), 3u);
+  }
+  EXPECT_EQ(sus::move(m).into_inner(), sus::Vec<i32>::with_values(1, 2, 3));
+}
+
+TEST(Mutex, TryLock) {
+  auto m = Mutex<i32>::with(4);
+  {
+    auto guard = m.lock();
+    EXPECT_EQ(m.try_lock().is_none(), true);
+  }
+  auto o = m.try_lock();
+  EXPECT_EQ(o.is_some(), true);
+  EXPECT_EQ(**o, 4);
+}
+
+TEST(Mutex, GuardMove) {
+  auto m = Mutex<i32>::with(1);
+  auto g = m.lock();
+  auto g2 = sus::move(g);
+  *g2 = 2;
+  EXPECT_EQ(m.try_lock().is_none(), true);
+  { auto drop = sus::move(g2); }
+  EXPECT_EQ(*m.lock(), 2);
+}
+
+TEST(Mutex, GetMut) {
+  auto m = Mutex<i32>::with(1);
+  m.get_mut() = 5;
+  EXPECT_EQ(*m.lock(), 5);
+}
+
+TEST(Mutex, Threads) {
+  // A non-atomic read-modify-write of two values, which would lose updates or
+  // tear without the lock.
+  struct Pair {
+    u64 a;
+    u64 b;
+  };
+  auto m = Mutex<Pair>::with(Pair(0u, 0u));
+  auto threads = Vec<std::thread>();
+  for (i32 t = 0; t < 4; t += 1) {
+    threads.push(std::thread([&m]() {
+      for (i32 i = 0; i < 5000; i += 1) {
+        auto guard = m.lock();
+        EXPECT_EQ(guard->a, guard->b);
+        guard->a += 1u;
+        guard->b += 1u;
+      }
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+  EXPECT_EQ(m.lock()->a, 20000u);
+}
+
+}  // namespace
@@ -0,0 +1,116 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "subspace/fn/fn_concepts.h"
+#include "subspace/mem/forward.h"
+
+namespace sus::sync {
+
+template <class T>
+class OnceLock;
+
+/// A synchronization primitive which runs a one-time initialization.
+///
+/// Once the initialization has completed, `call_once()` is a single acquire
+/// load. Threads that call `call_once()` while another thread is running the
+/// initialization sleep in the kernel (through a futex on Linux) until it
+/// completes.
+///
+/// # Example
+/// ```
+/// static sus::sync::Once init;
+/// init.call_once([]() { setup_global_state(); });
+/// ```
+class Once final {
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs a Once that has not yet run.
+  constexpr Once() noexcept = default;
+
+  Once(const Once&) = delete;
+  Once& operator=(const Once&) = delete;
+
+  /// Runs `f` if this is the first call to `call_once()` on this Once.
+  /// Otherwise, `f` is not run, and `call_once()` blocks until the first call
+  /// has finished running its function.
+  ///
+  /// When `call_once()` returns, the function given to the first call has
+  /// completed, and everything it did is visible to the calling thread.
+  ///
+  /// Calling `call_once()` again from inside `f` will deadlock.
+  void call_once(::sus::fn::FnOnce<void()> auto&& f) noexcept {
+    if (is_completed()) return;
+    call_once_slow(::sus::forward<decltype(f)>(f));
+  }
+
+  /// Returns true if some `call_once()` call has completed.
+  bool is_completed() const noexcept {
+    return state_.load(std::memory_order_acquire) == kComplete;
+  }
+
+ private:
+  template <class T>
+  friend class OnceLock;
+
+  void call_once_slow(::sus::fn::FnOnce<void()> auto&& f) noexcept {
+    uint32_t state = state_.load(std::memory_order_acquire);
+    while (true) {
+      switch (state) {
+        case kComplete: return;
+        case kIncomplete:
+          if (!state_.compare_exchange_weak(state, kRunning,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+            continue;
+          ::sus::forward<decltype(f)>(f)();
+          if (state_.exchange(kComplete, std::memory_order_release) ==
+              kRunningWithWaiters)
+            state_.notify_all();
+          return;
+        case kRunning:
+          // Tell the running thread that it needs to wake us.
+          if (!state_.compare_exchange_weak(state, kRunningWithWaiters,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+            continue;
+          [[fallthrough]];
+        case kRunningWithWaiters:
+          state_.wait(kRunningWithWaiters, std::memory_order_acquire);
+          state = state_.load(std::memory_order_acquire);
+      }
+    }
+  }
+
+  /// Returns a completed Once to its initial state. Requires exclusive access
+  /// to the Once.
+  void reset() noexcept {
+    state_.store(kIncomplete, std::memory_order_relaxed);
+  }
+
+  static constexpr uint32_t kIncomplete = 0u;
+  static constexpr uint32_t kRunning = 1u;
+  static constexpr uint32_t kRunningWithWaiters = 2u;
+  static constexpr uint32_t kComplete = 3u;
+
+  std::atomic<uint32_t> state_ = kIncomplete;
+};
+
+}  // namespace sus::sync
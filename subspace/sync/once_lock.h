@@ -0,0 +1,132 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <new>
+#include <type_traits>
+
+#include "subspace/fn/fn_concepts.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/mem/forward.h"
+#include "subspace/mem/move.h"
+#include "subspace/option/option.h"
+#include "subspace/sync/once.h"
+
+namespace sus::sync {
+
+/// A container which can be written to only once, and can be safely shared
+/// between threads.
+///
+/// Reading the value once it is set is a single acquire load, and returns a
+/// reference to the value inside the OnceLock. This makes OnceLock a good fit
+/// for lazily-initialized global state.
+///
+/// # Example
+/// ```
+/// static sus::sync::OnceLock<Config> config;
+/// const Config& c = config.get_or_init([]() { return Config::load(); });
+/// ```
+template <class T>
+class OnceLock final {
+  static_assert(!std::is_reference_v<T>,
+                "References in OnceLock are not supported.");
+
+ public:
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs an empty OnceLock.
+  constexpr OnceLock() noexcept {}
+
+  ~OnceLock() noexcept {
+    if (once_.is_completed()) value_.~T();
+  }
+
+  OnceLock(const OnceLock&) = delete;
+  OnceLock& operator=(const OnceLock&) = delete;
+
+  /// Returns a reference to the value if it has been set, or None if the
+  /// OnceLock is empty or is being initialized by another thread.
+  Option<const T&> get() const& noexcept {
+    if (once_.is_completed())
+      return Option<const T&>::some(value_);
+    else
+      return Option<const T&>::none();
+  }
+  Option<const T&> get() && = delete;
+
+  /// Returns a mutable reference to the value if it has been set, or None if
+  /// the OnceLock is empty.
+  ///
+  /// This is safe because a mutable reference to the OnceLock guarantees that
+  /// no other threads are concurrently accessing it.
+  Option<T&> get_mut() & noexcept {
+    if (once_.is_completed())
+      return Option<T&>::some(value_);
+    else
+      return Option<T&>::none();
+  }
+
+  /// Returns a reference to the value, initializing it with `f` if the
+  /// OnceLock is empty.
+  ///
+  /// If multiple threads call `get_or_init()` concurrently on an empty
+  /// OnceLock, only one of the functions runs, and the other threads block
+  /// until it has finished.
+  const T& get_or_init(::sus::fn::FnOnce<T()> auto&& f) const& noexcept {
+    once_.call_once([this, &f]() {
+      new (&value_) T(::sus::forward<decltype(f)>(f)());
+    });
+    return value_;
+  }
+  const T& get_or_init(::sus::fn::FnOnce<T()> auto&& f) && = delete;
+
+  /// Sets the value of the OnceLock if it is empty.
+  ///
+  /// Returns None if the value was set. If the OnceLock was already
+  /// initialized, the OnceLock is unchanged, and `value` is returned back.
+  //
+  // TODO: Return `Result<void, T>` once Result supports void.
+  Option<T> set(T value) const& noexcept {
+    bool stored = false;
+    once_.call_once([this, &value, &stored]() {
+      new (&value_) T(::sus::move(value));
+      stored = true;
+    });
+    if (stored)
+      return Option<T>::none();
+    else
+      return Option<T>::some(::sus::move(value));
+  }
+
+  /// Takes the value out of the OnceLock, leaving it empty.
+  Option<T> take() & noexcept {
+    if (!once_.is_completed()) return Option<T>::none();
+    auto out = Option<T>::some(::sus::move(value_));
+    value_.~T();
+    once_.reset();
+    return out;
+  }
+
+  /// Consumes the OnceLock, returning the value if it was set.
+  Option<T> into_inner() && noexcept { return take(); }
+
+ private:
+  mutable Once once_;
+  union {
+    mutable T value_;
+  };
+};
+
+}  // namespace sus::sync
@@ -0,0 +1,74 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/once_lock.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::sync::OnceLock;
+
+TEST(OnceLock, GetOrInit) {
+  OnceLock<Vec<i32>> l;
+  EXPECT_EQ(l.get().is_none(), true);
+  const Vec<i32>& v =
+      l.get_or_init([]() { return sus::Vec<i32>::with_values(1, 2); });
+  EXPECT_EQ(v.len(), 2u);
+  const Vec<i32>& v2 = l.get_or_init([]() { return Vec<i32>(); });
+  EXPECT_EQ(&v, &v2);
+  EXPECT_EQ(l.get().unwrap().len(), 2u);
+}
+
+TEST(OnceLock, Set) {
+  OnceLock<i32> l;
+  EXPECT_EQ(l.set(3).is_none(), true);
+  EXPECT_EQ(l.set(4).unwrap(), 4);
+  EXPECT_EQ(l.get().unwrap(), 3);
+}
+
+TEST(OnceLock, TakeAndGetMut) {
+  OnceLock<i32> l;
+  EXPECT_EQ(l.get_mut().is_none(), true);
+  EXPECT_EQ(l.set(3).is_none(), true);
+  l.get_mut().unwrap() = 5;
+  EXPECT_EQ(l.take().unwrap(), 5);
+  EXPECT_EQ(l.get().is_none(), true);
+  EXPECT_EQ(l.set(6).is_none(), true);
+  EXPECT_EQ(sus::move(l).into_inner().unwrap(), 6);
+}
+
+TEST(OnceLock, Threads) {
+  OnceLock<i32> l;
+  i32 calls = 0;
+  i32 results[4] = {};
+  auto threads = Vec<std::thread>();
+  for (usize t = 0u; t < 4u; t += 1u) {
+    threads.push(std::thread([&, t]() {
+      results[size_t{t}] = l.get_or_init([&]() {
+        calls += 1;
+        return 7_i32;
+      });
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+  EXPECT_EQ(calls, 1);
+  for (i32 r : results) EXPECT_EQ(r, 7);
+}
+
+}  // namespace
@@ -0,0 +1,61 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/once.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+#include "subspace/sync/atomic.h"
+
+namespace {
+
+using sus::sync::Atomic;
+using sus::sync::Once;
+using sus::sync::Ordering;
+
+TEST(Once, CallOnce) {
+  Once once;
+  EXPECT_EQ(once.is_completed(), false);
+  i32 calls = 0;
+  once.call_once([&]() { calls += 1; });
+  EXPECT_EQ(once.is_completed(), true);
+  once.call_once([&]() { calls += 1; });
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(Once, Threads) {
+  Once once;
+  auto calls = Atomic<u32>();
+  auto seen = Atomic<u32>();
+  auto threads = Vec<std::thread>();
+  for (i32 t = 0; t < 4; t += 1) {
+    threads.push(std::thread([&]() {
+      once.call_once([&]() {
+        // Make other threads wait on the running initialization.
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        calls.fetch_add(1u, Ordering::Relaxed);
+      });
+      // The initialization is visible to every thread once call_once returns.
+      seen.fetch_add(calls.load(Ordering::Relaxed), Ordering::Relaxed);
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+  EXPECT_EQ(calls.load(Ordering::Relaxed), 1u);
+  EXPECT_EQ(seen.load(Ordering::Relaxed), 4u);
+}
+
+}  // namespace
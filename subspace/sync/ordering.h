@@ -0,0 +1,60 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+
+#include "subspace/assertions/unreachable.h"
+
+namespace sus::sync {
+
+/// Memory orderings for atomic operations, which describe how the operation
+/// synchronizes with other threads.
+///
+/// These have the same meaning as the C++20 memory model orderings, without
+/// `memory_order_consume`. See
+/// https://en.cppreference.com/w/cpp/atomic/memory_order.
+enum class Ordering {
+  /// No ordering constraints, only atomicity.
+  Relaxed,
+  /// For stores: all previous writes become visible to a thread that loads
+  /// the stored value with `Acquire` (or stronger).
+  Release,
+  /// For loads: all writes made visible by a `Release` store of the loaded
+  /// value are visible after the load.
+  Acquire,
+  /// Both `Acquire` and `Release`, for read-modify-write operations.
+  AcqRel,
+  /// Like `AcqRel`, and additionally all threads see all `SeqCst` operations
+  /// in the same order.
+  SeqCst,
+};
+
+namespace __private {
+
+constexpr inline std::memory_order to_memory_order(Ordering o) noexcept {
+  switch (o) {
+    case Ordering::Relaxed: return std::memory_order_relaxed;
+    case Ordering::Release: return std::memory_order_release;
+    case Ordering::Acquire: return std::memory_order_acquire;
+    case Ordering::AcqRel: return std::memory_order_acq_rel;
+    case Ordering::SeqCst: return std::memory_order_seq_cst;
+  }
+  ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
+}
+
+}  // namespace __private
+
+}  // namespace sus::sync
@@ -0,0 +1,211 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <type_traits>
+
+#include "subspace/assertions/check.h"
+#include "subspace/construct/default.h"
+#include "subspace/macros/lifetimebound.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/mref.h"
+#include "subspace/mem/replace.h"
+#include "subspace/option/option.h"
+#include "subspace/sync/__private/raw_rwlock.h"
+
+namespace sus::sync {
+
+template <class T>
+class RwLock;
+
+/// A held shared read lock on a `RwLock`, which gives const access to the data
+/// it protects.
+///
+/// The lock is released when the RwLockReadGuard is destroyed.
+///
+/// This type is created by `RwLock::read()` and `RwLock::try_read()`.
+template <class T>
+class [[nodiscard]] RwLockReadGuard final {
+ public:
+  ~RwLockReadGuard() noexcept {
+    if (lock_) lock_->raw_.read_unlock();
+  }
+
+  RwLockReadGuard(RwLockReadGuard&& o) noexcept
+      : lock_(::sus::mem::replace(mref(o.lock_), nullptr)) {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+  }
+  RwLockReadGuard& operator=(RwLockReadGuard&& o) noexcept {
+    ::sus::check(o.lock_ != nullptr);  // Catch use-after-move.
+    if (lock_) lock_->raw_.read_unlock();
+    lock_ = ::sus::mem::replace(mref(o.lock_), nullptr);
+    return *this;
+  }
+
+  const T& operator*() const noexcept {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+    return lock_->data_;
+  }
+  const T* operator->() const noexcept {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+    return &lock_->data_;
+  }
+
+ private:
+  friend class RwLock<T>;
+
+  explicit RwLockReadGuard(const RwLock<T>& lock) noexcept : lock_(&lock) {}
+
+  const RwLock<T>* lock_;
+};
+
+/// A held exclusive write lock on a `RwLock`, which gives mutable access to
+/// the data it protects.
+///
+/// The lock is released when the RwLockWriteGuard is destroyed.
+///
+/// This type is created by `RwLock::write()` and `RwLock::try_write()`.
+template <class T>
+class [[nodiscard]] RwLockWriteGuard final {
+ public:
+  ~RwLockWriteGuard() noexcept {
+    if (lock_) lock_->raw_.write_unlock();
+  }
+
+  RwLockWriteGuard(RwLockWriteGuard&& o) noexcept
+      : lock_(::sus::mem::replace(mref(o.lock_), nullptr)) {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+  }
+  RwLockWriteGuard& operator=(RwLockWriteGuard&& o) noexcept {
+    ::sus::check(o.lock_ != nullptr);  // Catch use-after-move.
+    if (lock_) lock_->raw_.write_unlock();
+    lock_ = ::sus::mem::replace(mref(o.lock_), nullptr);
+    return *this;
+  }
+
+  const T& operator*() const noexcept {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+    return lock_->data_;
+  }
+  T& operator*() noexcept {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+    return lock_->data_;
+  }
+  const T* operator->() const noexcept {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+    return &lock_->data_;
+  }
+  T* operator->() noexcept {
+    ::sus::check(lock_ != nullptr);  // Catch use-after-move.
+    return &lock_->data_;
+  }
+
+ private:
+  friend class RwLock<T>;
+
+  explicit RwLockWriteGuard(const RwLock<T>& lock) noexcept : lock_(&lock) {}
+
+  const RwLock<T>* lock_;
+};
+
+/// A reader-writer lock that protects the data it owns.
+///
+/// Any number of readers may hold the lock at once, through the
+/// `RwLockReadGuard` returned from `read()`, which gives const access to the
+/// data. A single writer may hold the lock, through the `RwLockWriteGuard`
+/// returned from `write()`, which gives mutable access to the data.
+///
+/// Acquiring and releasing the lock without contention is a single atomic
+/// operation each. Threads that find the lock unavailable sleep in the kernel
+/// (through a futex on Linux) until it is released. Once a thread is waiting,
+/// new readers also wait rather than acquiring the lock, so that writers are
+/// not starved by a steady stream of readers.
+///
+/// Like `Mutex`, a RwLock is not reentrant: acquiring a write lock while
+/// holding a read lock from the same thread will deadlock, and so may
+/// acquiring a second read lock.
+template <class T>
+class RwLock final {
+  static_assert(!std::is_reference_v<T>,
+                "References in RwLock are not supported.");
+
+ public:
+  /// Constructs a RwLock holding `value`, in an unlocked state.
+  static RwLock with(T value) noexcept { return RwLock(::sus::move(value)); }
+
+  /// sus::construct::Default trait.
+  ///
+  /// Constructs a RwLock holding a default-constructed `T`.
+  RwLock() noexcept
+    requires(::sus::construct::Default<T>)
+      : data_() {}
+
+  RwLock(const RwLock&) = delete;
+  RwLock& operator=(const RwLock&) = delete;
+
+  /// Acquires a shared read lock, blocking the current thread until it is
+  /// able to do so.
+  RwLockReadGuard<T> read() const& noexcept {
+    raw_.read();
+    return RwLockReadGuard<T>(*this);
+  }
+  RwLockReadGuard<T> read() && = delete;
+
+  /// Attempts to acquire a shared read lock without blocking.
+  Option<RwLockReadGuard<T>> try_read() const& noexcept {
+    if (raw_.try_read())
+      return Option<RwLockReadGuard<T>>::some(RwLockReadGuard<T>(*this));
+    else
+      return Option<RwLockReadGuard<T>>::none();
+  }
+  Option<RwLockReadGuard<T>> try_read() && = delete;
+
+  /// Acquires an exclusive write lock, blocking the current thread until it is
+  /// able to do so.
+  RwLockWriteGuard<T> write() const& noexcept {
+    raw_.write();
+    return RwLockWriteGuard<T>(*this);
+  }
+  RwLockWriteGuard<T> write() && = delete;
+
+  /// Attempts to acquire an exclusive write lock without blocking.
+  Option<RwLockWriteGuard<T>> try_write() const& noexcept {
+    if (raw_.try_write())
+      return Option<RwLockWriteGuard<T>>::some(RwLockWriteGuard<T>(*this));
+    else
+      return Option<RwLockWriteGuard<T>>::none();
+  }
+  Option<RwLockWriteGuard<T>> try_write() && = delete;
+
+  /// Returns a mutable reference to the data, without locking.
+  ///
+  /// This is safe because a mutable reference to the RwLock guarantees that no
+  /// other threads are concurrently accessing it.
+  T& get_mut() & noexcept sus_lifetimebound { return data_; }
+
+  /// Consumes the RwLock and returns the data.
+  T into_inner() && noexcept { return ::sus::move(data_); }
+
+ private:
+  friend class RwLockReadGuard<T>;
+  friend class RwLockWriteGuard<T>;
+
+  explicit RwLock(T&& value) noexcept : data_(::sus::move(value)) {}
+
+  mutable __private::RawRwLock raw_;
+  mutable T data_;
+};
+
+}  // namespace sus::sync
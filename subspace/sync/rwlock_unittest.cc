@@ -0,0 +1,88 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/rwlock.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/containers/vec.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::sync::RwLock;
+
+TEST(RwLock, ManyReaders) {
+  auto l = RwLock<i32>::with(3);
+  auto r1 = l.read();
+  auto r2 = l.read();
+  EXPECT_EQ(*r1, 3);
+  EXPECT_EQ(*r2, 3);
+  EXPECT_EQ(l.try_read().is_some(), true);
+  EXPECT_EQ(l.try_write().is_none(), true);
+}
+
+TEST(RwLock, Writer) {
+  auto l = RwLock<Vec<i32>>();
+  {
+    auto w = l.write();
+    w->push(1);
+    EXPECT_EQ(l.try_read().is_none(), true);
+    EXPECT_EQ(l.try_write().is_none(), true);
+  }
+  EXPECT_EQ(l.read()->len(), 1u);
+  l.get_mut().push(2);
+  EXPECT_EQ(sus::move(l).into_inner(), sus::Vec<i32>::with_values(1, 2));
+}
+
+TEST(RwLock, WriterBlocksUntilReadersDone) {
+  auto l = RwLock<i32>::with(0);
+  auto r = sus::Option<sus::sync::RwLockReadGuard<i32>>::some(l.read());
+  auto t = std::thread([&l]() { *l.write() = 1; });
+  // The writer can't proceed while the read lock is held.
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(**r, 0);
+  r = sus::Option<sus::sync::RwLockReadGuard<i32>>::none();
+  t.join();
+  EXPECT_EQ(*l.read(), 1);
+}
+
+TEST(RwLock, Threads) {
+  struct Pair {
+    u64 a;
+    u64 b;
+  };
+  auto l = RwLock<Pair>::with(Pair(0u, 0u));
+  auto threads = Vec<std::thread>();
+  for (i32 t = 0; t < 2; t += 1) {
+    threads.push(std::thread([&l]() {
+      for (i32 i = 0; i < 5000; i += 1) {
+        auto w = l.write();
+        w->a += 1u;
+        w->b += 1u;
+      }
+    }));
+    threads.push(std::thread([&l]() {
+      for (i32 i = 0; i < 5000; i += 1) {
+        auto r = l.read();
+        EXPECT_EQ(r->a, r->b);
+      }
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+  EXPECT_EQ(l.read()->a, 10000u);
+}
+
+}  // namespace
@@ -0,0 +1,154 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <bit>
+#include <type_traits>
+
+#include "subspace/fn/fn_concepts.h"
+#include "subspace/mem/forward.h"
+#include "subspace/sync/__private/raw_mutex.h"
+
+namespace sus::sync {
+
+/// A sequence lock, which protects a small trivially-copyable value that is
+/// read often and written rarely.
+///
+/// Readers never block writers and never write to shared memory: a read copies
+/// the value optimistically and then checks a sequence counter to see if a
+/// writer changed it during the copy, retrying if so. This lets any number of
+/// readers proceed in parallel without bouncing a cache line between them, as
+/// a `RwLock` would. Writers are serialized by a lock, and bump the sequence
+/// counter before and after changing the value.
+///
+/// Since readers retry while a write is in progress, a SeqLock is not a good
+/// fit for values that are written frequently.
+///
+/// # Example
+/// ```
+/// struct Position { f64 x; f64 y; };
+/// static auto pos = sus::sync::SeqLock<Position>::with(Position(0.0, 0.0));
+/// pos.write(Position(1.0, 2.0));
+/// Position p = pos.read();
+/// ```
+template <class T>
+  requires(std::is_trivially_copyable_v<T>)
+class SeqLock final {
+ public:
+  /// Constructs a SeqLock holding `value`.
+  static SeqLock with(T value) noexcept { return SeqLock(value); }
+
+  SeqLock(const SeqLock&) = delete;
+  SeqLock& operator=(const SeqLock&) = delete;
+
+  /// Returns a copy of the value.
+  ///
+  /// If a write happens during the read, the read is retried, so this may spin
+  /// while a writer is active.
+  T read() const noexcept {
+    size_t words[kWords];
+    while (true) {
+      const uint32_t seq = seq_.load(std::memory_order_acquire);
+      // An odd sequence number means a write is in progress.
+      if ((seq & 1u) == 0u) {
+        for (size_t i = 0u; i < kWords; ++i)
+          words[i] = words_[i].load(std::memory_order_relaxed);
+        // Keeps the loads of the value from moving below the re-check.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) == seq) break;
+      }
+    }
+    return from_words(words);
+  }
+
+  /// Replaces the value.
+  void write(T value) noexcept {
+    size_t words[kWords];
+    to_words(value, words);
+    writer_.lock();
+    begin_write();
+    for (size_t i = 0u; i < kWords; ++i)
+      words_[i].store(words[i], std::memory_order_relaxed);
+    end_write();
+    writer_.unlock();
+  }
+
+  /// Modifies the value in place with `f`, while holding the write lock.
+  void update(::sus::fn::FnOnce<void(T&)> auto&& f) noexcept {
+    size_t words[kWords];
+    writer_.lock();
+    // The lock excludes other writers, so the value can't change under us.
+    for (size_t i = 0u; i < kWords; ++i)
+      words[i] = words_[i].load(std::memory_order_relaxed);
+    T value = from_words(words);
+    ::sus::forward<decltype(f)>(f)(value);
+    to_words(value, words);
+    begin_write();
+    for (size_t i = 0u; i < kWords; ++i)
+      words_[i].store(words[i], std::memory_order_relaxed);
+    end_write();
+    writer_.unlock();
+  }
+
+  /// Consumes the SeqLock and returns the value.
+  T into_inner() && noexcept { return read(); }
+
+ private:
+  // The value is stored as relaxed atomic words so that a read which races
+  // with a write is well-defined (it gets discarded by the sequence check).
+  static constexpr size_t kWords =
+      (sizeof(T) + sizeof(size_t) - 1u) / sizeof(size_t);
+
+  explicit SeqLock(T value) noexcept {
+    size_t words[kWords];
+    to_words(value, words);
+    for (size_t i = 0u; i < kWords; ++i)
+      words_[i].store(words[i], std::memory_order_relaxed);
+  }
+
+  void begin_write() noexcept {
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1u,
+               std::memory_order_relaxed);
+    // Keeps the stores of the value from moving above the odd sequence number.
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+  void end_write() noexcept {
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1u,
+               std::memory_order_release);
+  }
+
+  static void to_words(const T& value, size_t (&words)[kWords]) noexcept {
+    words[kWords - 1u] = 0u;
+    memcpy(words, &value, sizeof(T));
+  }
+  static T from_words(const size_t (&words)[kWords]) noexcept {
+    struct Bytes {
+      unsigned char bytes[sizeof(T)];
+    } bytes;
+    memcpy(bytes.bytes, words, sizeof(T));
+    return std::bit_cast<T>(bytes);
+  }
+
+  std::atomic<uint32_t> seq_ = 0u;
+  __private::RawMutex writer_;
+  std::atomic<size_t> words_[kWords];
+};
+
+}  // namespace sus::sync
@@ -0,0 +1,58 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/sync/seqlock.h"
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::sync::SeqLock;
+
+struct Triple {
+  u64 a;
+  u64 b;
+  u8 c;
+};
+
+TEST(SeqLock, ReadWrite) {
+  auto l = SeqLock<Triple>::with(Triple(1u, 2u, 3u));
+  Triple t = l.read();
+  EXPECT_EQ(t.a, 1u);
+  EXPECT_EQ(t.b, 2u);
+  EXPECT_EQ(t.c, 3u);
+  l.write(Triple(4u, 5u, 6u));
+  EXPECT_EQ(l.read().b, 5u);
+  l.update([](Triple& t) { t.c += 1u; });
+  EXPECT_EQ(l.read().c, 7u);
+  EXPECT_EQ(sus::move(l).into_inner().a, 4u);
+}
+
+TEST(SeqLock, NoTornReads) {
+  auto l = SeqLock<Triple>::with(Triple(0u, 0u, 0u));
+  auto writer = std::thread([&l]() {
+    for (u64 i = 1u; i <= 10000u; i += 1u) l.write(Triple(i, i, 0u));
+  });
+  for (i32 i = 0; i < 10000; i += 1) {
+    Triple t = l.read();
+    EXPECT_EQ(t.a, t.b);
+  }
+  writer.join();
+  EXPECT_EQ(l.read().a, 10000u);
+}
+
+}  // namespace
@@ -102,6 +102,93 @@ struct TupleStorage<T&, Ts...> : TupleStorage<Ts...> {
   T* value;
 };
 
+/// The `I`th type in the pack `Ts...`.
+template <size_t I, class T, class... Ts>
+struct NthType {
+  using type = typename NthType<I - 1u, Ts...>::type;
+};
+template <class T, class... Ts>
+struct NthType<0u, T, Ts...> {
+  using type = T;
+};
+
+/// Forwards the `I`th value in the pack `values...`.
+template <size_t I, class U, class... Us>
+constexpr inline decltype(auto) nth_value(U&& value, Us&&... more) noexcept {
+  if constexpr (I == 0u)
+    return ::sus::forward<U>(value);
+  else
+    return nth_value<I - 1u>(::sus::forward<Us>(more)...);
+}
+
+/// The alignment of `T` as it is held in TupleStorage, where references are
+/// held as pointers.
+template <class T>
+consteval size_t storage_align_of() noexcept {
+  if constexpr (std::is_reference_v<T>)
+    return alignof(std::remove_reference_t<T>*);
+  else
+    return alignof(T);
+}
+
+/// A mapping between the position of each element in a PackedTuple and its
+/// position in the PackedTuple's TupleStorage.
+template <size_t N>
+struct StorageOrder {
+  size_t storage_to_element[N];
+  size_t element_to_storage[N];
+};
+
+/// Orders the elements of a PackedTuple by increasing alignment.
+///
+/// TupleStorage places its last type first in memory, so this stores the
+/// elements from most to least aligned, which leaves no padding between them.
+/// The sort is stable, so a PackedTuple whose types are already ordered from
+/// smallest to largest alignment has the same storage order as a Tuple.
+template <class... Ts>
+consteval StorageOrder<sizeof...(Ts)> make_storage_order() noexcept {
+  constexpr size_t N = sizeof...(Ts);
+  constexpr size_t aligns[] = {storage_align_of<Ts>()...};
+  StorageOrder<N> order = {};
+  for (size_t i = 0u; i < N; ++i) order.storage_to_element[i] = i;
+  // Insertion sort, as N is small and the sort must be stable.
+  for (size_t i = 1u; i < N; ++i) {
+    for (size_t j = i; j > 0u && aligns[order.storage_to_element[j - 1u]] >
+                                     aligns[order.storage_to_element[j]];
+         --j) {
+      size_t tmp = order.storage_to_element[j];
+      order.storage_to_element[j] = order.storage_to_element[j - 1u];
+      order.storage_to_element[j - 1u] = tmp;
+    }
+  }
+  for (size_t i = 0u; i < N; ++i)
+    order.element_to_storage[order.storage_to_element[i]] = i;
+  return order;
+}
+
+template <class... Ts>
+inline constexpr StorageOrder<sizeof...(Ts)> kStorageOrder =
+    make_storage_order<Ts...>();
+
+template <class Seq, class... Ts>
+struct SortedTupleStorageHelper;
+
+template <size_t... Ks, class... Ts>
+struct SortedTupleStorageHelper<std::index_sequence<Ks...>, Ts...> {
+  using type = TupleStorage<typename NthType<
+      kStorageOrder<Ts...>.storage_to_element[Ks], Ts...>::type...>;
+};
+
+/// The TupleStorage for a PackedTuple of `Ts...`, holding the types in the
+/// order given by `kStorageOrder<Ts...>`.
+template <class... Ts>
+using SortedTupleStorage = typename SortedTupleStorageHelper<
+    std::make_index_sequence<sizeof...(Ts)>, Ts...>::type;
+
+/// Tag type for constructing a PackedTuple's storage from values in element
+/// order.
+enum WithStorageOrder { kWithStorageOrder };
+
 template <size_t I, class S>
 static constexpr const auto& find_tuple_storage(const S& storage) {
   return find_tuple_storage(storage, std::integral_constant<size_t, I>());
@@ -138,32 +225,35 @@ static constexpr S& find_tuple_storage_mut(S& storage,
   return storage;
 }
 
-template <size_t I, class S1, class S2>
-constexpr inline auto storage_eq_impl(const S1& l, const S2& r) noexcept {
-  return find_tuple_storage<I>(l).at() == find_tuple_storage<I>(r).at();
+// The PackedTuples being compared may hold their elements in different
+// storage orders, so elements are found through `at()` rather than their
+// storage.
+template <size_t I, class T1, class T2>
+constexpr inline auto tuple_eq_impl(const T1& l, const T2& r) noexcept {
+  return l.template at<I>() == r.template at<I>();
 };
 
-template <class S1, class S2, size_t... N>
-constexpr inline auto storage_eq(const S1& l, const S2& r,
-                                 std::index_sequence<N...>) noexcept {
-  return (... && (storage_eq_impl<N>(l, r)));
+template <class T1, class T2, size_t... N>
+constexpr inline auto tuple_eq(const T1& l, const T2& r,
+                               std::index_sequence<N...>) noexcept {
+  return (... && (tuple_eq_impl<N>(l, r)));
 };
 
-template <size_t I, class O, class S1, class S2>
-constexpr inline bool storage_cmp_impl(O& val, const S1& l,
-                                       const S2& r) noexcept {
-  auto cmp = find_tuple_storage<I>(l).at() <=> find_tuple_storage<I>(r).at();
+template <size_t I, class O, class T1, class T2>
+constexpr inline bool tuple_cmp_impl(O& val, const T1& l,
+                                     const T2& r) noexcept {
+  auto cmp = l.template at<I>() <=> r.template at<I>();
   // Allow downgrading from equal to equivalent, but not the inverse.
   if (cmp != 0) val = cmp;
   // Short circuit by returning true when we find a difference.
   return val == 0;
 };
 
-template <class S1, class S2, size_t... N>
-constexpr inline auto storage_cmp(auto equal, const S1& l, const S2& r,
-                                  std::index_sequence<N...>) noexcept {
+template <class T1, class T2, size_t... N>
+constexpr inline auto tuple_cmp(auto equal, const T1& l, const T2& r,
+                                std::index_sequence<N...>) noexcept {
   auto val = equal;
-  (... && (storage_cmp_impl<N>(val, l, r)));
+  (... && (tuple_cmp_impl<N>(val, l, r)));
   return val;
 };
 
@@ -0,0 +1,221 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <utility>
+
+#include "subspace/construct/default.h"
+#include "subspace/macros/no_unique_address.h"
+#include "subspace/mem/clone.h"
+#include "subspace/mem/copy.h"
+#include "subspace/mem/forward.h"
+#include "subspace/mem/move.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/ops/eq.h"
+#include "subspace/ops/ord.h"
+#include "subspace/tuple/__private/storage.h"
+
+namespace sus::tuple_type {
+
+/// A finite sequence of one or more heterogeneous values, like `Tuple`, which
+/// reorders its elements in memory to remove the padding between them.
+///
+/// The elements are stored ordered from most to least aligned, so
+/// `PackedTuple<u8, u64, u8>` is 16 bytes where `Tuple<u8, u64, u8>` is 24.
+/// The storage order is computed at compile time and does not change the index
+/// used to access each element with `at<I>()` or in a structured binding.
+/// Elements with the same alignment are stored in reverse of the order they are
+/// specified, as in `Tuple`.
+///
+/// # Construction and destruction order
+/// Elements are constructed in the order they are stored: from most to least
+/// aligned, and from last to first among elements with the same alignment.
+/// They are destroyed in the reverse order. So `PackedTuple<u8, u64, u32, u64>`
+/// constructs its elements at indices 3, 1, 2, 0 in that order, and destroys
+/// them in the order 0, 2, 1, 3. Use `Tuple` where the elements must be
+/// constructed and destroyed in the order they are specified.
+template <class T, class... Ts>
+class PackedTuple final {
+ public:
+  /// Construct a PackedTuple with the default value for the types it contains.
+  ///
+  /// The PackedTuple's contained types must all be #Default, and will be
+  /// constructed through that trait.
+  inline constexpr PackedTuple() noexcept
+    requires(::sus::construct::Default<T> && ... &&
+             ::sus::construct::Default<Ts>)
+      : PackedTuple(T(), Ts()...) {}
+
+  /// Construct a PackedTuple with the given values.
+  template <std::convertible_to<T> U, std::convertible_to<Ts>... Us>
+    requires(sizeof...(Us) == sizeof...(Ts))
+  constexpr inline static PackedTuple with(U&& first, Us&&... more) noexcept {
+    return PackedTuple(::sus::forward<U>(first), ::sus::forward<Us>(more)...);
+  }
+
+  /// sus::mem::Clone trait.
+  constexpr PackedTuple clone() const& noexcept
+    requires((::sus::mem::CloneOrRef<T> && ... && ::sus::mem::CloneOrRef<Ts>) &&
+             !(::sus::mem::CopyOrRef<T> && ... && ::sus::mem::CopyOrRef<Ts>))
+  {
+    auto f = [this]<size_t... Is>(std::index_sequence<Is...>) {
+      return PackedTuple::with(::sus::mem::clone_or_forward<T>(
+          this->template at<Is>())...);
+    };
+    return f(std::make_index_sequence<1u + sizeof...(Ts)>());
+  }
+
+  /// Gets a const reference to the `I`th element in the tuple.
+  template <size_t I>
+    requires(I <= sizeof...(Ts))
+  constexpr inline const auto& at() const& noexcept {
+    return __private::find_tuple_storage<storage_index<I>()>(storage_).at();
+  }
+  // Disallows getting a reference to temporary PackedTuple.
+  template <size_t I>
+  constexpr inline const auto& at() && = delete;
+
+  /// Gets a mutable reference to the `I`th element in the tuple.
+  template <size_t I>
+    requires(I <= sizeof...(Ts))
+  constexpr inline auto& at_mut() & noexcept {
+    return __private::find_tuple_storage_mut<storage_index<I>()>(storage_)
+        .at_mut();
+  }
+
+  /// Removes the `I`th element from the tuple, leaving the PackedTuple in a
+  /// moved-from state where it should no longer be used.
+  template <size_t I>
+    requires(I <= sizeof...(Ts))
+  constexpr inline decltype(auto) into_inner() && noexcept {
+    return ::sus::move(
+               __private::find_tuple_storage_mut<storage_index<I>()>(storage_))
+        .into_inner();
+  }
+
+  /// sus::ops::Eq<PackedTuple<U...>> trait.
+  template <class U, class... Us>
+    requires(sizeof...(Us) == sizeof...(Ts) &&
+             (::sus::ops::Eq<T, U> && ... && ::sus::ops::Eq<Ts, Us>))
+  constexpr bool operator==(const PackedTuple<U, Us...>& r) const& noexcept {
+    return __private::tuple_eq(*this, r,
+                               std::make_index_sequence<1u + sizeof...(Ts)>());
+  }
+
+  /// Compares two PackedTuples, element by element in index order.
+  //
+  // sus::ops::Ord<PackedTuple<U...>> trait.
+  template <class U, class... Us>
+    requires(sizeof...(Us) == sizeof...(Ts) &&
+             (::sus::ops::ExclusiveOrd<T, U> && ... &&
+              ::sus::ops::ExclusiveOrd<Ts, Us>))
+  constexpr auto operator<=>(const PackedTuple<U, Us...>& r) const& noexcept {
+    return __private::tuple_cmp(std::strong_ordering::equal, *this, r,
+                                std::make_index_sequence<1u + sizeof...(Ts)>());
+  }
+
+  // sus::ops::WeakOrd<PackedTuple<U...>> trait.
+  template <class U, class... Us>
+    requires(sizeof...(Us) == sizeof...(Ts) &&
+             (::sus::ops::ExclusiveWeakOrd<T, U> && ... &&
+              ::sus::ops::ExclusiveWeakOrd<Ts, Us>))
+  constexpr auto operator<=>(const PackedTuple<U, Us...>& r) const& noexcept {
+    return __private::tuple_cmp(std::weak_ordering::equivalent, *this, r,
+                                std::make_index_sequence<1u + sizeof...(Ts)>());
+  }
+
+  // sus::ops::PartialOrd<PackedTuple<U...>> trait.
+  template <class U, class... Us>
+    requires(sizeof...(Us) == sizeof...(Ts) &&
+             (::sus::ops::ExclusivePartialOrd<T, U> && ... &&
+              ::sus::ops::ExclusivePartialOrd<Ts, Us>))
+  constexpr auto operator<=>(const PackedTuple<U, Us...>& r) const& noexcept {
+    return __private::tuple_cmp(std::partial_ordering::equivalent, *this, r,
+                                std::make_index_sequence<1u + sizeof...(Ts)>());
+  }
+
+ private:
+  /// Storage for the tuple elements, which are reordered to minimize padding.
+  using Storage = __private::SortedTupleStorage<T, Ts...>;
+
+  /// The position in `Storage` of the `I`th element in the tuple.
+  template <size_t I>
+  static consteval size_t storage_index() noexcept {
+    return __private::kStorageOrder<T, Ts...>.element_to_storage[I];
+  }
+
+  template <std::convertible_to<T> U, std::convertible_to<Ts>... Us>
+  constexpr inline PackedTuple(U&& first, Us&&... more) noexcept
+      : PackedTuple(__private::kWithStorageOrder,
+                    std::make_index_sequence<1u + sizeof...(Ts)>(),
+                    ::sus::forward<U>(first), ::sus::forward<Us>(more)...) {}
+
+  template <size_t... Ks, class... Us>
+  constexpr inline PackedTuple(__private::WithStorageOrder,
+                               std::index_sequence<Ks...>,
+                               Us&&... values) noexcept
+      : storage_(__private::nth_value<
+                 __private::kStorageOrder<T, Ts...>.storage_to_element[Ks]>(
+            ::sus::forward<Us>(values)...)...) {}
+
+  [[sus_no_unique_address]] Storage storage_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn, T, Ts...);
+};
+
+// Support for structured binding.
+template <size_t I, class... Ts>
+constexpr decltype(auto) get(const PackedTuple<Ts...>& t) noexcept {
+  return t.template at<I>();
+}
+template <size_t I, class... Ts>
+constexpr decltype(auto) get(PackedTuple<Ts...>& t) noexcept {
+  return t.template at_mut<I>();
+}
+template <size_t I, class... Ts>
+constexpr decltype(auto) get(PackedTuple<Ts...>&& t) noexcept {
+  // As for Tuple, `t` is not moved-from here, since this is called for each
+  // member of `t` when making structured bindings from an rvalue.
+  return static_cast<decltype(::sus::move(t).template into_inner<I>())>(
+      t.template at_mut<I>());
+}
+
+}  // namespace sus::tuple_type
+
+namespace std {
+template <class... Types>
+struct tuple_size<::sus::tuple_type::PackedTuple<Types...>> {
+  static constexpr size_t value = sizeof...(Types);
+};
+
+template <size_t I, class T, class... Types>
+struct tuple_element<I, ::sus::tuple_type::PackedTuple<T, Types...>> {
+  using type =
+      tuple_element<I - 1, ::sus::tuple_type::PackedTuple<Types...>>::type;
+};
+
+template <class T, class... Types>
+struct tuple_element<0, ::sus::tuple_type::PackedTuple<T, Types...>> {
+  using type = T;
+};
+
+}  // namespace std
+
+// Promote PackedTuple into the `sus` namespace.
+namespace sus {
+using ::sus::tuple_type::PackedTuple;
+}  // namespace sus
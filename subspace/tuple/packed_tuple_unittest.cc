@@ -0,0 +1,91 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "subspace/tuple/packed_tuple.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "subspace/mem/relocate.h"
+#include "subspace/prelude.h"
+
+namespace {
+
+using sus::PackedTuple;
+
+static_assert(sus::mem::relocate_by_memcpy<PackedTuple<u8, u64, u8>>);
+
+TEST(PackedTuple, Layout) {
+  // Elements are stored from most to least aligned, whatever order they are
+  // specified in.
+  static_assert(sizeof(PackedTuple<u8, u64, u8>) == 16u);
+  static_assert(sizeof(PackedTuple<u64, u8, u8>) == 16u);
+  static_assert(sizeof(PackedTuple<u8, u8, u64>) == 16u);
+  static_assert(sizeof(PackedTuple<u8, u64, u16, u32>) == 16u);
+  static_assert(sizeof(PackedTuple<u8, i32&, u8>) == 16u);
+
+  // Indices are unchanged by the storage order.
+  auto t = PackedTuple<u8, u64, u16, u32>::with(1_u8, 2_u64, 3_u16, 4_u32);
+  EXPECT_EQ(t.at<0>(), 1_u8);
+  EXPECT_EQ(t.at<1>(), 2_u64);
+  EXPECT_EQ(t.at<2>(), 3_u16);
+  EXPECT_EQ(t.at<3>(), 4_u32);
+  t.at_mut<2>() = 5_u16;
+  EXPECT_EQ(t.at<2>(), 5_u16);
+  auto [a, b, c, d] = t;
+  EXPECT_EQ(a, 1_u8);
+  EXPECT_EQ(b, 2_u64);
+  EXPECT_EQ(c, 5_u16);
+  EXPECT_EQ(d, 4_u32);
+  EXPECT_EQ(sus::move(t).into_inner<3>(), 4_u32);
+}
+
+TEST(PackedTuple, Default) {
+  auto t = PackedTuple<u8, u64>();
+  EXPECT_EQ(t.at<0>(), 0_u8);
+  EXPECT_EQ(t.at<1>(), 0_u64);
+}
+
+TEST(PackedTuple, Eq) {
+  // PackedTuples with different storage orders can be compared.
+  auto l = PackedTuple<u8, u64>::with(1_u8, 2_u64);
+  auto r = PackedTuple<u64, u64>::with(1_u64, 2_u64);
+  EXPECT_EQ(l, r);
+  EXPECT_LT(l, (PackedTuple<u64, u64>::with(1_u64, 3_u64)));
+  EXPECT_GT(l, (PackedTuple<u64, u64>::with(0_u64, 3_u64)));
+}
+
+usize constructed_order = 0u;
+usize destroyed_order = 0u;
+
+template <size_t Align>
+struct alignas(Align) Ordered {
+  Ordered(uint8_t i) : i(i) { constructed_order = constructed_order * 10u + i; }
+  ~Ordered() { destroyed_order = destroyed_order * 10u + i; }
+  uint8_t i;
+};
+
+TEST(PackedTuple, ConstructDestroyOrder) {
+  constructed_order = destroyed_order = 0u;
+  {
+    auto t = PackedTuple<Ordered<1>, Ordered<8>, Ordered<4>,
+                         Ordered<8>>::with(1, 2, 3, 4);
+    EXPECT_EQ(t.at<0>().i, 1u);
+    EXPECT_EQ(t.at<3>().i, 4u);
+  }
+  // Elements are constructed from most to least aligned, and from last to
+  // first among those with the same alignment. They are destroyed in reverse.
+  EXPECT_EQ(constructed_order, 4231u);
+  EXPECT_EQ(destroyed_order, 1324u);
+}
+
+}  // namespace
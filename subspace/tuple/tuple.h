@@ -67,7 +67,11 @@ namespace sus::tuple_type {
 /// themselves), or in least-to-most tail-padding for more complex types.
 /// Elements in a Tuple are stored internally in reverse of the order they are
 /// specified, which is why the size of the *first* element matters for the
-/// Tuple's externally usable tail padding.
+/// Tuple's externally usable tail padding. Use `PackedTuple` to have the
+/// elements reordered to remove the padding between them instead.
+///
+/// Elements are constructed from last to first, and destroyed from first to
+/// last.
 template <class T, class... Ts>
 class Tuple final {
  public:
@@ -106,7 +110,7 @@ class Tuple final {
   {
     auto f = [this]<size_t... Is>(std::index_sequence<Is...>) {
       return Tuple::with(::sus::mem::clone_or_forward<T>(
-          __private::find_tuple_storage<Is>(storage_).at())...);
+          this->template at<Is>())...);
     };
     return f(std::make_index_sequence<1u + sizeof...(Ts)>());
   }
@@ -142,8 +146,8 @@ class Tuple final {
     requires(sizeof...(Us) == sizeof...(Ts) &&
              (::sus::ops::Eq<T, U> && ... && ::sus::ops::Eq<Ts, Us>))
   constexpr bool operator==(const Tuple<U, Us...>& r) const& noexcept {
-    return __private::storage_eq(
-        storage_, r.storage_, std::make_index_sequence<1u + sizeof...(Ts)>());
+    return __private::tuple_eq(*this, r,
+                               std::make_index_sequence<1u + sizeof...(Ts)>());
   }
 
   /// Compares two Tuples.
@@ -158,9 +162,8 @@ class Tuple final {
              (::sus::ops::ExclusiveOrd<T, U> && ... &&
               ::sus::ops::ExclusiveOrd<Ts, Us>))
   constexpr auto operator<=>(const Tuple<U, Us...>& r) const& noexcept {
-    return __private::storage_cmp(
-        std::strong_ordering::equal, storage_, r.storage_,
-        std::make_index_sequence<1u + sizeof...(Ts)>());
+    return __private::tuple_cmp(std::strong_ordering::equal, *this, r,
+                                std::make_index_sequence<1u + sizeof...(Ts)>());
   }
 
   // sus::ops::WeakOrd<Tuple<U...>> trait.
@@ -169,9 +172,8 @@ class Tuple final {
              (::sus::ops::ExclusiveWeakOrd<T, U> && ... &&
               ::sus::ops::ExclusiveWeakOrd<Ts, Us>))
   constexpr auto operator<=>(const Tuple<U, Us...>& r) const& noexcept {
-    return __private::storage_cmp(
-        std::weak_ordering::equivalent, storage_, r.storage_,
-        std::make_index_sequence<1u + sizeof...(Ts)>());
+    return __private::tuple_cmp(std::weak_ordering::equivalent, *this, r,
+                                std::make_index_sequence<1u + sizeof...(Ts)>());
   }
 
   // sus::ops::PartialOrd<Tuple<U...>> trait.
@@ -180,9 +182,8 @@ class Tuple final {
              (::sus::ops::ExclusivePartialOrd<T, U> && ... &&
               ::sus::ops::ExclusivePartialOrd<Ts, Us>))
   constexpr auto operator<=>(const Tuple<U, Us...>& r) const& noexcept {
-    return __private::storage_cmp(
-        std::partial_ordering::equivalent, storage_, r.storage_,
-        std::make_index_sequence<1u + sizeof...(Ts)>());
+    return __private::tuple_cmp(std::partial_ordering::equivalent, *this, r,
+                                std::make_index_sequence<1u + sizeof...(Ts)>());
   }
 
  private:
@@ -119,6 +119,13 @@ TEST(Tuple, TailPadding) {
   static_assert(sizeof(ExampleFromDocs) == (16 + sus_if_msvc_else(8, 0)));
 }
 
+TEST(Tuple, Layout) {
+  // Elements are stored in the order they are specified, so padding between
+  // them is kept. Use PackedTuple to remove it.
+  static_assert(sizeof(Tuple<u8, u64, u8>) == 24u);
+  static_assert(sizeof(Tuple<u8, u8, u64>) == 16u);
+}
+
 TEST(Tuple, With) {
   auto t1 = Tuple<i32>::with(2);
   auto t2 = Tuple<i32, f32>::with(2, 3.f);
@@ -531,4 +538,28 @@ TEST(Tuple, Destroy) {
   EXPECT_EQ(destroy.primitive_value, (((0u + 1u) * 1u + 2u) * 2u + 3u) * 3u);
 }
 
+usize constructed_order = 0u;
+usize destroyed_order = 0u;
+
+template <size_t Align>
+struct alignas(Align) Ordered {
+  Ordered(uint8_t i) : i(i) { constructed_order = constructed_order * 10u + i; }
+  ~Ordered() { destroyed_order = destroyed_order * 10u + i; }
+  uint8_t i;
+};
+
+TEST(Tuple, ConstructDestroyOrder) {
+  constructed_order = destroyed_order = 0u;
+  {
+    auto t = Tuple<Ordered<1>, Ordered<8>, Ordered<4>, Ordered<8>>::with(1, 2,
+                                                                        3, 4);
+    EXPECT_EQ(t.at<0>().i, 1u);
+    EXPECT_EQ(t.at<3>().i, 4u);
+  }
+  // Elements are constructed from last to first, whatever their alignment,
+  // and destroyed from first to last.
+  EXPECT_EQ(constructed_order, 4321u);
+  EXPECT_EQ(destroyed_order, 1234u);
+}
+
 }  // namespace